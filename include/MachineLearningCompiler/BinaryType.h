@@ -0,0 +1,18 @@
+#ifndef MLC_BINARY_H
+#define MLC_BINARY_H
+#include <cstdint>
+
+namespace mlc
+{
+  enum class BinaryType : int64_t
+  {
+    None = 0,
+    Add = 1,      // input0 + input1
+    Sub = 2,      // input0 - input1
+    Mul = 3,      // input0 * input1
+    Maximum = 4,  // max(input0, input1), NaN propagates
+    Minimum = 5,  // min(input0, input1), NaN propagates
+  };
+}  // namespace mlc
+
+#endif  // MLC_BINARY_H
@@ -0,0 +1,15 @@
+#ifndef MLC_DATATYPE_H
+#define MLC_DATATYPE_H
+#include <cstdint>
+
+namespace mlc
+{
+  enum class DataType : int64_t
+  {
+    FP32 = 0,
+    FP64 = 1,
+    FP16 = 2,
+  };
+}  // namespace mlc
+
+#endif  // MLC_DATATYPE_H
\ No newline at end of file
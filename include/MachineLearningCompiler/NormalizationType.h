@@ -0,0 +1,16 @@
+#ifndef MLC_NORMALIZATION_H
+#define MLC_NORMALIZATION_H
+#include <cstdint>
+
+namespace mlc
+{
+  enum class NormalizationType : int64_t
+  {
+    None = 0,
+    Softmax = 1,    // exp(x - max(x)) / sum(exp(x - max(x)))
+    LayerNorm = 2,  // (x - mean(x)) / sqrt(var(x) + epsilon)
+    RmsNorm = 3,    // x / sqrt(mean(x^2) + epsilon)
+  };
+}  // namespace mlc
+
+#endif  // MLC_NORMALIZATION_H
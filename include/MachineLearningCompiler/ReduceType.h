@@ -0,0 +1,16 @@
+#ifndef MLC_REDUCE_H
+#define MLC_REDUCE_H
+#include <cstdint>
+
+namespace mlc
+{
+  enum class ReduceType : int64_t
+  {
+    None = 0,
+    Sum = 1,   // sum of the reduced elements
+    Max = 2,   // maximum of the reduced elements, NaN propagates
+    Mean = 3,  // sum of the reduced elements divided by their count
+  };
+}  // namespace mlc
+
+#endif  // MLC_REDUCE_H
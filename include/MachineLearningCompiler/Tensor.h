@@ -1,6 +1,10 @@
 #ifndef MLC_TENSOR_H
 #define MLC_TENSOR_H
+#include "BinaryType.h"
+#include "DataType.h"
 #include "Error.h"
+#include "NormalizationType.h"
+#include "ReduceType.h"
 #include "UnaryType.h"
 #include <cstdint>
 #include <functional>
@@ -12,7 +16,10 @@ namespace mlc
   struct Tensor
   {
     bool ownsData = false;
+    DataType dtype = DataType::FP32;
     float *data = nullptr;
+    double *data_fp64 = nullptr;
+    uint16_t *data_fp16 = nullptr;
     std::vector<uint64_t> dim_sizes;
     std::vector<uint64_t> strides;
 
@@ -38,19 +45,69 @@ namespace mlc
       }
     };
 
+    /**
+     * @brief Construct a new fp64 Tensor with with a pointer to memory and the dimension sizes sorted in by stride in descending order.
+     *
+     * @param data The pointer to the data array.
+     * @param dim_sizes The dimension sizes sorted by stride in descending order.
+     */
+    Tensor(double *data, const std::vector<uint64_t> &dim_sizes) : dtype(DataType::FP64), data_fp64(data), dim_sizes(dim_sizes)
+    {
+      strides.resize(dim_sizes.size());
+      if (!dim_sizes.empty())
+      {
+        strides[dim_sizes.size() - 1] = 1;
+        for (size_t i = dim_sizes.size() - 1; i > 0; --i)
+        {
+          strides[i - 1] = strides[i] * dim_sizes[i];
+        }
+      }
+    };
+
+    /**
+     * @brief Construct a new fp16 Tensor with with a pointer to memory and the dimension sizes sorted in by stride in descending order.
+     *
+     * @param data The pointer to the data array, i.e. the bits of the half-precision elements.
+     * @param dim_sizes The dimension sizes sorted by stride in descending order.
+     */
+    Tensor(uint16_t *data, const std::vector<uint64_t> &dim_sizes) : dtype(DataType::FP16), data_fp16(data), dim_sizes(dim_sizes)
+    {
+      strides.resize(dim_sizes.size());
+      if (!dim_sizes.empty())
+      {
+        strides[dim_sizes.size() - 1] = 1;
+        for (size_t i = dim_sizes.size() - 1; i > 0; --i)
+        {
+          strides[i - 1] = strides[i] * dim_sizes[i];
+        }
+      }
+    };
+
     /**
      * @brief Construct a new Tensor with the dimension sizes sorted by stride in descending order.
      *
      * @param dim_sizes The dimension sizes sorted by stride in descending order.
+     * @param dtype The data type of the allocated elements.
      */
-    Tensor(const std::vector<uint64_t> &dim_sizes) : dim_sizes(dim_sizes)
+    Tensor(const std::vector<uint64_t> &dim_sizes, DataType dtype = DataType::FP32) : dtype(dtype), dim_sizes(dim_sizes)
     {
       uint64_t size = 1;
       for (auto dim : dim_sizes)
       {
         size *= dim;
       }
-      data = new float[size]{0};
+      if (dtype == DataType::FP64)
+      {
+        data_fp64 = new double[size]{0};
+      }
+      else if (dtype == DataType::FP16)
+      {
+        data_fp16 = new uint16_t[size]{0};
+      }
+      else
+      {
+        data = new float[size]{0};
+      }
       ownsData = true;
 
       strides.resize(dim_sizes.size());
@@ -74,6 +131,16 @@ namespace mlc
         delete[] data;
         data = nullptr;
       }
+      if (ownsData && data_fp64 != nullptr)
+      {
+        delete[] data_fp64;
+        data_fp64 = nullptr;
+      }
+      if (ownsData && data_fp16 != nullptr)
+      {
+        delete[] data_fp16;
+        data_fp16 = nullptr;
+      }
     }
 
     /**
@@ -193,9 +260,10 @@ namespace mlc
    * @param inputs The input tensors shapes.
    * @param output The output tensor shape.
    * @param tree The einsum tree to contract in the format [in0],[in1]->[out].
+   * @param dtype The data type of all tensors the operation is executed on.
    */
   TensorOperation *einsum_operation(const std::vector<std::vector<uint64_t>> &inputs, const std::vector<uint64_t> &output,
-                                    const std::string &tree);
+                                    const std::string &tree, DataType dtype = DataType::FP32);
 
   /**
    * @brief Perform a binary contraction and adds it to the output.
@@ -258,6 +326,175 @@ namespace mlc
    * @return Error The error code or ErrorType::None on success.
    */
   Error unary_identity(const Tensor &input, Tensor &output);
+
+  /**
+   * @brief Performs a unary that applies the unary type elementwise from the input tensor to the output tensor, e.g. a GELU.
+   * The activations from Exp on support only fp32 tensors.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param type The unary type to apply, None is not allowed.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error unary(const Tensor &input, Tensor &output, const UnaryType type);
+
+  /**
+   * @brief Performs a binary that combines the input tensors elementwise into the output tensor, e.g. adds a bias.
+   * The inputs are broadcast to the output like in numpy, i.e. the dimensions are aligned from the last one and an input dimension of
+   * size one or a missing leading dimension is repeated along the output dimension. The binary supports fp32 and fp64 tensors.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor with the broadcast dimension sizes of the inputs.
+   * @param type The binary type to apply, None is not allowed.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error binary(const Tensor &input0, const Tensor &input1, Tensor &output, const BinaryType type);
+
+  /**
+   * @brief Performs a binary that combines the input tensors elementwise into the output tensor, after the binary a last touch unary
+   * is applied to the output tensor, e.g. a residual add followed by a relu.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor with the broadcast dimension sizes of the inputs.
+   * @param type The binary type to apply, None is not allowed.
+   * @param lastTouch The unary that should be executed after the binary.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error binary(const Tensor &input0, const Tensor &input1, Tensor &output, const BinaryType type, const UnaryType lastTouch);
+
+  /**
+   * @brief Adds the input tensors elementwise with broadcasting, see binary.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error add(const Tensor &input0, const Tensor &input1, Tensor &output);
+
+  /**
+   * @brief Subtracts input1 from input0 elementwise with broadcasting, see binary.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error sub(const Tensor &input0, const Tensor &input1, Tensor &output);
+
+  /**
+   * @brief Multiplies the input tensors elementwise with broadcasting, see binary.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error mul(const Tensor &input0, const Tensor &input1, Tensor &output);
+
+  /**
+   * @brief Computes the elementwise maximum of the input tensors with broadcasting, see binary.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error maximum(const Tensor &input0, const Tensor &input1, Tensor &output);
+
+  /**
+   * @brief Computes the elementwise minimum of the input tensors with broadcasting, see binary.
+   *
+   * @param input0 The first input tensor.
+   * @param input1 The second input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error minimum(const Tensor &input0, const Tensor &input1, Tensor &output);
+
+  /**
+   * @brief Performs a reduce of the given dimensions of the input tensor into the output tensor, the remaining dimensions are executed
+   * in parallel. The output holds the remaining dimensions in the order of the input, the reduced dimensions are either removed or kept
+   * with size one. The reduce supports fp32 and fp64 tensors.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param dims The indices of the input dimensions to reduce, each dimension at most once.
+   * @param type The reduce type to apply, None is not allowed.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error reduce(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims, const ReduceType type);
+
+  /**
+   * @brief Sums the given dimensions of the input tensor, see reduce.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param dims The indices of the input dimensions to reduce.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error reduce_sum(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims);
+
+  /**
+   * @brief Computes the maximum over the given dimensions of the input tensor, see reduce.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param dims The indices of the input dimensions to reduce.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error reduce_max(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims);
+
+  /**
+   * @brief Computes the mean over the given dimensions of the input tensor, see reduce.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param dims The indices of the input dimensions to reduce.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error reduce_mean(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims);
+
+  /**
+   * @brief Normalizes each row of the last dimension of the input tensor into the output tensor, the remaining dimensions are executed
+   * in parallel. The input and output have the same dimensions, the layer norm and the rms norm add an epsilon of 1e-5. The
+   * normalization supports fp32 tensors.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @param type The normalization type to apply, None is not allowed.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error normalize(const Tensor &input, Tensor &output, const NormalizationType type);
+
+  /**
+   * @brief Computes the softmax over the last dimension of the input tensor, see normalize.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error softmax(const Tensor &input, Tensor &output);
+
+  /**
+   * @brief Computes the layer norm without scale and bias over the last dimension of the input tensor, see normalize.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error layer_norm(const Tensor &input, Tensor &output);
+
+  /**
+   * @brief Computes the rms norm without scale over the last dimension of the input tensor, see normalize.
+   *
+   * @param input The input tensor.
+   * @param output The output tensor.
+   * @return Error The error code or ErrorType::None on success.
+   */
+  Error rms_norm(const Tensor &input, Tensor &output);
 }  // namespace mlc
 
 #endif  // MLC_TENSOR
\ No newline at end of file
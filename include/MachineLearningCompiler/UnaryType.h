@@ -10,6 +10,12 @@ namespace mlc
     Zero = 1,
     ReLU = 2,
     Identity = 3,
+    Exp = 4,       // exp(x), fp32 only
+    Sigmoid = 5,   // 1 / (1 + exp(-x)), fp32 only
+    Tanh = 6,      // tanh(x), fp32 only
+    GeluErf = 7,   // x / 2 * (1 + erf(x / sqrt(2))), fp32 only
+    GeluTanh = 8,  // x / 2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))), fp32 only
+    SiLU = 9,      // x / (1 + exp(-x)), fp32 only
   };
 }  // namespace mlc
 
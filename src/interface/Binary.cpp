@@ -0,0 +1,138 @@
+#include "../../include/MachineLearningCompiler/Tensor.h"
+#include "../main/TensorOperation.h"
+#include "TensorUtils.h"
+#include <algorithm>
+
+namespace
+{
+  /**
+   * @brief Computes the strides of an input that is broadcast to the output dimensions, the dimensions are aligned from the last one.
+   * A dimension of size one or a missing leading dimension of the input gets the stride zero.
+   *
+   * @param input The input tensor.
+   * @param dimSizes The dimension sizes of the output.
+   * @param strides The strides of the input in the dimensions of the output.
+   * @return true The input can be broadcast to the output.
+   * @return false An input dimension does not match the output dimension and is not of size one.
+   */
+  bool broadcast_strides(const mlc::Tensor &input, const std::vector<int64_t> &dimSizes, std::vector<int64_t> &strides)
+  {
+    const size_t offset = dimSizes.size() - input.dim_sizes.size();
+    int64_t stride = 1;
+
+    strides.assign(dimSizes.size(), 0);
+    for (int64_t i = input.dim_sizes.size() - 1; i >= 0; i--)
+    {
+      int64_t size = static_cast<int64_t>(input.dim_sizes[i]);
+      if (size != dimSizes[i + offset] && size != 1)
+      {
+        return false;
+      }
+
+      strides[i + offset] = size == 1 ? 0 : stride;
+      stride *= size;
+    }
+    return true;
+  }
+}  // namespace
+
+mlc::Error mlc::binary(const Tensor &input0, const Tensor &input1, Tensor &output, const BinaryType type)
+{
+  return binary(input0, input1, output, type, UnaryType::None);
+}
+
+mlc::Error mlc::binary(const Tensor &input0, const Tensor &input1, Tensor &output, const BinaryType type, const UnaryType lastTouch)
+{
+  if (type == BinaryType::None)
+  {
+    return {ErrorType::ExecuteWrongMainPrimitive, "Expected a binary type other than None."};
+  }
+
+  if (input0.dtype != output.dtype || input1.dtype != output.dtype)
+  {
+    return {ErrorType::ExecuteWrongDType, "Expected the input tensors to have the same data type as the output tensor."};
+  }
+
+  if (output.dim_sizes.empty() || input0.dim_sizes.size() > output.dim_sizes.size() || input1.dim_sizes.size() > output.dim_sizes.size())
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected the output tensor to have at least as many dimensions as the input tensors."};
+  }
+
+  // The primitive needs a m and a n dimension, a vector is the matrix of a single row
+  const size_t dimCount = std::max<size_t>(output.dim_sizes.size(), 2);
+  std::vector<int64_t> dimSizes(dimCount, 1);
+  std::vector<int64_t> stridesOut(dimCount);
+  std::copy(output.dim_sizes.begin(), output.dim_sizes.end(), dimSizes.end() - output.dim_sizes.size());
+
+  int64_t stride = 1;
+  for (int64_t i = dimCount - 1; i >= 0; i--)
+  {
+    stridesOut[i] = stride;
+    stride *= dimSizes[i];
+  }
+
+  std::vector<int64_t> stridesIn0;
+  std::vector<int64_t> stridesIn1;
+  if (!broadcast_strides(input0, dimSizes, stridesIn0) || !broadcast_strides(input1, dimSizes, stridesIn1))
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected the dimensions of the input tensors to match the output or to be of size one."};
+  }
+
+  // Each output dimension is the dimension of an input, the broadcast does not repeat the output
+  for (size_t i = 0; i < dimCount; i++)
+  {
+    if (dimSizes[i] != 1 && stridesIn0[i] == 0 && stridesIn1[i] == 0)
+    {
+      return {ErrorType::ExecuteWrongDimension, "Expected an output dimension to match the dimension of an input tensor."};
+    }
+  }
+
+  mini_jit::TensorOperation op;
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                        // first_touch
+    internal::convertPrimitiveType(type),                        // main
+    internal::convertPrimitiveType(lastTouch),                   // last touch
+    std::vector(dimCount, mini_jit::TensorConfig::dim_t::c),     // dim_types
+    std::vector(dimCount, mini_jit::TensorConfig::exec_t::seq),  // exec_types
+    dimSizes,                                                    // dim_sizes
+    stridesIn0,                                                  // strides_in0
+    stridesIn1,                                                  // strides_in1
+    stridesOut,                                                  // strides_out
+    internal::convertDataType(output.dtype),                     // dtype_t
+  };
+
+  mini_jit::TensorOperation::error_t error = op.setup(config);
+  mlc::ErrorType errorType = internal::convertTensorOperationError(error);
+  if (errorType != mlc::ErrorType::None)
+  {
+    return {errorType, "Could not generate the kernels for the binary operation."};
+  }
+
+  op.execute(internal::getTensorData(&input0), internal::getTensorData(&input1), internal::getTensorData(&output));
+  return {ErrorType::None, "Success"};
+}
+
+mlc::Error mlc::add(const Tensor &input0, const Tensor &input1, Tensor &output)
+{
+  return binary(input0, input1, output, BinaryType::Add);
+}
+
+mlc::Error mlc::sub(const Tensor &input0, const Tensor &input1, Tensor &output)
+{
+  return binary(input0, input1, output, BinaryType::Sub);
+}
+
+mlc::Error mlc::mul(const Tensor &input0, const Tensor &input1, Tensor &output)
+{
+  return binary(input0, input1, output, BinaryType::Mul);
+}
+
+mlc::Error mlc::maximum(const Tensor &input0, const Tensor &input1, Tensor &output)
+{
+  return binary(input0, input1, output, BinaryType::Maximum);
+}
+
+mlc::Error mlc::minimum(const Tensor &input0, const Tensor &input1, Tensor &output)
+{
+  return binary(input0, input1, output, BinaryType::Minimum);
+}
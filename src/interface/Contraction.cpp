@@ -12,6 +12,11 @@ mlc::Error mlc::contraction(const Tensor &input0, const Tensor &input1, Tensor &
 mlc::Error mlc::contraction(const Tensor &input0, const Tensor &input1, Tensor &output, const std::string &contraction,
                             const UnaryType firstTouch, const UnaryType lastTouch)
 {
+  if (input0.dtype != output.dtype || input1.dtype != output.dtype)
+  {
+    return {ErrorType::ExecuteWrongDType, "Expected the input tensors to have the same data type as the output tensor."};
+  }
+
   mini_jit::EinsumTree einsumTree(contraction);
   mini_jit::EinsumTree::ErrorParse errorParse = einsumTree.parse_tree(false);
   if (errorParse != mini_jit::EinsumTree::ErrorParse::None)
@@ -28,6 +33,7 @@ mlc::Error mlc::contraction(const Tensor &input0, const Tensor &input1, Tensor &
   std::vector<int64_t> sorted_dim_sizes;
   internal::get_sorted_dimensions_sizes(einsumTree.get_root(), {input0, input1}, sorted_dim_sizes);
   einsumTree.set_sorted_dim_sizes(sorted_dim_sizes);
+  einsumTree.set_dtype(internal::convertDataType(output.dtype));
   errorParse = einsumTree.generate_operators();
   if (errorParse != mini_jit::EinsumTree::ErrorParse::None)
   {
@@ -47,6 +53,6 @@ mlc::Error mlc::contraction(const Tensor &input0, const Tensor &input1, Tensor &
     return {errorType, "Could not generate the kernels for the gemm operation."};
   }
 
-  op.execute(input0.data, input1.data, output.data);
+  op.execute(internal::getTensorData(&input0), internal::getTensorData(&input1), internal::getTensorData(&output));
   return {ErrorType::None, "Success"};
 }
\ No newline at end of file
@@ -13,7 +13,8 @@ mlc::Error mlc::einsum(const std::vector<Tensor *> &inputs, Tensor &output, cons
   return internal::einsum<Tensor *>(inputs, output, tree);
 }
 
-mlc::EinsumOperation::EinsumOperation(const std::vector<std::reference_wrapper<const Tensor>> &inputs, Tensor &, const std::string &tree)
+mlc::EinsumOperation::EinsumOperation(const std::vector<std::reference_wrapper<const Tensor>> &inputs, Tensor &output,
+                                      const std::string &tree)
     : einsumTree(tree)
 {
   mini_jit::EinsumTree::ErrorParse errorParse = einsumTree.parse_tree(false);
@@ -26,6 +27,7 @@ mlc::EinsumOperation::EinsumOperation(const std::vector<std::reference_wrapper<c
   std::vector<int64_t> sorted_dim_sizes;
   internal::get_sorted_dimensions_sizes<std::reference_wrapper<const Tensor>>(einsumTree.get_root(), inputs, sorted_dim_sizes);
   einsumTree.set_sorted_dim_sizes(sorted_dim_sizes);
+  einsumTree.set_dtype(internal::convertDataType(output.dtype));
   errorParse = einsumTree.generate_operators();
   if (errorParse != mini_jit::EinsumTree::ErrorParse::None)
   {
@@ -74,7 +76,7 @@ mlc::Error mlc::EinsumOperation::execute(const std::vector<const Tensor *> &inpu
 }
 
 mlc::TensorOperation *mlc::einsum_operation(const std::vector<std::vector<uint64_t>> &inputs, const std::vector<uint64_t> &output,
-                                            const std::string &tree)
+                                            const std::string &tree, DataType dtype)
 {
   std::vector<Tensor> rawTensor;
   std::vector<std::reference_wrapper<const Tensor>> inputTensors;
@@ -83,11 +85,13 @@ mlc::TensorOperation *mlc::einsum_operation(const std::vector<std::vector<uint64
   for (const auto &shape : inputs)
   {
     // Create a dummy tensor with the given shape
-    rawTensor.emplace_back(nullptr, shape);
+    rawTensor.emplace_back(static_cast<float *>(nullptr), shape);
+    rawTensor.back().dtype = dtype;
     inputTensors.push_back(rawTensor.back());
   }
 
-  Tensor outputTensor(output);
+  Tensor outputTensor(static_cast<float *>(nullptr), output);
+  outputTensor.dtype = dtype;
   EinsumOperation *operation = new EinsumOperation(inputTensors, outputTensor, tree);
   return operation;
 }
\ No newline at end of file
@@ -21,6 +21,11 @@ namespace mlc
      */
     template <typename T> mlc::Error einsum(const std::vector<T> &inputs, mlc::Tensor &output, const std::string &tree)
     {
+      if (!hasSameDataType(inputs, output))
+      {
+        return {mlc::ErrorType::ExecuteWrongDType, "Expected all tensors of the einsum expression to have the same data type."};
+      }
+
       mini_jit::EinsumTree einsumTree(tree);
       mini_jit::EinsumTree::ErrorParse errorParse = einsumTree.parse_tree(false);
       if (errorParse != mini_jit::EinsumTree::ErrorParse::None)
@@ -32,6 +37,7 @@ namespace mlc
       std::vector<int64_t> sorted_dim_sizes;
       get_sorted_dimensions_sizes(einsumTree.get_root(), inputs, sorted_dim_sizes);
       einsumTree.set_sorted_dim_sizes(sorted_dim_sizes);
+      einsumTree.set_dtype(convertDataType(output.dtype));
       errorParse = einsumTree.generate_operators();
       if (errorParse != mini_jit::EinsumTree::ErrorParse::None)
       {
@@ -42,10 +48,10 @@ namespace mlc
       std::vector<void *> tensors(inputs.size() + 1);
       for (size_t i = 0; i < inputs.size(); i++)
       {
-        tensors[i] = getTensor<T>(inputs[i])->data;
+        tensors[i] = getTensorData(getTensor<T>(inputs[i]));
         assert(tensors[i] != nullptr);
       }
-      tensors[inputs.size()] = output.data;
+      tensors[inputs.size()] = getTensorData(&output);
 
       mini_jit::EinsumTree::ErrorExecute errorExecute = einsumTree.execute(tensors);
       if (errorExecute != mini_jit::EinsumTree::ErrorExecute::None)
@@ -84,9 +90,9 @@ namespace mlc
     std::vector<void *> tensors(inputs.size() + 1);
     for (size_t i = 0; i < inputs.size(); i++)
     {
-      tensors[i] = internal::getTensor<T>(inputs[i])->data;
+      tensors[i] = internal::getTensorData(internal::getTensor<T>(inputs[i]));
     }
-    tensors[inputs.size()] = output.data;
+    tensors[inputs.size()] = internal::getTensorData(&output);
 
     mini_jit::EinsumTree::ErrorExecute errorExecute = einsumTree.execute(tensors);
     if (errorExecute != mini_jit::EinsumTree::ErrorExecute::None)
@@ -103,6 +109,11 @@ namespace mlc
     auto &sortedDimSizes = einsumTree.get_sorted_dim_sizes();
     const mini_jit::EinsumTree::EinsumNode *root = einsumTree.get_root();
 
+    if (internal::convertDataType(output.dtype) != einsumTree.get_dtype() || !internal::hasSameDataType(inputs, output))
+    {
+      return {ErrorType::ExecuteWrongDType, "The tensors have a different data type than the tensors it was setup up with."};
+    }
+
     if (output.dim_sizes.size() != root->output_dim_ids.size())
     {
       return {ErrorType::ExecuteWrongDimension, "The count of dimensions do not match in the output tensor."};
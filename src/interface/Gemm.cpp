@@ -28,6 +28,11 @@ mlc::Error mlc::gemm(const Tensor &input0, const Tensor &input1, Tensor &output)
     return {ErrorType::ExecuteWrongDimension, "Expected the input1 tensor to have the same k dimension size as the input0."};
   }
 
+  if (input0.dtype != output.dtype || input1.dtype != output.dtype)
+  {
+    return {ErrorType::ExecuteWrongDType, "Expected the input tensors to have the same data type as the output tensor."};
+  }
+
   mini_jit::TensorOperation op;
   mini_jit::TensorConfig config{
     mini_jit::TensorConfig::prim_t::none,                                                                                // first_touch
@@ -39,7 +44,7 @@ mlc::Error mlc::gemm(const Tensor &input0, const Tensor &input1, Tensor &output)
     {1, 0, mSize},                                                                                                       // strides_in0
     {0, kSize, 1},                                                                                                       // strides_in1
     {1, mSize, 0},                                                                                                       // strides_out
-    mini_jit::TensorConfig::dtype_t::fp32,                                                                               // dtype_t
+    internal::convertDataType(output.dtype),                                                                             // dtype_t
   };
 
   mini_jit::TensorOperation::error_t error = op.setup(config);
@@ -49,6 +54,6 @@ mlc::Error mlc::gemm(const Tensor &input0, const Tensor &input1, Tensor &output)
     return {errorType, "Could not generate the kernels for the gemm operation."};
   }
 
-  op.execute(input0.data, input1.data, output.data);
+  op.execute(internal::getTensorData(&input0), internal::getTensorData(&input1), internal::getTensorData(&output));
   return {ErrorType::None, "Success"};
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "../../include/MachineLearningCompiler/Tensor.h"
+#include "../main/TensorOperation.h"
+#include "TensorUtils.h"
+
+mlc::Error mlc::normalize(const Tensor &input, Tensor &output, const NormalizationType type)
+{
+  if (type == NormalizationType::None)
+  {
+    return {ErrorType::ExecuteWrongMainPrimitive, "Expected a normalization type other than None."};
+  }
+
+  if (input.dtype != DataType::FP32 || output.dtype != DataType::FP32)
+  {
+    return {ErrorType::ExecuteWrongDType, "Expected the input and output tensors to be fp32 tensors."};
+  }
+
+  if (input.dim_sizes.empty())
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected at least one dimension of the input tensor to normalize."};
+  }
+
+  if (output.dim_sizes != input.dim_sizes)
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected the output tensor to have the same dimensions as the input."};
+  }
+
+  // The last dimension is the normalized m dimension, the remaining dimensions are independent rows
+  std::vector<int64_t> dimSizes(input.dim_sizes.size());
+  std::vector<int64_t> strides(input.dim_sizes.size());
+  std::vector<mini_jit::TensorConfig::dim_t> dimTypes(input.dim_sizes.size(), mini_jit::TensorConfig::dim_t::c);
+  dimTypes.back() = mini_jit::TensorConfig::dim_t::m;
+
+  int64_t stride = 1;
+  for (int64_t i = input.dim_sizes.size() - 1; i >= 0; i--)
+  {
+    dimSizes[i] = static_cast<int64_t>(input.dim_sizes[i]);
+    strides[i] = stride;
+    stride *= dimSizes[i];
+  }
+
+  // The primitive needs a dimension of rows, a single row is a column of size one
+  if (dimSizes.size() == 1)
+  {
+    dimSizes.insert(dimSizes.begin(), 1);
+    dimTypes.insert(dimTypes.begin(), mini_jit::TensorConfig::dim_t::c);
+    strides.insert(strides.begin(), stride);
+  }
+
+  mini_jit::TensorOperation op;
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                               // first_touch
+    internal::convertPrimitiveType(type),                               // main
+    mini_jit::TensorConfig::prim_t::none,                               // last touch
+    dimTypes,                                                           // dim_types
+    std::vector(dimSizes.size(), mini_jit::TensorConfig::exec_t::seq),  // exec_types
+    dimSizes,                                                           // dim_sizes
+    strides,                                                            // strides_in0
+    std::vector<int64_t>(dimSizes.size(), 0),                           // strides_in1
+    strides,                                                            // strides_out
+    internal::convertDataType(output.dtype),                            // dtype_t
+  };
+
+  mini_jit::TensorOperation::error_t error = op.setup(config);
+  mlc::ErrorType errorType = internal::convertTensorOperationError(error);
+  if (errorType != mlc::ErrorType::None)
+  {
+    return {errorType, "Could not generate the kernels for the normalization operation."};
+  }
+
+  op.execute(internal::getTensorData(&input), nullptr, internal::getTensorData(&output));
+  return {ErrorType::None, "Success"};
+}
+
+mlc::Error mlc::softmax(const Tensor &input, Tensor &output)
+{
+  return normalize(input, output, NormalizationType::Softmax);
+}
+
+mlc::Error mlc::layer_norm(const Tensor &input, Tensor &output)
+{
+  return normalize(input, output, NormalizationType::LayerNorm);
+}
+
+mlc::Error mlc::rms_norm(const Tensor &input, Tensor &output)
+{
+  return normalize(input, output, NormalizationType::RmsNorm);
+}
@@ -0,0 +1,115 @@
+#include "../../include/MachineLearningCompiler/Tensor.h"
+#include "../main/TensorOperation.h"
+#include "TensorUtils.h"
+#include <algorithm>
+
+mlc::Error mlc::reduce(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims, const ReduceType type)
+{
+  if (type == ReduceType::None)
+  {
+    return {ErrorType::ExecuteWrongMainPrimitive, "Expected a reduce type other than None."};
+  }
+
+  if (output.dtype != input.dtype)
+  {
+    return {ErrorType::ExecuteWrongDType, "Expected the output tensor to have the same data type as the input."};
+  }
+
+  if (input.dim_sizes.empty() || dims.empty())
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected at least one dimension of the input tensor to reduce."};
+  }
+
+  std::vector<bool> isReduced(input.dim_sizes.size(), false);
+  for (int64_t dim : dims)
+  {
+    if (dim < 0 || dim >= static_cast<int64_t>(input.dim_sizes.size()) || isReduced[dim])
+    {
+      return {ErrorType::ExecuteWrongDimension, "Expected the reduced dimensions to be unique dimensions of the input tensor."};
+    }
+    isReduced[dim] = true;
+  }
+
+  // The output either removes the reduced dimensions or keeps them with size one
+  std::vector<uint64_t> removedSizes;
+  std::vector<uint64_t> keptSizes;
+  for (size_t i = 0; i < input.dim_sizes.size(); i++)
+  {
+    keptSizes.push_back(isReduced[i] ? 1 : input.dim_sizes[i]);
+    if (!isReduced[i])
+    {
+      removedSizes.push_back(input.dim_sizes[i]);
+    }
+  }
+
+  if (output.dim_sizes != removedSizes && output.dim_sizes != keptSizes)
+  {
+    return {ErrorType::ExecuteWrongDimension, "Expected the output tensor to have the not reduced dimensions of the input."};
+  }
+
+  // The reduced dimensions are k dimensions that do not move the output
+  std::vector<int64_t> dimSizes(input.dim_sizes.size());
+  std::vector<int64_t> stridesIn0(input.dim_sizes.size());
+  std::vector<int64_t> stridesOut(input.dim_sizes.size());
+  std::vector<mini_jit::TensorConfig::dim_t> dimTypes(input.dim_sizes.size());
+
+  int64_t strideIn = 1;
+  int64_t strideOut = 1;
+  for (int64_t i = input.dim_sizes.size() - 1; i >= 0; i--)
+  {
+    dimSizes[i] = static_cast<int64_t>(input.dim_sizes[i]);
+    dimTypes[i] = isReduced[i] ? mini_jit::TensorConfig::dim_t::k : mini_jit::TensorConfig::dim_t::c;
+    stridesIn0[i] = strideIn;
+    stridesOut[i] = isReduced[i] ? 0 : strideOut;
+    strideIn *= dimSizes[i];
+    strideOut *= isReduced[i] ? 1 : dimSizes[i];
+  }
+
+  // The primitive needs a dimension of the output, a full reduce writes the single column of a scalar
+  if (std::ranges::all_of(isReduced, [](bool reduced) { return reduced; }))
+  {
+    dimSizes.insert(dimSizes.begin(), 1);
+    dimTypes.insert(dimTypes.begin(), mini_jit::TensorConfig::dim_t::c);
+    stridesIn0.insert(stridesIn0.begin(), 0);
+    stridesOut.insert(stridesOut.begin(), 1);
+  }
+
+  mini_jit::TensorOperation op;
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                               // first_touch
+    internal::convertPrimitiveType(type),                               // main
+    mini_jit::TensorConfig::prim_t::none,                               // last touch
+    dimTypes,                                                           // dim_types
+    std::vector(dimSizes.size(), mini_jit::TensorConfig::exec_t::seq),  // exec_types
+    dimSizes,                                                           // dim_sizes
+    stridesIn0,                                                         // strides_in0
+    std::vector<int64_t>(dimSizes.size(), 0),                           // strides_in1
+    stridesOut,                                                         // strides_out
+    internal::convertDataType(output.dtype),                            // dtype_t
+  };
+
+  mini_jit::TensorOperation::error_t error = op.setup(config);
+  mlc::ErrorType errorType = internal::convertTensorOperationError(error);
+  if (errorType != mlc::ErrorType::None)
+  {
+    return {errorType, "Could not generate the kernels for the reduce operation."};
+  }
+
+  op.execute(internal::getTensorData(&input), nullptr, internal::getTensorData(&output));
+  return {ErrorType::None, "Success"};
+}
+
+mlc::Error mlc::reduce_sum(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims)
+{
+  return reduce(input, output, dims, ReduceType::Sum);
+}
+
+mlc::Error mlc::reduce_max(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims)
+{
+  return reduce(input, output, dims, ReduceType::Max);
+}
+
+mlc::Error mlc::reduce_mean(const Tensor &input, Tensor &output, const std::vector<int64_t> &dims)
+{
+  return reduce(input, output, dims, ReduceType::Mean);
+}
@@ -29,7 +29,7 @@ void mlc::fill_random(Tensor &tensor)
 
     float random = numerator / denominator;
 
-    tensor.data[i] = random;
+    internal::setTensorValue(tensor, i, random);
   }
 }
 
@@ -47,7 +47,7 @@ void mlc::fill_number(Tensor &tensor, float number)
 #endif
   for (size_t i = 0; i < size; i++)
   {
-    tensor.data[i] = number;
+    internal::setTensorValue(tensor, i, number);
   }
 }
 
@@ -65,7 +65,7 @@ void mlc::fill_counting_up(Tensor &tensor, float start, float step)
 #endif
   for (int64_t i = 0; i < size; i++)
   {
-    tensor.data[i] = start + i * step;
+    internal::setTensorValue(tensor, i, start + i * step);
   }
 }
 
@@ -83,7 +83,7 @@ void mlc::fill_counting_down(Tensor &tensor, float start, float step)
 #endif
   for (int64_t i = 0; i < size; i++)
   {
-    tensor.data[i] = start - i * step;
+    internal::setTensorValue(tensor, i, start - i * step);
   }
 }
 
@@ -101,7 +101,7 @@ void mlc::fill_lambda(Tensor &tensor, std::function<float(const Tensor &, size_t
 #endif
   for (size_t i = 0; i < size; i++)
   {
-    tensor.data[i] = function(tensor, i);
+    internal::setTensorValue(tensor, i, function(tensor, i));
   }
 }
 
@@ -116,10 +116,18 @@ void mlc::internal::tensor_dim_to_string(mlc::Tensor *tensor, std::string &str,
       {
         str += ", ";
       }
-      if (tensor->data == nullptr)
+      if (getTensorData(tensor) == nullptr)
       {
         str += "-";
       }
+      else if (tensor->dtype == mlc::DataType::FP64)
+      {
+        str += std::to_string(tensor->data_fp64[offset + i]);
+      }
+      else if (tensor->dtype == mlc::DataType::FP16)
+      {
+        str += std::to_string(fromHalf(tensor->data_fp16[offset + i]));
+      }
       else
       {
         str += std::to_string(tensor->data[offset + i]);
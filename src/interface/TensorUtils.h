@@ -3,7 +3,9 @@
 #include "../../include/MachineLearningCompiler/Tensor.h"
 #include "../main/EinsumTree.h"
 #include "../main/release_assert.h"
+#include <bit>
 #include <cassert>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <iostream>
@@ -261,6 +263,152 @@ namespace mlc
       return size;
     }
 
+    /**
+     * @brief Converts a value to the nearest half-precision float, ties are rounded to even.
+     *
+     * @param value The value to convert, values beyond the range of half precision become infinity.
+     * @return uint16_t The bits of the half-precision float.
+     */
+    inline uint16_t toHalf(double value)
+    {
+      // Rounding to float and then to half precision could round twice, rounding the float to odd keeps the inexact bits of the double
+      float single = static_cast<float>(value);
+      if (std::isfinite(single) && static_cast<double>(single) != value)
+      {
+        if (std::abs(static_cast<double>(single)) > std::abs(value))
+        {
+          single = std::nextafter(single, 0.0f);
+        }
+        single = std::bit_cast<float>(std::bit_cast<uint32_t>(single) | 1);
+      }
+      const uint32_t bits = std::bit_cast<uint32_t>(single);
+      const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+      const uint32_t magnitude = bits & 0x7fffffff;
+      if (magnitude > 0x7f800000)
+      {
+        return sign | 0x7e00;  // quiet NaN
+      }
+      if (magnitude >= 0x477ff000)
+      {
+        return sign | 0x7c00;  // rounds to at least 2^16, i.e. infinity
+      }
+      if (magnitude < 0x38800000)
+      {
+        // Subnormal, the scaling by 2^24 is exact and the smallest normal 0x0400 is reached by rounding up
+        return sign | static_cast<uint16_t>(std::nearbyint(std::bit_cast<float>(magnitude) * 16777216.0f));
+      }
+      const uint32_t rounded = magnitude + 0xfff + ((magnitude >> 13) & 1);
+      return sign | static_cast<uint16_t>((rounded - 0x38000000) >> 13);
+    }
+
+    /**
+     * @brief Converts a half-precision float to the float of the same value.
+     *
+     * @param value The bits of the half-precision float.
+     * @return float The float of the same value.
+     */
+    inline float fromHalf(uint16_t value)
+    {
+      const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+      const uint32_t exponent = (value >> 10) & 0x1f;
+      const uint32_t mantissa = value & 0x3ff;
+      if (exponent == 0)
+      {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign != 0 ? -magnitude : magnitude;
+      }
+      if (exponent == 0x1f)
+      {
+        return std::bit_cast<float>(sign | 0x7f800000 | (mantissa << 13));
+      }
+      return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    /**
+     * @brief Gets the pointer to the elements of the tensor matching its data type.
+     *
+     * @param tensor The tensor to get the data from.
+     * @return void* The pointer to the first element of the tensor.
+     */
+    constexpr void *getTensorData(const mlc::Tensor *tensor)
+    {
+      if (tensor->dtype == mlc::DataType::FP64)
+      {
+        return tensor->data_fp64;
+      }
+      if (tensor->dtype == mlc::DataType::FP16)
+      {
+        return tensor->data_fp16;
+      }
+      return tensor->data;
+    }
+
+    /**
+     * @brief Sets the element at the given index of the tensor, converted to the data type of the tensor.
+     *
+     * @param tensor The tensor to write to.
+     * @param index The index of the element.
+     * @param value The value to write.
+     */
+    inline void setTensorValue(mlc::Tensor &tensor, size_t index, double value)
+    {
+      if (tensor.dtype == mlc::DataType::FP64)
+      {
+        tensor.data_fp64[index] = value;
+      }
+      else if (tensor.dtype == mlc::DataType::FP16)
+      {
+        tensor.data_fp16[index] = toHalf(value);
+      }
+      else
+      {
+        tensor.data[index] = static_cast<float>(value);
+      }
+    }
+
+    /**
+     * @brief Converts a data type from the interface to the corresponding data type of the tensor config.
+     *
+     * @param dtype The data type to convert.
+     * @return constexpr mini_jit::TensorConfig::dtype_t The converted data type.
+     */
+    constexpr mini_jit::TensorConfig::dtype_t convertDataType(mlc::DataType dtype)
+    {
+      switch (dtype)
+      {
+      case mlc::DataType::FP32:
+        return mini_jit::TensorConfig::dtype_t::fp32;
+      case mlc::DataType::FP64:
+        return mini_jit::TensorConfig::dtype_t::fp64;
+      case mlc::DataType::FP16:
+        return mini_jit::TensorConfig::dtype_t::fp16;
+      default:
+        release_assert(false, "Found unhandled mlc::DataType.");
+        return mini_jit::TensorConfig::dtype_t::fp32;
+      }
+    }
+
+    /**
+     * @brief Checks if all input tensors have the same data type as the output tensor.
+     *
+     * @tparam T The type of the input tensors, either mlc::Tensor* or std::reference_wrapper<const mlc::Tensor>.
+     * @param inputs The input tensors.
+     * @param output The output tensor.
+     * @return true All tensors share the data type of the output.
+     * @return false At least one input has a different data type.
+     */
+    template <typename T> constexpr bool hasSameDataType(const std::vector<T> &inputs, const mlc::Tensor &output)
+    {
+      for (const T &input : inputs)
+      {
+        if (getTensor<T>(input)->dtype != output.dtype)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
     /**
      * @brief Converts a primitive type from the interface unary to a corresponding primitive of the tensor config.
      *
@@ -279,6 +427,85 @@ namespace mlc
         return mini_jit::TensorConfig::prim_t::zero;
       case mlc::UnaryType::ReLU:
         return mini_jit::TensorConfig::prim_t::relu;
+      case mlc::UnaryType::Exp:
+        return mini_jit::TensorConfig::prim_t::exp;
+      case mlc::UnaryType::Sigmoid:
+        return mini_jit::TensorConfig::prim_t::sigmoid;
+      case mlc::UnaryType::Tanh:
+        return mini_jit::TensorConfig::prim_t::tanh;
+      case mlc::UnaryType::GeluErf:
+        return mini_jit::TensorConfig::prim_t::gelu_erf;
+      case mlc::UnaryType::GeluTanh:
+        return mini_jit::TensorConfig::prim_t::gelu_tanh;
+      case mlc::UnaryType::SiLU:
+        return mini_jit::TensorConfig::prim_t::silu;
+      default:
+        return mini_jit::TensorConfig::prim_t::none;
+      }
+    }
+
+    /**
+     * @brief Converts a primitive type from the interface binary to a corresponding primitive of the tensor config.
+     *
+     * @param type The binary type to convert.
+     * @return constexpr mini_jit::TensorConfig::prim_t The converted primitive.
+     */
+    constexpr mini_jit::TensorConfig::prim_t convertPrimitiveType(mlc::BinaryType type)
+    {
+      switch (type)
+      {
+      case mlc::BinaryType::Add:
+        return mini_jit::TensorConfig::prim_t::add;
+      case mlc::BinaryType::Sub:
+        return mini_jit::TensorConfig::prim_t::sub;
+      case mlc::BinaryType::Mul:
+        return mini_jit::TensorConfig::prim_t::mul;
+      case mlc::BinaryType::Maximum:
+        return mini_jit::TensorConfig::prim_t::max;
+      case mlc::BinaryType::Minimum:
+        return mini_jit::TensorConfig::prim_t::min;
+      default:
+        return mini_jit::TensorConfig::prim_t::none;
+      }
+    }
+
+    /**
+     * @brief Converts a primitive type from the interface reduce to a corresponding primitive of the tensor config.
+     *
+     * @param type The reduce type to convert.
+     * @return constexpr mini_jit::TensorConfig::prim_t The converted primitive.
+     */
+    constexpr mini_jit::TensorConfig::prim_t convertPrimitiveType(mlc::ReduceType type)
+    {
+      switch (type)
+      {
+      case mlc::ReduceType::Sum:
+        return mini_jit::TensorConfig::prim_t::reduce_sum;
+      case mlc::ReduceType::Max:
+        return mini_jit::TensorConfig::prim_t::reduce_max;
+      case mlc::ReduceType::Mean:
+        return mini_jit::TensorConfig::prim_t::reduce_mean;
+      default:
+        return mini_jit::TensorConfig::prim_t::none;
+      }
+    }
+
+    /**
+     * @brief Converts a primitive type from the interface normalization to a corresponding primitive of the tensor config.
+     *
+     * @param type The normalization type to convert.
+     * @return constexpr mini_jit::TensorConfig::prim_t The converted primitive.
+     */
+    constexpr mini_jit::TensorConfig::prim_t convertPrimitiveType(mlc::NormalizationType type)
+    {
+      switch (type)
+      {
+      case mlc::NormalizationType::Softmax:
+        return mini_jit::TensorConfig::prim_t::softmax;
+      case mlc::NormalizationType::LayerNorm:
+        return mini_jit::TensorConfig::prim_t::layer_norm;
+      case mlc::NormalizationType::RmsNorm:
+        return mini_jit::TensorConfig::prim_t::rms_norm;
       default:
         return mini_jit::TensorConfig::prim_t::none;
       }
@@ -294,6 +521,6 @@ namespace mlc
      * @param indent The indentation of the current dimension.
      */
     void tensor_dim_to_string(mlc::Tensor *tensor, std::string &str, size_t dim, size_t offset, std::string indent);
-  }  // namespace internal
-}  // namespace mlc
+  }     // namespace internal
+}       // namespace mlc
 #endif  // MLC_TENSORUTILS_H
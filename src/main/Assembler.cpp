@@ -0,0 +1,87 @@
+#include "Assembler.h"
+#include "arm_instructions/base/nop.h"
+#include "arm_instructions/register.h"
+#include "release_assert.h"
+#include <utility>
+
+void mini_jit::Assembler::add(uint32_t instruction)
+{
+  kernel.add(instruction);
+}
+
+void mini_jit::Assembler::add(std::vector<uint32_t> instructions)
+{
+  kernel.add(std::move(instructions));
+}
+
+void mini_jit::Assembler::add(uint32_t instruction, std::string const &label, relocation_t relocation)
+{
+  relocations.push_back(Relocation{kernel.get_instruction_count(), label, relocation});
+  kernel.add(instruction);
+}
+
+void mini_jit::Assembler::label(std::string const &name)
+{
+  bool inserted = labels.emplace(name, kernel.get_instruction_count()).second;
+  release_assert(inserted, "The label is already bound.");
+}
+
+void mini_jit::Assembler::patch_point(std::string const &name)
+{
+  kernel.add_patch_point(name);
+}
+
+void mini_jit::Assembler::align(std::size_t alignment_bytes)
+{
+  release_assert(alignment_bytes % sizeof(uint32_t) == 0, "The alignment must be a multiple of the instruction size.");
+  release_assert((alignment_bytes & (alignment_bytes - 1)) == 0, "The alignment must be a power of two.");
+
+  while (kernel.get_size() % alignment_bytes != 0)
+  {
+    kernel.add(arm_instructions::nop());
+  }
+}
+
+std::size_t mini_jit::Assembler::get_label_offset(std::string const &name) const
+{
+  auto found = labels.find(name);
+  release_assert(found != labels.end(), "The label is not bound.");
+  return found->second * sizeof(uint32_t);
+}
+
+void mini_jit::Assembler::finalize()
+{
+  using namespace mini_jit::arm_instructions;
+
+  for (Relocation const &relocation : relocations)
+  {
+    auto found = labels.find(relocation.label);
+    release_assert(found != labels.end(), "A branch references a label that is not bound.");
+
+    int64_t offset = static_cast<int64_t>(found->second) - static_cast<int64_t>(relocation.index);
+    uint32_t instruction = kernel.get_buffer()[relocation.index];
+
+    switch (relocation.relocation)
+    {
+    case relocation_t::imm19:
+      release_assert(offset >= -(1 << 18) && offset < (1 << 18), "The label is out of range of the imm19 offset.");
+      release_assert((instruction & (mask19 << 5)) == 0, "The instruction must be encoded with an offset of 0.");
+      instruction |= (static_cast<uint32_t>(offset) & mask19) << 5;
+      break;
+
+    case relocation_t::imm26:
+      release_assert(offset >= -(1 << 25) && offset < (1 << 25), "The label is out of range of the imm26 offset.");
+      release_assert((instruction & mask26) == 0, "The instruction must be encoded with an offset of 0.");
+      instruction |= static_cast<uint32_t>(offset) & mask26;
+      break;
+
+    default:
+      release_assert(false, "Found unhandled relocation_t");
+      break;
+    }
+
+    kernel.patch(relocation.index, instruction);
+  }
+
+  relocations.clear();
+}
@@ -0,0 +1,126 @@
+#ifndef MINI_JIT_ASSEMBLER_H
+#define MINI_JIT_ASSEMBLER_H
+
+#include "Kernel.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mini_jit
+{
+
+  /**
+   * Emits instructions into a kernel and resolves branch targets by named labels.
+   * Branches are emitted with an offset of 0 and relocated by finalize, hence labels can be referenced before they are bound.
+   *
+   * Example:
+   *   Assembler assembler(kernel);
+   *   assembler.label("loop_k");
+   *   assembler.add(sub(x15, x15, 1));
+   *   assembler.add(cbnz(x15, 0), "loop_k", Assembler::relocation_t::imm19);
+   *   assembler.finalize();
+   */
+  class Assembler
+  {
+  public:
+    //! immediate field of an instruction that holds the pc-relative offset to a label
+    enum class relocation_t : uint32_t
+    {
+      imm19 = 0,  //!< bits 5 to 23, e.g. cbnz, cbz, b.cond
+      imm26 = 1,  //!< bits 0 to 25, e.g. b, bl
+    };
+
+  private:
+    struct Relocation
+    {
+      //! index of the instruction in the code buffer
+      std::size_t index;
+
+      //! name of the target label
+      std::string label;
+
+      //! immediate field that is relocated
+      relocation_t relocation;
+    };
+
+    //! kernel the instructions are added to
+    Kernel &kernel;
+
+    //! instruction index of each bound label
+    std::unordered_map<std::string, std::size_t> labels;
+
+    //! references that are resolved by finalize
+    std::vector<Relocation> relocations;
+
+  public:
+    /**
+     * Constructor
+     *
+     * @param kernel kernel the instructions are added to.
+     **/
+    explicit Assembler(Kernel &kernel) : kernel(kernel) {};
+
+    /**
+     * Adds an instruction to the kernel.
+     *
+     * @param instruction instruction which is added.
+     **/
+    void add(uint32_t instruction);
+
+    /**
+     * Adds instructions to the kernel.
+     *
+     * @param instructions instructions which are added.
+     **/
+    void add(std::vector<uint32_t> instructions);
+
+    /**
+     * Adds a pc-relative instruction whose offset is resolved to the given label by finalize.
+     *
+     * @param instruction instruction encoded with an offset of 0.
+     * @param label name of the target label.
+     * @param relocation immediate field of the instruction that holds the offset.
+     **/
+    void add(uint32_t instruction, std::string const &label, relocation_t relocation);
+
+    /**
+     * Binds a label to the next added instruction.
+     *
+     * @param name name of the label, must be unique within the kernel.
+     **/
+    void label(std::string const &name);
+
+    /**
+     * Marks the next added instruction as patch point of the kernel.
+     *
+     * @param name name of the patch point, must be unique within the kernel.
+     **/
+    void patch_point(std::string const &name);
+
+    /**
+     * Pads the kernel with nops until the next instruction is aligned.
+     * The alignment is relative to the entry point of the kernel, which is 64 byte aligned in the code arena.
+     *
+     * @param alignment_bytes alignment in bytes, a power of two and a multiple of 4.
+     **/
+    void align(std::size_t alignment_bytes);
+
+    /**
+     * Gets the byte offset of a bound label from the entry point of the kernel.
+     *
+     * @param name name of the label.
+     * @return offset in bytes.
+     **/
+    std::size_t get_label_offset(std::string const &name) const;
+
+    /**
+     * Resolves all references to labels.
+     * Must be called after all instructions are added and before the kernel is set.
+     **/
+    void finalize();
+  };
+
+}  // namespace mini_jit
+#endif
@@ -0,0 +1,57 @@
+#include "Binary.h"
+#include "KernelCache.h"
+#include "kernels/binary/binary.h"
+#include "release_assert.h"
+#include <format>
+
+mini_jit::Binary::error_t mini_jit::Binary::generate(uint32_t m, uint32_t n, bool broadcast_a, bool broadcast_b, dtype_t dtype,
+                                                     ptype_t ptype, activation_t activation)
+{
+  if (dtype != dtype_t::fp32 && dtype != dtype_t::fp64)
+  {
+    return error_t::err_wrong_dtype;
+  }
+  if (m == 0 || n == 0)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  if (activation != activation_t::none && activation != activation_t::relu)
+  {
+    return error_t::err_wrong_activation;
+  }
+  release_assert(ptype <= ptype_t::min, "Found unhandled ptype_t");
+
+  const std::string key = std::format("binary_m{}_n{}_ba{}_bb{}_dtype{}_ptype{}_act{}", m, n, static_cast<int32_t>(broadcast_a),
+                                      static_cast<int32_t>(broadcast_b), static_cast<int32_t>(dtype), static_cast<int32_t>(ptype),
+                                      static_cast<int32_t>(activation));
+
+  native_kernel = KernelCache::instance().get_or_generate(
+    key,
+    [&](mini_jit::Kernel &native_kernel)
+    {
+      // The primitive types follow the order of binary_op_t
+      const auto op = static_cast<kernels::binary_op_t>(ptype);
+      const kernels::dtype_t kernel_dtype = dtype == dtype_t::fp64 ? kernels::dtype_t::fp64 : kernels::dtype_t::fp32;
+      constexpr char const *names[] = {"add", "sub", "mul", "max", "min"};
+      native_kernel.set_name(std::format("binary_{}{}{}{}{}_m{}_n{}", names[static_cast<uint32_t>(ptype)],
+                                         dtype == dtype_t::fp64 ? "_fp64" : "", broadcast_a ? "_broadcast_a" : "",
+                                         broadcast_b ? "_broadcast_b" : "", activation == activation_t::relu ? "_relu" : "", m, n));
+      kernels::binary(native_kernel, m, n, op, kernel_dtype, broadcast_a, broadcast_b, activation);
+    });
+  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel->get_kernel()));
+
+  return error_t::success;
+}
+
+mini_jit::Binary::kernel_t mini_jit::Binary::get_kernel() const
+{
+  return kernel;
+}
+
+void mini_jit::Binary::write_kernel_to_file(const char *path) const
+{
+  if (native_kernel != nullptr)
+  {
+    native_kernel->write(path);
+  }
+}
@@ -0,0 +1,91 @@
+#ifndef MINI_JIT_BINARY_H
+#define MINI_JIT_BINARY_H
+
+#include "Kernel.h"
+#include "kernels/epilogue.h"
+#include <cstdint>
+#include <memory>
+
+namespace mini_jit
+{
+  class Binary;
+}
+
+class mini_jit::Binary
+{
+public:
+  /*
+   * Kernel type.
+   * The kernel is a function that takes the following parameters:
+   * - a:    Pointer to column-major matrix A.
+   * - b:    Pointer to column-major matrix B.
+   * - c:    Pointer to column-major matrix C.
+   * - ld_a: Leading dimension of A, zero broadcasts the first column of A.
+   * - ld_b: Leading dimension of B, zero broadcasts the first column of B.
+   * - ld_c: Leading dimension of C.
+   */
+  using kernel_t = void (*)(void const *a, void const *b, void *c, int64_t ld_a, int64_t ld_b, int64_t ld_c);
+
+  /// data type
+  enum class dtype_t : uint32_t
+  {
+    fp32 = 0,
+    fp64 = 1
+  };
+
+  /// primitive type, max and min propagate NaN
+  enum class ptype_t : uint32_t
+  {
+    add = 0,
+    sub = 1,
+    mul = 2,
+    max = 3,
+    min = 4,
+  };
+
+  /// activation applied to the result before it is stored
+  using activation_t = kernels::activation_t;
+
+  /// error codes
+  enum class error_t : int32_t
+  {
+    success = 0,
+    err_wrong_dtype = 1,
+    err_wrong_dimension = 2,
+    err_wrong_activation = 3,
+  };
+
+private:
+  kernel_t kernel = nullptr;
+  std::shared_ptr<mini_jit::Kernel> native_kernel;
+
+public:
+  /**
+   * @brief Generate a kernel for a binary primitive.
+   * @param m           Number of rows in A, B and C.
+   * @param n           Number of columns in A, B and C.
+   * @param broadcast_a True if A holds a single row per column, i.e. the rows of A have the stride zero.
+   * @param broadcast_b True if B holds a single row per column, i.e. the rows of B have the stride zero.
+   * @param dtype       Data type of the matrices.
+   * @param ptype       Primitive type.
+   * @param activation  Activation applied to C, either none or relu.
+   * @return error_t::success on success, another error_t value otherwise.
+   **/
+  error_t generate(uint32_t m, uint32_t n, bool broadcast_a, bool broadcast_b, dtype_t dtype, ptype_t ptype,
+                   activation_t activation = activation_t::none);
+
+  /**
+   * @brief Get the generated kernel: C := activation(op(A, B)).
+   * @return pointer to the generated kernel.
+   **/
+  kernel_t get_kernel() const;
+
+  /**
+   * @brief Writes the current kernel into a file.
+   *
+   * @param path The file to write the kernel to.
+   */
+  void write_kernel_to_file(const char *path) const;
+};
+
+#endif
@@ -1,160 +1,324 @@
 #include "Brgemm.h"
+#include "BrgemmTuner.h"
+#include "Cpu.h"
 #include "Kernel.h"
+#include "KernelCache.h"
+#include "Peephole.h"
+#include "kernels/br_matmul_bf16.h"
+#include "kernels/br_matmul_fp16.h"
+#include "kernels/br_matmul_int8.h"
+#include "kernels/br_matmul_sve.h"
 #include "kernels/matmuls_all.h"
 #include <format>
-#include <stdexcept>
 
 mini_jit::Brgemm::error_t mini_jit::Brgemm::generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a,
-                                                     uint32_t trans_b, uint32_t trans_c, dtype_t dtype)
+                                                     uint32_t trans_b, uint32_t trans_c, dtype_t dtype, double alpha, double beta,
+                                                     epilogue_t epilogue, prefetch_t prefetch, batch_reduce_t batch_reduce,
+                                                     packing_t packing)
 {
-  if (dtype != dtype_t::fp32)
+  tile_t tile;
+  // The strips of packed operands have the size of the default tile
+  if (dtype == dtype_t::fp32 && m != 0 && n != 0 && k != 0 && (trans_a + trans_b + trans_c) == 0 && packing == packing_t{})
+  {
+    tile = BrgemmTuner::instance().get_tile(m, n, k, br_size);
+  }
+
+  return generate(m, n, k, br_size, trans_a, trans_b, trans_c, dtype, tile, alpha, beta, epilogue, prefetch, batch_reduce, packing);
+}
+
+mini_jit::Brgemm::error_t mini_jit::Brgemm::generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a,
+                                                     uint32_t trans_b, uint32_t trans_c, dtype_t dtype, tile_t tile, double alpha,
+                                                     double beta, epilogue_t epilogue, prefetch_t prefetch, batch_reduce_t batch_reduce,
+                                                     packing_t packing)
+{
+  if (dtype != dtype_t::fp32 && dtype != dtype_t::fp64 && dtype != dtype_t::bf16 && dtype != dtype_t::s8 && dtype != dtype_t::u8 &&
+      dtype != dtype_t::fp16 && dtype != dtype_t::fp16_fp32)
   {
     return error_t::err_wrong_dtype;
   }
+  const bool is_int8 = dtype == dtype_t::s8 || dtype == dtype_t::u8;
+  const bool is_fp16 = dtype == dtype_t::fp16 || dtype == dtype_t::fp16_fp32;
   if (m == 0 || n == 0 || k == 0)
   {
     return error_t::err_wrong_dimension;
   }
-  if ((trans_a + trans_b + trans_c) != 0)
+  if (trans_a > 1 || trans_b > 1 || trans_c > 1)
   {
     return error_t::err_row_major_order_not_supported;
   }
-
-  if (br_size == 1 && (trans_a + trans_b + trans_c) == 0 && dtype == dtype_t::fp32)
+  if (!is_valid_tile(m, n, tile, dtype))
   {
-    fill_with_matmuls_no_batch_dim_column_major_fp32(m, n, k);
+    return error_t::err_wrong_tile;
   }
-  else if (br_size > 1 && (trans_a + trans_b + trans_c) == 0 && dtype == dtype_t::fp32)
+  if (batch_reduce != batch_reduce_t::stride && (epilogue.bias != bias_t::none ||
+                                                 (batch_reduce != batch_reduce_t::address && batch_reduce != batch_reduce_t::offset)))
   {
-    fill_with_matmuls_batch_dim_column_major_fp32(m, n, k, br_size);
+    // The kernel types of the pointer and offset lists have no bias argument
+    return error_t::err_batch_reduce_type_not_supported;
   }
-  else
+  if (epilogue.requantize != requantize_t::none && !is_int8)
   {
-    throw std::logic_error(
-      std::format("Unhandled parameter combination found: m='{}', n='{}', k='{}', br_size='{}', trans_a='{}', trans_b='{}', "
-                  "trans_c = '{}', dtype = '{}'",
-                  m, n, k, br_size, trans_a, trans_b, trans_c, static_cast<int32_t>(dtype)));
+    return error_t::err_wrong_dtype;
   }
+  if (dtype == dtype_t::bf16 || is_int8)
+  {
+    // The bfmmla, dot product and int8 mmla blocks are only read from the interleaved strips of Packing
+    if (packing != packing_t{true, true} || (trans_a + trans_b + trans_c) != 0)
+    {
+      return error_t::err_packing_not_supported;
+    }
+    if (alpha != 1 || (beta != 0 && beta != 1) || prefetch != prefetch_t{} || batch_reduce != batch_reduce_t::stride)
+    {
+      return error_t::err_wrong_dtype;
+    }
 
-  native_kernel.set_kernel();
-  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel.get_kernel()));  // Properly cast from const void* to kernel_t
-
-  return error_t::success;
-}
-
-mini_jit::Brgemm::kernel_t mini_jit::Brgemm::get_kernel() const
-{
-  return kernel;
-}
-
-void mini_jit::Brgemm::write_kernel_to_file(const char *path) const
-{
-  native_kernel.write(path);
-}
-
-void mini_jit::Brgemm::fill_with_matmuls_no_batch_dim_column_major_fp32(uint32_t m, uint32_t n, uint32_t k)
-{
-  // Always sort from the specific to the more general case
-
-  if (m == 16 && n == 6 && k == 1)
+    // The int8 kernels only requantize, a requantized C is int8 and cannot be accumulated
+    const bool is_requantized = epilogue.requantize != requantize_t::none;
+    if (epilogue.bias != bias_t::none || epilogue.activation != activation_t::none || (is_requantized && beta != 0))
+    {
+      return error_t::err_wrong_dtype;
+    }
+  }
+  else if (is_fp16)
   {
-    kernels::matmul_16_6_1(native_kernel);
-    return;
+    // The fp16 kernels read the column-major operands in place and have no epilogue
+    if ((trans_a + trans_b + trans_c) != 0)
+    {
+      return error_t::err_row_major_order_not_supported;
+    }
+    if (packing != packing_t{})
+    {
+      return error_t::err_packing_not_supported;
+    }
+    if (alpha != 1 || (beta != 0 && beta != 1) || epilogue != epilogue_t{} || prefetch != prefetch_t{} ||
+        batch_reduce != batch_reduce_t::stride)
+    {
+      return error_t::err_wrong_dtype;
+    }
   }
-
-  if (m == 16 && n == 6)
+  else if ((packing.a && (trans_a || (trans_b && trans_c))) || (packing.b && (!trans_b || trans_a || trans_c)))
   {
-    kernels::matmul_16_6_k(native_kernel, k);
-    return;
+    return error_t::err_packing_not_supported;
   }
 
-  if (m >= 16 && m % 16 == 0 && n >= 4 && n % 4 == 0)
+  // The bfmmla of the bf16 kernel traps on processors without the BFloat16 extension
+  if (dtype == dtype_t::bf16 && !Cpu::has_bf16())
   {
-    kernels::matmul_16m_4n_k(native_kernel, m / 16, n / 4, k);
-    return;
+    return error_t::err_wrong_dtype;
   }
-
-  if (m >= 16 && m % 16 == 0)
+  // The int8 kernels use the int8 mmla or fall back to the dot product instructions, a processor without both has no int8 kernel
+  if (is_int8 && !Cpu::has_i8mm() && !Cpu::has_dotprod())
+  {
+    return error_t::err_wrong_dtype;
+  }
+  // The half-precision accumulation uses the fmla of FEAT_FP16, the single-precision accumulation only converts
+  if (dtype == dtype_t::fp16 && !Cpu::has_fp16())
   {
-    // At this point n % 4 != 0
-    kernels::matmul_16m_lt4nRest_k(native_kernel, m / 16, n / 4, k, n % 4);
-    return;
+    return error_t::err_wrong_dtype;
   }
 
-  if (m >= 16 && n >= 4 && n % 4 == 0)
+  std::string key = std::format("brgemm_m{}_n{}_k{}_br{}_ta{}_tb{}_tc{}_dtype{}", m, n, k, br_size, trans_a, trans_b, trans_c,
+                                static_cast<int32_t>(dtype));
+  if (tile != tile_t{})
   {
-    // At this point m % 16 != 0
-    kernels::matmul_16mRest_4n_k(native_kernel, m / 16, n / 4, k, m % 16);
-    return;
+    key += std::format("_tile{}x{}", tile.m, tile.n);
   }
 
-  if (m < 16 && n >= 4 && n % 4 == 0)
+  // Each option changes the generated code, hence is part of the key if it differs from its default
+  const bool is_scaled = alpha != 1 || beta != 1;
+  if (is_scaled)
+  {
+    key += std::format("_alpha{}_beta{}", alpha, beta);
+  }
+  const bool has_epilogue = epilogue != epilogue_t{};
+  if (has_epilogue)
   {
-    kernels::matmul_lt16_4n_k(native_kernel, n / 4, k, m % 16);
-    return;
+    key += std::format("_bias{}_act{}", static_cast<int32_t>(epilogue.bias), static_cast<int32_t>(epilogue.activation));
+    if (epilogue.activation == activation_t::clamp)
+    {
+      key += std::format("_min{}_max{}", epilogue.clamp_min, epilogue.clamp_max);
+    }
+    if (epilogue.requantize != requantize_t::none)
+    {
+      key += std::format("_requantize{}_scale{}_zero{}", static_cast<int32_t>(epilogue.requantize), epilogue.scale, epilogue.zero_point);
+    }
+  }
+  const bool has_prefetch = prefetch != prefetch_t{};
+  if (has_prefetch)
+  {
+    key += std::format("_prefetch_a{}_b{}_c{}", prefetch.a, prefetch.b, prefetch.c);
+  }
+  const bool has_batch_list = batch_reduce != batch_reduce_t::stride;
+  if (has_batch_list)
+  {
+    key += std::format("_batch_reduce{}", static_cast<int32_t>(batch_reduce));
+  }
+  const bool has_packing = packing != packing_t{};
+  if (has_packing)
+  {
+    key += std::format("_packed_a{}_b{}", packing.a, packing.b);
   }
 
-  if (m >= 16)
+  // The int8 instruction decides the interleaved layout of Packing
+  const kernels::int8_instruction_t int8_instruction =
+    Cpu::has_i8mm() ? kernels::int8_instruction_t::mmla : kernels::int8_instruction_t::dot;
+  if (is_int8)
   {
-    // At this point m % 16 != 0 and n % 4 != 0
-    kernels::matmul_16mRest_lt4nRest_k(native_kernel, m / 16, n / 4, k, m % 16, n % 4);
-    return;
+    key += std::format("_int8_instruction{}", static_cast<int32_t>(int8_instruction));
   }
 
-  if (m < 16)
+  // The SVE kernel covers the plain column-major product, every other option is generated for NEON
+  const bool use_sve = Cpu::is_sve_enabled() && dtype != dtype_t::bf16 && !is_int8 && !is_fp16 && tile == tile_t{} &&
+                       (trans_a + trans_b + trans_c) == 0 && alpha == 1 && (beta == 0 || beta == 1) && !has_epilogue && !has_prefetch &&
+                       !has_batch_list && !has_packing;
+  if (use_sve)
+  {
+    key += "_sve";
+  }
+#ifdef MLC_USE_PEEPHOLE
+  else if (dtype != dtype_t::bf16 && !is_int8 && !is_fp16)
   {
-    // At this point m % 16 != 0 and n % 4 != 0
-    kernels::matmul_lt16_lt4nRest_k(native_kernel, n / 4, k, m % 16, n % 4);
-    return;
+    key += "_peephole";
   }
+#endif  // MLC_USE_PEEPHOLE
+
+  native_kernel = KernelCache::instance().get_or_generate(
+    key,
+    [&](mini_jit::Kernel &native_kernel)
+    {
+      if (use_sve)
+      {
+        const kernels::dtype_t kernel_dtype = dtype == dtype_t::fp64 ? kernels::dtype_t::fp64 : kernels::dtype_t::fp32;
+        native_kernel.set_name(std::format("br_matmul_sve{}_mv{}_nr{}_m{}_n{}_k{}_br{}", dtype == dtype_t::fp64 ? "_fp64" : "",
+                                           kernels::br_matmul_sve_default_m_vectors, kernels::br_matmul_sve_default_nr, m, n, k, br_size));
+        kernels::br_matmul_sve(native_kernel, kernels::br_matmul_sve_default_m_vectors, kernels::br_matmul_sve_default_nr, m, n, k,
+                               br_size, kernel_dtype, beta);
+
+        // The peephole pass only decodes NEON instructions
+        return;
+      }
+
+      if (dtype == dtype_t::bf16)
+      {
+        native_kernel.set_name(std::format("br_matmul_bf16_m{}_n{}_k{}_br{}", m, n, k, br_size));
+        kernels::br_matmul_bf16(native_kernel, m, n, k, br_size, beta);
+
+        // The peephole pass does not decode bfmmla
+        return;
+      }
+
+      if (is_int8)
+      {
+        native_kernel.set_name(std::format("br_matmul_int8_{}{}_m{}_n{}_k{}_br{}", dtype == dtype_t::s8 ? "s" : "u",
+                                           int8_instruction == kernels::int8_instruction_t::mmla ? "mmla" : "dot", m, n, k, br_size));
+        kernels::br_matmul_int8(native_kernel, m, n, k, br_size, dtype == dtype_t::s8, int8_instruction, beta, epilogue);
+
+        // The peephole pass does not decode the dot product and int8 mmla instructions
+        return;
+      }
+
+      if (is_fp16)
+      {
+        const kernels::fp16_accumulation_t accumulation =
+          dtype == dtype_t::fp16 ? kernels::fp16_accumulation_t::fp16 : kernels::fp16_accumulation_t::fp32;
+        native_kernel.set_name(std::format("br_matmul_fp16_{}_m{}_n{}_k{}_br{}", dtype == dtype_t::fp16 ? "fp16" : "fp32", m, n, k,
+                                           br_size));
+        kernels::br_matmul_fp16(native_kernel, m, n, k, br_size, accumulation, beta);
 
-  throw std::logic_error(std::format("Unhandled combination found for MxNxK matmul: m='{}', n='{}', k='{}'", m, n, k));
+        // The peephole pass does not decode the half-precision instructions
+        return;
+      }
+
+      if (dtype == dtype_t::fp64)
+      {
+        tile_t fp64_tile = tile != tile_t{} ? tile : default_fp64_tile;
+        native_kernel.set_name(std::format("br_matmul_mr_nr_k_fp64_mr{}_nr{}_m{}_n{}_k{}_br{}_ta{}_tb{}_tc{}", fp64_tile.m, fp64_tile.n,
+                                           m, n, k, br_size, trans_a, trans_b, trans_c));
+        kernels::br_matmul_mr_nr_k(native_kernel, fp64_tile.m, fp64_tile.n, m, n, k, br_size, kernels::dtype_t::fp64, trans_a,
+                                   trans_b, trans_c, alpha, beta, epilogue, prefetch, batch_reduce, packing);
+      }
+      else
+      {
+        tile_t fp32_tile = tile != tile_t{} ? tile : default_fp32_tile;
+        native_kernel.set_name(std::format("br_matmul_mr_nr_k_mr{}_nr{}_m{}_n{}_k{}_br{}_ta{}_tb{}_tc{}", fp32_tile.m, fp32_tile.n, m, n,
+                                           k, br_size, trans_a, trans_b, trans_c));
+        kernels::br_matmul_mr_nr_k(native_kernel, fp32_tile.m, fp32_tile.n, m, n, k, br_size, kernels::dtype_t::fp32, trans_a, trans_b,
+                                   trans_c, alpha, beta, epilogue, prefetch, batch_reduce, packing);
+      }
+
+#ifdef MLC_USE_PEEPHOLE
+      Peephole::optimize(native_kernel);
+#endif  // MLC_USE_PEEPHOLE
+    });
+  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel->get_kernel()));  // Properly cast from const void* to kernel_t
+
+  return error_t::success;
 }
 
-void mini_jit::Brgemm::fill_with_matmuls_batch_dim_column_major_fp32(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size)
+bool mini_jit::Brgemm::is_valid_tile(uint32_t m, uint32_t n, tile_t tile, dtype_t dtype)
 {
-  // Always sort from the specific to the more general case
-
-  if (m >= 16 && m % 16 == 0 && n >= 4 && n % 4 == 0)
+  if (tile == tile_t{})
   {
-    kernels::br_matmul_16m_4n_k(native_kernel, m / 16, n / 4, k, br_size);
-    return;
+    return true;
   }
-
-  if (m >= 16 && m % 16 == 0)
+  if (dtype == dtype_t::bf16)
   {
-    // At this point n % 4 != 0
-    kernels::br_matmul_16m_lt4nRest_k(native_kernel, m / 16, n / 4, k, br_size, n % 4);
-    return;
+    return tile == default_bf16_tile;
   }
-
-  if (m >= 16 && n >= 4 && n % 4 == 0)
+  if (dtype == dtype_t::s8 || dtype == dtype_t::u8)
   {
-    // At this point m % 16 != 0
-    kernels::br_matmul_16mRest_4n_k(native_kernel, m / 16, n / 4, k, br_size, m % 16);
-    return;
+    return tile == default_int8_tile;
   }
+  if (dtype == dtype_t::fp16)
+  {
+    return tile == default_fp16_tile;
+  }
+  if (dtype == dtype_t::fp16_fp32)
+  {
+    return tile == default_fp16_fp32_tile;
+  }
+
+  kernels::dtype_t kernel_dtype = dtype == dtype_t::fp64 ? kernels::dtype_t::fp64 : kernels::dtype_t::fp32;
+  return tile.m != 0 && tile.m % kernels::get_dtype_lanes(kernel_dtype) == 0 && tile.n != 0 &&
+         tile.n <= kernels::br_matmul_mr_nr_k_max_nr(tile.m, kernel_dtype) && m % tile.m == 0 && n % tile.n == 0;
+}
+
+mini_jit::Brgemm::kernel_t mini_jit::Brgemm::get_kernel() const
+{
+  return kernel;
+}
 
-  if (m < 16 && n >= 4 && n % 4 == 0)
+mini_jit::Brgemm::kernel_bias_t mini_jit::Brgemm::get_kernel_bias() const
+{
+  if (native_kernel == nullptr)
   {
-    kernels::br_matmul_lt16_4n_k(native_kernel, n / 4, k, br_size, m % 16);
-    return;
+    return nullptr;
   }
+  return reinterpret_cast<kernel_bias_t>(const_cast<void *>(native_kernel->get_kernel()));
+}
 
-  if (m >= 16)
+mini_jit::Brgemm::kernel_address_t mini_jit::Brgemm::get_kernel_address() const
+{
+  if (native_kernel == nullptr)
   {
-    // At this point m % 16 != 0 and n % 4 != 0
-    kernels::br_matmul_16mRest_lt4nRest_k(native_kernel, m / 16, n / 4, k, br_size, m % 16, n % 4);
-    return;
+    return nullptr;
   }
+  return reinterpret_cast<kernel_address_t>(const_cast<void *>(native_kernel->get_kernel()));
+}
 
-  if (m < 16)
+mini_jit::Brgemm::kernel_offset_t mini_jit::Brgemm::get_kernel_offset() const
+{
+  if (native_kernel == nullptr)
   {
-    // At this point m % 16 != 0 and n % 4 != 0
-    kernels::br_matmul_lt16_lt4nRest_k(native_kernel, n / 4, k, br_size, m % 16, n % 4);
-    return;
+    return nullptr;
   }
+  return reinterpret_cast<kernel_offset_t>(const_cast<void *>(native_kernel->get_kernel()));
+}
 
-  throw std::logic_error(
-    std::format("Unhandled combination found for MxNxKxBatch matmul: m='{}', n='{}', k='{}', batch='{}'", m, n, k, br_size));
-}
\ No newline at end of file
+void mini_jit::Brgemm::write_kernel_to_file(const char *path) const
+{
+  if (native_kernel != nullptr)
+  {
+    native_kernel->write(path);
+  }
+}
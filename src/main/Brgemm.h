@@ -2,7 +2,12 @@
 #define MINI_JIT_BRGEMM_H
 
 #include "Kernel.h"
+#include "kernels/batch_reduce.h"
+#include "kernels/epilogue.h"
+#include "kernels/packing.h"
+#include "kernels/prefetch.h"
 #include <cstdint>
+#include <memory>
 
 namespace mini_jit
 {
@@ -28,11 +33,66 @@ public:
   using kernel_t = void (*)(void const *a, void const *b, void *c, int64_t lda, int64_t ldb, int64_t ldc, int64_t br_stride_a,
                             int64_t br_stride_b);
 
+  /*
+   * Kernel type of kernels with a bias epilogue.
+   * The kernel takes the parameters of kernel_t followed by:
+   * - bias: pointer to the m row or n column bias values.
+   */
+  using kernel_bias_t = void (*)(void const *a, void const *b, void *c, int64_t lda, int64_t ldb, int64_t ldc, int64_t br_stride_a,
+                                 int64_t br_stride_b, void const *bias);
+
+  /*
+   * Kernel type of kernels with an address batch-reduce.
+   * The kernel takes the following parameters:
+   * - a: array of br_size pointers to the column-major A matrices.
+   * - b: array of br_size pointers to the column-major B matrices.
+   * - c: pointer to the column-major C matrix.
+   * - lda: leading dimension of A.
+   * - ldb: leading dimension of B.
+   * - ldc: leading dimension of C.
+   */
+  using kernel_address_t = void (*)(void const *const *a, void const *const *b, void *c, int64_t lda, int64_t ldb, int64_t ldc);
+
+  /*
+   * Kernel type of kernels with an offset batch-reduce.
+   * The kernel takes the parameters of kernel_t with the strides replaced by:
+   * - offsets_a: array of br_size offsets of the A matrices from a (in elements, not bytes).
+   * - offsets_b: array of br_size offsets of the B matrices from b (in elements, not bytes).
+   */
+  using kernel_offset_t = void (*)(void const *a, void const *b, void *c, int64_t lda, int64_t ldb, int64_t ldc, int64_t const *offsets_a,
+                                   int64_t const *offsets_b);
+
+  /// operations applied to C before it is stored
+  using epilogue_t = kernels::epilogue_t;
+
+  /// bias of the epilogue
+  using bias_t = kernels::bias_t;
+
+  /// activation of the epilogue
+  using activation_t = kernels::activation_t;
+
+  /// requantization of the int8 kernels
+  using requantize_t = kernels::requantize_t;
+
+  /// software prefetches of the kernel
+  using prefetch_t = kernels::prefetch_t;
+
+  /// location of the A and B matrices of the batch
+  using batch_reduce_t = kernels::batch_reduce_t;
+
+  /// packed operands, see Packing
+  using packing_t = kernels::packing_t;
+
   /// data type
   enum class dtype_t : uint32_t
   {
     fp32 = 0,
-    fp64 = 1
+    fp64 = 1,
+    bf16 = 2,       // bfloat16 A and B accumulated into a single-precision C, requires Cpu::has_bf16
+    s8 = 3,         // signed int8 A and B accumulated into an int32 C, requires Cpu::has_i8mm or Cpu::has_dotprod
+    u8 = 4,         // unsigned int8 A and B accumulated into an int32 C, requires Cpu::has_i8mm or Cpu::has_dotprod
+    fp16 = 5,       // half-precision A, B and C accumulated in half precision, requires Cpu::has_fp16
+    fp16_fp32 = 6,  // half-precision A, B and C accumulated in single precision
   };
 
   /// error codes
@@ -43,8 +103,52 @@ public:
     err_wrong_dimension = 2,
     err_row_major_order_not_supported = 3,
     err_batch_reduce_size_not_supported = 4,
+    err_wrong_tile = 5,
+    err_batch_reduce_type_not_supported = 6,
+    err_packing_not_supported = 7,
   };
 
+  /**
+   * Register block of the micro-kernel.
+   * All NEON kernels are generated by br_matmul_mr_nr_k, the default tile {0, 0} selects default_fp32_tile or default_fp64_tile.
+   * Only a default tile supports dimensions that are not multiples of the tile, the remaining rows and columns use smaller blocks.
+   * If SVE is enabled, see Cpu::is_sve_enabled, the default tile of a column-major stride batch-reduce with an alpha of one, a beta of
+   * zero or one and no epilogue, prefetch or packing selects the vector-length agnostic br_matmul_sve kernel instead.
+   * The bf16 kernels are generated by br_matmul_bf16 with default_bf16_tile, which handles all dimensions.
+   * The int8 kernels are generated by br_matmul_int8 with default_int8_tile, with smmla or ummla if Cpu::has_i8mm and sdot or udot
+   * otherwise.
+   * The fp16 kernels are generated by br_matmul_fp16 with default_fp16_tile or default_fp16_fp32_tile, which handle all dimensions.
+   */
+  struct tile_t
+  {
+    //! rows of the register block, a multiple of 4 for fp32 and of 2 for fp64
+    uint32_t m = 0;
+
+    //! columns of the register block
+    uint32_t n = 0;
+
+    bool operator==(tile_t const &) const = default;
+  };
+
+  //! register block of the fp64 kernels if no tile is given, 4 x 6 accumulators of two doubles each
+  static constexpr tile_t default_fp64_tile = {8, 6};
+
+  //! register block of the fp32 kernels if no tile is given, 4 x 4 accumulators of four floats each
+  static constexpr tile_t default_fp32_tile = {16, 4};
+
+  //! register block of the bf16 kernels, 4 x 4 accumulators of a 2x2 block each, the only tile of bf16
+  static constexpr tile_t default_bf16_tile = {8, 8};
+
+  //! register block of the int8 kernels, 2 x 8 accumulators of four rows or 4 x 4 accumulators of a 2x2 block, the only tile of int8
+  static constexpr tile_t default_int8_tile = {8, 8};
+
+  //! register block of the fp16 kernels with half-precision accumulators, 2 x 8 accumulators of eight halves each, the only tile of fp16
+  static constexpr tile_t default_fp16_tile = {16, 8};
+
+  //! register block of the fp16 kernels with single-precision accumulators, 4 x 4 accumulators of four floats each, the only tile of
+  //! fp16_fp32
+  static constexpr tile_t default_fp16_fp32_tile = {16, 4};
+
   /**
    * @brief Generate a kernel for batch-reduce matrix multiplication.
    * @param m number of rows in A and C.
@@ -54,18 +158,91 @@ public:
    * @param trans_a 0 if A is stored in column-major order, 1 if A is stored in row-major order.
    * @param trans_b 0 if B is stored in column-major order, 1 if B is stored in row-major order.
    * @param trans_c 0 if C is stored in column-major order, 1 if C is stored in row-major order.
-   * @param dtype data type of the matrices.
+   * @param dtype data type of the matrices, bf16, s8 and u8 require packed A and B in the interleaved layout of Packing, column-major
+   *              operands, an alpha of one, a beta of zero or one and no prefetch or batch list. Only s8 and u8 support an epilogue,
+   *              which is the requantization of the int32 C to an int8 C with a beta of zero. fp16 and fp16_fp32 require column-major
+   *              operands without packing, an alpha of one, a beta of zero or one and no epilogue, prefetch or batch list.
+   * @param alpha scaling of the product, i.e. C := alpha * sum_i(A_i * B_i) + beta * C.
+   * @param beta scaling of C, zero overwrites C without loading it.
+   * @param epilogue bias and activation applied to the result, a bias requires the kernel of get_kernel_bias. The requantization
+   *                 requires s8 or u8.
+   * @param prefetch software prefetches of A, B and the next C block, none by default.
+   * @param batch_reduce location of the A and B matrices, an address or offset batch-reduce requires the kernel of get_kernel_address or
+   *                     get_kernel_offset and does not support a bias.
+   * @param packing packed operands, a packed A requires trans_a = 0 and a packed B requires trans_b = 1 and trans_a = trans_c = 0.
+   *                The strips have the size of the tile, the leading dimensions passed to the kernel are tile.m and tile.n.
    * @return error_t::success on success, another error_t value otherwise.
    **/
   error_t generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a, uint32_t trans_b, uint32_t trans_c,
-                   dtype_t dtype);
+                   dtype_t dtype, double alpha = 1, double beta = 1, epilogue_t epilogue = {}, prefetch_t prefetch = {},
+                   batch_reduce_t batch_reduce = batch_reduce_t::stride, packing_t packing = {});
 
   /**
-   * @brief Get the generated kernel: C += sum_i(A_i * B_i).
+   * @brief Generate a kernel for batch-reduce matrix multiplication with the given register block.
+   * The tile chosen by the BrgemmTuner is used by the overload without a tile.
+   * @param m number of rows in A and C.
+   * @param n number of columns in B and C.
+   * @param k number of columns in A and rows in B.
+   * @param br_size batch-reduce size.
+   * @param trans_a 0 if A is stored in column-major order, 1 if A is stored in row-major order.
+   * @param trans_b 0 if B is stored in column-major order, 1 if B is stored in row-major order.
+   * @param trans_c 0 if C is stored in column-major order, 1 if C is stored in row-major order.
+   * @param dtype data type of the matrices, bf16, s8 and u8 require packed A and B in the interleaved layout of Packing, column-major
+   *              operands, an alpha of one, a beta of zero or one and no prefetch or batch list. Only s8 and u8 support an epilogue,
+   *              which is the requantization of the int32 C to an int8 C with a beta of zero. fp16 and fp16_fp32 require column-major
+   *              operands without packing, an alpha of one, a beta of zero or one and no epilogue, prefetch or batch list.
+   * @param tile register block of the micro-kernel, must divide m and n. The only tiles of bf16, int8, fp16 and fp16_fp32 are
+   *             default_bf16_tile, default_int8_tile, default_fp16_tile and default_fp16_fp32_tile.
+   *             Blocks the columns and rows of C for at least two transposed operands.
+   * @param alpha scaling of the product, i.e. C := alpha * sum_i(A_i * B_i) + beta * C.
+   * @param beta scaling of C, zero overwrites C without loading it.
+   * @param epilogue bias and activation applied to the result, a bias requires the kernel of get_kernel_bias. The requantization
+   *                 requires s8 or u8.
+   * @param prefetch software prefetches of A, B and the next C block, none by default.
+   * @param batch_reduce location of the A and B matrices, an address or offset batch-reduce requires the kernel of get_kernel_address or
+   *                     get_kernel_offset and does not support a bias.
+   * @param packing packed operands, a packed A requires trans_a = 0 and a packed B requires trans_b = 1 and trans_a = trans_c = 0.
+   *                The strips have the size of the tile, the leading dimensions passed to the kernel are tile.m and tile.n.
+   * @return error_t::success on success, another error_t value otherwise.
+   **/
+  error_t generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a, uint32_t trans_b, uint32_t trans_c,
+                   dtype_t dtype, tile_t tile, double alpha = 1, double beta = 1, epilogue_t epilogue = {}, prefetch_t prefetch = {},
+                   batch_reduce_t batch_reduce = batch_reduce_t::stride, packing_t packing = {});
+
+  /**
+   * @brief Checks if a register block can be used for a matrix multiplication.
+   * @param m number of rows in A and C.
+   * @param n number of columns in B and C.
+   * @param tile register block of the micro-kernel.
+   * @param dtype data type of the matrices.
+   * @return true if the tile is the default tile or fits into the registers and divides m and n.
+   **/
+  static bool is_valid_tile(uint32_t m, uint32_t n, tile_t tile, dtype_t dtype = dtype_t::fp32);
+
+  /**
+   * @brief Get the generated kernel: C := alpha * sum_i(A_i * B_i) + beta * C.
    * @return pointer to the generated kernel.
    **/
   kernel_t get_kernel() const;
 
+  /**
+   * @brief Get the generated kernel with a bias epilogue: C := act(alpha * sum_i(A_i * B_i) + beta * C + bias).
+   * @return pointer to the generated kernel.
+   **/
+  kernel_bias_t get_kernel_bias() const;
+
+  /**
+   * @brief Get the generated kernel with an address batch-reduce: C := alpha * sum_i(*a[i] * *b[i]) + beta * C.
+   * @return pointer to the generated kernel.
+   **/
+  kernel_address_t get_kernel_address() const;
+
+  /**
+   * @brief Get the generated kernel with an offset batch-reduce: C := alpha * sum_i(A_{offsets_a[i]} * B_{offsets_b[i]}) + beta * C.
+   * @return pointer to the generated kernel.
+   **/
+  kernel_offset_t get_kernel_offset() const;
+
   /**
    * @brief Writes the current kernel into a file.
    *
@@ -75,28 +252,7 @@ public:
 
 private:
   kernel_t kernel = nullptr;
-  mini_jit::Kernel native_kernel;
-
-  /**
-   * @brief Fills the kernel with a suitable matmul with no batch size, column major format, and fp32 datatypes
-   *
-   * @param Kernel The kernel to add instructions too.
-   * @param m number of rows in A and C.
-   * @param n number of columns in B and C.
-   * @param k number of columns in A and rows in B.
-   */
-  void fill_with_matmuls_no_batch_dim_column_major_fp32(uint32_t m, uint32_t n, uint32_t k);
-
-  /**
-   * @brief Fills the kernel with a suitable matmul with no batch size, column major format, and fp32 datatypes
-   *
-   * @param Kernel The kernel to add instructions too.
-   * @param m number of rows in A and C.
-   * @param n number of columns in B and C.
-   * @param k number of columns in A and rows in B.
-   * @param br_size number of batch dimensions.
-   */
-  void fill_with_matmuls_batch_dim_column_major_fp32(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size);
+  std::shared_ptr<mini_jit::Kernel> native_kernel;
 };
 
 #endif
\ No newline at end of file
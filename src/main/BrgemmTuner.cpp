@@ -0,0 +1,200 @@
+#include "BrgemmTuner.h"
+#include "kernels/br_matmul_mr_nr_k.h"
+#include "release_assert.h"
+#include <bit>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <limits>
+
+namespace
+{
+  //! rows of the register blocks that are tried, the vector registers hold 4 floats
+  constexpr uint32_t candidate_rows[] = {4, 8, 12, 16, 20, 24};
+
+  /**
+   * Checks if an environment flag is set to 1.
+   */
+  bool get_environment_flag(char const *variable)
+  {
+    char const *value = std::getenv(variable);
+    return value != nullptr && std::strcmp(value, "1") == 0;
+  }
+}  // namespace
+
+mini_jit::BrgemmTuner &mini_jit::BrgemmTuner::instance()
+{
+  static BrgemmTuner tuner(get_environment_flag(enable_environment_variable));
+  return tuner;
+}
+
+std::vector<mini_jit::Brgemm::tile_t> mini_jit::BrgemmTuner::get_candidates(uint32_t m, uint32_t n)
+{
+  std::vector<Brgemm::tile_t> candidates = {Brgemm::tile_t{}};
+  for (uint32_t rows : candidate_rows)
+  {
+    if (m % rows != 0)
+    {
+      continue;
+    }
+
+    for (uint32_t columns = kernels::br_matmul_mr_nr_k_max_nr(rows); columns > 0; --columns)
+    {
+      if (n % columns == 0)
+      {
+        candidates.push_back(Brgemm::tile_t{rows, columns});
+        break;
+      }
+    }
+  }
+
+  return candidates;
+}
+
+std::string mini_jit::BrgemmTuner::get_shape_class(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size)
+{
+  return std::format("m{}_n{}_k{}_br{}", m, n, std::bit_ceil(k), br_size);
+}
+
+double mini_jit::BrgemmTuner::measure(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, Brgemm::tile_t tile, double min_time_seconds)
+{
+  Brgemm brgemm;
+  Brgemm::error_t error = brgemm.generate(m, n, k, br_size, 0, 0, 0, Brgemm::dtype_t::fp32, tile);
+  release_assert(error == Brgemm::error_t::success, "The candidate tile could not be generated.");
+  Brgemm::kernel_t kernel = brgemm.get_kernel();
+
+  // Zeros keep the accumulated values finite over all repetitions
+  std::vector<float> a(static_cast<std::size_t>(m) * k * br_size, 0);
+  std::vector<float> b(static_cast<std::size_t>(k) * n * br_size, 0);
+  std::vector<float> c(static_cast<std::size_t>(m) * n, 0);
+
+  // Warm up the caches and the branch predictor
+  kernel(a.data(), b.data(), c.data(), m, k, m, m * k, k * n);
+
+  using clock = std::chrono::steady_clock;
+  for (uint64_t repetitions = 1;; repetitions *= 2)
+  {
+    clock::time_point start = clock::now();
+    for (uint64_t i = 0; i < repetitions; ++i)
+    {
+      kernel(a.data(), b.data(), c.data(), m, k, m, m * k, k * n);
+    }
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    if (seconds >= min_time_seconds)
+    {
+      return seconds / static_cast<double>(repetitions);
+    }
+  }
+}
+
+mini_jit::Brgemm::tile_t mini_jit::BrgemmTuner::get_tile(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = tiles.find(get_shape_class(m, n, k, br_size));
+    if (found != tiles.end())
+    {
+      return found->second;
+    }
+    if (!enabled || br_size == 0)
+    {
+      return Brgemm::tile_t{};
+    }
+  }
+
+  return tune(m, n, k, br_size);
+}
+
+mini_jit::Brgemm::tile_t mini_jit::BrgemmTuner::tune(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size)
+{
+  std::string shape_class = get_shape_class(m, n, k, br_size);
+  double min_time = 0;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    // Another thread may have tuned the shape class while waiting for the lock or still benchmarks it
+    tuned.wait(lock, [&]() { return !in_flight.contains(shape_class); });
+    auto found = tiles.find(shape_class);
+    if (found != tiles.end())
+    {
+      return found->second;
+    }
+
+    in_flight.insert(shape_class);
+    min_time = min_time_seconds;
+  }
+
+  // Benchmark without the lock, lookups and the tuning of other shape classes must not wait for the measurements
+  Brgemm::tile_t best_tile;
+  try
+  {
+    double best_seconds = std::numeric_limits<double>::max();
+    for (Brgemm::tile_t tile : get_candidates(m, n))
+    {
+      double seconds = measure(m, n, k, br_size, tile, min_time);
+      if (seconds < best_seconds)
+      {
+        best_seconds = seconds;
+        best_tile = tile;
+      }
+    }
+  }
+  catch (...)
+  {
+    // release the shape class, otherwise the threads waiting for it would never wake up
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      in_flight.erase(shape_class);
+    }
+    tuned.notify_all();
+    throw;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tiles[shape_class] = best_tile;
+    in_flight.erase(shape_class);
+  }
+  tuned.notify_all();
+  return best_tile;
+}
+
+void mini_jit::BrgemmTuner::set_tile(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, Brgemm::tile_t tile)
+{
+  release_assert(Brgemm::is_valid_tile(m, n, tile), "The tile is not valid for the matrix multiplication.");
+
+  std::lock_guard<std::mutex> lock(mutex);
+  tiles[get_shape_class(m, n, k, br_size)] = tile;
+}
+
+void mini_jit::BrgemmTuner::set_enabled(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->enabled = enabled;
+}
+
+bool mini_jit::BrgemmTuner::is_enabled() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return enabled;
+}
+
+void mini_jit::BrgemmTuner::set_min_time(double min_time_seconds)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->min_time_seconds = min_time_seconds;
+}
+
+void mini_jit::BrgemmTuner::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  tiles.clear();
+}
+
+std::size_t mini_jit::BrgemmTuner::get_size() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return tiles.size();
+}
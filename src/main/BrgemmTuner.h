@@ -0,0 +1,176 @@
+#ifndef MINI_JIT_BRGEMM_TUNER_H
+#define MINI_JIT_BRGEMM_TUNER_H
+
+#include "Brgemm.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace mini_jit
+{
+
+  /**
+   * Chooses the register block of the Brgemm micro-kernel by benchmarking the candidate tiles on the running machine.
+   * The fastest tile is remembered per shape class, i.e. m, n, br_size and k rounded up to a power of two.
+   * Tuning is disabled by default, Brgemm then uses the default tile unless a tile was set explicitly.
+   */
+  class BrgemmTuner
+  {
+  public:
+    //! environment variable that enables tuning of the process-wide tuner if set to 1
+    static constexpr char const *enable_environment_variable = "MLC_TUNE_BRGEMM";
+
+    //! minimum measured time per candidate in seconds
+    static constexpr double default_min_time_seconds = 0.002;
+
+  private:
+    //! guards all members below, not held while the candidates are benchmarked
+    mutable std::mutex mutex;
+
+    //! notified when a thread finished benchmarking a shape class
+    std::condition_variable tuned;
+
+    //! chosen tile by shape class
+    std::unordered_map<std::string, Brgemm::tile_t> tiles;
+
+    //! shape classes whose candidates are benchmarked by a thread, each shape class is measured once
+    std::unordered_set<std::string> in_flight;
+
+    //! unknown shape classes are tuned if enabled
+    bool enabled = false;
+
+    //! minimum measured time per candidate in seconds
+    double min_time_seconds = default_min_time_seconds;
+
+  public:
+    /**
+     * Constructor
+     *
+     * @param enabled true to tune unknown shape classes.
+     **/
+    explicit BrgemmTuner(bool enabled = false) : enabled(enabled) {};
+
+    BrgemmTuner(BrgemmTuner const &) = delete;
+    BrgemmTuner &operator=(BrgemmTuner const &) = delete;
+    BrgemmTuner(BrgemmTuner &&) noexcept = delete;
+    BrgemmTuner &operator=(BrgemmTuner &&) noexcept = delete;
+
+    /**
+     * Gets the process-wide tuner used by Brgemm.
+     * Tuning is enabled if the environment variable MLC_TUNE_BRGEMM is set to 1.
+     *
+     * @return the process-wide tuner.
+     **/
+    static BrgemmTuner &instance();
+
+    /**
+     * Gets the candidate tiles of a matrix multiplication, the default tile is always the first candidate.
+     * For each number of rows that divides m, the widest tile whose columns divide n and that fits into the registers is a candidate.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @return the candidate tiles.
+     **/
+    static std::vector<Brgemm::tile_t> get_candidates(uint32_t m, uint32_t n);
+
+    /**
+     * Gets the shape class under which the tile of a matrix multiplication is remembered.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @param k number of columns in A and rows in B.
+     * @param br_size batch-reduce size.
+     * @return unique description of the shape class.
+     **/
+    static std::string get_shape_class(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size);
+
+    /**
+     * Measures the time of a single call of the kernel generated with the given tile.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @param k number of columns in A and rows in B.
+     * @param br_size batch-reduce size.
+     * @param tile register block of the micro-kernel.
+     * @param min_time_seconds minimum time of the measurement.
+     * @return time per call in seconds.
+     **/
+    static double measure(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, Brgemm::tile_t tile, double min_time_seconds);
+
+    /**
+     * Gets the tile of the shape class of the matrix multiplication.
+     * An unknown shape class is tuned if tuning is enabled, otherwise the default tile is returned.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @param k number of columns in A and rows in B.
+     * @param br_size batch-reduce size.
+     * @return the tile to generate the kernel with.
+     **/
+    Brgemm::tile_t get_tile(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size);
+
+    /**
+     * Benchmarks all candidate tiles and remembers the fastest one for the shape class.
+     * The lock is only taken to claim and publish the shape class, a thread that asks for a shape class while another thread
+     * benchmarks it waits for the result.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @param k number of columns in A and rows in B.
+     * @param br_size batch-reduce size.
+     * @return the fastest tile.
+     **/
+    Brgemm::tile_t tune(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size);
+
+    /**
+     * Remembers a tile for the shape class of the matrix multiplication, e.g. from an earlier tuning run.
+     *
+     * @param m number of rows in A and C.
+     * @param n number of columns in B and C.
+     * @param k number of columns in A and rows in B.
+     * @param br_size batch-reduce size.
+     * @param tile register block of the micro-kernel, must be valid for m and n.
+     **/
+    void set_tile(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, Brgemm::tile_t tile);
+
+    /**
+     * Enables or disables tuning of unknown shape classes.
+     *
+     * @param enabled true to tune unknown shape classes.
+     **/
+    void set_enabled(bool enabled);
+
+    /**
+     * Checks if unknown shape classes are tuned.
+     *
+     * @return true if tuning is enabled.
+     **/
+    bool is_enabled() const;
+
+    /**
+     * Sets the minimum measured time per candidate.
+     *
+     * @param min_time_seconds time in seconds.
+     **/
+    void set_min_time(double min_time_seconds);
+
+    /**
+     * Forgets all remembered tiles.
+     **/
+    void clear();
+
+    /**
+     * Gets the number of remembered shape classes.
+     *
+     * @return number of shape classes.
+     **/
+    std::size_t get_size() const;
+  };
+
+}  // namespace mini_jit
+#endif
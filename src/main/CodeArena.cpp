@@ -0,0 +1,294 @@
+#include "CodeArena.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+mini_jit::CodeArena::~CodeArena() noexcept
+{
+  for (Region const &region : regions)
+  {
+    unmap_region(region);
+  }
+}
+
+mini_jit::CodeArena &mini_jit::CodeArena::instance()
+{
+  // never destroyed, kernels of other static objects may be released during exit
+  static CodeArena *arena = new CodeArena();
+  return *arena;
+}
+
+char *mini_jit::CodeArena::reserve_region(std::size_t size_bytes, int protection) const
+{
+  // huge pages require a region aligned to the huge page size, hence map more and trim the ends
+  std::size_t size_map = use_huge_pages ? size_bytes + region_size : size_bytes;
+  void *memory = mmap(0, size_map, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)
+  {
+    throw std::runtime_error("Failed to allocate code region: " + std::string(std::strerror(errno)));
+  }
+
+  char *start = reinterpret_cast<char *>(memory);
+  if (!use_huge_pages)
+  {
+    return start;
+  }
+
+  char *aligned = reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(start) + region_size - 1) / region_size * region_size);
+  if (aligned != start)
+  {
+    munmap(start, aligned - start);
+  }
+  munmap(aligned + size_bytes, (start + size_map) - (aligned + size_bytes));
+  return aligned;
+}
+
+mini_jit::CodeArena::Region mini_jit::CodeArena::map_region_dual(std::size_t size_bytes) const
+{
+  Region region;
+  region.size = size_bytes;
+
+  int file = memfd_create("mini_jit_code", MFD_CLOEXEC);
+  if (file == -1)
+  {
+    return region;
+  }
+
+  if (ftruncate(file, static_cast<off_t>(size_bytes)) == -1)
+  {
+    close(file);
+    return region;
+  }
+
+  void *writable = mmap(0, size_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  if (writable == MAP_FAILED)
+  {
+    close(file);
+    return region;
+  }
+
+  // replace the reserved range by the executable view of the same file
+  char *reserved = reserve_region(size_bytes, PROT_READ | PROT_EXEC);
+  void *executable = mmap(reserved, size_bytes, PROT_READ | PROT_EXEC, MAP_SHARED | MAP_FIXED, file, 0);
+  close(file);
+  if (executable == MAP_FAILED)
+  {
+    munmap(reserved, size_bytes);
+    munmap(writable, size_bytes);
+    return region;
+  }
+
+  region.memory = reinterpret_cast<char *>(executable);
+  region.memory_writable = reinterpret_cast<char *>(writable);
+  return region;
+}
+
+mini_jit::CodeArena::Region mini_jit::CodeArena::map_region(std::size_t min_size_bytes) const
+{
+  std::size_t size = (min_size_bytes + region_size - 1) / region_size * region_size;
+
+  Region region;
+  if (use_dual_mapping)
+  {
+    region = map_region_dual(size);
+  }
+
+  // fall back to a single writable mapping whose pages are sealed executable kernel by kernel, e.g. if memfd_create is not permitted
+  if (region.memory == nullptr)
+  {
+    region.memory = reserve_region(size, PROT_READ | PROT_WRITE);
+    region.memory_writable = nullptr;
+    region.size = size;
+  }
+
+#ifdef MADV_HUGEPAGE
+  if (use_huge_pages)
+  {
+    madvise(region.memory, region.size, MADV_HUGEPAGE);  // only a hint, falls back to regular pages
+  }
+#endif
+
+  return region;
+}
+
+void mini_jit::CodeArena::unmap_region(Region const &region)
+{
+  munmap(region.memory, region.size);
+  if (region.memory_writable != nullptr)
+  {
+    munmap(region.memory_writable, region.size);
+  }
+}
+
+std::size_t mini_jit::CodeArena::find_region(void const *memory) const
+{
+  char const *entry = reinterpret_cast<char const *>(memory);
+  for (std::size_t i = 0; i < regions.size(); ++i)
+  {
+    if (entry >= regions[i].memory && entry < regions[i].memory + regions[i].size)
+    {
+      return i;
+    }
+  }
+
+  throw std::logic_error("Memory is not part of the code arena.");
+}
+
+void mini_jit::CodeArena::protect(char *begin, std::size_t size_bytes, int protection)
+{
+  uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  uintptr_t page_begin = reinterpret_cast<uintptr_t>(begin) / page_size * page_size;
+  uintptr_t page_end = (reinterpret_cast<uintptr_t>(begin) + size_bytes + page_size - 1) / page_size * page_size;
+
+  if (mprotect(reinterpret_cast<void *>(page_begin), page_end - page_begin, protection) == -1)
+  {
+    throw std::runtime_error("Failed to change the protection of a code region: " + std::string(std::strerror(errno)));
+  }
+}
+
+void mini_jit::CodeArena::copy_code(Region const &region, char *destination, void const *code, std::size_t size_bytes)
+{
+  if (region.memory_writable != nullptr)
+  {
+    std::memcpy(region.memory_writable + (destination - region.memory), code, size_bytes);
+    __builtin___clear_cache(destination, destination + size_bytes);
+    return;
+  }
+
+  // the pages of a single mapping belong to one kernel, which is not executed while it is written
+  protect(destination, size_bytes, PROT_READ | PROT_WRITE);
+  std::memcpy(destination, code, size_bytes);
+  protect(destination, size_bytes, PROT_READ | PROT_EXEC);
+
+  __builtin___clear_cache(destination, destination + size_bytes);
+}
+
+void *mini_jit::CodeArena::allocate(void const *code, std::size_t size_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // sealed pages of a single mapping are never written again, hence its kernels start on a new page
+  std::size_t offset = 0;
+  if (!regions.empty())
+  {
+    std::size_t alignment =
+      regions.back().memory_writable != nullptr ? entry_alignment : static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    offset = (regions.back().used + alignment - 1) / alignment * alignment;
+  }
+
+  if (regions.empty() || offset + size_bytes > regions.back().size)
+  {
+    if (!regions.empty() && regions.back().live_allocations == 0)
+    {
+      unmap_region(regions.back());
+      regions.pop_back();
+    }
+
+    regions.push_back(map_region(size_bytes));
+    offset = 0;
+  }
+
+  Region &region = regions.back();
+  char *entry = region.memory + offset;
+  if (region.memory_writable != nullptr)
+  {
+    copy_code(region, entry, code, size_bytes);
+  }
+  else
+  {
+    std::memcpy(entry, code, size_bytes);
+    protect(entry, size_bytes, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache(entry, entry + size_bytes);
+  }
+  region.used = offset + size_bytes;
+  ++region.live_allocations;
+
+  return entry;
+}
+
+void mini_jit::CodeArena::write(void *memory, std::size_t offset_bytes, void const *code, std::size_t size_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Region const &region = regions[find_region(memory)];
+  char *destination = reinterpret_cast<char *>(memory) + offset_bytes;
+  if (destination + size_bytes > region.memory + region.size)
+  {
+    throw std::logic_error("Write exceeds the code region.");
+  }
+
+  copy_code(region, destination, code, size_bytes);
+}
+
+void mini_jit::CodeArena::release(void const *memory)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::size_t index = find_region(memory);
+  Region &region = regions[index];
+
+  --region.live_allocations;
+  if (region.live_allocations == 0)
+  {
+    if (index + 1 == regions.size() && region.memory_writable != nullptr)
+    {
+      region.used = 0;  // keep the active region for the next kernels, the sealed pages of a single mapping are not reused
+    }
+    else
+    {
+      unmap_region(region);
+      regions.erase(regions.begin() + index);
+    }
+  }
+}
+
+void mini_jit::CodeArena::set_enabled(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->enabled = enabled;
+}
+
+bool mini_jit::CodeArena::is_enabled() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return enabled;
+}
+
+void mini_jit::CodeArena::set_use_dual_mapping(bool use_dual_mapping)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->use_dual_mapping = use_dual_mapping;
+}
+
+bool mini_jit::CodeArena::is_dual_mapped(void const *memory) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return regions[find_region(memory)].memory_writable != nullptr;
+}
+
+void mini_jit::CodeArena::set_use_huge_pages(bool use_huge_pages)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->use_huge_pages = use_huge_pages;
+}
+
+std::size_t mini_jit::CodeArena::get_region_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return regions.size();
+}
+
+std::size_t mini_jit::CodeArena::get_used_bytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::size_t used = 0;
+  for (Region const &region : regions)
+  {
+    used += region.used;
+  }
+  return used;
+}
@@ -0,0 +1,231 @@
+#ifndef MINI_JIT_CODE_ARENA_H
+#define MINI_JIT_CODE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mini_jit
+{
+
+  class CodeArena
+  {
+  public:
+    //! size of a region, matches the size of a huge page
+    static constexpr std::size_t region_size = 2 * 1024 * 1024;
+
+    //! alignment of each kernel entry point, matches the size of a cache line
+    static constexpr std::size_t entry_alignment = 64;
+
+  private:
+    struct Region
+    {
+      //! start of the executable view
+      char *memory = nullptr;
+
+      //! start of the writable view of the same memory, nullptr if the region is not dual-mapped
+      char *memory_writable = nullptr;
+
+      //! size of the mapping in bytes
+      std::size_t size = 0;
+
+      //! offset of the next free byte
+      std::size_t used = 0;
+
+      //! number of kernels that are still alive in the region
+      std::size_t live_allocations = 0;
+    };
+
+    //! guards all members below
+    mutable std::mutex mutex;
+
+    //! all mapped regions, the last region is used for new allocations
+    std::vector<Region> regions;
+
+    //! kernels are placed into the arena if enabled, otherwise each kernel has its own mapping
+    bool enabled = true;
+
+    //! maps new regions twice, once writable and once executable
+    bool use_dual_mapping = true;
+
+    //! requests transparent huge pages for new regions
+#ifdef MLC_USE_HUGE_PAGES
+    bool use_huge_pages = true;
+#else
+    bool use_huge_pages = false;
+#endif
+
+    /**
+     * Maps a new region.
+     * The caller must hold the mutex.
+     *
+     * @param min_size_bytes minimum number of usable bytes.
+     * @return the mapped region.
+     **/
+    Region map_region(std::size_t min_size_bytes) const;
+
+    /**
+     * Reserves an address range for a region.
+     *
+     * @param size_bytes size of the region.
+     * @param protection initial protection of the pages, e.g. PROT_READ | PROT_EXEC for the executable view.
+     * @return start of the reserved address range.
+     **/
+    char *reserve_region(std::size_t size_bytes, int protection) const;
+
+    /**
+     * Maps a memory file with a read/write view and a read/execute view of the same pages.
+     * Returns a region without executable view if memory files are not available.
+     *
+     * @param size_bytes size of the region.
+     * @return the mapped region.
+     **/
+    Region map_region_dual(std::size_t size_bytes) const;
+
+    /**
+     * Finds the region containing the given executable address.
+     * The caller must hold the mutex.
+     *
+     * @param memory executable address.
+     * @return index of the region.
+     **/
+    std::size_t find_region(void const *memory) const;
+
+    /**
+     * Releases the mapping of a region.
+     *
+     * @param region the region to release.
+     **/
+    static void unmap_region(Region const &region);
+
+    /**
+     * Changes the protection of all pages overlapping the given range.
+     *
+     * @param begin start of the range.
+     * @param size_bytes size of the range in bytes.
+     * @param protection new protection of the pages.
+     **/
+    static void protect(char *begin, std::size_t size_bytes, int protection);
+
+    /**
+     * Copies machine code into executable memory.
+     * Dual-mapped regions are written through the writable view.
+     * Otherwise the pages of the copied range are read/write while copying and read/execute afterwards.
+     * These pages belong to a single kernel, see allocate, no page is ever writable and executable.
+     *
+     * @param region region containing the destination.
+     * @param destination executable destination inside a region.
+     * @param code machine code to copy.
+     * @param size_bytes size of the machine code in bytes.
+     **/
+    static void copy_code(Region const &region, char *destination, void const *code, std::size_t size_bytes);
+
+  public:
+    /**
+     * Constructor
+     **/
+    CodeArena() {};
+
+    /**
+     * Destructor
+     **/
+    ~CodeArena() noexcept;
+
+    CodeArena(CodeArena const &) = delete;
+    CodeArena &operator=(CodeArena const &) = delete;
+    CodeArena(CodeArena &&) noexcept = delete;
+    CodeArena &operator=(CodeArena &&) noexcept = delete;
+
+    /**
+     * Gets the process-wide code arena used by all kernels.
+     *
+     * @return the process-wide code arena.
+     **/
+    static CodeArena &instance();
+
+    /**
+     * Copies the machine code into the arena and returns its executable entry point.
+     * The entry point is aligned to entry_alignment bytes.
+     * Dual-mapped regions are written without a syscall. Otherwise the region is mapped read/write, each kernel starts on a new page
+     * and its pages are sealed read/execute by a single mprotect, no page is ever writable and executable.
+     *
+     * @param code machine code to copy.
+     * @param size_bytes size of the machine code in bytes.
+     * @return executable entry point of the code.
+     **/
+    void *allocate(void const *code, std::size_t size_bytes);
+
+    /**
+     * Overwrites code previously returned by allocate, e.g. to patch immediates or to re-emit a kernel.
+     * The code must not be executed by another thread while it is written.
+     * The write must stay within the allocation of the code, a kernel without dual mapping is not executable while it is written.
+     *
+     * @param memory entry point returned by allocate.
+     * @param offset_bytes offset from the entry point in bytes.
+     * @param code machine code to copy.
+     * @param size_bytes size of the machine code in bytes.
+     **/
+    void write(void *memory, std::size_t offset_bytes, void const *code, std::size_t size_bytes);
+
+    /**
+     * Releases code previously returned by allocate.
+     * A region is unmapped in bulk once all of its kernels are released.
+     *
+     * @param memory entry point returned by allocate.
+     **/
+    void release(void const *memory);
+
+    /**
+     * Enables or disables the arena for newly generated kernels.
+     *
+     * @param enabled true to pack new kernels into the arena, false to map each kernel separately.
+     **/
+    void set_enabled(bool enabled);
+
+    /**
+     * Indicates if newly generated kernels are placed into the arena.
+     *
+     * @return true if the arena is enabled.
+     **/
+    bool is_enabled() const;
+
+    /**
+     * Enables or disables dual mapping for new regions.
+     *
+     * @param use_dual_mapping true to map new regions with a writable and a separate executable view.
+     **/
+    void set_use_dual_mapping(bool use_dual_mapping);
+
+    /**
+     * Indicates if the region containing the given code is dual-mapped.
+     *
+     * @param memory entry point returned by allocate.
+     * @return true if the code is written without changing page permissions.
+     **/
+    bool is_dual_mapped(void const *memory) const;
+
+    /**
+     * Requests transparent huge pages for new regions.
+     *
+     * @param use_huge_pages true to back new regions by huge pages if the system supports it.
+     **/
+    void set_use_huge_pages(bool use_huge_pages);
+
+    /**
+     * Gets the number of mapped regions.
+     *
+     * @return number of mapped regions.
+     **/
+    std::size_t get_region_count() const;
+
+    /**
+     * Gets the number of bytes occupied by kernels including alignment padding.
+     *
+     * @return number of occupied bytes.
+     **/
+    std::size_t get_used_bytes() const;
+  };
+
+}  // namespace mini_jit
+#endif
@@ -0,0 +1,143 @@
+#include "Cpu.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__) && defined(__aarch64__)
+#include <sys/auxv.h>
+#include <sys/prctl.h>
+
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
+#ifndef HWCAP_FPHP
+#define HWCAP_FPHP (1 << 9)
+#endif
+
+#ifndef HWCAP_ASIMDHP
+#define HWCAP_ASIMDHP (1 << 10)
+#endif
+
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 20)
+#endif
+
+#ifndef HWCAP2_I8MM
+#define HWCAP2_I8MM (1 << 13)
+#endif
+
+#ifndef HWCAP2_BF16
+#define HWCAP2_BF16 (1 << 14)
+#endif
+
+#ifndef PR_SVE_SET_VL
+#define PR_SVE_SET_VL 50
+#define PR_SVE_GET_VL 51
+#define PR_SVE_VL_LEN_MASK 0xffff
+#endif
+#define MINI_JIT_LINUX_AARCH64
+#endif
+
+namespace
+{
+  /**
+   * Checks if an environment flag is set to 1.
+   */
+  bool get_environment_flag(char const *variable)
+  {
+    char const *value = std::getenv(variable);
+    return value != nullptr && std::strcmp(value, "1") == 0;
+  }
+}  // namespace
+
+bool mini_jit::Cpu::has_sve()
+{
+#ifdef MINI_JIT_LINUX_AARCH64
+  return (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#else
+  return false;
+#endif
+}
+
+bool mini_jit::Cpu::is_sve_enabled()
+{
+  static const bool enabled = has_sve() && !get_environment_flag(disable_sve_environment_variable);
+  return enabled;
+}
+
+bool mini_jit::Cpu::has_bf16()
+{
+#ifdef MINI_JIT_LINUX_AARCH64
+  return (getauxval(AT_HWCAP2) & HWCAP2_BF16) != 0;
+#else
+  return false;
+#endif
+}
+
+bool mini_jit::Cpu::has_dotprod()
+{
+#ifdef MINI_JIT_LINUX_AARCH64
+  return (getauxval(AT_HWCAP) & HWCAP_ASIMDDP) != 0;
+#else
+  return false;
+#endif
+}
+
+bool mini_jit::Cpu::has_i8mm()
+{
+#ifdef MINI_JIT_LINUX_AARCH64
+  return (getauxval(AT_HWCAP2) & HWCAP2_I8MM) != 0;
+#else
+  return false;
+#endif
+}
+
+bool mini_jit::Cpu::has_fp16()
+{
+#ifdef MINI_JIT_LINUX_AARCH64
+  // The scalar and the vector half-precision arithmetic are implemented together
+  constexpr unsigned long fp16 = HWCAP_FPHP | HWCAP_ASIMDHP;
+  return (getauxval(AT_HWCAP) & fp16) == fp16;
+#else
+  return false;
+#endif
+}
+
+uint32_t mini_jit::Cpu::get_sve_vector_length()
+{
+  if (!has_sve())
+  {
+    return 0;
+  }
+#ifdef MINI_JIT_LINUX_AARCH64
+  int result = prctl(PR_SVE_GET_VL);
+  return result < 0 ? 0 : static_cast<uint32_t>(result & PR_SVE_VL_LEN_MASK);
+#else
+  return 0;
+#endif
+}
+
+bool mini_jit::Cpu::set_sve_vector_length(uint32_t bytes)
+{
+  if (!has_sve() || bytes == 0 || bytes % 16 != 0)
+  {
+    return false;
+  }
+#ifdef MINI_JIT_LINUX_AARCH64
+  // The kernel rounds an unsupported length down to a supported one
+  uint32_t previous = get_sve_vector_length();
+  int result = prctl(PR_SVE_SET_VL, bytes);
+  if (result < 0)
+  {
+    return false;
+  }
+  if (static_cast<uint32_t>(result & PR_SVE_VL_LEN_MASK) != bytes)
+  {
+    prctl(PR_SVE_SET_VL, previous);
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
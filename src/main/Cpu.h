@@ -0,0 +1,81 @@
+#ifndef MINI_JIT_CPU_H
+#define MINI_JIT_CPU_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+
+  /**
+   * Detects the features of the running processor that select between the backends of the generators.
+   * The Scalable Vector Extension (SVE) and the other optional extensions are detected through the hardware capabilities of the auxiliary
+   * vector on Linux, other systems are treated as NEON-only.
+   */
+  class Cpu
+  {
+  public:
+    //! environment variable that disables the SVE backend if set to 1
+    static constexpr char const *disable_sve_environment_variable = "MLC_DISABLE_SVE";
+
+    /**
+     * Checks if the processor implements SVE.
+     *
+     * @return true if SVE instructions can be executed.
+     **/
+    static bool has_sve();
+
+    /**
+     * Checks if the generators emit SVE kernels, i.e. SVE is implemented and not disabled by MLC_DISABLE_SVE.
+     *
+     * @return true if the SVE backend is used.
+     **/
+    static bool is_sve_enabled();
+
+    /**
+     * Checks if the processor implements the BFloat16 extension, i.e. the bfdot and bfmmla instructions.
+     *
+     * @return true if the bf16 kernels of Brgemm can be executed.
+     **/
+    static bool has_bf16();
+
+    /**
+     * Checks if the processor implements the dot product instructions sdot and udot.
+     *
+     * @return true if the int8 kernels of Brgemm can be executed.
+     **/
+    static bool has_dotprod();
+
+    /**
+     * Checks if the processor implements the Int8 matrix multiplication extension, i.e. the smmla and ummla instructions.
+     *
+     * @return true if the int8 kernels of Brgemm are generated with smmla and ummla instead of sdot and udot.
+     **/
+    static bool has_i8mm();
+
+    /**
+     * Checks if the processor implements the half-precision floating-point arithmetic of Armv8.2, i.e. fmla and fmax on .8h.
+     *
+     * @return true if the fp16 kernels of Brgemm with half-precision accumulators and the fp16 Unary kernels can be executed.
+     **/
+    static bool has_fp16();
+
+    /**
+     * Gets the SVE vector length of the calling thread.
+     *
+     * @return the vector length in bytes, 0 if SVE is not implemented.
+     **/
+    static uint32_t get_sve_vector_length();
+
+    /**
+     * Sets the SVE vector length of the calling thread, the generated SVE kernels are vector-length agnostic.
+     * The processor may only implement some vector lengths, the length is not changed if the requested one is unsupported.
+     *
+     * @param bytes vector length in bytes, a multiple of 16.
+     * @return true if the vector length of the calling thread is bytes afterwards.
+     **/
+    static bool set_sve_vector_length(uint32_t bytes);
+  };
+
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_CPU_H
@@ -182,6 +182,16 @@ const std::vector<int64_t> &mini_jit::EinsumTree::get_sorted_dim_sizes()
   return dim_sizes;
 }
 
+void mini_jit::EinsumTree::set_dtype(TensorConfig::dtype_t dtype)
+{
+  EinsumTree::dtype = dtype;
+}
+
+mini_jit::TensorConfig::dtype_t mini_jit::EinsumTree::get_dtype() const
+{
+  return dtype;
+}
+
 void mini_jit::EinsumTree::delete_tree(EinsumNode *node)
 {
   if (node == nullptr)
@@ -296,7 +306,7 @@ mini_jit::TensorConfig mini_jit::EinsumTree::lower_node(const EinsumNode *node)
       stridesIn0,                                                                   // strides_in0
       stridesIn1,                                                                   // strides_in1
       stridesOut,                                                                   // strides_out
-      TensorConfig::dtype_t::fp32                                                   // dtype_t
+      dtype,                                                                        // dtype_t
     };
     return config;
   }
@@ -321,7 +331,7 @@ mini_jit::TensorConfig mini_jit::EinsumTree::lower_node(const EinsumNode *node)
       stridesIn0,                                                                                 // strides_in0
       std::vector<int64_t>(node->output_dim_ids.size(), 0),  // strides_in1 (not used for transposition)
       compute_strides(node->output_dim_ids),                 // strides_out
-      TensorConfig::dtype_t::fp32                            // dtype_t
+      dtype,                                                 // dtype_t
     };
     return config;
   }
@@ -465,7 +475,7 @@ mini_jit::EinsumTree::ErrorExecute mini_jit::EinsumTree::execute(const std::vect
     return ErrorExecute::TooManyInputTensors;
   }
 
-  root->tensor = static_cast<float *>(tensors[tensors.size() - 1]);
+  root->tensor = static_cast<char *>(tensors[tensors.size() - 1]);
 
   // Recursive execution of the tree
   ErrorExecute error_execute = execute_node(tensors, root);
@@ -486,7 +496,7 @@ mini_jit::EinsumTree::ErrorExecute mini_jit::EinsumTree::execute_node(const std:
   if (node->type == NodeType::Leaf)
   {
     release_assert(node->input_tensor_index != -1, "Expected a input_tensor_index to be a valid index.");
-    node->tensor = static_cast<float *>(input_tensors[node->input_tensor_index]);
+    node->tensor = static_cast<char *>(input_tensors[node->input_tensor_index]);
 
     if (node->tensor == nullptr)
     {
@@ -510,7 +520,7 @@ mini_jit::EinsumTree::ErrorExecute mini_jit::EinsumTree::execute_node(const std:
     if (node->tensor == nullptr)
     {
       // Generate intermediate tensor.
-      node->tensor = new float[node->get_size(dim_sizes)]();
+      node->tensor = new char[node->get_size(dim_sizes) * TensorConfig::get_dtype_size(dtype)]();
     }
 
     if (node->tensor_op.getHasSetupError() == true)
@@ -545,7 +555,7 @@ mini_jit::EinsumTree::ErrorExecute mini_jit::EinsumTree::execute_node(const std:
     if (node->tensor == nullptr)
     {
       // Generate intermediate tensor.
-      node->tensor = new float[node->get_size(dim_sizes)]();
+      node->tensor = new char[node->get_size(dim_sizes) * TensorConfig::get_dtype_size(dtype)]();
     }
 
     if (node->tensor_op.getHasSetupError() == true)
@@ -807,6 +817,13 @@ void mini_jit::EinsumTree::reorder_left_node(EinsumNode *node)
     return;
   }
 
+  if (node->left->type == NodeType::Leaf && indexLeftMDim == static_cast<int32_t>(node->left->output_dim_ids.size()) - 2 &&
+      indexLeftKDim == static_cast<int32_t>(node->left->output_dim_ids.size()) - 1)
+  {
+    // The brgemm reads the row-major input directly, no need to copy the input tensor
+    return;
+  }
+
   std::vector<int64_t> reorderDimIds = node->left->output_dim_ids;  // copy
   // iter_swap -> swap values between two indices
   std::iter_swap(reorderDimIds.begin() + indexLeftMDim, reorderDimIds.begin() + node->left->output_dim_ids.size() - 1);
@@ -853,6 +870,13 @@ void mini_jit::EinsumTree::reorder_right_node(EinsumNode *node)
     return;
   }
 
+  if (node->right->type == NodeType::Leaf && indexRightKDim == static_cast<int32_t>(node->right->output_dim_ids.size()) - 2 &&
+      indexRightNDim == static_cast<int32_t>(node->right->output_dim_ids.size()) - 1)
+  {
+    // The brgemm reads the row-major input directly, no need to copy the input tensor
+    return;
+  }
+
   std::vector<int64_t> reorderDimIds = node->right->output_dim_ids;  // copy
   // iter_swap -> swap values between two indices
   std::iter_swap(reorderDimIds.begin() + indexRightKDim, reorderDimIds.begin() + node->right->output_dim_ids.size() - 1);
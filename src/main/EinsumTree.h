@@ -64,7 +64,7 @@ namespace mini_jit
     {
       NodeType type;
       int32_t input_tensor_index = -1;
-      float *tensor = nullptr;
+      char *tensor = nullptr;
       mini_jit::TensorOperation tensor_op;
 
       // Always filled — dims of the output tensor
@@ -109,6 +109,7 @@ namespace mini_jit
     const std::string tree_str;
     ErrorParse error_parse = ErrorParse::None;
     std::vector<int64_t> dim_sizes;
+    TensorConfig::dtype_t dtype = TensorConfig::dtype_t::fp32;
 
     // Parser
     /**
@@ -266,6 +267,15 @@ namespace mini_jit
 
     const std::vector<int64_t> &get_sorted_dim_sizes();
 
+    /**
+     * @brief Set the data type of the tensors the operators are generated for.
+     *
+     * @param dtype The data type of all tensors in the tree.
+     */
+    void set_dtype(TensorConfig::dtype_t dtype);
+
+    TensorConfig::dtype_t get_dtype() const;
+
     /**
      * Parses the einsum tree string and builds the tree structure.
      *
@@ -312,7 +322,7 @@ namespace mini_jit
 
     /**
      * Reorders left node of a contraction to ensure the 'km' dimensions are at the right.
-     * The 'm' dimension has unit-stride.
+     * The 'm' dimension has unit-stride. A leaf that ends with the 'mk' dimensions is kept as the brgemm reads it row-major.
      *
      * @param node The EinsumNode representing the parent child of the contraction.
      */
@@ -320,7 +330,7 @@ namespace mini_jit
 
     /**
      * Reorders right node of a contraction to ensure the 'nk' dimensions are at the right.
-     * The 'k' dimension has unit-stride.
+     * The 'k' dimension has unit-stride. A leaf that ends with the 'kn' dimensions is kept as the brgemm reads it row-major.
      *
      * @param node The EinsumNode representing the parent of the contraction.
      */
@@ -0,0 +1,223 @@
+#include "GdbJit.h"
+#include <cstring>
+#include <elf.h>
+
+extern "C"
+{
+  // GDB sets a breakpoint in this function and reads the descriptor whenever it is called.
+  // Both are weak, other JIT compilers in the same process share the same list.
+  __attribute__((weak, noinline, used)) void __jit_debug_register_code()
+  {
+    asm volatile("" ::: "memory");
+  }
+
+  __attribute__((weak, used)) jit_descriptor __jit_debug_descriptor = {1, 0, nullptr, nullptr};
+}
+
+namespace
+{
+  enum jit_actions_t : uint32_t
+  {
+    JIT_NOACTION = 0,
+    JIT_REGISTER_FN = 1,
+    JIT_UNREGISTER_FN = 2
+  };
+
+  //! section indices of the in-memory ELF file
+  enum section_t : uint16_t
+  {
+    section_null = 0,
+    section_text = 1,
+    section_symtab = 2,
+    section_strtab = 3,
+    section_shstrtab = 4,
+    section_count = 5
+  };
+
+  constexpr char section_names[] = "\0.text\0.symtab\0.strtab\0.shstrtab";
+
+  /**
+   * Appends the bytes of an object to an ELF file.
+   *
+   * @param file the ELF file.
+   * @param data object to append.
+   * @param size_bytes size of the object in bytes.
+   * @return offset of the object in the file.
+   */
+  uint64_t append(std::vector<char> &file, void const *data, std::size_t size_bytes)
+  {
+    uint64_t offset = file.size();
+    char const *bytes = reinterpret_cast<char const *>(data);
+    file.insert(file.end(), bytes, bytes + size_bytes);
+    return offset;
+  }
+}  // namespace
+
+mini_jit::GdbJit::~GdbJit() noexcept
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto &registration : registrations)
+  {
+    unlink(*registration.second);
+  }
+}
+
+mini_jit::GdbJit &mini_jit::GdbJit::instance()
+{
+  // never destroyed, kernels of other static objects may be released during exit
+  static GdbJit *gdb_jit = new GdbJit();
+  return *gdb_jit;
+}
+
+std::vector<char> mini_jit::GdbJit::create_symbol_file(std::string const &name, void const *code, std::size_t size_bytes)
+{
+  // same layout as used by LuaJIT: a relocatable file with a NOBITS .text section at the address of the code,
+  // GDB reads the instructions from the process memory
+  std::vector<char> file(sizeof(Elf64_Ehdr) + section_count * sizeof(Elf64_Shdr), 0);
+
+  Elf64_Shdr sections[section_count] = {};
+
+  sections[section_text].sh_name = 1;
+  sections[section_text].sh_type = SHT_NOBITS;
+  sections[section_text].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+  sections[section_text].sh_addr = reinterpret_cast<uintptr_t>(code);
+  sections[section_text].sh_size = size_bytes;
+  sections[section_text].sh_addralign = 4;
+
+  std::vector<char> strings(1, '\0');
+  strings.insert(strings.end(), name.begin(), name.end());
+  strings.push_back('\0');
+  sections[section_strtab].sh_name = 15;
+  sections[section_strtab].sh_type = SHT_STRTAB;
+  sections[section_strtab].sh_offset = append(file, strings.data(), strings.size());
+  sections[section_strtab].sh_size = strings.size();
+  sections[section_strtab].sh_addralign = 1;
+
+  sections[section_shstrtab].sh_name = 23;
+  sections[section_shstrtab].sh_type = SHT_STRTAB;
+  sections[section_shstrtab].sh_offset = append(file, section_names, sizeof(section_names));
+  sections[section_shstrtab].sh_size = sizeof(section_names);
+  sections[section_shstrtab].sh_addralign = 1;
+
+  file.resize((file.size() + 7) / 8 * 8, 0);
+
+  Elf64_Sym symbols[2] = {};
+  symbols[1].st_name = 1;
+  symbols[1].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_FUNC);
+  symbols[1].st_shndx = section_text;
+  symbols[1].st_value = 0;  // relative to .text
+  symbols[1].st_size = size_bytes;
+  sections[section_symtab].sh_name = 7;
+  sections[section_symtab].sh_type = SHT_SYMTAB;
+  sections[section_symtab].sh_offset = append(file, symbols, sizeof(symbols));
+  sections[section_symtab].sh_size = sizeof(symbols);
+  sections[section_symtab].sh_link = section_strtab;
+  sections[section_symtab].sh_info = 1;  // index of the first global symbol
+  sections[section_symtab].sh_addralign = 8;
+  sections[section_symtab].sh_entsize = sizeof(Elf64_Sym);
+
+  Elf64_Ehdr header = {};
+  std::memcpy(header.e_ident, ELFMAG, SELFMAG);
+  header.e_ident[EI_CLASS] = ELFCLASS64;
+  header.e_ident[EI_DATA] = ELFDATA2LSB;
+  header.e_ident[EI_VERSION] = EV_CURRENT;
+  header.e_ident[EI_OSABI] = ELFOSABI_NONE;
+  header.e_type = ET_REL;
+  header.e_machine = EM_AARCH64;
+  header.e_version = EV_CURRENT;
+  header.e_shoff = sizeof(Elf64_Ehdr);
+  header.e_ehsize = sizeof(Elf64_Ehdr);
+  header.e_shentsize = sizeof(Elf64_Shdr);
+  header.e_shnum = section_count;
+  header.e_shstrndx = section_shstrtab;
+
+  std::memcpy(file.data(), &header, sizeof(header));
+  std::memcpy(file.data() + sizeof(header), sections, sizeof(sections));
+  return file;
+}
+
+void mini_jit::GdbJit::unlink(Registration &registration)
+{
+  jit_code_entry *entry = &registration.entry;
+  if (entry->prev_entry != nullptr)
+  {
+    entry->prev_entry->next_entry = entry->next_entry;
+  }
+  else
+  {
+    __jit_debug_descriptor.first_entry = entry->next_entry;
+  }
+  if (entry->next_entry != nullptr)
+  {
+    entry->next_entry->prev_entry = entry->prev_entry;
+  }
+
+  __jit_debug_descriptor.relevant_entry = entry;
+  __jit_debug_descriptor.action_flag = JIT_UNREGISTER_FN;
+  __jit_debug_register_code();
+  __jit_debug_descriptor.action_flag = JIT_NOACTION;
+}
+
+void mini_jit::GdbJit::add(std::string const &name, void const *code, std::size_t size_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!enabled || code == nullptr || size_bytes == 0)
+  {
+    return;
+  }
+
+  // re-emitted kernels replace their previous registration
+  auto found = registrations.find(code);
+  if (found != registrations.end())
+  {
+    unlink(*found->second);
+    registrations.erase(found);
+  }
+
+  std::unique_ptr<Registration> registration = std::make_unique<Registration>();
+  registration->symfile = create_symbol_file(name, code, size_bytes);
+
+  jit_code_entry *entry = &registration->entry;
+  entry->symfile_addr = registration->symfile.data();
+  entry->symfile_size = registration->symfile.size();
+  entry->prev_entry = nullptr;
+  entry->next_entry = __jit_debug_descriptor.first_entry;
+  if (entry->next_entry != nullptr)
+  {
+    entry->next_entry->prev_entry = entry;
+  }
+  __jit_debug_descriptor.first_entry = entry;
+
+  __jit_debug_descriptor.relevant_entry = entry;
+  __jit_debug_descriptor.action_flag = JIT_REGISTER_FN;
+  __jit_debug_register_code();
+  __jit_debug_descriptor.action_flag = JIT_NOACTION;
+
+  registrations.emplace(code, std::move(registration));
+}
+
+void mini_jit::GdbJit::remove(void const *code)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto found = registrations.find(code);
+  if (found == registrations.end())
+  {
+    return;
+  }
+
+  unlink(*found->second);
+  registrations.erase(found);
+}
+
+void mini_jit::GdbJit::set_enabled(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->enabled = enabled;
+}
+
+std::size_t mini_jit::GdbJit::get_registration_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return registrations.size();
+}
@@ -0,0 +1,139 @@
+#ifndef MINI_JIT_GDB_JIT_H
+#define MINI_JIT_GDB_JIT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+extern "C"
+{
+  //! entry of the list read by GDB, layout defined by the GDB JIT interface
+  struct jit_code_entry
+  {
+    jit_code_entry *next_entry;
+    jit_code_entry *prev_entry;
+    char const *symfile_addr;
+    uint64_t symfile_size;
+  };
+
+  //! head of the list read by GDB, layout defined by the GDB JIT interface
+  struct jit_descriptor
+  {
+    uint32_t version;
+    uint32_t action_flag;
+    jit_code_entry *relevant_entry;
+    jit_code_entry *first_entry;
+  };
+
+  //! descriptor read by GDB
+  extern jit_descriptor __jit_debug_descriptor;
+}
+
+namespace mini_jit
+{
+
+  /**
+   * Registers jitted kernels through the GDB JIT interface.
+   * Each kernel is described by a minimal in-memory ELF file with a single function symbol,
+   * hence backtraces and 'disassemble' show the kernel name when debugging with GDB.
+   */
+  class GdbJit
+  {
+  private:
+    struct Registration
+    {
+      //! entry linked into the list of GDB
+      jit_code_entry entry = {};
+
+      //! in-memory ELF file referenced by the entry
+      std::vector<char> symfile;
+    };
+
+    //! guards all members below and the list of GDB
+    mutable std::mutex mutex;
+
+    //! registrations by executable entry point
+    std::unordered_map<void const *, std::unique_ptr<Registration>> registrations;
+
+    //! kernels are registered if enabled
+    bool enabled = true;
+
+    /**
+     * Unlinks and notifies GDB about a removed registration.
+     * The caller must hold the mutex.
+     *
+     * @param registration the registration to unlink.
+     **/
+    static void unlink(Registration &registration);
+
+  public:
+    /**
+     * Constructor
+     **/
+    GdbJit() {};
+
+    /**
+     * Destructor
+     **/
+    ~GdbJit() noexcept;
+
+    GdbJit(GdbJit const &) = delete;
+    GdbJit &operator=(GdbJit const &) = delete;
+    GdbJit(GdbJit &&) noexcept = delete;
+    GdbJit &operator=(GdbJit &&) noexcept = delete;
+
+    /**
+     * Gets the process-wide instance used by all kernels.
+     *
+     * @return the process-wide instance.
+     **/
+    static GdbJit &instance();
+
+    /**
+     * Creates an in-memory ELF file describing a single function.
+     *
+     * @param name symbol name of the function.
+     * @param code executable entry point of the function.
+     * @param size_bytes size of the function in bytes.
+     * @return the ELF file.
+     **/
+    static std::vector<char> create_symbol_file(std::string const &name, void const *code, std::size_t size_bytes);
+
+    /**
+     * Registers a kernel with GDB, replaces an existing registration of the same entry point.
+     *
+     * @param name symbol name of the kernel.
+     * @param code executable entry point of the kernel.
+     * @param size_bytes size of the kernel in bytes.
+     **/
+    void add(std::string const &name, void const *code, std::size_t size_bytes);
+
+    /**
+     * Unregisters a kernel, does nothing if the kernel is not registered.
+     *
+     * @param code executable entry point of the kernel.
+     **/
+    void remove(void const *code);
+
+    /**
+     * Enables or disables the registration of new kernels.
+     *
+     * @param enabled true to register new kernels with GDB.
+     **/
+    void set_enabled(bool enabled);
+
+    /**
+     * Gets the number of registered kernels.
+     *
+     * @return number of registered kernels.
+     **/
+    std::size_t get_registration_count() const;
+  };
+
+}  // namespace mini_jit
+#endif
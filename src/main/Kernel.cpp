@@ -1,11 +1,17 @@
 #include "Kernel.h"
+#include "CodeArena.h"
+#include "GdbJit.h"
+#include "PerfMap.h"
 #include "release_assert.h"
 #include <cerrno>
+#include <fcntl.h>
 #include <cstring>
 #include <fstream>
 #include <stdexcept>
 #include <string>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 void *mini_jit::Kernel::allocate_mmap(std::size_t size_bytes) const
 {
@@ -39,15 +45,31 @@ void mini_jit::Kernel::set_executable(std::size_t size_bytes, void *memory) cons
   }
 }
 
+void mini_jit::Kernel::register_symbols() const
+{
+  PerfMap::instance().add(name, kernel, get_size());
+  GdbJit::instance().add(name, kernel, get_size());
+}
+
 void mini_jit::Kernel::release_memory()
 {
   if (kernel != nullptr)
+  {
+    GdbJit::instance().remove(kernel);
+  }
+
+  if (kernel != nullptr && is_arena_memory)
+  {
+    CodeArena::instance().release(kernel);
+  }
+  else if (kernel != nullptr)
   {
     release_mmap(size_allocate, kernel);
   }
   size_allocate = 0;
 
   kernel = nullptr;
+  is_arena_memory = false;
 }
 
 mini_jit::Kernel::~Kernel() noexcept
@@ -72,6 +94,83 @@ void mini_jit::Kernel::add(std::vector<uint32_t> instructions)
   buffer.insert(buffer.end(), instructions.begin(), instructions.end());
 }
 
+void mini_jit::Kernel::add_patch_point(std::string const &name)
+{
+  patch_points[name] = buffer.size();
+}
+
+std::size_t mini_jit::Kernel::get_patch_point(std::string const &name) const
+{
+  auto found = patch_points.find(name);
+  release_assert(found != patch_points.end(), "The patch point does not exist in the kernel.");
+  return found->second;
+}
+
+std::unordered_map<std::string, std::size_t> const &mini_jit::Kernel::get_patch_points() const
+{
+  return patch_points;
+}
+
+void mini_jit::Kernel::replace_buffer(std::vector<uint32_t> instructions, std::vector<std::size_t> const &index_map)
+{
+  release_assert(kernel == nullptr, "The code buffer cannot be replaced after the kernel is set.");
+  release_assert(index_map.size() == buffer.size(), "The index map must cover the old code buffer.");
+
+  for (auto &patch_point : patch_points)
+  {
+    if (patch_point.second < index_map.size())
+    {
+      patch_point.second = index_map[patch_point.second];
+    }
+    else
+    {
+      patch_point.second = instructions.size();
+    }
+  }
+  buffer = std::move(instructions);
+}
+
+void mini_jit::Kernel::patch(std::size_t index, uint32_t instruction)
+{
+  release_assert(!shared, "A kernel shared through the KernelCache must not be patched.");
+  release_assert(index < buffer.size(), "The patched instruction is out of bounds of the code buffer.");
+
+  buffer[index] = instruction;
+  if (kernel == nullptr)
+  {
+    return;
+  }
+
+  if (is_arena_memory)
+  {
+    CodeArena::instance().write(kernel, index * sizeof(uint32_t), &instruction, sizeof(uint32_t));
+  }
+  else
+  {
+    set_kernel();
+  }
+}
+
+void mini_jit::Kernel::set_shared()
+{
+  shared = true;
+}
+
+bool mini_jit::Kernel::is_shared() const
+{
+  return shared;
+}
+
+void mini_jit::Kernel::set_name(std::string const &name)
+{
+  this->name = name;
+}
+
+std::string const &mini_jit::Kernel::get_name() const
+{
+  return name;
+}
+
 std::size_t mini_jit::Kernel::get_size() const
 {
   return buffer.size() * sizeof(uint32_t);
@@ -84,6 +183,16 @@ std::size_t mini_jit::Kernel::get_instruction_count() const
 
 void mini_jit::Kernel::set_kernel()
 {
+  release_assert(!shared, "A kernel shared through the KernelCache must not be set again.");
+
+  // re-emit without a new allocation
+  if (is_arena_memory && !buffer.empty() && get_size() <= size_allocate)
+  {
+    CodeArena::instance().write(kernel, 0, buffer.data(), get_size());
+    register_symbols();
+    return;
+  }
+
   release_memory();
 
   if (buffer.empty())
@@ -91,6 +200,17 @@ void mini_jit::Kernel::set_kernel()
     return;
   }
 
+  // pack the kernel into the shared code arena, the arena aligns the entry point and handles the cache maintenance
+  CodeArena &arena = CodeArena::instance();
+  if (arena.is_enabled())
+  {
+    kernel = arena.allocate(buffer.data(), get_size());
+    size_allocate = get_size();
+    is_arena_memory = true;
+    register_symbols();
+    return;
+  }
+
   // allocate kernel memory
   size_allocate = get_size();
   try
@@ -111,6 +231,55 @@ void mini_jit::Kernel::set_kernel()
 
   // set executable
   set_executable(size_allocate, kernel);
+
+  register_symbols();
+}
+
+void mini_jit::Kernel::set_kernel_from_file(char const *path, std::size_t offset_bytes, std::size_t size_bytes)
+{
+  release_assert(!shared, "A kernel shared through the KernelCache must not be set again.");
+
+  release_memory();
+
+  release_assert(size_bytes % sizeof(uint32_t) == 0, "The machine code must consist of whole instructions.");
+  if (size_bytes == 0)
+  {
+    return;
+  }
+
+  int file = open(path, O_RDONLY | O_CLOEXEC);
+  if (file == -1)
+  {
+    throw std::runtime_error("Failed to open file: " + std::string(path) + ": " + std::string(std::strerror(errno)));
+  }
+
+  struct stat file_stat;
+  if (fstat(file, &file_stat) == -1 || static_cast<std::size_t>(file_stat.st_size) < offset_bytes + size_bytes)
+  {
+    close(file);
+    throw std::runtime_error("File is smaller than the requested kernel: " + std::string(path));
+  }
+
+  // map the machine code directly as executable, no copy and no writable mapping is required
+  void *memory = mmap(0, size_bytes, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, static_cast<off_t>(offset_bytes));
+  close(file);
+
+  if (memory == MAP_FAILED)
+  {
+    throw std::runtime_error("Failed to map kernel file: " + std::string(path) + ": " + std::string(std::strerror(errno)));
+  }
+
+  kernel = memory;
+  size_allocate = size_bytes;
+
+  uint32_t const *instructions = reinterpret_cast<uint32_t const *>(kernel);
+  buffer.assign(instructions, instructions + size_bytes / sizeof(uint32_t));
+
+  // clear cache
+  char *kernel_ptr = reinterpret_cast<char *>(kernel);
+  __builtin___clear_cache(kernel_ptr, kernel_ptr + size_bytes);
+
+  register_symbols();
 }
 
 void const *mini_jit::Kernel::get_kernel() const
@@ -118,6 +287,11 @@ void const *mini_jit::Kernel::get_kernel() const
   return kernel;
 }
 
+std::vector<uint32_t> const &mini_jit::Kernel::get_buffer() const
+{
+  return buffer;
+}
+
 void mini_jit::Kernel::write(char const *path) const
 {
   std::ofstream out(path, std::ios::out | std::ios::binary);
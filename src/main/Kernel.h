@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mini_jit
@@ -20,6 +22,23 @@ namespace mini_jit
     //! executable kernel
     void *kernel = nullptr;
 
+    //! true if the executable kernel is placed in the code arena
+    bool is_arena_memory = false;
+
+    //! true if the kernel is shared through the KernelCache and must not be changed
+    bool shared = false;
+
+    //! named instruction indices that can be patched after generation
+    std::unordered_map<std::string, std::size_t> patch_points;
+
+    //! symbol name of the kernel, e.g. shown by perf
+    std::string name = "mini_jit_kernel";
+
+    /**
+     * Registers the executable kernel with the PerfMap and GDB.
+     **/
+    void register_symbols() const;
+
     /**
      * Allocates memory through POSIX mmap.
      *
@@ -78,6 +97,76 @@ namespace mini_jit
      **/
     void add(std::vector<uint32_t> instructions);
 
+    /**
+     * Marks the next added instruction as patch point.
+     *
+     * @param name name of the patch point.
+     **/
+    void add_patch_point(std::string const &name);
+
+    /**
+     * Gets the instruction index of a patch point.
+     *
+     * @param name name of the patch point.
+     * @return index of the instruction in the code buffer.
+     **/
+    std::size_t get_patch_point(std::string const &name) const;
+
+    /**
+     * Gets all patch points of the kernel.
+     *
+     * @return instruction index of each patch point by name.
+     **/
+    std::unordered_map<std::string, std::size_t> const &get_patch_points() const;
+
+    /**
+     * Replaces the code buffer by a rewritten one, e.g. by the Peephole pass.
+     * Must be called before the kernel is set.
+     *
+     * @param instructions the new code buffer.
+     * @param index_map new index of each instruction of the old code buffer, used to move the patch points.
+     **/
+    void replace_buffer(std::vector<uint32_t> instructions, std::vector<std::size_t> const &index_map);
+
+    /**
+     * Replaces a single instruction of the code buffer and of the executable kernel.
+     * Kernels in the code arena are patched in place through the writable view without a syscall.
+     * The kernel must not be executed by another thread while it is patched.
+     * Kernels shared through the KernelCache must not be patched, which is enforced by a release assert.
+     *
+     * @param index index of the instruction in the code buffer.
+     * @param instruction the new instruction.
+     **/
+    void patch(std::size_t index, uint32_t instruction);
+
+    /**
+     * Marks the kernel as shared by multiple users, e.g. by the KernelCache.
+     * A shared kernel can not be patched or set again.
+     **/
+    void set_shared();
+
+    /**
+     * Indicates if the kernel is shared by multiple users.
+     *
+     * @return true if the kernel must not be changed.
+     **/
+    bool is_shared() const;
+
+    /**
+     * Sets the symbol name of the kernel.
+     * The name is registered with the PerfMap when the kernel becomes executable.
+     *
+     * @param name symbol name, e.g. the generator and its parameters.
+     **/
+    void set_name(std::string const &name);
+
+    /**
+     * Gets the symbol name of the kernel.
+     *
+     * @return symbol name of the kernel.
+     **/
+    std::string const &get_name() const;
+
     /**
      * Gets the size of the code buffer.
      *
@@ -94,14 +183,34 @@ namespace mini_jit
 
     /**
      * Sets the kernel based on the code buffer.
+     * A kernel in the code arena is re-emitted in place if the code buffer still fits into its allocation.
+     * Must not be called on a shared kernel.
      **/
     void set_kernel();
 
+    /**
+     * Sets the kernel by mapping machine code of a file directly into executable memory.
+     * The code buffer is filled with the mapped instructions.
+     * Must not be called on a shared kernel.
+     *
+     * @param path path to the file.
+     * @param offset_bytes page aligned offset of the machine code in the file.
+     * @param size_bytes size of the machine code in bytes.
+     **/
+    void set_kernel_from_file(char const *path, std::size_t offset_bytes, std::size_t size_bytes);
+
     /**
      * Gets a pointer to the executable kernel.
      **/
     void const *get_kernel() const;
 
+    /**
+     * Gets the code buffer.
+     *
+     * @return instructions of the code buffer.
+     **/
+    std::vector<uint32_t> const &get_buffer() const;
+
     /**
      * Writes the code buffer to the given file.
      *
@@ -0,0 +1,332 @@
+#include "KernelCache.h"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <sys/auxv.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#ifndef MLC_VERSION
+#define MLC_VERSION "unknown"
+#endif
+
+// hash of the generator sources, set by CMake for this translation unit only
+#ifndef MLC_GENERATOR_HASH
+#define MLC_GENERATOR_HASH "unknown"
+#endif
+
+namespace
+{
+  /**
+   * Layout of the header of an on-disk kernel file.
+   * The header is followed by the key and zero padding up to the page aligned code offset.
+   */
+  struct DiskHeader
+  {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t code_offset;
+    char library_version[32];
+    char generator_hash[40];
+    uint64_t hwcap;
+    uint64_t hwcap2;
+    uint64_t code_size;
+    uint64_t key_size;
+  };
+
+  constexpr char disk_magic[8] = {'M', 'L', 'C', 'J', 'I', 'T', '\0', '\0'};
+
+  /**
+   * Fills a header with the properties of the running process.
+   *
+   * @param format_version version of the on-disk kernel format.
+   * @return header describing the running process.
+   */
+  DiskHeader get_process_header(uint32_t format_version)
+  {
+    DiskHeader header{};
+    std::memcpy(header.magic, disk_magic, sizeof(header.magic));
+    header.format_version = format_version;
+    std::strncpy(header.library_version, MLC_VERSION, sizeof(header.library_version) - 1);
+    std::strncpy(header.generator_hash, MLC_GENERATOR_HASH, sizeof(header.generator_hash) - 1);
+    header.hwcap = getauxval(AT_HWCAP);
+    header.hwcap2 = getauxval(AT_HWCAP2);
+    return header;
+  }
+
+  /**
+   * Reads the on-disk cache directory from the environment.
+   *
+   * @param variable name of the environment variable.
+   * @return the directory or an empty string if the variable is not set.
+   */
+  std::string get_environment_directory(char const *variable)
+  {
+    char const *directory = std::getenv(variable);
+    return directory != nullptr ? directory : "";
+  }
+}  // namespace
+
+mini_jit::KernelCache &mini_jit::KernelCache::instance()
+{
+  static KernelCache cache(default_capacity, get_environment_directory(directory_environment_variable));
+  return cache;
+}
+
+void mini_jit::KernelCache::evict_to_capacity()
+{
+  while (entries.size() > capacity)
+  {
+    entries.erase(lru.back());
+    lru.pop_back();
+    ++evictions;
+  }
+}
+
+std::shared_ptr<mini_jit::Kernel> mini_jit::KernelCache::get_or_generate(std::string const &key, generator_t const &generator)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto found = entries.find(key);
+    if (found != entries.end())
+    {
+      ++hits;
+      lru.splice(lru.begin(), lru, found->second.lru_position);
+      return found->second.kernel;
+    }
+
+    ++misses;
+  }
+
+  std::string directory = get_directory();
+
+  // load or generate without holding the lock, code generation of other keys must not be serialized
+  std::shared_ptr<Kernel> kernel = nullptr;
+  if (!directory.empty())
+  {
+    kernel = load_from_disk(directory, key);
+  }
+
+  bool from_disk = kernel != nullptr;
+  if (!from_disk)
+  {
+    kernel = std::make_shared<Kernel>();
+    kernel->set_name(key);  // generators may choose a more descriptive name
+    generator(*kernel);
+    kernel->set_kernel();
+
+    if (!directory.empty())
+    {
+      store_to_disk(directory, key, *kernel);
+    }
+  }
+
+  // every user of the key gets the same kernel, patching it would change the code of all of them
+  kernel->set_shared();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (from_disk)
+  {
+    ++disk_hits;
+  }
+
+  auto found = entries.find(key);
+  if (found != entries.end())
+  {
+    // another thread generated the same kernel in the meantime
+    lru.splice(lru.begin(), lru, found->second.lru_position);
+    return found->second.kernel;
+  }
+
+  if (capacity == 0)
+  {
+    return kernel;
+  }
+
+  lru.push_front(key);
+  entries.emplace(key, Entry{kernel, lru.begin()});
+  evict_to_capacity();
+
+  return kernel;
+}
+
+void mini_jit::KernelCache::set_capacity(std::size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->capacity = capacity;
+  evict_to_capacity();
+}
+
+std::size_t mini_jit::KernelCache::get_capacity() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return capacity;
+}
+
+std::size_t mini_jit::KernelCache::get_size() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return entries.size();
+}
+
+uint64_t mini_jit::KernelCache::get_hits() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return hits;
+}
+
+uint64_t mini_jit::KernelCache::get_misses() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return misses;
+}
+
+uint64_t mini_jit::KernelCache::get_evictions() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return evictions;
+}
+
+void mini_jit::KernelCache::set_directory(std::string const &directory)
+{
+  if (!directory.empty())
+  {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error)
+    {
+      throw std::runtime_error("Failed to create kernel cache directory: " + directory + ": " + error.message());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  this->directory = directory;
+}
+
+std::string mini_jit::KernelCache::get_directory() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return directory;
+}
+
+uint64_t mini_jit::KernelCache::get_disk_hits() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return disk_hits;
+}
+
+void mini_jit::KernelCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+  lru.clear();
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  disk_hits = 0;
+}
+
+std::string mini_jit::KernelCache::get_disk_path(std::string const &directory, std::string const &key)
+{
+  return (std::filesystem::path(directory) / (key + ".kernel")).string();
+}
+
+std::shared_ptr<mini_jit::Kernel> mini_jit::KernelCache::load_from_disk(std::string const &directory, std::string const &key)
+{
+  std::string path = get_disk_path(directory, key);
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in)
+  {
+    return nullptr;
+  }
+
+  DiskHeader header{};
+  in.read(reinterpret_cast<char *>(&header), sizeof(header));
+  std::string file_key(header.key_size <= key.size() ? header.key_size : 0, '\0');
+  in.read(file_key.data(), file_key.size());
+  if (!in)
+  {
+    return nullptr;
+  }
+
+  DiskHeader expected = get_process_header(disk_format_version);
+  uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.format_version != expected.format_version ||
+      std::strncmp(header.library_version, expected.library_version, sizeof(header.library_version)) != 0 ||
+      std::strncmp(header.generator_hash, expected.generator_hash, sizeof(header.generator_hash)) != 0 ||
+      header.hwcap != expected.hwcap || header.hwcap2 != expected.hwcap2 || header.code_offset % page_size != 0 ||
+      header.code_size == 0 || header.code_size % sizeof(uint32_t) != 0 || file_key != key)
+  {
+    return nullptr;
+  }
+
+  std::shared_ptr<Kernel> kernel = std::make_shared<Kernel>();
+  kernel->set_name(key);
+  try
+  {
+    kernel->set_kernel_from_file(path.c_str(), header.code_offset, header.code_size);
+  }
+  catch (std::runtime_error &)
+  {
+    // e.g. truncated file or a directory mounted with noexec
+    return nullptr;
+  }
+
+  return kernel;
+}
+
+void mini_jit::KernelCache::store_to_disk(std::string const &directory, std::string const &key, Kernel const &kernel)
+{
+  std::vector<uint32_t> const &buffer = kernel.get_buffer();
+  if (buffer.empty())
+  {
+    return;
+  }
+
+  uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  DiskHeader header = get_process_header(disk_format_version);
+  header.code_size = buffer.size() * sizeof(uint32_t);
+  header.key_size = key.size();
+  header.code_offset = static_cast<uint32_t>((sizeof(header) + key.size() + page_size - 1) / page_size * page_size);
+
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  if (error)
+  {
+    return;
+  }
+
+  // write to a unique temporary file and rename, concurrent processes never observe partial files
+  std::string path = get_disk_path(directory, key);
+  std::string path_tmp =
+    path + ".tmp" + std::to_string(getpid()) + "_" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  {
+    std::ofstream out(path_tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      return;
+    }
+
+    std::vector<char> padding(header.code_offset - sizeof(header) - key.size(), 0);
+    out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    out.write(key.data(), key.size());
+    out.write(padding.data(), padding.size());
+    out.write(reinterpret_cast<char const *>(buffer.data()), header.code_size);
+    if (!out)
+    {
+      out.close();
+      std::filesystem::remove(path_tmp, error);
+      return;
+    }
+  }
+
+  std::filesystem::rename(path_tmp, path, error);
+  if (error)
+  {
+    std::filesystem::remove(path_tmp, error);
+  }
+}
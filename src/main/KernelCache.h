@@ -0,0 +1,208 @@
+#ifndef MINI_JIT_KERNEL_CACHE_H
+#define MINI_JIT_KERNEL_CACHE_H
+
+#include "Kernel.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace mini_jit
+{
+
+  class KernelCache
+  {
+  public:
+    /**
+     * Fills the given empty kernel with instructions.
+     * The cache makes the kernel executable after the generator returns.
+     **/
+    using generator_t = std::function<void(Kernel &kernel)>;
+
+    //! default number of kernels kept alive by the cache
+    static constexpr std::size_t default_capacity = 1024;
+
+    //! version of the on-disk kernel format, increase if the file layout changes
+    static constexpr uint32_t disk_format_version = 2;
+
+    //! environment variable that sets the on-disk cache directory of the process-wide cache
+    static constexpr char const *directory_environment_variable = "MLC_KERNEL_CACHE_DIR";
+
+  private:
+    struct Entry
+    {
+      //! shared executable kernel
+      std::shared_ptr<Kernel> kernel;
+
+      //! position of the key in the lru list
+      std::list<std::string>::iterator lru_position;
+    };
+
+    //! guards all members below
+    mutable std::mutex mutex;
+
+    //! keys ordered from most recently used (front) to least recently used (back)
+    std::list<std::string> lru;
+
+    //! cached kernels by key
+    std::unordered_map<std::string, Entry> entries;
+
+    //! maximum number of cached kernels, 0 disables caching
+    std::size_t capacity = default_capacity;
+
+    //! directory of the on-disk cache, empty disables the on-disk cache
+    std::string directory;
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t disk_hits = 0;
+
+    /**
+     * Evicts the least recently used kernels until the capacity is met.
+     * The caller must hold the mutex.
+     **/
+    void evict_to_capacity();
+
+    /**
+     * Gets the path of the on-disk kernel file of the given key.
+     *
+     * @param directory directory of the on-disk cache.
+     * @param key unique description of all generator parameters.
+     * @return path to the kernel file.
+     **/
+    static std::string get_disk_path(std::string const &directory, std::string const &key);
+
+    /**
+     * Loads a kernel from the on-disk cache.
+     * Files written by another library version, by other generator sources, for other cpu features or in another format are ignored.
+     *
+     * @param directory directory of the on-disk cache.
+     * @param key unique description of all generator parameters.
+     * @return the executable kernel or nullptr if no valid kernel file exists.
+     **/
+    static std::shared_ptr<Kernel> load_from_disk(std::string const &directory, std::string const &key);
+
+    /**
+     * Stores a kernel in the on-disk cache.
+     * Failures are ignored as the kernel can always be generated again.
+     *
+     * @param directory directory of the on-disk cache.
+     * @param key unique description of all generator parameters.
+     * @param kernel the kernel to store.
+     **/
+    static void store_to_disk(std::string const &directory, std::string const &key, Kernel const &kernel);
+
+  public:
+    /**
+     * Constructor
+     *
+     * @param capacity maximum number of cached kernels.
+     * @param directory directory of the on-disk cache, empty disables the on-disk cache.
+     **/
+    explicit KernelCache(std::size_t capacity = default_capacity, std::string directory = "")
+        : capacity(capacity), directory(std::move(directory)) {};
+
+    KernelCache(KernelCache const &) = delete;
+    KernelCache &operator=(KernelCache const &) = delete;
+    KernelCache(KernelCache &&) noexcept = delete;
+    KernelCache &operator=(KernelCache &&) noexcept = delete;
+
+    /**
+     * Gets the process-wide kernel cache used by Brgemm and Unary.
+     * The on-disk cache is enabled if the environment variable MLC_KERNEL_CACHE_DIR is set.
+     *
+     * @return the process-wide kernel cache.
+     **/
+    static KernelCache &instance();
+
+    /**
+     * Returns the kernel cached under the given key or generates, caches and returns a new one.
+     * On a miss, the kernel is mapped from the on-disk cache if available, otherwise it is generated and written to the on-disk cache.
+     * Kernels are reference counted, an evicted kernel stays valid until its last user releases it.
+     * The returned kernel is marked as shared and can not be patched.
+     * If two threads miss on the same key concurrently, the first inserted kernel is returned to both.
+     *
+     * @param key unique description of all generator parameters, must be a valid file name.
+     * @param generator fills the kernel on a cache miss.
+     * @return the executable kernel.
+     **/
+    std::shared_ptr<Kernel> get_or_generate(std::string const &key, generator_t const &generator);
+
+    /**
+     * Sets the maximum number of cached kernels and evicts kernels if required.
+     *
+     * @param capacity maximum number of cached kernels, 0 disables caching.
+     **/
+    void set_capacity(std::size_t capacity);
+
+    /**
+     * Gets the maximum number of cached kernels.
+     *
+     * @return the capacity of the cache.
+     **/
+    std::size_t get_capacity() const;
+
+    /**
+     * Gets the number of currently cached kernels.
+     *
+     * @return number of cached kernels.
+     **/
+    std::size_t get_size() const;
+
+    /**
+     * Gets the number of lookups served from the cache.
+     *
+     * @return number of cache hits.
+     **/
+    uint64_t get_hits() const;
+
+    /**
+     * Gets the number of lookups that required a code generation.
+     *
+     * @return number of cache misses.
+     **/
+    uint64_t get_misses() const;
+
+    /**
+     * Gets the number of kernels evicted because of the capacity bound.
+     *
+     * @return number of evictions.
+     **/
+    uint64_t get_evictions() const;
+
+    /**
+     * Sets the directory of the on-disk cache, the directory is created if it does not exist.
+     *
+     * @param directory directory of the on-disk cache, empty disables the on-disk cache.
+     **/
+    void set_directory(std::string const &directory);
+
+    /**
+     * Gets the directory of the on-disk cache.
+     *
+     * @return directory of the on-disk cache, empty if disabled.
+     **/
+    std::string get_directory() const;
+
+    /**
+     * Gets the number of misses that were served from the on-disk cache.
+     *
+     * @return number of on-disk cache hits.
+     **/
+    uint64_t get_disk_hits() const;
+
+    /**
+     * Drops all cached kernels and resets the counters.
+     * Files of the on-disk cache are kept.
+     **/
+    void clear();
+  };
+
+}  // namespace mini_jit
+#endif
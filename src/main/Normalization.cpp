@@ -0,0 +1,51 @@
+#include "Normalization.h"
+#include "KernelCache.h"
+#include "kernels/normalization/normalization.h"
+#include "release_assert.h"
+#include <bit>
+#include <format>
+
+mini_jit::Normalization::error_t mini_jit::Normalization::generate(uint32_t m, uint32_t n, dtype_t dtype, ptype_t ptype, float epsilon)
+{
+  if (dtype != dtype_t::fp32)
+  {
+    return error_t::err_wrong_dtype;
+  }
+  if (m == 0 || n == 0)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  release_assert(ptype <= ptype_t::rms_norm, "Found unhandled ptype_t");
+  release_assert(epsilon >= 0, "The epsilon of a normalization cannot be negative.");
+
+  // The softmax does not depend on the epsilon
+  const uint32_t epsilon_bits = ptype == ptype_t::softmax ? 0 : std::bit_cast<uint32_t>(epsilon);
+  const std::string key = std::format("normalization_m{}_n{}_ptype{}_eps{:x}", m, n, static_cast<int32_t>(ptype), epsilon_bits);
+
+  native_kernel = KernelCache::instance().get_or_generate(
+    key,
+    [&](mini_jit::Kernel &native_kernel)
+    {
+      // The primitive types follow the order of normalization_t
+      const auto normalization = static_cast<kernels::normalization_t>(ptype);
+      constexpr char const *names[] = {"softmax", "layer_norm", "rms_norm"};
+      native_kernel.set_name(std::format("normalization_{}_m{}_n{}", names[static_cast<uint32_t>(ptype)], m, n));
+      kernels::normalization(native_kernel, m, n, normalization, epsilon);
+    });
+  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel->get_kernel()));
+
+  return error_t::success;
+}
+
+mini_jit::Normalization::kernel_t mini_jit::Normalization::get_kernel() const
+{
+  return kernel;
+}
+
+void mini_jit::Normalization::write_kernel_to_file(const char *path) const
+{
+  if (native_kernel != nullptr)
+  {
+    native_kernel->write(path);
+  }
+}
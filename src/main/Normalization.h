@@ -0,0 +1,81 @@
+#ifndef MINI_JIT_NORMALIZATION_H
+#define MINI_JIT_NORMALIZATION_H
+
+#include "Kernel.h"
+#include <cstdint>
+#include <memory>
+
+namespace mini_jit
+{
+  class Normalization;
+}
+
+class mini_jit::Normalization
+{
+public:
+  /*
+   * Kernel type.
+   * The kernel is a function that takes the following parameters:
+   * - a:    Pointer to column-major matrix A.
+   * - b:    Pointer to column-major matrix B.
+   * - ld_a: Leading dimension of A.
+   * - ld_b: Leading dimension of B.
+   */
+  using kernel_t = void (*)(void const *a, void *b, int64_t ld_a, int64_t ld_b);
+
+  /// data type
+  enum class dtype_t : uint32_t
+  {
+    fp32 = 0,
+  };
+
+  /// primitive type, each column of A is normalized
+  enum class ptype_t : uint32_t
+  {
+    softmax = 0,
+    layer_norm = 1,
+    rms_norm = 2,
+  };
+
+  /// error codes
+  enum class error_t : int32_t
+  {
+    success = 0,
+    err_wrong_dtype = 1,
+    err_wrong_dimension = 2,
+  };
+
+  //! default epsilon of the layer norm and the rms norm
+  static constexpr float default_epsilon = 1e-5f;
+
+private:
+  kernel_t kernel = nullptr;
+  std::shared_ptr<mini_jit::Kernel> native_kernel;
+
+public:
+  /**
+   * @brief Generate a kernel for a normalization primitive.
+   * @param m       Number of rows in A and B, i.e. the normalized dimension.
+   * @param n       Number of columns in A and B.
+   * @param dtype   Data type of the matrices.
+   * @param ptype   Primitive type.
+   * @param epsilon Value added to the variance of a layer norm or to the mean square of a rms norm, ignored by the softmax.
+   * @return error_t::success on success, another error_t value otherwise.
+   **/
+  error_t generate(uint32_t m, uint32_t n, dtype_t dtype, ptype_t ptype, float epsilon = default_epsilon);
+
+  /**
+   * @brief Get the generated kernel: B := normalization(A).
+   * @return pointer to the generated kernel.
+   **/
+  kernel_t get_kernel() const;
+
+  /**
+   * @brief Writes the current kernel into a file.
+   *
+   * @param path The file to write the kernel to.
+   */
+  void write_kernel_to_file(const char *path) const;
+};
+
+#endif
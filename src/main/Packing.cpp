@@ -0,0 +1,250 @@
+#include "Packing.h"
+#include "Cpu.h"
+#include "kernels/br_matmul_bf16.h"
+#include "kernels/br_matmul_int8.h"
+#include "release_assert.h"
+
+mini_jit::Packing::tile_t mini_jit::Packing::get_packing_tile(tile_t tile, dtype_t dtype)
+{
+  if (tile != tile_t{})
+  {
+    return tile;
+  }
+  switch (dtype)
+  {
+  case dtype_t::fp64:
+    return Brgemm::default_fp64_tile;
+  case dtype_t::bf16:
+    return Brgemm::default_bf16_tile;
+  case dtype_t::s8:
+  case dtype_t::u8:
+    return Brgemm::default_int8_tile;
+  default:
+    return Brgemm::default_fp32_tile;
+  }
+}
+
+mini_jit::Packing::error_t mini_jit::Packing::generate_strips(Unary &strip, Unary &rest, uint32_t size, uint32_t strip_size,
+                                                              bool transpose)
+{
+  Unary::dtype_t unary_dtype = element_size == 8 ? Unary::dtype_t::fp64 : Unary::dtype_t::fp32;
+
+  // A transposed strip is read as the k x strip_size matrix, otherwise as the strip_size x k matrix
+  auto generate_strip = [&](Unary &unary, uint32_t strip_rows)
+  {
+    return transpose ? unary.generate(k, strip_rows, 1, unary_dtype, Unary::ptype_t::identity)
+                     : unary.generate(strip_rows, k, 0, unary_dtype, Unary::ptype_t::identity);
+  };
+
+  if (size >= strip_size && generate_strip(strip, strip_size) != Unary::error_t::success)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  if (size % strip_size != 0 && generate_strip(rest, size % strip_size) != Unary::error_t::success)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  return error_t::success;
+}
+
+template <typename T>
+void mini_jit::Packing::interleave(T const *src, int64_t stride_strip, int64_t stride_k, uint32_t size, uint32_t strip_size, T *dst) const
+{
+  const uint32_t packed_k = get_packed_k();
+
+  for (uint32_t iStrip = 0; iStrip < size; iStrip += strip_size)
+  {
+    for (uint32_t iK = 0; iK < packed_k; iK += k_block)
+    {
+      // The rows of A or columns of B follow each other, a block holds the k_block values of the first one followed by the second and so on
+      for (uint32_t iRow = 0; iRow < strip_size; ++iRow)
+      {
+        const uint32_t index = iStrip + iRow;
+        for (uint32_t iBlock = 0; iBlock < k_block; ++iBlock)
+        {
+          const bool is_padding = index >= size || iK + iBlock >= k;
+          *dst++ = is_padding ? 0 : src[index * stride_strip + (iK + iBlock) * stride_k];
+        }
+      }
+    }
+  }
+}
+
+uint32_t mini_jit::Packing::get_packed_k() const
+{
+  return k_block != 0 ? (k + k_block - 1) / k_block * k_block : k;
+}
+
+mini_jit::Packing::error_t mini_jit::Packing::generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a,
+                                                       uint32_t trans_b, dtype_t dtype, tile_t tile)
+{
+  if (dtype != dtype_t::fp32 && dtype != dtype_t::fp64 && dtype != dtype_t::bf16 && dtype != dtype_t::s8 && dtype != dtype_t::u8)
+  {
+    return error_t::err_wrong_dtype;
+  }
+  if (m == 0 || n == 0 || k == 0 || br_size == 0)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  if (trans_a > 1 || trans_b > 1)
+  {
+    return error_t::err_row_major_order_not_supported;
+  }
+  if (!Brgemm::is_valid_tile(m, n, tile, dtype))
+  {
+    return error_t::err_wrong_tile;
+  }
+  // The interleaved int8 layout belongs to the int8 mmla or the dot product instructions
+  if ((dtype == dtype_t::s8 || dtype == dtype_t::u8) && !Cpu::has_i8mm() && !Cpu::has_dotprod())
+  {
+    return error_t::err_wrong_dtype;
+  }
+
+  Packing::m = m;
+  Packing::n = n;
+  Packing::k = k;
+  Packing::br_size = br_size;
+  Packing::trans_a = trans_a;
+  Packing::trans_b = trans_b;
+  Packing::element_size = 4;
+  Packing::k_block = 0;
+  Packing::tile = get_packing_tile(tile, dtype);
+
+  switch (dtype)
+  {
+  case dtype_t::fp64:
+    Packing::element_size = 8;
+    break;
+  case dtype_t::bf16:
+    Packing::element_size = 2;
+    Packing::k_block = kernels::br_matmul_bf16_k_block;
+    break;
+  case dtype_t::s8:
+  case dtype_t::u8:
+    Packing::element_size = 1;
+    Packing::k_block =
+      kernels::br_matmul_int8_k_block(Cpu::has_i8mm() ? kernels::int8_instruction_t::mmla : kernels::int8_instruction_t::dot);
+    break;
+  default:
+    break;
+  }
+
+  if (k_block != 0)
+  {
+    // The strips are interleaved while packing
+    return error_t::success;
+  }
+
+  // The strips of A are column-major and the strips of B row-major
+  error_t error = generate_strips(strip_a, rest_a, m, Packing::tile.m, trans_a == 1);
+  if (error != error_t::success)
+  {
+    return error;
+  }
+  return generate_strips(strip_b, rest_b, n, Packing::tile.n, trans_b == 0);
+}
+
+void mini_jit::Packing::pack_a(void const *a, int64_t lda, int64_t br_stride_a, void *packed_a) const
+{
+  release_assert(tile != tile_t{}, "The packing was not generated.");
+
+  if (k_block != 0)
+  {
+    for (uint32_t iB = 0; iB < br_size; ++iB)
+    {
+      if (element_size == sizeof(uint16_t))
+      {
+        interleave(static_cast<uint16_t const *>(a) + iB * br_stride_a, trans_a ? lda : 1, trans_a ? 1 : lda, m, tile.m,
+                   static_cast<uint16_t *>(packed_a) + iB * get_size_a());
+      }
+      else
+      {
+        interleave(static_cast<uint8_t const *>(a) + iB * br_stride_a, trans_a ? lda : 1, trans_a ? 1 : lda, m, tile.m,
+                   static_cast<uint8_t *>(packed_a) + iB * get_size_a());
+      }
+    }
+    return;
+  }
+
+  const uint32_t m_strips = m / tile.m;
+  const uint32_t m_rest = m % tile.m;
+  const int64_t strip_bytes = static_cast<int64_t>(tile.m) * k * element_size;
+
+  // The rows of a column-major A are contiguous, the rows of a row-major A are lda apart
+  const int64_t row_bytes = (trans_a ? lda : 1) * element_size;
+
+  for (uint32_t iB = 0; iB < br_size; ++iB)
+  {
+    char const *src = static_cast<char const *>(a) + iB * br_stride_a * element_size;
+    char *dst = static_cast<char *>(packed_a) + iB * get_size_a() * element_size;
+
+    for (uint32_t iStrip = 0; iStrip < m_strips; ++iStrip)
+    {
+      strip_a.get_kernel()(src + iStrip * tile.m * row_bytes, dst + iStrip * strip_bytes, lda, tile.m);
+    }
+    if (m_rest != 0)
+    {
+      rest_a.get_kernel()(src + m_strips * tile.m * row_bytes, dst + m_strips * strip_bytes, lda, tile.m);
+    }
+  }
+}
+
+void mini_jit::Packing::pack_b(void const *b, int64_t ldb, int64_t br_stride_b, void *packed_b) const
+{
+  release_assert(tile != tile_t{}, "The packing was not generated.");
+
+  if (k_block != 0)
+  {
+    for (uint32_t iB = 0; iB < br_size; ++iB)
+    {
+      if (element_size == sizeof(uint16_t))
+      {
+        interleave(static_cast<uint16_t const *>(b) + iB * br_stride_b, trans_b ? 1 : ldb, trans_b ? ldb : 1, n, tile.n,
+                   static_cast<uint16_t *>(packed_b) + iB * get_size_b());
+      }
+      else
+      {
+        interleave(static_cast<uint8_t const *>(b) + iB * br_stride_b, trans_b ? 1 : ldb, trans_b ? ldb : 1, n, tile.n,
+                   static_cast<uint8_t *>(packed_b) + iB * get_size_b());
+      }
+    }
+    return;
+  }
+
+  const uint32_t n_strips = n / tile.n;
+  const uint32_t n_rest = n % tile.n;
+  const int64_t strip_bytes = static_cast<int64_t>(tile.n) * k * element_size;
+
+  // The columns of a row-major B are contiguous, the columns of a column-major B are ldb apart
+  const int64_t column_bytes = (trans_b ? 1 : ldb) * element_size;
+
+  for (uint32_t iB = 0; iB < br_size; ++iB)
+  {
+    char const *src = static_cast<char const *>(b) + iB * br_stride_b * element_size;
+    char *dst = static_cast<char *>(packed_b) + iB * get_size_b() * element_size;
+
+    for (uint32_t iStrip = 0; iStrip < n_strips; ++iStrip)
+    {
+      strip_b.get_kernel()(src + iStrip * tile.n * column_bytes, dst + iStrip * strip_bytes, ldb, tile.n);
+    }
+    if (n_rest != 0)
+    {
+      rest_b.get_kernel()(src + n_strips * tile.n * column_bytes, dst + n_strips * strip_bytes, ldb, tile.n);
+    }
+  }
+}
+
+int64_t mini_jit::Packing::get_size_a() const
+{
+  return static_cast<int64_t>((m + tile.m - 1) / tile.m) * tile.m * get_packed_k();
+}
+
+int64_t mini_jit::Packing::get_size_b() const
+{
+  return static_cast<int64_t>((n + tile.n - 1) / tile.n) * tile.n * get_packed_k();
+}
+
+mini_jit::Packing::tile_t mini_jit::Packing::get_tile() const
+{
+  return tile;
+}
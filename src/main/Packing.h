@@ -0,0 +1,149 @@
+#ifndef MINI_JIT_PACKING_H
+#define MINI_JIT_PACKING_H
+
+#include "Brgemm.h"
+#include "Unary.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  class Packing;
+}
+
+/**
+ * Copies the operands of a batch-reduce matrix multiplication into the strips of a packed A and B, see Brgemm::packing_t.
+ * A strip is contiguous and read in the order of the micro-kernel, which avoids the TLB and cache conflicts of large leading dimensions.
+ * The strips are copied by identity and transpose Unary kernels.
+ * The bf16 strips are instead interleaved into the 2x4 blocks of bfmmla, see br_matmul_bf16, and padded to a multiple of four k.
+ * The s8 and u8 strips are interleaved into the blocks of k of the dot product or int8 mmla kernel, see br_matmul_int8, the instruction
+ * and thereby the layout is selected by Cpu::has_i8mm() in the same way as in Brgemm.
+ */
+class mini_jit::Packing
+{
+public:
+  /// data type
+  using dtype_t = Brgemm::dtype_t;
+
+  /// register block of the micro-kernel that reads the packed operands
+  using tile_t = Brgemm::tile_t;
+
+  /// error codes
+  enum class error_t : int32_t
+  {
+    success = 0,
+    err_wrong_dtype = 1,
+    err_wrong_dimension = 2,
+    err_row_major_order_not_supported = 3,
+    err_wrong_tile = 4,
+  };
+
+private:
+  uint32_t m = 0;
+  uint32_t n = 0;
+  uint32_t k = 0;
+  uint32_t br_size = 0;
+  uint32_t trans_a = 0;
+  uint32_t trans_b = 0;
+  uint32_t element_size = 0;
+  uint32_t k_block = 0;
+  tile_t tile;
+
+  Unary strip_a;
+  Unary rest_a;
+  Unary strip_b;
+  Unary rest_b;
+
+  /**
+   * @brief Generates the kernels that copy a full and the last partial strip of an operand.
+   *
+   * @param strip The kernel of a full strip.
+   * @param rest The kernel of the last strip, not generated if the strips divide the operand.
+   * @param size The rows of A or the columns of B.
+   * @param strip_size The rows or columns of a strip.
+   * @param transpose True if the strips are transposed while copying.
+   * @return error_t::success on success, another error_t value otherwise.
+   */
+  error_t generate_strips(Unary &strip, Unary &rest, uint32_t size, uint32_t strip_size, bool transpose);
+
+  /**
+   * @brief Interleaves a bf16 or int8 operand into strips of rows of A or columns of B, each row or column holds blocks of k_block k.
+   *
+   * @tparam T uint16_t for bf16, uint8_t for s8 and u8.
+   * @param src pointer to the first element of the operand.
+   * @param stride_strip stride between two rows of A or columns of B (in elements, not bytes).
+   * @param stride_k stride between two consecutive k (in elements, not bytes).
+   * @param size The rows of A or the columns of B.
+   * @param strip_size The rows or columns of a strip.
+   * @param dst pointer to the packed operand.
+   */
+  template <typename T>
+  void interleave(T const *src, int64_t stride_strip, int64_t stride_k, uint32_t size, uint32_t strip_size, T *dst) const;
+
+  /**
+   * @brief Gets the k of a packed operand, which is padded to a multiple of k_block for interleaved strips.
+   * @return the number of k of a strip.
+   */
+  uint32_t get_packed_k() const;
+
+public:
+  /**
+   * @brief Gets the register block of the packed operands.
+   * @param tile register block of the Brgemm, the default tile {0, 0} selects the default tile of the data type.
+   * @param dtype data type of the matrices.
+   * @return the register block whose rows and columns are the sizes of the strips.
+   **/
+  static tile_t get_packing_tile(tile_t tile, dtype_t dtype);
+
+  /**
+   * @brief Generate the packing of the operands of a batch-reduce matrix multiplication.
+   * @param m number of rows in A and C.
+   * @param n number of columns in B and C.
+   * @param k number of columns in A and rows in B.
+   * @param br_size batch-reduce size.
+   * @param trans_a 0 if A is stored in column-major order, 1 if A is stored in row-major order.
+   * @param trans_b 0 if B is stored in column-major order, 1 if B is stored in row-major order.
+   * @param dtype data type of the matrices.
+   * @param tile register block of the Brgemm that reads the packed operands.
+   * @return error_t::success on success, another error_t value otherwise.
+   **/
+  error_t generate(uint32_t m, uint32_t n, uint32_t k, uint32_t br_size, uint32_t trans_a, uint32_t trans_b, dtype_t dtype,
+                   tile_t tile = {});
+
+  /**
+   * @brief Packs the br_size matrices of A, the packed matrices are get_size_a() elements apart.
+   * @param a pointer to the first A matrix.
+   * @param lda leading dimension of A.
+   * @param br_stride_a stride between two A matrices (in elements, not bytes).
+   * @param packed_a pointer to get_size_a() * br_size elements.
+   **/
+  void pack_a(void const *a, int64_t lda, int64_t br_stride_a, void *packed_a) const;
+
+  /**
+   * @brief Packs the br_size matrices of B, the packed matrices are get_size_b() elements apart.
+   * @param b pointer to the first B matrix.
+   * @param ldb leading dimension of B.
+   * @param br_stride_b stride between two B matrices (in elements, not bytes).
+   * @param packed_b pointer to get_size_b() * br_size elements.
+   **/
+  void pack_b(void const *b, int64_t ldb, int64_t br_stride_b, void *packed_b) const;
+
+  /**
+   * @brief Gets the elements of a packed A matrix including the padding of the last strip.
+   * @return the stride between two packed A matrices.
+   **/
+  int64_t get_size_a() const;
+
+  /**
+   * @brief Gets the elements of a packed B matrix including the padding of the last strip.
+   * @return the stride between two packed B matrices.
+   **/
+  int64_t get_size_b() const;
+
+  /**
+   * @brief Gets the register block of the packed operands.
+   * @return the tile whose m is the leading dimension of a packed A and whose n is the leading dimension of a packed B.
+   **/
+  tile_t get_tile() const;
+};
+
+#endif
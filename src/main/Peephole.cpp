@@ -0,0 +1,878 @@
+#include "Peephole.h"
+#include "release_assert.h"
+#include <algorithm>
+#include <bitset>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+  //! ids of the tracked registers: x0-x30, sp and v0-v31
+  constexpr uint32_t register_sp = 31;
+  constexpr uint32_t register_vector = 32;
+  constexpr uint32_t register_count = 64;
+  using register_set_t = std::bitset<register_count>;
+
+  enum class bank_t : uint8_t
+  {
+    gpr_sp,  //!< general purpose register, 31 encodes sp
+    gpr_zr,  //!< general purpose register, 31 encodes the zero register
+    vector,
+  };
+
+  enum class branch_t : uint8_t
+  {
+    none,
+    imm14,
+    imm19,
+    imm26,
+    indirect,
+  };
+
+  //! register field of an instruction
+  struct Operand
+  {
+    uint8_t shift;
+    uint8_t count;  //!< number of consecutive registers, e.g. of ld1 {v0.4s-v3.4s}
+    bank_t bank;
+    bool read;
+    bool write;
+  };
+
+  struct Instruction
+  {
+    uint32_t code = 0;
+
+    //! false if the instruction is not understood by the pass, it is never moved or removed
+    bool known = false;
+
+    branch_t branch = branch_t::none;
+    bool load = false;
+    bool store = false;
+
+    //! general purpose data processing without side effects besides its destination
+    bool alu = false;
+
+    uint32_t latency = 1;
+    std::vector<Operand> operands;
+
+    //! ldr with unsigned immediate offset that can be merged into ldp
+    bool pairable = false;
+    uint32_t access_size = 0;
+    uint32_t offset = 0;
+  };
+
+  uint32_t get_field(uint32_t code, uint32_t shift)
+  {
+    return (code >> shift) & 0x1F;
+  }
+
+  /**
+   * Decodes the register operands and properties of an instruction.
+   * Only the instruction classes emitted through arm_instructions are decoded.
+   *
+   * @param code the instruction.
+   * @return the decoded instruction.
+   */
+  Instruction decode(uint32_t code)
+  {
+    Instruction instruction;
+    instruction.code = code;
+    auto add_operand = [&instruction](uint8_t shift, bank_t bank, bool read, bool write, uint8_t count = 1)
+    { instruction.operands.push_back(Operand{shift, count, bank, read, write}); };
+    auto set_known = [&instruction](uint32_t latency)
+    {
+      instruction.known = true;
+      instruction.latency = latency;
+    };
+
+    // branches
+    if ((code & 0x7C000000) == 0x14000000)  // b, bl
+    {
+      instruction.branch = branch_t::imm26;
+      return instruction;
+    }
+    if ((code & 0x7E000000) == 0x34000000 || (code & 0xFF000010) == 0x54000000)  // cbz, cbnz, b.cond
+    {
+      instruction.branch = branch_t::imm19;
+      return instruction;
+    }
+    if ((code & 0x7E000000) == 0x36000000)  // tbz, tbnz
+    {
+      instruction.branch = branch_t::imm14;
+      return instruction;
+    }
+    if ((code & 0xFE000000) == 0xD6000000)  // br, blr, ret
+    {
+      instruction.branch = branch_t::indirect;
+      return instruction;
+    }
+
+    // add and sub (immediate) without flags
+    if ((code & 0x3F800000) == 0x11000000)
+    {
+      set_known(1);
+      instruction.alu = true;
+      add_operand(0, bank_t::gpr_sp, false, true);
+      add_operand(5, bank_t::gpr_sp, true, false);
+      return instruction;
+    }
+
+    // add and sub (shifted register) without flags
+    if ((code & 0x3F200000) == 0x0B000000)
+    {
+      set_known(1);
+      instruction.alu = true;
+      add_operand(0, bank_t::gpr_zr, false, true);
+      add_operand(5, bank_t::gpr_zr, true, false);
+      add_operand(16, bank_t::gpr_zr, true, false);
+      return instruction;
+    }
+
+    // logical (shifted register) without flags, e.g. orr and mov
+    if ((code & 0x1F000000) == 0x0A000000 && ((code >> 29) & 0b11) != 0b11)
+    {
+      set_known(1);
+      instruction.alu = true;
+      add_operand(0, bank_t::gpr_zr, false, true);
+      add_operand(5, bank_t::gpr_zr, true, false);
+      add_operand(16, bank_t::gpr_zr, true, false);
+      return instruction;
+    }
+
+    // movz, movn and movk
+    if ((code & 0x1F800000) == 0x12800000 && ((code >> 29) & 0b11) != 0b01)
+    {
+      set_known(1);
+      instruction.alu = ((code >> 29) & 0b11) != 0b11;
+      add_operand(0, bank_t::gpr_zr, !instruction.alu, true);
+      return instruction;
+    }
+
+    // sbfm and ubfm, e.g. lsl
+    if ((code & 0x1F800000) == 0x13000000 && (((code >> 29) & 0b11) == 0b00 || ((code >> 29) & 0b11) == 0b10))
+    {
+      set_known(1);
+      instruction.alu = true;
+      add_operand(0, bank_t::gpr_zr, false, true);
+      add_operand(5, bank_t::gpr_zr, true, false);
+      return instruction;
+    }
+
+    // data processing (3 source), e.g. madd
+    if ((code & 0x1F000000) == 0x1B000000)
+    {
+      set_known(3);
+      instruction.alu = true;
+      add_operand(0, bank_t::gpr_zr, false, true);
+      add_operand(5, bank_t::gpr_zr, true, false);
+      add_operand(16, bank_t::gpr_zr, true, false);
+      add_operand(10, bank_t::gpr_zr, true, false);
+      return instruction;
+    }
+
+    // load and store register (unsigned immediate) and (immediate pre/post-indexed, unscaled)
+    bool unsigned_offset = (code & 0x3B000000) == 0x39000000;
+    bool unscaled = (code & 0x3B200000) == 0x38000000 && ((code >> 10) & 0b11) != 0b10;
+    if (unsigned_offset || unscaled)
+    {
+      uint32_t size = code >> 30;
+      uint32_t opc = (code >> 22) & 0b11;
+      bool is_vector = (code >> 26) & 0b1;
+      bool writeback = unscaled && ((code >> 10) & 0b01);
+
+      if (is_vector && opc >= 0b10 && size != 0b00)
+      {
+        return instruction;
+      }
+
+      bool is_prefetch = !is_vector && size == 0b11 && opc == 0b10;
+      instruction.load = is_vector ? (opc & 0b1) : opc != 0b00;
+      instruction.store = !instruction.load;
+      instruction.access_size = is_vector && opc >= 0b10 ? 16 : 1 << size;
+      set_known(instruction.load ? 4 : 1);
+
+      if (!is_prefetch)
+      {
+        add_operand(0, is_vector ? bank_t::vector : bank_t::gpr_zr, instruction.store, instruction.load);
+      }
+      add_operand(5, bank_t::gpr_sp, true, writeback);
+
+      if (unsigned_offset && instruction.load && instruction.access_size >= 4 && (is_vector || opc == 0b01))
+      {
+        instruction.pairable = true;
+        instruction.offset = ((code >> 10) & 0xFFF) * instruction.access_size;
+      }
+      return instruction;
+    }
+
+    // load and store pair (offset, pre/post-indexed, no-allocate)
+    if ((code & 0x38000000) == 0x28000000 && ((code >> 23) & 0b111) <= 0b011)
+    {
+      bool is_load = (code >> 22) & 0b1;
+      bool is_vector = (code >> 26) & 0b1;
+      uint32_t index = (code >> 23) & 0b111;
+      bool writeback = index == 0b001 || index == 0b011;
+      bank_t bank = is_vector ? bank_t::vector : bank_t::gpr_zr;
+
+      instruction.load = is_load;
+      instruction.store = !is_load;
+      set_known(is_load ? 4 : 1);
+      add_operand(0, bank, !is_load, is_load);
+      add_operand(10, bank, !is_load, is_load);
+      add_operand(5, bank_t::gpr_sp, true, writeback);
+      return instruction;
+    }
+
+    // ld1 and st1 (multiple structures) with and without post-index
+    bool multiple = (code & 0xBFBF0000) == 0x0C000000;
+    bool multiple_post = (code & 0xBFA00000) == 0x0C800000;
+    if (multiple || multiple_post)
+    {
+      uint8_t count = 0;
+      switch ((code >> 12) & 0xF)
+      {
+      case 0b0111:
+        count = 1;
+        break;
+      case 0b1010:
+        count = 2;
+        break;
+      case 0b0110:
+        count = 3;
+        break;
+      case 0b0010:
+        count = 4;
+        break;
+      default:
+        return instruction;
+      }
+
+      bool is_load = (code >> 22) & 0b1;
+      instruction.load = is_load;
+      instruction.store = !is_load;
+      set_known(is_load ? 4 + count / 2 : count);
+      add_operand(0, bank_t::vector, !is_load, is_load, count);
+      add_operand(5, bank_t::gpr_sp, true, multiple_post);
+      if (multiple_post && get_field(code, 16) != 31)
+      {
+        add_operand(16, bank_t::gpr_zr, true, false);
+      }
+      return instruction;
+    }
+
+    // ld1 and st1 (single structure) with and without post-index
+    uint32_t single_class = (code >> 23) & 0x7F;
+    if ((code >> 31) == 0 && (single_class == 0b0011010 || single_class == 0b0011011) && ((code >> 21) & 0b1) == 0)
+    {
+      bool post = single_class == 0b0011011;
+      bool is_load = (code >> 22) & 0b1;
+      uint32_t opcode = (code >> 13) & 0b111;
+      if (!post && get_field(code, 16) != 0)
+      {
+        return instruction;
+      }
+
+      if (opcode == 0b000 || opcode == 0b010 || opcode == 0b100)
+      {
+        // a lane load merges into the register
+        add_operand(0, bank_t::vector, true, is_load);
+      }
+      else if (opcode == 0b110 && is_load && ((code >> 12) & 0b1) == 0)
+      {
+        add_operand(0, bank_t::vector, false, true);  // ld1r
+      }
+      else
+      {
+        return instruction;
+      }
+
+      instruction.load = is_load;
+      instruction.store = !is_load;
+      set_known(is_load ? 5 : 1);
+      add_operand(5, bank_t::gpr_sp, true, post);
+      if (post && get_field(code, 16) != 31)
+      {
+        add_operand(16, bank_t::gpr_zr, true, false);
+      }
+      return instruction;
+    }
+
+    // fmla and fmls (vector), fmla and fmls (by element) for single and double precision
+    if ((code & 0xBF20FC00) == 0x0E20CC00 || (code & 0xBF80B400) == 0x0F801000 || (code & 0xFF80B400) == 0x5F801000)
+    {
+      set_known(4);
+      add_operand(0, bank_t::vector, true, true);
+      add_operand(5, bank_t::vector, true, false);
+      add_operand(16, bank_t::vector, true, false);
+      return instruction;
+    }
+
+    // three register vector instructions that do not read the destination
+    struct Pattern
+    {
+      uint32_t mask;
+      uint32_t value;
+      uint32_t latency;
+    };
+    static constexpr Pattern three_register[] = {
+      {0xBFA0FC00, 0x0E20F400, 2},  // fmax (vector)
+      {0xBFA0FC00, 0x2E20F400, 2},  // fmaxp (vector)
+      {0xBFA0FC00, 0x0EA0F400, 2},  // fmin (vector)
+      {0xBFA0FC00, 0x0E20D400, 3},  // fadd (vector)
+      {0xBFA0FC00, 0x2E20D400, 3},  // faddp (vector)
+      {0xBFA0FC00, 0x0EA0D400, 3},  // fsub (vector)
+      {0xBFA0FC00, 0x2E20DC00, 3},  // fmul (vector)
+      {0xBFE0FC00, 0x2E201C00, 1},  // eor (vector)
+    };
+    for (Pattern const &pattern : three_register)
+    {
+      if ((code & pattern.mask) == pattern.value)
+      {
+        set_known(pattern.latency);
+        add_operand(0, bank_t::vector, false, true);
+        add_operand(5, bank_t::vector, true, false);
+        add_operand(16, bank_t::vector, true, false);
+        return instruction;
+      }
+    }
+
+    // uzp1, trn1, zip1, uzp2, trn2, zip2
+    if ((code & 0xBF208C00) == 0x0E000800 && ((code >> 12) & 0b011) != 0b000)
+    {
+      set_known(2);
+      add_operand(0, bank_t::vector, false, true);
+      add_operand(5, bank_t::vector, true, false);
+      add_operand(16, bank_t::vector, true, false);
+      return instruction;
+    }
+
+    return instruction;
+  }
+
+  /**
+   * Gets the id of a register field.
+   *
+   * @return id of the register or register_count for the zero register.
+   */
+  uint32_t get_register_id(uint32_t number, bank_t bank)
+  {
+    if (bank == bank_t::vector)
+    {
+      return register_vector + number;
+    }
+    if (number == 31)
+    {
+      return bank == bank_t::gpr_sp ? register_sp : register_count;
+    }
+    return number;
+  }
+
+  /**
+   * Gets the registers read or written by an instruction.
+   *
+   * @param instruction the decoded instruction.
+   * @param write true for written registers, false for read registers.
+   * @return set of register ids.
+   */
+  register_set_t get_registers(Instruction const &instruction, bool write)
+  {
+    register_set_t registers;
+    for (Operand const &operand : instruction.operands)
+    {
+      if ((write && !operand.write) || (!write && !operand.read))
+      {
+        continue;
+      }
+      for (uint32_t i = 0; i < operand.count; ++i)
+      {
+        uint32_t id = get_register_id((get_field(instruction.code, operand.shift) + i) % 32, operand.bank);
+        if (id < register_count)
+        {
+          registers.set(id);
+        }
+      }
+    }
+    return registers;
+  }
+
+  //! instruction of a basic block with the index of its first instruction in the original code buffer
+  struct Item
+  {
+    Instruction instruction;
+    std::size_t origin;
+  };
+
+  struct Block
+  {
+    std::size_t start;
+    std::size_t length;  //!< number of instructions in the original code buffer
+    bool pinned;
+    std::vector<Item> items;
+  };
+
+  /**
+   * Removes self moves and general purpose instructions whose result is overwritten in the block before it is read.
+   */
+  std::size_t remove_redundant(std::vector<Item> &items)
+  {
+    std::vector<bool> remove(items.size(), false);
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+      Instruction const &instruction = items[i].instruction;
+      uint32_t code = instruction.code;
+
+      // mov xd, xd and add xd, xd, #0
+      bool self_move = (code & 0xFFE0FFE0) == 0xAA0003E0 && get_field(code, 0) == get_field(code, 16);
+      bool self_add = (code & 0xFF3FFC00) == 0x91000000 && get_field(code, 0) == get_field(code, 5);
+      if (self_move || self_add)
+      {
+        remove[i] = true;
+        continue;
+      }
+
+      register_set_t written = get_registers(instruction, true);
+      if (!instruction.alu || written.count() != 1)
+      {
+        continue;
+      }
+
+      for (std::size_t j = i + 1; j < items.size(); ++j)
+      {
+        if (remove[j])
+        {
+          continue;
+        }
+        if ((get_registers(items[j].instruction, false) & written).any())
+        {
+          break;
+        }
+        if ((get_registers(items[j].instruction, true) & written).any())
+        {
+          remove[i] = true;
+          break;
+        }
+      }
+    }
+
+    std::size_t removed = 0;
+    std::vector<Item> kept;
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+      if (remove[i])
+      {
+        ++removed;
+      }
+      else
+      {
+        kept.push_back(items[i]);
+      }
+    }
+    items = std::move(kept);
+    return removed;
+  }
+
+  /**
+   * Merges adjacent ldr instructions of consecutive addresses into ldp.
+   */
+  std::size_t merge_loads(std::vector<Item> &items)
+  {
+    std::size_t merged = 0;
+    std::vector<Item> result;
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+      if (i + 1 < items.size() && items[i].instruction.pairable && items[i + 1].instruction.pairable)
+      {
+        Instruction const &first = items[i].instruction;
+        Instruction const &second = items[i + 1].instruction;
+        bool is_vector = (first.code >> 26) & 0b1;
+        uint32_t base = get_field(first.code, 5);
+        uint32_t size = first.access_size;
+
+        bool compatible = is_vector == static_cast<bool>((second.code >> 26) & 0b1) && size == second.access_size &&
+                          base == get_field(second.code, 5) && get_field(first.code, 0) != get_field(second.code, 0) &&
+                          (is_vector || get_field(first.code, 0) != base);
+
+        Instruction const *low = first.offset < second.offset ? &first : &second;
+        Instruction const *high = first.offset < second.offset ? &second : &first;
+        if (compatible && high->offset == low->offset + size && low->offset / size <= 63)
+        {
+          uint32_t opc = 0;
+          uint32_t code = 0;
+          if (is_vector)
+          {
+            opc = size == 4 ? 0b00 : (size == 8 ? 0b01 : 0b10);
+            code = 0x2D400000;
+          }
+          else
+          {
+            opc = size == 8 ? 0b10 : 0b00;
+            code = 0x29400000;
+          }
+          code |= opc << 30;
+          code |= ((low->offset / size) & 0x7F) << 15;
+          code |= get_field(high->code, 0) << 10;
+          code |= base << 5;
+          code |= get_field(low->code, 0);
+
+          result.push_back(Item{decode(code), items[i].origin});
+          ++merged;
+          ++i;
+          continue;
+        }
+      }
+      result.push_back(items[i]);
+    }
+    items = std::move(result);
+    return merged;
+  }
+
+  /**
+   * Renames vector registers that are written and overwritten inside the block to unused registers.
+   * This removes the write-after-read dependencies that prevent the scheduler from issuing loads early.
+   * The register that is released for the longest time is chosen, hence consecutive values do not share a register.
+   */
+  std::size_t rename_registers(std::vector<Item> &items, std::vector<uint32_t> const &free_registers)
+  {
+    std::size_t renamed = 0;
+    std::vector<int64_t> busy_until(32, -1);
+
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+      Instruction &definition = items[i].instruction;
+      for (Operand &operand : definition.operands)
+      {
+        if (operand.bank != bank_t::vector || operand.count != 1 || !operand.write || operand.read)
+        {
+          continue;
+        }
+
+        uint32_t number = get_field(definition.code, operand.shift);
+        uint32_t id = register_vector + number;
+        if (get_registers(definition, false).test(id))
+        {
+          continue;
+        }
+
+        // all reads of the value must be renameable and the value must be overwritten in the block
+        std::vector<std::size_t> uses;
+        bool killed = false;
+        bool renameable = true;
+        for (std::size_t j = i + 1; j < items.size() && renameable && !killed; ++j)
+        {
+          Instruction const &user = items[j].instruction;
+          bool reads = get_registers(user, false).test(id);
+          bool writes = get_registers(user, true).test(id);
+          if (reads)
+          {
+            for (Operand const &user_operand : user.operands)
+            {
+              uint32_t user_number = get_field(user.code, user_operand.shift);
+              bool covers = user_operand.bank == bank_t::vector && (number - user_number + 32) % 32 < user_operand.count;
+              if (user_operand.read && covers && (user_operand.count != 1 || user_operand.write))
+              {
+                renameable = false;
+              }
+            }
+            uses.push_back(j);
+          }
+          if (writes)
+          {
+            killed = !reads;
+            renameable = renameable && !reads;
+          }
+        }
+        if (!renameable || !killed || uses.empty())
+        {
+          continue;
+        }
+
+        auto free_register = std::min_element(free_registers.begin(), free_registers.end(), [&busy_until](uint32_t lhs, uint32_t rhs)
+                                              { return busy_until[lhs] < busy_until[rhs]; });
+        if (free_register == free_registers.end() || busy_until[*free_register] >= static_cast<int64_t>(i))
+        {
+          continue;
+        }
+
+        uint32_t replacement = *free_register;
+        definition.code = (definition.code & ~(0x1F << operand.shift)) | (replacement << operand.shift);
+        for (std::size_t j : uses)
+        {
+          Instruction &user = items[j].instruction;
+          for (Operand const &user_operand : user.operands)
+          {
+            if (user_operand.bank == bank_t::vector && user_operand.read && get_field(user.code, user_operand.shift) == number)
+            {
+              user.code = (user.code & ~(0x1F << user_operand.shift)) | (replacement << user_operand.shift);
+            }
+          }
+        }
+        busy_until[replacement] = static_cast<int64_t>(uses.back());
+        ++renamed;
+      }
+    }
+
+    return renamed;
+  }
+
+  /**
+   * Reorders the block by a list scheduler that prefers the instruction on the longest latency path.
+   */
+  std::size_t schedule(std::vector<Item> &items)
+  {
+    std::size_t count = items.size();
+    std::vector<register_set_t> reads(count);
+    std::vector<register_set_t> writes(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      reads[i] = get_registers(items[i].instruction, false);
+      writes[i] = get_registers(items[i].instruction, true);
+    }
+
+    // dependencies with the minimum distance in cycles
+    std::vector<std::vector<std::pair<std::size_t, uint32_t>>> successors(count);
+    std::vector<std::size_t> predecessor_count(count, 0);
+    for (std::size_t j = 0; j < count; ++j)
+    {
+      for (std::size_t i = 0; i < j; ++i)
+      {
+        Instruction const &first = items[i].instruction;
+        Instruction const &second = items[j].instruction;
+
+        bool raw = (writes[i] & reads[j]).any();
+        bool war = (reads[i] & writes[j]).any();
+        bool waw = (writes[i] & writes[j]).any();
+        bool memory = (first.store && (second.load || second.store)) || (first.load && second.store);
+        if (raw || war || waw || memory)
+        {
+          successors[i].push_back({j, raw ? first.latency : 0});
+          ++predecessor_count[j];
+        }
+      }
+    }
+
+    // priority is the longest latency path to the end of the block
+    std::vector<uint32_t> priority(count, 0);
+    for (std::size_t i = count; i-- > 0;)
+    {
+      priority[i] = items[i].instruction.latency;
+      for (auto const &[successor, latency] : successors[i])
+      {
+        priority[i] = std::max(priority[i], latency + priority[successor]);
+      }
+    }
+
+    std::vector<uint32_t> ready_cycle(count, 0);
+    std::vector<bool> scheduled(count, false);
+    std::vector<std::size_t> order;
+    uint32_t cycle = 0;
+    while (order.size() < count)
+    {
+      std::size_t best = count;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (scheduled[i] || predecessor_count[i] != 0)
+        {
+          continue;
+        }
+        if (best == count)
+        {
+          best = i;
+          continue;
+        }
+
+        bool ready = ready_cycle[i] <= cycle;
+        bool best_ready = ready_cycle[best] <= cycle;
+        if (ready != best_ready)
+        {
+          best = ready ? i : best;
+        }
+        else if (!ready && ready_cycle[i] != ready_cycle[best])
+        {
+          best = ready_cycle[i] < ready_cycle[best] ? i : best;
+        }
+        else if (priority[i] > priority[best])
+        {
+          best = i;
+        }
+      }
+
+      scheduled[best] = true;
+      order.push_back(best);
+      cycle = std::max(cycle, ready_cycle[best]);
+      for (auto const &[successor, latency] : successors[best])
+      {
+        ready_cycle[successor] = std::max(ready_cycle[successor], cycle + latency);
+        --predecessor_count[successor];
+      }
+      ++cycle;
+    }
+
+    std::size_t moved = 0;
+    std::vector<Item> result;
+    for (std::size_t position = 0; position < count; ++position)
+    {
+      moved += order[position] != position;
+      result.push_back(items[order[position]]);
+    }
+    items = std::move(result);
+    return moved;
+  }
+
+  /**
+   * Decodes the pc-relative offset of a branch in instructions.
+   */
+  int64_t get_branch_offset(uint32_t code, branch_t branch)
+  {
+    switch (branch)
+    {
+    case branch_t::imm14:
+      return static_cast<int64_t>(static_cast<int32_t>(((code >> 5) & 0x3FFF) << 18) >> 18);
+    case branch_t::imm19:
+      return static_cast<int64_t>(static_cast<int32_t>(((code >> 5) & 0x7FFFF) << 13) >> 13);
+    case branch_t::imm26:
+      return static_cast<int64_t>(static_cast<int32_t>((code & 0x3FFFFFF) << 6) >> 6);
+    default:
+      return 0;
+    }
+  }
+
+  /**
+   * Encodes the pc-relative offset of a branch in instructions.
+   */
+  uint32_t set_branch_offset(uint32_t code, branch_t branch, int64_t offset)
+  {
+    uint32_t value = static_cast<uint32_t>(offset);
+    switch (branch)
+    {
+    case branch_t::imm14:
+      return (code & ~(0x3FFFu << 5)) | ((value & 0x3FFF) << 5);
+    case branch_t::imm19:
+      return (code & ~(0x7FFFFu << 5)) | ((value & 0x7FFFF) << 5);
+    case branch_t::imm26:
+      return (code & ~0x3FFFFFFu) | (value & 0x3FFFFFF);
+    default:
+      return code;
+    }
+  }
+}  // namespace
+
+mini_jit::Peephole::Statistics mini_jit::Peephole::optimize(Kernel &kernel)
+{
+  Statistics statistics;
+  std::vector<uint32_t> const &buffer = kernel.get_buffer();
+  std::size_t size = buffer.size();
+
+  std::vector<Instruction> instructions;
+  instructions.reserve(size);
+  for (uint32_t code : buffer)
+  {
+    instructions.push_back(decode(code));
+  }
+
+  // branch targets and pinned instructions start new basic blocks
+  std::unordered_set<std::size_t> patch_points;
+  for (auto const &patch_point : kernel.get_patch_points())
+  {
+    patch_points.insert(patch_point.second);
+  }
+
+  std::vector<bool> block_start(size + 1, false);
+  std::vector<bool> pinned(size, false);
+  bool all_known = true;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    Instruction const &instruction = instructions[i];
+    pinned[i] = !instruction.known || patch_points.count(i) != 0;
+    all_known = all_known && (instruction.known || instruction.branch != branch_t::none);
+
+    if (instruction.branch != branch_t::none && instruction.branch != branch_t::indirect)
+    {
+      int64_t target = static_cast<int64_t>(i) + get_branch_offset(instruction.code, instruction.branch);
+      if (target < 0 || target > static_cast<int64_t>(size))
+      {
+        return statistics;  // leaves the kernel, keep the code unchanged
+      }
+      block_start[target] = true;
+    }
+  }
+
+  // caller-saved vector registers that are never referenced by the kernel
+  std::vector<uint32_t> free_registers;
+  if (all_known)
+  {
+    register_set_t used;
+    for (Instruction const &instruction : instructions)
+    {
+      used |= get_registers(instruction, false) | get_registers(instruction, true);
+    }
+    for (uint32_t number = 0; number < 32; ++number)
+    {
+      bool callee_saved = number >= 8 && number <= 15;
+      if (!callee_saved && !used.test(register_vector + number))
+      {
+        free_registers.push_back(number);
+      }
+    }
+  }
+
+  std::vector<Block> blocks;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    if (blocks.empty() || block_start[i] || pinned[i] || blocks.back().pinned)
+    {
+      blocks.push_back(Block{i, 0, pinned[i], {}});
+    }
+    blocks.back().items.push_back(Item{instructions[i], i});
+    ++blocks.back().length;
+  }
+
+  for (Block &block : blocks)
+  {
+    if (block.pinned)
+    {
+      continue;
+    }
+    statistics.removed_instructions += remove_redundant(block.items);
+    statistics.merged_loads += merge_loads(block.items);
+    statistics.renamed_registers += rename_registers(block.items, free_registers);
+    statistics.moved_instructions += schedule(block.items);
+  }
+
+  // emit the blocks and map the original indices to the new indices, removed instructions map to their block start
+  std::vector<std::size_t> index_map(size, 0);
+  std::unordered_map<std::size_t, std::size_t> new_block_start;
+  std::vector<uint32_t> code;
+  for (Block const &block : blocks)
+  {
+    new_block_start[block.start] = code.size();
+    for (std::size_t i = block.start; i < block.start + block.length; ++i)
+    {
+      index_map[i] = code.size();
+    }
+    for (Item const &item : block.items)
+    {
+      index_map[item.origin] = code.size();
+      code.push_back(item.instruction.code);
+    }
+  }
+  new_block_start[size] = code.size();
+
+  // all branches are pinned, adjust their offsets to the new block starts
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    Instruction const &instruction = instructions[i];
+    if (instruction.branch == branch_t::none || instruction.branch == branch_t::indirect)
+    {
+      continue;
+    }
+
+    std::size_t target = i + get_branch_offset(instruction.code, instruction.branch);
+    int64_t offset = static_cast<int64_t>(new_block_start.at(target)) - static_cast<int64_t>(index_map[i]);
+    code[index_map[i]] = set_branch_offset(instruction.code, instruction.branch, offset);
+  }
+
+  kernel.replace_buffer(std::move(code), index_map);
+  return statistics;
+}
@@ -0,0 +1,42 @@
+#ifndef MINI_JIT_PEEPHOLE_H
+#define MINI_JIT_PEEPHOLE_H
+
+#include "Kernel.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace mini_jit
+{
+
+  /**
+   * Post-pass over the code buffer of a generated kernel.
+   * The pass decodes the instructions emitted through arm_instructions and
+   * - removes self moves and moves that are overwritten before being read,
+   * - merges adjacent ldr instructions of consecutive addresses into ldp,
+   * - renames short-lived vector registers to unused caller-saved registers and reorders each basic block by a
+   *   latency-driven list scheduler, hence loads are issued early and interleaved with the fmla instructions.
+   * Instructions that cannot be decoded, branches and patch points are never moved, branch offsets are adjusted.
+   * The pass must run before the kernel is set.
+   */
+  class Peephole
+  {
+  public:
+    struct Statistics
+    {
+      std::size_t removed_instructions = 0;
+      std::size_t merged_loads = 0;
+      std::size_t renamed_registers = 0;
+      std::size_t moved_instructions = 0;
+    };
+
+    /**
+     * Optimizes the code buffer of the kernel.
+     *
+     * @param kernel kernel whose code buffer is optimized.
+     * @return statistics of the applied transformations.
+     **/
+    static Statistics optimize(Kernel &kernel);
+  };
+
+}  // namespace mini_jit
+#endif
@@ -0,0 +1,293 @@
+#include "PerfMap.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+  //! jitdump magic "JiTD" and version as defined in tools/perf/util/jitdump.h of the Linux kernel
+  constexpr uint32_t jitdump_magic = 0x4A695444;
+  constexpr uint32_t jitdump_version = 1;
+  constexpr uint32_t jitdump_code_load = 0;
+  constexpr uint32_t jitdump_code_close = 3;
+  constexpr uint32_t elf_machine_aarch64 = 183;
+
+  struct JitdumpHeader
+  {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t total_size;
+    uint32_t elf_mach;
+    uint32_t pad1;
+    uint32_t pid;
+    uint64_t timestamp;
+    uint64_t flags;
+  };
+
+  struct JitdumpRecordHeader
+  {
+    uint32_t id;
+    uint32_t total_size;
+    uint64_t timestamp;
+  };
+
+  /**
+   * Layout of a code load record.
+   * The record is followed by the zero terminated name and the machine code.
+   */
+  struct JitdumpCodeLoad
+  {
+    JitdumpRecordHeader header;
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;
+    uint64_t code_addr;
+    uint64_t code_size;
+    uint64_t code_index;
+  };
+
+  /**
+   * Gets the timestamp of the clock used by 'perf record -k mono'.
+   *
+   * @return monotonic time in nanoseconds.
+   */
+  uint64_t get_timestamp()
+  {
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000 + static_cast<uint64_t>(time.tv_nsec);
+  }
+
+  /**
+   * Writes all bytes to a file descriptor.
+   *
+   * @param file file descriptor.
+   * @param data bytes to write.
+   * @param size_bytes number of bytes.
+   * @return true if all bytes were written.
+   */
+  bool write_all(int file, void const *data, std::size_t size_bytes)
+  {
+    char const *bytes = reinterpret_cast<char const *>(data);
+    while (size_bytes > 0)
+    {
+      ssize_t written = write(file, bytes, size_bytes);
+      if (written == -1 && errno == EINTR)
+      {
+        continue;
+      }
+      if (written <= 0)
+      {
+        return false;
+      }
+      bytes += written;
+      size_bytes -= static_cast<std::size_t>(written);
+    }
+    return true;
+  }
+
+  /**
+   * Gets the path of a file named after the process id.
+   *
+   * @param directory directory of the file.
+   * @param prefix file name before the process id.
+   * @param suffix file name after the process id.
+   * @return path of the file.
+   */
+  std::string get_process_path(std::string const &directory, char const *prefix, char const *suffix)
+  {
+    return directory + "/" + prefix + std::to_string(getpid()) + suffix;
+  }
+
+  /**
+   * Reads a boolean flag from the environment.
+   *
+   * @param variable name of the environment variable.
+   * @return true if the variable is set to 1.
+   */
+  bool get_environment_flag(char const *variable)
+  {
+    char const *value = std::getenv(variable);
+    return value != nullptr && std::strcmp(value, "1") == 0;
+  }
+}  // namespace
+
+mini_jit::PerfMap::~PerfMap() noexcept
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  close_files();
+}
+
+mini_jit::PerfMap &mini_jit::PerfMap::instance()
+{
+  // never destroyed, kernels of other static objects may be registered during exit
+  static PerfMap *perf_map = []()
+  {
+    PerfMap *perf_map = new PerfMap();
+    perf_map->set_perf_map_enabled(get_environment_flag(perf_map_environment_variable));
+    perf_map->set_jitdump_enabled(get_environment_flag(jitdump_environment_variable));
+    return perf_map;
+  }();
+  return *perf_map;
+}
+
+bool mini_jit::PerfMap::open_perf_map()
+{
+  if (perf_map_file != -1)
+  {
+    return true;
+  }
+
+  std::string path = get_process_path(directory, "perf-", ".map");
+  perf_map_file = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  if (perf_map_file == -1)
+  {
+    std::cerr << "Warning: disabling the perf map, failed to open " << path << ": " << std::strerror(errno) << std::endl;
+    perf_map_enabled = false;
+    return false;
+  }
+  return true;
+}
+
+bool mini_jit::PerfMap::open_jitdump()
+{
+  if (jitdump_file != -1)
+  {
+    return true;
+  }
+
+  std::string path = get_process_path(directory, "jit-", ".dump");
+  jitdump_file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (jitdump_file == -1)
+  {
+    std::cerr << "Warning: disabling the jitdump, failed to open " << path << ": " << std::strerror(errno) << std::endl;
+    jitdump_enabled = false;
+    return false;
+  }
+
+  JitdumpHeader header{};
+  header.magic = jitdump_magic;
+  header.version = jitdump_version;
+  header.total_size = sizeof(header);
+  header.elf_mach = elf_machine_aarch64;
+  header.pid = static_cast<uint32_t>(getpid());
+  header.timestamp = get_timestamp();
+  if (!write_all(jitdump_file, &header, sizeof(header)))
+  {
+    close(jitdump_file);
+    jitdump_file = -1;
+    std::cerr << "Warning: disabling the jitdump, failed to write the header of " << path << std::endl;
+    jitdump_enabled = false;
+    return false;
+  }
+
+  // perf record only picks up jitdumps that are mapped executable by the process
+  void *marker = mmap(0, static_cast<std::size_t>(sysconf(_SC_PAGESIZE)), PROT_READ | PROT_EXEC, MAP_PRIVATE, jitdump_file, 0);
+  jitdump_marker = marker == MAP_FAILED ? nullptr : marker;
+  return true;
+}
+
+void mini_jit::PerfMap::close_files()
+{
+  if (perf_map_file != -1)
+  {
+    close(perf_map_file);
+    perf_map_file = -1;
+  }
+
+  if (jitdump_file != -1)
+  {
+    JitdumpRecordHeader record{jitdump_code_close, sizeof(JitdumpRecordHeader), get_timestamp()};
+    write_all(jitdump_file, &record, sizeof(record));
+    close(jitdump_file);
+    jitdump_file = -1;
+  }
+
+  if (jitdump_marker != nullptr)
+  {
+    munmap(jitdump_marker, static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+    jitdump_marker = nullptr;
+  }
+}
+
+void mini_jit::PerfMap::add(std::string const &name, void const *code, std::size_t size_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if ((!perf_map_enabled && !jitdump_enabled) || code == nullptr || size_bytes == 0)
+  {
+    return;
+  }
+
+  uint64_t address = reinterpret_cast<uintptr_t>(code);
+
+  if (perf_map_enabled && open_perf_map())
+  {
+
+    // one line per symbol: <start> <size> <name> with hexadecimal start and size
+    char range[40];
+    int length =
+      std::snprintf(range, sizeof(range), "%lx %lx ", static_cast<unsigned long>(address), static_cast<unsigned long>(size_bytes));
+    std::string line = std::string(range, length) + name + "\n";
+    write_all(perf_map_file, line.data(), line.size());
+  }
+
+  if (jitdump_enabled && open_jitdump())
+  {
+
+    JitdumpCodeLoad record{};
+    record.header.id = jitdump_code_load;
+    record.header.total_size = static_cast<uint32_t>(sizeof(record) + name.size() + 1 + size_bytes);
+    record.header.timestamp = get_timestamp();
+    record.pid = static_cast<uint32_t>(getpid());
+    record.tid = static_cast<uint32_t>(syscall(SYS_gettid));
+    record.vma = address;
+    record.code_addr = address;
+    record.code_size = size_bytes;
+    record.code_index = code_index++;
+
+    // a single write per record, the jitdump stays parsable if the process is killed
+    std::vector<char> bytes(record.header.total_size);
+    std::memcpy(bytes.data(), &record, sizeof(record));
+    std::memcpy(bytes.data() + sizeof(record), name.c_str(), name.size() + 1);
+    std::memcpy(bytes.data() + sizeof(record) + name.size() + 1, code, size_bytes);
+    write_all(jitdump_file, bytes.data(), bytes.size());
+  }
+}
+
+void mini_jit::PerfMap::set_perf_map_enabled(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  perf_map_enabled = enabled;
+}
+
+void mini_jit::PerfMap::set_jitdump_enabled(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  jitdump_enabled = enabled;
+}
+
+bool mini_jit::PerfMap::is_enabled() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return perf_map_enabled || jitdump_enabled;
+}
+
+std::string mini_jit::PerfMap::get_perf_map_path() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return get_process_path(directory, "perf-", ".map");
+}
+
+std::string mini_jit::PerfMap::get_jitdump_path() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return get_process_path(directory, "jit-", ".dump");
+}
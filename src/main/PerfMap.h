@@ -0,0 +1,151 @@
+#ifndef MINI_JIT_PERF_MAP_H
+#define MINI_JIT_PERF_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace mini_jit
+{
+
+  /**
+   * Registers the symbols of jitted kernels for Linux perf.
+   * The perf map (<directory>/perf-<pid>.map) is read by perf report to name samples inside kernels.
+   * The jitdump (<directory>/jit-<pid>.dump) additionally contains the machine code for perf annotate,
+   * record with 'perf record -k mono' and run 'perf inject --jit' before reporting.
+   */
+  class PerfMap
+  {
+  public:
+    //! environment variable that enables the perf map of the process-wide instance if set to 1
+    static constexpr char const *perf_map_environment_variable = "MLC_PERF_MAP";
+
+    //! environment variable that enables the jitdump of the process-wide instance if set to 1
+    static constexpr char const *jitdump_environment_variable = "MLC_PERF_JITDUMP";
+
+    //! directory perf searches for perf maps
+    static constexpr char const *default_directory = "/tmp";
+
+  private:
+    //! guards all members below
+    mutable std::mutex mutex;
+
+    //! directory of the perf map and the jitdump
+    std::string directory;
+
+    bool perf_map_enabled = false;
+    bool jitdump_enabled = false;
+
+    //! file descriptor of the perf map, -1 if not opened
+    int perf_map_file = -1;
+
+    //! file descriptor of the jitdump, -1 if not opened
+    int jitdump_file = -1;
+
+    //! executable mapping of the jitdump header, perf record uses it to find the jitdump
+    void *jitdump_marker = nullptr;
+
+    //! unique index of each code load record in the jitdump
+    uint64_t code_index = 0;
+
+    /**
+     * Opens the perf map if not opened yet.
+     * Disables the perf map and reports the error on the standard error if the file can not be opened.
+     * The caller must hold the mutex.
+     *
+     * @return true if the perf map is opened.
+     **/
+    bool open_perf_map();
+
+    /**
+     * Opens the jitdump and writes its header if not opened yet.
+     * Disables the jitdump and reports the error on the standard error if the file can not be created.
+     * The caller must hold the mutex.
+     *
+     * @return true if the jitdump is opened.
+     **/
+    bool open_jitdump();
+
+    /**
+     * Closes all opened files.
+     * The caller must hold the mutex.
+     **/
+    void close_files();
+
+  public:
+    /**
+     * Constructor
+     *
+     * @param directory directory of the perf map and the jitdump.
+     **/
+    explicit PerfMap(std::string directory = default_directory) : directory(std::move(directory)) {};
+
+    /**
+     * Destructor
+     **/
+    ~PerfMap() noexcept;
+
+    PerfMap(PerfMap const &) = delete;
+    PerfMap &operator=(PerfMap const &) = delete;
+    PerfMap(PerfMap &&) noexcept = delete;
+    PerfMap &operator=(PerfMap &&) noexcept = delete;
+
+    /**
+     * Gets the process-wide instance used by all kernels.
+     * The outputs are enabled through the environment variables MLC_PERF_MAP and MLC_PERF_JITDUMP.
+     *
+     * @return the process-wide instance.
+     **/
+    static PerfMap &instance();
+
+    /**
+     * Registers the symbol of an executable kernel.
+     * Does nothing if neither the perf map nor the jitdump is enabled.
+     * An output whose file can not be opened, e.g. in a read-only directory, is disabled instead of failing the kernel.
+     *
+     * @param name symbol name of the kernel.
+     * @param code executable entry point of the kernel.
+     * @param size_bytes size of the kernel in bytes.
+     **/
+    void add(std::string const &name, void const *code, std::size_t size_bytes);
+
+    /**
+     * Enables or disables writing the perf map.
+     *
+     * @param enabled true to register new kernels in the perf map.
+     **/
+    void set_perf_map_enabled(bool enabled);
+
+    /**
+     * Enables or disables writing the jitdump.
+     *
+     * @param enabled true to register new kernels in the jitdump.
+     **/
+    void set_jitdump_enabled(bool enabled);
+
+    /**
+     * Indicates if any output is enabled.
+     *
+     * @return true if the perf map or the jitdump is enabled.
+     **/
+    bool is_enabled() const;
+
+    /**
+     * Gets the path of the perf map of this process.
+     *
+     * @return path of the perf map.
+     **/
+    std::string get_perf_map_path() const;
+
+    /**
+     * Gets the path of the jitdump of this process.
+     *
+     * @return path of the jitdump.
+     **/
+    std::string get_jitdump_path() const;
+  };
+
+}  // namespace mini_jit
+#endif
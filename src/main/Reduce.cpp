@@ -0,0 +1,54 @@
+#include "Reduce.h"
+#include "KernelCache.h"
+#include "kernels/reduce/reduce.h"
+#include "release_assert.h"
+#include <format>
+
+mini_jit::Reduce::error_t mini_jit::Reduce::generate(uint32_t m, uint32_t n, axis_t axis, bool accumulate, dtype_t dtype, ptype_t ptype,
+                                                     int64_t mean_size)
+{
+  if (dtype != dtype_t::fp32 && dtype != dtype_t::fp64)
+  {
+    return error_t::err_wrong_dtype;
+  }
+  if (m == 0 || n == 0 || mean_size <= 0)
+  {
+    return error_t::err_wrong_dimension;
+  }
+  release_assert(ptype <= ptype_t::mean, "Found unhandled ptype_t");
+  release_assert(axis <= axis_t::n, "Found unhandled axis_t");
+
+  // A mean is the sum of the elements divided by their number
+  const int64_t size = ptype == ptype_t::mean ? mean_size : 1;
+  const std::string key = std::format("reduce_m{}_n{}_axis{}_acc{}_dtype{}_ptype{}_size{}", m, n, static_cast<int32_t>(axis),
+                                      static_cast<int32_t>(accumulate), static_cast<int32_t>(dtype), static_cast<int32_t>(ptype), size);
+
+  native_kernel = KernelCache::instance().get_or_generate(
+    key,
+    [&](mini_jit::Kernel &native_kernel)
+    {
+      const kernels::reduce_op_t op = ptype == ptype_t::max ? kernels::reduce_op_t::max : kernels::reduce_op_t::sum;
+      const kernels::reduce_axis_t kernel_axis = axis == axis_t::m ? kernels::reduce_axis_t::m : kernels::reduce_axis_t::n;
+      const kernels::dtype_t kernel_dtype = dtype == dtype_t::fp64 ? kernels::dtype_t::fp64 : kernels::dtype_t::fp32;
+      constexpr char const *names[] = {"sum", "max", "mean"};
+      native_kernel.set_name(std::format("reduce_{}_{}{}{}_m{}_n{}", names[static_cast<uint32_t>(ptype)], axis == axis_t::m ? "m" : "n",
+                                         dtype == dtype_t::fp64 ? "_fp64" : "", accumulate ? "_accumulate" : "", m, n));
+      kernels::reduce(native_kernel, m, n, op, kernel_dtype, kernel_axis, accumulate, 1.0 / static_cast<double>(size));
+    });
+  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel->get_kernel()));
+
+  return error_t::success;
+}
+
+mini_jit::Reduce::kernel_t mini_jit::Reduce::get_kernel() const
+{
+  return kernel;
+}
+
+void mini_jit::Reduce::write_kernel_to_file(const char *path) const
+{
+  if (native_kernel != nullptr)
+  {
+    native_kernel->write(path);
+  }
+}
@@ -0,0 +1,88 @@
+#ifndef MINI_JIT_REDUCE_H
+#define MINI_JIT_REDUCE_H
+
+#include "Kernel.h"
+#include <cstdint>
+#include <memory>
+
+namespace mini_jit
+{
+  class Reduce;
+}
+
+class mini_jit::Reduce
+{
+public:
+  /*
+   * Kernel type.
+   * The kernel is a function that takes the following parameters:
+   * - a:    Pointer to column-major matrix A.
+   * - b:    Pointer to the row or column B.
+   * - ld_a: Leading dimension of A.
+   * - ld_b: Stride between the elements of a row B, unused by a column B.
+   */
+  using kernel_t = void (*)(void const *a, void *b, int64_t ld_a, int64_t ld_b);
+
+  /// data type
+  enum class dtype_t : uint32_t
+  {
+    fp32 = 0,
+    fp64 = 1
+  };
+
+  /// primitive type, max propagates NaN
+  enum class ptype_t : uint32_t
+  {
+    sum = 0,
+    max = 1,
+    mean = 2,
+  };
+
+  /// reduced dimension of A
+  enum class axis_t : uint32_t
+  {
+    m = 0,
+    n = 1,
+  };
+
+  /// error codes
+  enum class error_t : int32_t
+  {
+    success = 0,
+    err_wrong_dtype = 1,
+    err_wrong_dimension = 2,
+  };
+
+private:
+  kernel_t kernel = nullptr;
+  std::shared_ptr<mini_jit::Kernel> native_kernel;
+
+public:
+  /**
+   * @brief Generate a kernel for a reduce primitive.
+   * @param m          Number of rows in A.
+   * @param n          Number of columns in A.
+   * @param axis       Reduced dimension, m writes a row of n elements, n writes a column of m elements.
+   * @param accumulate True if the reduction is combined with the values of B, false overwrites B.
+   * @param dtype      Data type of the matrices.
+   * @param ptype      Primitive type.
+   * @param mean_size  Number of elements of a mean, i.e. the sums are divided by it, ignored by sum and max.
+   * @return error_t::success on success, another error_t value otherwise.
+   **/
+  error_t generate(uint32_t m, uint32_t n, axis_t axis, bool accumulate, dtype_t dtype, ptype_t ptype, int64_t mean_size = 1);
+
+  /**
+   * @brief Get the generated kernel: B := reduce(A) or B := op(B, reduce(A)).
+   * @return pointer to the generated kernel.
+   **/
+  kernel_t get_kernel() const;
+
+  /**
+   * @brief Writes the current kernel into a file.
+   *
+   * @param path The file to write the kernel to.
+   */
+  void write_kernel_to_file(const char *path) const;
+};
+
+#endif
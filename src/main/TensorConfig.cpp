@@ -1,4 +1,5 @@
 #include "TensorConfig.h"
+#include "release_assert.h"
 #include <algorithm>
 #include <cstdint>
 #include <string>
@@ -57,4 +58,39 @@ std::string mini_jit::TensorConfig::to_string() const
   result += "]\n}";
 
   return result;
-}
\ No newline at end of file
+}
+
+uint32_t mini_jit::TensorConfig::get_dtype_size(dtype_t dtype)
+{
+  switch (dtype)
+  {
+  case dtype_t::fp32:
+    return sizeof(float);
+  case dtype_t::fp64:
+    return sizeof(double);
+  case dtype_t::bf16:
+    return sizeof(uint16_t);
+  case dtype_t::s8:
+    return sizeof(int8_t);
+  case dtype_t::s32:
+    return sizeof(int32_t);
+  case dtype_t::fp16:
+    return sizeof(uint16_t);
+  default:
+    release_assert(false, "Found unhandled dtype_t.");
+    return 0;
+  }
+}
+
+mini_jit::TensorConfig::dtype_t mini_jit::TensorConfig::get_output_dtype(dtype_t dtype)
+{
+  switch (dtype)
+  {
+  case dtype_t::bf16:
+    return dtype_t::fp32;
+  case dtype_t::s8:
+    return dtype_t::s32;
+  default:
+    return dtype;
+  }
+}
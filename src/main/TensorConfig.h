@@ -25,6 +25,23 @@ namespace mini_jit
       relu = 3,
       gemm = 4,
       brgemm = 5,
+      exp = 6,  // the activations are unary fp32 primitives, see kernels::unary_activation_t
+      sigmoid = 7,
+      tanh = 8,
+      gelu_erf = 9,
+      gelu_tanh = 10,
+      silu = 11,
+      add = 12,  // the binary primitives read in0 and in1, a stride of zero broadcasts the input
+      sub = 13,
+      mul = 14,
+      max = 15,
+      min = 16,
+      reduce_sum = 17,  // the reduce primitives combine the k dimensions of in0, the output has a stride of zero in them
+      reduce_max = 18,
+      reduce_mean = 19,
+      softmax = 20,  // the normalizations are fp32 primitives over the whole m dimension, see kernels::normalization_t
+      layer_norm = 21,
+      rms_norm = 22,
     };
 
     /// dimension type
@@ -41,7 +58,11 @@ namespace mini_jit
     enum class dtype_t : uint32_t
     {
       fp32 = 0,
-      fp64 = 1
+      fp64 = 1,
+      bf16 = 2,  // bfloat16 inputs of a gemm or brgemm with a single-precision output
+      s8 = 3,    // signed 8-bit integer inputs of a gemm or brgemm with a 32-bit integer output
+      s32 = 4,   // 32-bit integer output of the s8 inputs
+      fp16 = 5,  // half-precision inputs and output, a gemm or brgemm accumulates in single precision
     };
 
     /// @brief The first touch primitive to be executed.
@@ -71,7 +92,7 @@ namespace mini_jit
     /// @brief The strides of the output of each dimension.
     std::vector<int64_t> strides_out;
 
-    /// @brief The data type to be used in the tensor operation.
+    /// @brief The data type of the inputs of the tensor operation, the output has the data type of get_output_dtype.
     dtype_t dtype;
 
     /**
@@ -90,6 +111,24 @@ namespace mini_jit
      * @return false Both configuration are NOT equal.
      */
     static bool equals(const TensorConfig &config1, const TensorConfig config2);
+
+    /**
+     * @brief Gets the size of a single element of the given data type.
+     *
+     * @param dtype The data type of the elements.
+     * @return uint32_t The size of an element in bytes.
+     */
+    static uint32_t get_dtype_size(dtype_t dtype);
+
+    /**
+     * @brief Gets the data type of the output of a tensor operation whose inputs have the given data type.
+     * The products of bf16 inputs are accumulated into a fp32 output and those of s8 inputs into a s32 output, the other data types are
+     * used for the inputs and the output.
+     *
+     * @param dtype The data type of the inputs.
+     * @return dtype_t The data type of the output.
+     */
+    static dtype_t get_output_dtype(dtype_t dtype);
   };
 }  // namespace mini_jit
 
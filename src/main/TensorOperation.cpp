@@ -1,6 +1,9 @@
 #include "TensorOperation.h"
+#include "Cpu.h"
 #include "TensorOptimization.h"
 #include "release_assert.h"
+#include <algorithm>
+#include <atomic>
 #include <format>
 #include <iostream>
 #include <omp.h>
@@ -89,9 +92,51 @@
 //                           ...:::-+*####*#%###=...-.
 //                                     .-==+=...-.
 
+namespace
+{
+  /// packed inputs of a thread, a packed input is reused as long as the brgemm calls of the same execution read the same input
+  struct packed_inputs_t
+  {
+    std::vector<char> in0;
+    std::vector<char> in1;
+    char const *source_in0 = nullptr;
+    char const *source_in1 = nullptr;
+    uint64_t execution = 0;
+  };
+
+  //! scratch of the executing thread, grows to the largest packed inputs executed by the thread
+  thread_local packed_inputs_t packed_inputs;
+
+  //! id of the next execution, zero is never used
+  std::atomic<uint64_t> next_execution{1};
+}  // namespace
+
 bool mini_jit::TensorOperation::isUnary(TensorConfig::prim_t prim)
 {
-  return prim == TensorConfig::prim_t::copy || prim == TensorConfig::prim_t::relu || prim == TensorConfig::prim_t::zero;
+  return prim == TensorConfig::prim_t::copy || prim == TensorConfig::prim_t::relu || prim == TensorConfig::prim_t::zero ||
+         isActivation(prim);
+}
+
+bool mini_jit::TensorOperation::isActivation(TensorConfig::prim_t prim)
+{
+  return prim == TensorConfig::prim_t::exp || prim == TensorConfig::prim_t::sigmoid || prim == TensorConfig::prim_t::tanh ||
+         prim == TensorConfig::prim_t::gelu_erf || prim == TensorConfig::prim_t::gelu_tanh || prim == TensorConfig::prim_t::silu;
+}
+
+bool mini_jit::TensorOperation::isBinary(TensorConfig::prim_t prim)
+{
+  return prim == TensorConfig::prim_t::add || prim == TensorConfig::prim_t::sub || prim == TensorConfig::prim_t::mul ||
+         prim == TensorConfig::prim_t::max || prim == TensorConfig::prim_t::min;
+}
+
+bool mini_jit::TensorOperation::isReduce(TensorConfig::prim_t prim)
+{
+  return prim == TensorConfig::prim_t::reduce_sum || prim == TensorConfig::prim_t::reduce_max || prim == TensorConfig::prim_t::reduce_mean;
+}
+
+bool mini_jit::TensorOperation::isNormalization(TensorConfig::prim_t prim)
+{
+  return prim == TensorConfig::prim_t::softmax || prim == TensorConfig::prim_t::layer_norm || prim == TensorConfig::prim_t::rms_norm;
 }
 
 bool mini_jit::TensorOperation::isBrgemm(TensorConfig::prim_t prim)
@@ -124,8 +169,27 @@ int32_t mini_jit::TensorOperation::findMatch(const std::span<const TensorConfig:
 }
 
 bool mini_jit::TensorOperation::isValidPrimConfig(const std::span<const TensorConfig::dim_t> &dim,
-                                                  const std::span<const TensorConfig::exec_t> &exec)
+                                                  const std::span<const TensorConfig::exec_t> &exec, const TensorConfig::prim_t main_prim)
 {
+  if (isReduce(main_prim))
+  {
+    int32_t indexK = findMatch(dim, exec, TensorConfig::dim_t::k, TensorConfig::exec_t::prim);
+    int32_t indexM = findMatch(dim, exec, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
+    int32_t indexN = findMatch(dim, exec, TensorConfig::dim_t::n, TensorConfig::exec_t::prim);
+    if (indexK == -1 || (indexM == -1) == (indexN == -1))
+    {
+      std::cerr << "isValidPrimConfig: Expected a k primitive and either a m or a n primitive: indexK:" << indexK << ", indexM:" << indexM
+                << ", indexN:" << indexN << std::endl;
+      return false;
+    }
+
+    // Search for new that fits the configuration, all should return -1
+    indexK = findMatch(dim, exec, TensorConfig::dim_t::k, TensorConfig::exec_t::prim, indexK + 1);
+    indexM = indexM == -1 ? -1 : findMatch(dim, exec, TensorConfig::dim_t::m, TensorConfig::exec_t::prim, indexM + 1);
+    indexN = indexN == -1 ? -1 : findMatch(dim, exec, TensorConfig::dim_t::n, TensorConfig::exec_t::prim, indexN + 1);
+    return indexK == -1 && indexM == -1 && indexN == -1;
+  }
+
   int32_t indexM = findMatch(dim, exec, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
   int32_t indexN = findMatch(dim, exec, TensorConfig::dim_t::n, TensorConfig::exec_t::prim);
   if (indexM == -1 || indexN == -1)
@@ -153,6 +217,18 @@ bool mini_jit::TensorOperation::isValidPrimStrides(const std::span<const TensorC
 {
   int32_t indexM = findMatch(dim, exec, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
   int32_t indexN = findMatch(dim, exec, TensorConfig::dim_t::n, TensorConfig::exec_t::prim);
+
+  // A reduce keeps the rows of its columns or reduces the unit-stride rows of each column, the output is validated with the k dimensions
+  if (isReduce(main_prim))
+  {
+    int32_t indexK = findMatch(dim, exec, TensorConfig::dim_t::k, TensorConfig::exec_t::prim);
+    if (indexM != -1)
+    {
+      return isExpectedStride(1, indexM, strides_in0) && isExpectedStride(1, indexM, strides_out);
+    }
+    return isExpectedStride(1, indexK, strides_in0);
+  }
+
   if (indexM == -1 || indexN == -1)
   {
     std::cerr << "isValidStride: Could not find a matching index: indexM:" << indexM << ", indexN:" << indexN << std::endl;
@@ -172,6 +248,19 @@ bool mini_jit::TensorOperation::isValidPrimStrides(const std::span<const TensorC
     return true;
   }
 
+  // Binary broadcasts a single element of in0 per column, in1 is validated together with the other strides of the binary
+  if (isBinary(main_prim) && isExpectedStride(0, indexM, strides_in0) && isExpectedStride(1, indexM, strides_out))
+  {
+    return true;
+  }
+
+  // Brgemm writes a column-major or row-major output, the inputs are validated together with the k dimension
+  if (isBrgemm(main_prim) && (isExpectedStride(1, indexM, strides_out) || isExpectedStride(1, indexN, strides_out)))
+  {
+    isTransposeC = !isExpectedStride(1, indexM, strides_out);
+    return true;
+  }
+
   std::cerr << "isValidStride: Could not find a valid stride: in0: m-stride: " << strides_in0[indexM]
             << ", n-stride: " << strides_in0[indexN] << "; out: m-stride: " << strides_out[indexM] << ", n-stride: " << strides_out[indexN]
             << std::endl;
@@ -179,8 +268,8 @@ bool mini_jit::TensorOperation::isValidPrimStrides(const std::span<const TensorC
 }
 
 bool mini_jit::TensorOperation::isValidKDim(const std::span<const TensorConfig::dim_t> &dim,
-                                            const std::span<const TensorConfig::exec_t> &exec, const std::span<const int64_t> &strides_in1,
-                                            const TensorConfig::prim_t prim)
+                                            const std::span<const TensorConfig::exec_t> &exec, const std::span<const int64_t> &strides_in0,
+                                            const std::span<const int64_t> &strides_in1, const TensorConfig::prim_t prim)
 {
   if (isBrgemm(prim))
   {
@@ -202,16 +291,28 @@ bool mini_jit::TensorOperation::isValidKDim(const std::span<const TensorConfig::
       }
     }
 
-    if (!isExpectedStride(1, indexK, strides_in1))
+    int32_t indexM = findMatch(dim, exec, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
+    int32_t indexN = findMatch(dim, exec, TensorConfig::dim_t::n, TensorConfig::exec_t::prim);
+
+    // in0 has a unit stride in m (column-major) or in k (row-major)
+    if (!isExpectedStride(1, indexM, strides_in0) && !isExpectedStride(1, indexK, strides_in0))
     {
       return false;
     }
+    isTransposeA = !isExpectedStride(1, indexM, strides_in0);
+
+    // in1 has a unit stride in k (column-major) or in n (row-major)
+    if (!isExpectedStride(1, indexK, strides_in1) && !isExpectedStride(1, indexN, strides_in1))
+    {
+      return false;
+    }
+    isTransposeB = !isExpectedStride(1, indexK, strides_in1);
 
     // No other k dim should exists
     indexK = findMatch(dim, exec, TensorConfig::dim_t::k, TensorConfig::exec_t::prim, indexK + 1);
     return indexK == -1;
   }
-  else if (isUnary(prim))
+  else if (isUnary(prim) || isBinary(prim) || isNormalization(prim))
   {
     // Expected to find not K dim
     int32_t indexK = findMatch(dim, exec, TensorConfig::dim_t::k, TensorConfig::exec_t::prim);
@@ -358,11 +459,16 @@ bool mini_jit::TensorOperation::isValidStride(const std::span<const TensorConfig
 }
 
 mini_jit::Unary::error_t mini_jit::TensorOperation::generateUnary(Unary &unary, TensorConfig::prim_t prim,
-                                                                  const std::span<const int64_t> &dim_sizes, bool isTranspose)
+                                                                  const std::span<const int64_t> &dim_sizes, bool isTranspose,
+                                                                  TensorConfig::dtype_t dtype)
 {
   release_assert(indexPrimM != -1, "Expected a match for the m primitive dimension");
   release_assert(indexPrimN != -1, "Expected a match for the n primitive dimension");
 
+  // A row-major output is touched as the column-major transposed output
+  int64_t size_m = isTransposeC ? dim_sizes[indexPrimN] : dim_sizes[indexPrimM];
+  int64_t size_n = isTransposeC ? dim_sizes[indexPrimM] : dim_sizes[indexPrimN];
+
   Unary::ptype_t type;
   switch (prim)
   {
@@ -378,12 +484,222 @@ mini_jit::Unary::error_t mini_jit::TensorOperation::generateUnary(Unary &unary,
     type = Unary::ptype_t::relu;
     break;
 
+  case TensorConfig::prim_t::exp:
+    type = Unary::ptype_t::exp;
+    break;
+
+  case TensorConfig::prim_t::sigmoid:
+    type = Unary::ptype_t::sigmoid;
+    break;
+
+  case TensorConfig::prim_t::tanh:
+    type = Unary::ptype_t::tanh;
+    break;
+
+  case TensorConfig::prim_t::gelu_erf:
+    type = Unary::ptype_t::gelu_erf;
+    break;
+
+  case TensorConfig::prim_t::gelu_tanh:
+    type = Unary::ptype_t::gelu_tanh;
+    break;
+
+  case TensorConfig::prim_t::silu:
+    type = Unary::ptype_t::silu;
+    break;
+
   default:
     release_assert(false, "Found a invalid type for the unary first touch.");
     break;
   }
 
-  return unary.generate(dim_sizes[indexPrimM], dim_sizes[indexPrimN], isTranspose, Unary::dtype_t::fp32, type);
+  Unary::dtype_t unary_dtype = dtype == TensorConfig::dtype_t::fp64 ? Unary::dtype_t::fp64 : Unary::dtype_t::fp32;
+  if (dtype == TensorConfig::dtype_t::fp16)
+  {
+    unary_dtype = Unary::dtype_t::fp16;
+  }
+  return unary.generate(size_m, size_n, isTranspose, unary_dtype, type);
+}
+
+mini_jit::Binary::error_t mini_jit::TensorOperation::generateBinary(Binary &binary, TensorConfig::prim_t prim,
+                                                                    const std::span<const int64_t> &dim_sizes,
+                                                                    const std::span<const int64_t> &strides_in0,
+                                                                    const std::span<const int64_t> &strides_in1,
+                                                                    TensorConfig::dtype_t dtype, Binary::activation_t activation)
+{
+  release_assert(indexPrimM != -1, "Expected a match for the m primitive dimension");
+  release_assert(indexPrimN != -1, "Expected a match for the n primitive dimension");
+
+  if (dtype != TensorConfig::dtype_t::fp32 && dtype != TensorConfig::dtype_t::fp64)
+  {
+    return Binary::error_t::err_wrong_dtype;
+  }
+
+  Binary::ptype_t type;
+  switch (prim)
+  {
+  case TensorConfig::prim_t::add:
+    type = Binary::ptype_t::add;
+    break;
+
+  case TensorConfig::prim_t::sub:
+    type = Binary::ptype_t::sub;
+    break;
+
+  case TensorConfig::prim_t::mul:
+    type = Binary::ptype_t::mul;
+    break;
+
+  case TensorConfig::prim_t::max:
+    type = Binary::ptype_t::max;
+    break;
+
+  case TensorConfig::prim_t::min:
+    type = Binary::ptype_t::min;
+    break;
+
+  default:
+    release_assert(false, "Found a invalid type for the main binary.");
+    break;
+  }
+
+  const bool broadcast_in0 = strides_in0[indexPrimM] == 0;
+  const bool broadcast_in1 = strides_in1[indexPrimM] == 0;
+  Binary::dtype_t binary_dtype = dtype == TensorConfig::dtype_t::fp64 ? Binary::dtype_t::fp64 : Binary::dtype_t::fp32;
+  return binary.generate(dim_sizes[indexPrimM], dim_sizes[indexPrimN], broadcast_in0, broadcast_in1, binary_dtype, type, activation);
+}
+
+mini_jit::Reduce::error_t mini_jit::TensorOperation::generateReduce(Reduce &reduce, TensorConfig::prim_t prim,
+                                                                    const std::span<const TensorConfig::dim_t> &dim_types,
+                                                                    const std::span<const int64_t> &dim_sizes, bool accumulate,
+                                                                    TensorConfig::dtype_t dtype)
+{
+  release_assert(indexPrimK != -1, "Expected a match for the k primitive dimension");
+  release_assert(indexPrimM != -1 || indexPrimN != -1, "Expected a match for the m or the n primitive dimension");
+
+  if (dtype != TensorConfig::dtype_t::fp32 && dtype != TensorConfig::dtype_t::fp64)
+  {
+    return Reduce::error_t::err_wrong_dtype;
+  }
+
+  Reduce::ptype_t type;
+  switch (prim)
+  {
+  case TensorConfig::prim_t::reduce_sum:
+    type = Reduce::ptype_t::sum;
+    break;
+
+  case TensorConfig::prim_t::reduce_max:
+    type = Reduce::ptype_t::max;
+    break;
+
+  case TensorConfig::prim_t::reduce_mean:
+    type = Reduce::ptype_t::mean;
+    break;
+
+  default:
+    release_assert(false, "Found a invalid type for the main reduce.");
+    break;
+  }
+
+  // The mean divides by the number of elements of all k dimensions, each call adds its scaled part
+  int64_t mean_size = 1;
+  for (auto [iDim, iSize] = std::tuple{dim_types.begin(), dim_sizes.begin()}; iDim != dim_types.end(); ++iDim, ++iSize)
+  {
+    if (*iDim == TensorConfig::dim_t::k)
+    {
+      mean_size *= *iSize;
+    }
+  }
+
+  Reduce::dtype_t reduce_dtype = dtype == TensorConfig::dtype_t::fp64 ? Reduce::dtype_t::fp64 : Reduce::dtype_t::fp32;
+  if (indexPrimM != -1)
+  {
+    return reduce.generate(dim_sizes[indexPrimM], dim_sizes[indexPrimK], Reduce::axis_t::n, accumulate, reduce_dtype, type, mean_size);
+  }
+  return reduce.generate(dim_sizes[indexPrimK], dim_sizes[indexPrimN], Reduce::axis_t::m, accumulate, reduce_dtype, type, mean_size);
+}
+
+mini_jit::Normalization::error_t mini_jit::TensorOperation::generateNormalization(Normalization &normalization, TensorConfig::prim_t prim,
+                                                                                  const std::span<const int64_t> &dim_sizes,
+                                                                                  TensorConfig::dtype_t dtype)
+{
+  release_assert(indexPrimM != -1, "Expected a match for the m primitive dimension");
+  release_assert(indexPrimN != -1, "Expected a match for the n primitive dimension");
+
+  if (dtype != TensorConfig::dtype_t::fp32)
+  {
+    return Normalization::error_t::err_wrong_dtype;
+  }
+
+  Normalization::ptype_t type;
+  switch (prim)
+  {
+  case TensorConfig::prim_t::softmax:
+    type = Normalization::ptype_t::softmax;
+    break;
+
+  case TensorConfig::prim_t::layer_norm:
+    type = Normalization::ptype_t::layer_norm;
+    break;
+
+  case TensorConfig::prim_t::rms_norm:
+    type = Normalization::ptype_t::rms_norm;
+    break;
+
+  default:
+    release_assert(false, "Found a invalid type for the main normalization.");
+    break;
+  }
+
+  return normalization.generate(dim_sizes[indexPrimM], dim_sizes[indexPrimN], Normalization::dtype_t::fp32, type);
+}
+
+mini_jit::Brgemm::error_t mini_jit::TensorOperation::generateBrgemm(Brgemm &brgemm, const std::span<const int64_t> &dim_sizes,
+                                                                    const std::span<const int64_t> &strides_in0,
+                                                                    const std::span<const int64_t> &strides_in1, int64_t br_size,
+                                                                    Brgemm::dtype_t dtype, double beta, Brgemm::epilogue_t epilogue)
+{
+  release_assert(indexPrimM != -1, "Expected a match for the m primitive dimension");
+  release_assert(indexPrimN != -1, "Expected a match for the n primitive dimension");
+  release_assert(indexPrimK != -1, "Expected a match for the k primitive dimension");
+
+  int64_t size_m = dim_sizes[indexPrimM];
+  int64_t size_n = dim_sizes[indexPrimN];
+  int64_t size_k = dim_sizes[indexPrimK];
+
+  // The leading dimensions span the memory of the inputs, large leading dimensions touch a page per column
+  int64_t lda = isTransposeA ? strides_in0[indexPrimM] : strides_in0[indexPrimK];
+  int64_t ldb = isTransposeB ? strides_in1[indexPrimK] : strides_in1[indexPrimN];
+  const bool isInterleaved = dtype == Brgemm::dtype_t::bf16 || dtype == Brgemm::dtype_t::s8;
+  const bool isHalf = dtype == Brgemm::dtype_t::fp16_fp32;
+  int64_t dtype_bytes = dtype == Brgemm::dtype_t::fp64 ? 8 : (dtype == Brgemm::dtype_t::bf16 ? 2 : (dtype == Brgemm::dtype_t::s8 ? 1 : 4));
+  if (isHalf)
+  {
+    dtype_bytes = 2;
+  }
+  int64_t input_bytes = (lda * (isTransposeA ? size_m : size_k) + ldb * (isTransposeB ? size_k : size_n)) * br_size * dtype_bytes;
+
+  // The packed B is row-major, which requires a column-major A and output, the bf16 and int8 kernels only read packed inputs and the
+  // fp16 kernels read their column-major inputs in place
+  isPacked = !isTransposeC && !isHalf && (input_bytes > packing_threshold || isInterleaved);
+  if (!isPacked)
+  {
+    return brgemm.generate(size_m, size_n, size_k, br_size, isTransposeA, isTransposeB, isTransposeC, dtype, 1, beta, epilogue);
+  }
+
+  if (packing.generate(size_m, size_n, size_k, br_size, isTransposeA, isTransposeB, dtype) != Packing::error_t::success)
+  {
+    return Brgemm::error_t::err_packing_not_supported;
+  }
+
+  packed_bytes_in0 = packing.get_size_a() * br_size * dtype_bytes;
+  packed_bytes_in1 = packing.get_size_b() * br_size * dtype_bytes;
+
+  // The interleaved strips of bf16 and int8 are read in the order of column-major operands
+  const uint32_t trans_b = isInterleaved ? 0 : 1;
+  return brgemm.generate(size_m, size_n, size_k, br_size, 0, trans_b, 0, dtype, 1, beta, epilogue, {}, Brgemm::batch_reduce_t::stride,
+                         Brgemm::packing_t{true, true});
 }
 
 mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup(const TensorConfig &config)
@@ -406,6 +722,13 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
   hasSetupError = true;
   isParallel = false;
   isTranspose = false;
+  TensorOperation::prim_first = TensorConfig::prim_t::none;
+  TensorOperation::prim_main = TensorConfig::prim_t::none;
+  TensorOperation::prim_last = TensorConfig::prim_t::none;
+  isTransposeA = false;
+  isTransposeB = false;
+  isTransposeC = false;
+  isPacked = false;
   indexPrimBatch = -1;
   indexPrimK = -1;
   indexPrimM = -1;
@@ -422,9 +745,9 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
 
   if (!(strides_in0.size() == dim_sizes.size() && strides_out.size() == dim_sizes.size() &&
         (strides_in1.size() == dim_sizes.size()
-         // strides_in1 can be empty for unary operations
+         // strides_in1 can be empty for unary operations, reductions and normalizations
          || ((isUnary(prim_first_touch) || prim_first_touch == TensorConfig::prim_t::none) &&
-             (isUnary(prim_main) || prim_main == TensorConfig::prim_t::none) &&
+             (isUnary(prim_main) || isReduce(prim_main) || isNormalization(prim_main) || prim_main == TensorConfig::prim_t::none) &&
              (isUnary(prim_last_touch) || prim_last_touch == TensorConfig::prim_t::none) && strides_in1.empty()))))
   {
     hasSetupError = true;
@@ -455,14 +778,56 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
     }
   }
 
-  // Validate dtype types - currently only fp32 is supported
-  if (dtype != TensorConfig::dtype_t::fp32)
+  // Validate dtype types - fp32, fp64 and fp16 are supported, bf16 and s8 inputs are supported by the gemm and brgemm primitives
+  if (dtype != TensorConfig::dtype_t::fp32 && dtype != TensorConfig::dtype_t::fp64 && dtype != TensorConfig::dtype_t::fp16 &&
+      ((dtype != TensorConfig::dtype_t::bf16 && dtype != TensorConfig::dtype_t::s8) || !isBrgemm(prim_main)))
+  {
+    hasSetupError = true;
+    std::cerr << "Error: data type must be fp32 or fp64 or fp16, or bf16 or s8 for a gemm or brgemm, but got "
+              << static_cast<uint32_t>(dtype) << std::endl;
+    return error_t::err_wrong_dtype;
+  }
+  if (dtype == TensorConfig::dtype_t::bf16 && !Cpu::has_bf16())
+  {
+    hasSetupError = true;
+    std::cerr << "Error: the processor does not implement the BFloat16 extension of a bf16 gemm or brgemm." << std::endl;
+    return error_t::err_wrong_dtype;
+  }
+  if (dtype == TensorConfig::dtype_t::s8 && !Cpu::has_i8mm() && !Cpu::has_dotprod())
+  {
+    hasSetupError = true;
+    std::cerr << "Error: the processor implements neither the int8 mmla nor the dot product instructions of a s8 gemm or brgemm."
+              << std::endl;
+    return error_t::err_wrong_dtype;
+  }
+  Brgemm::dtype_t brgemm_dtype = dtype == TensorConfig::dtype_t::fp64 ? Brgemm::dtype_t::fp64 : Brgemm::dtype_t::fp32;
+  if (dtype == TensorConfig::dtype_t::bf16)
+  {
+    brgemm_dtype = Brgemm::dtype_t::bf16;
+  }
+  if (dtype == TensorConfig::dtype_t::s8)
+  {
+    brgemm_dtype = Brgemm::dtype_t::s8;
+  }
+  // The single-precision accumulators round the output once per call and run without the half-precision arithmetic
+  if (dtype == TensorConfig::dtype_t::fp16)
+  {
+    brgemm_dtype = Brgemm::dtype_t::fp16_fp32;
+  }
+
+  // The touch kernels of the s32 output copy bits, a relu or an activation would treat the integers as floating-point values
+  if (dtype == TensorConfig::dtype_t::s8 &&
+      (prim_first_touch == TensorConfig::prim_t::relu || prim_last_touch == TensorConfig::prim_t::relu ||
+       isActivation(prim_first_touch) || isActivation(prim_last_touch)))
   {
     hasSetupError = true;
-    std::cerr << "Error: data type must be fp32, but got " << static_cast<uint32_t>(dtype) << std::endl;
+    std::cerr << "Error: the touch primitives of a s8 gemm or brgemm must be zero or copy." << std::endl;
     return error_t::err_wrong_dtype;
   }
 
+  // The first touch and last touch primitives operate on the output
+  const TensorConfig::dtype_t dtype_out = TensorConfig::get_output_dtype(dtype);
+
   // Validate execution type order: shared -> seq -> prim
   if (!isSortedConfiguration(exec_types))
   {
@@ -471,10 +836,11 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
     return error_t::err_invalid_execution_order;
   }
 
-  if (!isValidPrimConfig(dim_types, exec_types))
+  if (!isValidPrimConfig(dim_types, exec_types, prim_main))
   {
     hasSetupError = true;
-    std::cerr << "Error: Invalid primitive configuration detected. Expected one primitive for m and one primitive for n to exist"
+    std::cerr << "Error: Invalid primitive configuration detected. Expected one primitive for m and one primitive for n to exist, or "
+                 "one primitive for k and one primitive for m or n for a reduce."
               << std::endl;
     return error_t::err_invalid_primitive_configuration;
   }
@@ -486,7 +852,7 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
     return error_t::err_invalid_strides;
   }
 
-  if (!isValidKDim(dim_types, exec_types, strides_in1, prim_main))
+  if (!isValidKDim(dim_types, exec_types, strides_in0, strides_in1, prim_main))
   {
     hasSetupError = true;
     std::cerr << (int)prim_main << std::endl;
@@ -512,6 +878,69 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
       return error_t::err_invalid_main_configuration;
     }
   }
+  else if (isBinary(prim_main))
+  {
+    // The inputs broadcast with a stride of zero in any dimension, in1 holds a column of unit stride or a broadcast element per column
+    const int32_t indexM = findMatch(dim_types, exec_types, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
+    if (!isValidStride(dim_types, strides_out, stride_t::out) || std::ranges::find(dim_types, TensorConfig::dim_t::k) != dim_types.end() ||
+        (!isExpectedStride(0, indexM, strides_in1) && !isExpectedStride(1, indexM, strides_in1)))
+    {
+      hasSetupError = true;
+      std::cerr << "Error: Invalid stride configuration detected for binary. Expected no k-dimension and in1 to have a m-dimension "
+                   "stride of zero or one."
+                << std::endl;
+      return error_t::err_invalid_strides;
+    }
+
+    // The binary overwrites the output, hence only a last touch is applied
+    if (prim_first_touch != TensorConfig::prim_t::none)
+    {
+      hasSetupError = true;
+      std::cerr << "Error: A main 'Binary' primitive can not have a first touch primitive." << std::endl;
+      return error_t::err_invalid_main_configuration;
+    }
+  }
+  else if (isReduce(prim_main))
+  {
+    if (!isValidStride(dim_types, strides_out, stride_t::out))
+    {
+      hasSetupError = true;
+      std::cerr << "Error: Invalid stride configuration detected for reduce. Expected the k-dimensions of out to have a stride of zero."
+                << std::endl;
+      return error_t::err_invalid_strides;
+    }
+
+    if (prim_first_touch != TensorConfig::prim_t::none || prim_last_touch != TensorConfig::prim_t::none)
+    {
+      hasSetupError = true;
+      std::cerr << "Error: A main 'Reduce' primitive can not have first touch and last touch primitives." << std::endl;
+      return error_t::err_invalid_main_configuration;
+    }
+  }
+  else if (isNormalization(prim_main))
+  {
+    if (!isValidStride(dim_types, strides_out, stride_t::out))
+    {
+      hasSetupError = true;
+      std::cerr << "Error: Invalid stride configuration detected for normalization. Expected no stride of zero in out." << std::endl;
+      return error_t::err_invalid_strides;
+    }
+
+    // Each call normalizes whole columns, a m dimension outside of the primitive would split the normalized elements
+    if (std::ranges::count(dim_types, TensorConfig::dim_t::m) != 1)
+    {
+      hasSetupError = true;
+      std::cerr << "Error: A main normalization primitive expects the m primitive to be the only m dimension." << std::endl;
+      return error_t::err_invalid_primitive_configuration;
+    }
+
+    if (prim_first_touch != TensorConfig::prim_t::none || prim_last_touch != TensorConfig::prim_t::none)
+    {
+      hasSetupError = true;
+      std::cerr << "Error: A main 'Normalization' primitive can not have first touch and last touch primitives." << std::endl;
+      return error_t::err_invalid_main_configuration;
+    }
+  }
   else if (isBrgemm(prim_main))
   {
     if (!isValidStride(dim_types, strides_in0, stride_t::in0) || !isValidStride(dim_types, strides_in1, stride_t::in1) ||
@@ -537,17 +966,43 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
   indexPrimM = findMatch(dim_types, exec_types, TensorConfig::dim_t::m, TensorConfig::exec_t::prim);
   indexPrimN = findMatch(dim_types, exec_types, TensorConfig::dim_t::n, TensorConfig::exec_t::prim);
 
-  release_assert(indexPrimM != -1, "Expected a valid index for the M dimension but found none.");
-  release_assert(indexPrimN != -1, "Expected a valid index for the N dimension but found none.");
+  if (isReduce(prim_main))
+  {
+    indexPrimK = findMatch(dim_types, exec_types, TensorConfig::dim_t::k, TensorConfig::exec_t::prim);
+    release_assert(indexPrimK != -1, "Expected a valid index for the K dimension but found none.");
+    release_assert(indexPrimM != -1 || indexPrimN != -1, "Expected a valid index for the M or the N dimension but found none.");
+  }
+  else
+  {
+    release_assert(indexPrimM != -1, "Expected a valid index for the M dimension but found none.");
+    release_assert(indexPrimN != -1, "Expected a valid index for the N dimension but found none.");
+  }
+
+  // Without a k loop outside of the primitive each call of the main kernel computes its output block completely, hence the main kernel
+  // can overwrite the output instead of accumulating onto the zeroed output and apply a relu before storing the block
+  const bool isBlockComplete = isBrgemm(prim_main) &&
+                               findMatch(dim_types, exec_types, TensorConfig::dim_t::k, TensorConfig::exec_t::seq) == -1 &&
+                               findMatch(dim_types, exec_types, TensorConfig::dim_t::k, TensorConfig::exec_t::shared) == -1;
+  const bool isZeroFolded = isBlockComplete && prim_first_touch == TensorConfig::prim_t::zero;
+  // A binary has no k dimension and always overwrites its output block
+  const bool isReluFused = prim_last_touch == TensorConfig::prim_t::relu &&
+                           ((isBlockComplete && brgemm_dtype != Brgemm::dtype_t::bf16 && brgemm_dtype != Brgemm::dtype_t::fp16_fp32) ||
+                            isBinary(prim_main));
+  const double beta = isZeroFolded ? 0 : 1;
+  Brgemm::epilogue_t epilogue;
+  if (isReluFused)
+  {
+    epilogue.activation = Brgemm::activation_t::relu;
+  }
 
-  if (prim_first_touch != TensorConfig::prim_t::none)
+  if (prim_first_touch != TensorConfig::prim_t::none && !isZeroFolded)
   {
     if (isUnary(prim_first_touch))
     {
       first_touch.emplace<Unary>();
       TensorOperation::prim_first = prim_first_touch;
 
-      Unary::error_t error = generateUnary(std::get<Unary>(first_touch), prim_first_touch, dim_sizes, false);
+      Unary::error_t error = generateUnary(std::get<Unary>(first_touch), prim_first_touch, dim_sizes, false, dtype_out);
 
       if (error != Unary::error_t::success)
       {
@@ -559,7 +1014,7 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
     else
     {
       hasSetupError = true;
-      std::cerr << "Error: Invalid type for the first touch primitive, only support zero, copy, relu." << std::endl;
+      std::cerr << "Error: Invalid type for the first touch primitive, only support zero, copy, relu and the activations." << std::endl;
       return error_t::err_wrong_first_touch_primitive;
     }
   }
@@ -579,9 +1034,8 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
         release_assert(indexPrimBatch != -1, "Expected a valid index for the Batch dimension but found none.");
         release_assert(indexPrimK != -1, "Expected a valid index for the Batch dimension but found none.");
 
-        Brgemm::error_t error = std::get<Brgemm>(main_kernel)
-                                  .generate(dim_sizes[indexPrimM], dim_sizes[indexPrimN], dim_sizes[indexPrimK], dim_sizes[indexPrimBatch],
-                                            0, 0, 0, Brgemm::dtype_t::fp32);
+        Brgemm::error_t error = generateBrgemm(std::get<Brgemm>(main_kernel), dim_sizes, strides_in0, strides_in1,
+                                               dim_sizes[indexPrimBatch], brgemm_dtype, beta, epilogue);
         if (error != Brgemm::error_t::success)
         {
           hasSetupError = true;
@@ -596,8 +1050,7 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
         release_assert(indexPrimK != -1, "Expected a valid index for the K dimension but found none.");
 
         Brgemm::error_t error =
-          std::get<Brgemm>(main_kernel)
-            .generate(dim_sizes[indexPrimM], dim_sizes[indexPrimN], dim_sizes[indexPrimK], 1, 0, 0, 0, Brgemm::dtype_t::fp32);
+          generateBrgemm(std::get<Brgemm>(main_kernel), dim_sizes, strides_in0, strides_in1, 1, brgemm_dtype, beta, epilogue);
 
         if (error != Brgemm::error_t::success)
         {
@@ -616,7 +1069,7 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
       main_kernel.emplace<Unary>();
       TensorOperation::prim_main = prim_main;
 
-      Unary::error_t error = generateUnary(std::get<Unary>(main_kernel), prim_main, dim_sizes, isTranspose);
+      Unary::error_t error = generateUnary(std::get<Unary>(main_kernel), prim_main, dim_sizes, isTranspose, dtype);
 
       if (error != Unary::error_t::success)
       {
@@ -625,22 +1078,74 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
         return error_t::err_invalid_main_configuration;
       }
     }
+    else if (isBinary(prim_main))
+    {
+      main_kernel.emplace<Binary>();
+      TensorOperation::prim_main = prim_main;
+
+      Binary::error_t error = generateBinary(std::get<Binary>(main_kernel), prim_main, dim_sizes, strides_in0, strides_in1, dtype,
+                                             isReluFused ? Binary::activation_t::relu : Binary::activation_t::none);
+
+      if (error != Binary::error_t::success)
+      {
+        hasSetupError = true;
+        std::cerr << "Error: while generating the main binary: " << static_cast<uint32_t>(error) << std::endl;
+        return error_t::err_invalid_main_configuration;
+      }
+    }
+    else if (isReduce(prim_main))
+    {
+      main_kernel.emplace<Reduce>();
+      TensorOperation::prim_main = prim_main;
+
+      Reduce::error_t error = generateReduce(std::get<Reduce>(main_kernel), prim_main, dim_types, dim_sizes, false, dtype);
+
+      // The k loops outside of the primitive accumulate onto the output of their first iteration
+      const bool hasOuterK = std::ranges::count(dim_types, TensorConfig::dim_t::k) > 1;
+      if (error == Reduce::error_t::success && hasOuterK)
+      {
+        error = generateReduce(main_accumulate, prim_main, dim_types, dim_sizes, true, dtype);
+      }
+
+      if (error != Reduce::error_t::success)
+      {
+        hasSetupError = true;
+        std::cerr << "Error: while generating the main reduce: " << static_cast<uint32_t>(error) << std::endl;
+        return error_t::err_invalid_main_configuration;
+      }
+    }
+    else if (isNormalization(prim_main))
+    {
+      main_kernel.emplace<Normalization>();
+      TensorOperation::prim_main = prim_main;
+
+      Normalization::error_t error = generateNormalization(std::get<Normalization>(main_kernel), prim_main, dim_sizes, dtype);
+
+      if (error != Normalization::error_t::success)
+      {
+        hasSetupError = true;
+        std::cerr << "Error: while generating the main normalization: " << static_cast<uint32_t>(error) << std::endl;
+        return error_t::err_invalid_main_configuration;
+      }
+    }
     else
     {
       hasSetupError = true;
-      std::cerr << "Error: Invalid type for the main primitive, only support zero, copy, relu, gemm, brgemm." << std::endl;
+      std::cerr << "Error: Invalid type for the main primitive, only support zero, copy, relu, the activations, add, sub, mul, max, min, "
+                   "reduce_sum, reduce_max, reduce_mean, softmax, layer_norm, rms_norm, gemm, brgemm."
+                << std::endl;
       return error_t::err_wrong_main_primitive;
     }
   }
 
-  if (prim_last_touch != TensorConfig::prim_t::none)
+  if (prim_last_touch != TensorConfig::prim_t::none && !isReluFused)
   {
     if (isUnary(prim_last_touch))
     {
       last_touch.emplace<Unary>();
       TensorOperation::prim_last = prim_last_touch;
 
-      Unary::error_t error = generateUnary(std::get<Unary>(last_touch), prim_last_touch, dim_sizes, false);
+      Unary::error_t error = generateUnary(std::get<Unary>(last_touch), prim_last_touch, dim_sizes, false, dtype_out);
 
       if (error != Unary::error_t::success)
       {
@@ -652,7 +1157,7 @@ mini_jit::TensorOperation::error_t mini_jit::TensorOperation::setup_no_optimizat
     else
     {
       hasSetupError = true;
-      std::cerr << "Error: Invalid type for the last touch primitive, only support zero, copy, relu." << std::endl;
+      std::cerr << "Error: Invalid type for the last touch primitive, only support zero, copy, relu and the activations." << std::endl;
       return error_t::err_wrong_last_touch_primitive;
     }
   }
@@ -675,7 +1180,7 @@ void mini_jit::TensorOperation::execute(void const *tensor_in0, void const *tens
   release_assert(tensor_in0 != nullptr, "The tensor_in0 parameter is a nullptr, but should be a valid pointer to memory.");
   release_assert(tensor_out != nullptr, "The tensor_out parameter is a nullptr, but should be a valid pointer to memory.");
 
-  if (isBrgemm(prim_main))
+  if (isBrgemm(prim_main) || isBinary(prim_main))
   {
     release_assert(tensor_in1 != nullptr, "The tensor_in1 parameter is a nullptr, but should be a valid pointer to memory");
   }
@@ -690,10 +1195,18 @@ void mini_jit::TensorOperation::execute(void const *tensor_in0, void const *tens
 void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const *ptr_in0, char const *ptr_in1, char *ptr_out,
                                                   bool first_access, bool last_access)
 {
-  uint32_t dtype_bytes = 4;
+  // The inputs may have changed since the last execution
+  execute_dimension(index_dim, ptr_in0, ptr_in1, ptr_out, first_access, last_access, next_execution.fetch_add(1));
+}
+
+void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const *ptr_in0, char const *ptr_in1, char *ptr_out,
+                                                  bool first_access, bool last_access, uint64_t execution)
+{
+  uint32_t dtype_bytes = TensorConfig::get_dtype_size(dtype);
+  uint32_t dtype_bytes_out = TensorConfig::get_dtype_size(TensorConfig::get_output_dtype(dtype));
   int64_t dim_size = dim_sizes[index_dim];
   int64_t stride_in0 = strides_in0[index_dim];
-  int64_t stride_in1 = isUnary(prim_main) ? 1 : strides_in1[index_dim];
+  int64_t stride_in1 = isUnary(prim_main) || isReduce(prim_main) || isNormalization(prim_main) ? 1 : strides_in1[index_dim];
   int64_t stride_out = strides_out[index_dim];
 
   if (exec_types[index_dim] == TensorConfig::exec_t::shared)
@@ -715,8 +1228,8 @@ void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const
 
       char const *rec_ptr_in0 = ptr_in0 + iDim * stride_in0 * dtype_bytes;
       char const *rec_ptr_in1 = ptr_in1 + iDim * stride_in1 * dtype_bytes;
-      char *rec_ptr_out = ptr_out + iDim * stride_out * dtype_bytes;
-      execute_dimension(index_dim + 1, rec_ptr_in0, rec_ptr_in1, rec_ptr_out, is_first, is_last);
+      char *rec_ptr_out = ptr_out + iDim * stride_out * dtype_bytes_out;
+      execute_dimension(index_dim + 1, rec_ptr_in0, rec_ptr_in1, rec_ptr_out, is_first, is_last, execution);
     }
   }
   else if (exec_types[index_dim] == TensorConfig::exec_t::seq)
@@ -735,8 +1248,8 @@ void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const
 
       char const *rec_ptr_in0 = ptr_in0 + iDim * stride_in0 * dtype_bytes;
       char const *rec_ptr_in1 = ptr_in1 + iDim * stride_in1 * dtype_bytes;
-      char *rec_ptr_out = ptr_out + iDim * stride_out * dtype_bytes;
-      execute_dimension(index_dim + 1, rec_ptr_in0, rec_ptr_in1, rec_ptr_out, is_first, is_last);
+      char *rec_ptr_out = ptr_out + iDim * stride_out * dtype_bytes_out;
+      execute_dimension(index_dim + 1, rec_ptr_in0, rec_ptr_in1, rec_ptr_out, is_first, is_last, execution);
     }
   }
   else
@@ -749,7 +1262,8 @@ void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const
       if (std::holds_alternative<Unary>(first_touch))
       {
         Unary::kernel_t kernel = std::get<Unary>(first_touch).get_kernel();
-        kernel(ptr_out, ptr_out, strides_out[indexPrimN], strides_out[indexPrimN]);
+        int32_t indexLeadingDimension = isTransposeC ? indexPrimM : indexPrimN;
+        kernel(ptr_out, ptr_out, strides_out[indexLeadingDimension], strides_out[indexLeadingDimension]);
       }
       else
       {
@@ -766,18 +1280,73 @@ void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const
         int32_t indexLeadingDimension = isTranspose ? indexPrimM : indexPrimN;
         kernel(ptr_in0, ptr_out, strides_in0[indexPrimN], strides_out[indexLeadingDimension]);
       }
+      else if (std::holds_alternative<Binary>(main_kernel))
+      {
+        // A n-stride of zero is the leading dimension of an input whose column is broadcast
+        Binary::kernel_t kernel = std::get<Binary>(main_kernel).get_kernel();
+        kernel(ptr_in0, ptr_in1, ptr_out, strides_in0[indexPrimN], strides_in1[indexPrimN], strides_out[indexPrimN]);
+      }
+      else if (std::holds_alternative<Reduce>(main_kernel))
+      {
+        // The first access overwrites the output, the later iterations of an outer k loop accumulate onto it
+        Reduce::kernel_t kernel = first_access ? std::get<Reduce>(main_kernel).get_kernel() : main_accumulate.get_kernel();
+        if (indexPrimM != -1)
+        {
+          kernel(ptr_in0, ptr_out, strides_in0[indexPrimK], 0);
+        }
+        else
+        {
+          kernel(ptr_in0, ptr_out, strides_in0[indexPrimN], strides_out[indexPrimN]);
+        }
+      }
+      else if (std::holds_alternative<Normalization>(main_kernel))
+      {
+        Normalization::kernel_t kernel = std::get<Normalization>(main_kernel).get_kernel();
+        kernel(ptr_in0, ptr_out, strides_in0[indexPrimN], strides_out[indexPrimN]);
+      }
       else if (std::holds_alternative<Brgemm>(main_kernel))
       {
         Brgemm::kernel_t kernel = std::get<Brgemm>(main_kernel).get_kernel();
+        int64_t lda = isTransposeA ? strides_in0[indexPrimM] : strides_in0[indexPrimK];
+        int64_t ldb = isTransposeB ? strides_in1[indexPrimK] : strides_in1[indexPrimN];
+        int64_t ldc = isTransposeC ? strides_out[indexPrimM] : strides_out[indexPrimN];
 
-        if (prim_main == TensorConfig::prim_t::gemm)
+        if (isPacked)
         {
-          kernel(ptr_in0, ptr_in1, ptr_out, strides_in0[indexPrimK], strides_in1[indexPrimN], strides_out[indexPrimN], 1, 1);
+          packed_inputs_t &inputs = packed_inputs;
+          if (inputs.execution != execution)
+          {
+            inputs.execution = execution;
+            inputs.source_in0 = nullptr;
+            inputs.source_in1 = nullptr;
+            inputs.in0.resize(std::max<std::size_t>(inputs.in0.size(), packed_bytes_in0));
+            inputs.in1.resize(std::max<std::size_t>(inputs.in1.size(), packed_bytes_in1));
+          }
+          int64_t br_stride_in0 = prim_main == TensorConfig::prim_t::brgemm ? strides_in0[indexPrimBatch] : 1;
+          int64_t br_stride_in1 = prim_main == TensorConfig::prim_t::brgemm ? strides_in1[indexPrimBatch] : 1;
+
+          // Inputs that do not change between consecutive calls, e.g. in0 over an outer n loop, are packed once
+          if (inputs.source_in0 != ptr_in0)
+          {
+            packing.pack_a(ptr_in0, lda, br_stride_in0, inputs.in0.data());
+            inputs.source_in0 = ptr_in0;
+          }
+          if (inputs.source_in1 != ptr_in1)
+          {
+            packing.pack_b(ptr_in1, ldb, br_stride_in1, inputs.in1.data());
+            inputs.source_in1 = ptr_in1;
+          }
+
+          Brgemm::tile_t tile = packing.get_tile();
+          kernel(inputs.in0.data(), inputs.in1.data(), ptr_out, tile.m, tile.n, ldc, packing.get_size_a(), packing.get_size_b());
+        }
+        else if (prim_main == TensorConfig::prim_t::gemm)
+        {
+          kernel(ptr_in0, ptr_in1, ptr_out, lda, ldb, ldc, 1, 1);
         }
         else if (prim_main == TensorConfig::prim_t::brgemm)
         {
-          kernel(ptr_in0, ptr_in1, ptr_out, strides_in0[indexPrimK], strides_in1[indexPrimN], strides_out[indexPrimN],
-                 strides_in0[indexPrimBatch], strides_in1[indexPrimBatch]);
+          kernel(ptr_in0, ptr_in1, ptr_out, lda, ldb, ldc, strides_in0[indexPrimBatch], strides_in1[indexPrimBatch]);
         }
         else
         {
@@ -796,7 +1365,8 @@ void mini_jit::TensorOperation::execute_dimension(int64_t index_dim, char const
       if (std::holds_alternative<Unary>(last_touch))
       {
         Unary::kernel_t kernel = std::get<Unary>(last_touch).get_kernel();
-        kernel(ptr_out, ptr_out, strides_out[indexPrimN], strides_out[indexPrimN]);
+        int32_t indexLeadingDimension = isTransposeC ? indexPrimM : indexPrimN;
+        kernel(ptr_out, ptr_out, strides_out[indexLeadingDimension], strides_out[indexLeadingDimension]);
       }
       else
       {
@@ -828,6 +1398,18 @@ void mini_jit::TensorOperation::write_kernel_to_file(std::string path_no_extensi
     {
       std::get<Unary>(main_kernel).write_kernel_to_file(std::format("{}_main.bin", path_no_extension).c_str());
     }
+    else if (std::holds_alternative<Binary>(main_kernel))
+    {
+      std::get<Binary>(main_kernel).write_kernel_to_file(std::format("{}_main.bin", path_no_extension).c_str());
+    }
+    else if (std::holds_alternative<Reduce>(main_kernel))
+    {
+      std::get<Reduce>(main_kernel).write_kernel_to_file(std::format("{}_main.bin", path_no_extension).c_str());
+    }
+    else if (std::holds_alternative<Normalization>(main_kernel))
+    {
+      std::get<Normalization>(main_kernel).write_kernel_to_file(std::format("{}_main.bin", path_no_extension).c_str());
+    }
   }
 
   if (prim_last != TensorConfig::prim_t::none && std::holds_alternative<Unary>(last_touch))
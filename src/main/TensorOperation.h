@@ -1,7 +1,11 @@
 #ifndef MINI_JIT_TENSOR_OPERATION_H
 #define MINI_JIT_TENSOR_OPERATION_H
 
+#include "Binary.h"
 #include "Brgemm.h"
+#include "Packing.h"
+#include "Normalization.h"
+#include "Reduce.h"
 #include "TensorConfig.h"
 #include "Unary.h"
 #include <cstdint>
@@ -66,27 +70,48 @@ namespace mini_jit
     int32_t indexPrimBatch = -1;
 
     std::variant<Brgemm, Unary> first_touch;
-    std::variant<Brgemm, Unary> main_kernel;
+    std::variant<Brgemm, Unary, Binary, Reduce, Normalization> main_kernel;
+    Reduce main_accumulate;  // reduce of the calls after the first access of an output block, i.e. the later iterations of a k loop
     std::variant<Brgemm, Unary> last_touch;
 
     bool isParallel = false;  // default is sequential execution
 
     bool isTranspose = false;  // default is no transpose
 
+    bool isTransposeA = false;  // brgemm in0 is row-major, i.e. unit stride in k
+    bool isTransposeB = false;  // brgemm in1 is row-major, i.e. unit stride in n
+    bool isTransposeC = false;  // brgemm out is row-major, i.e. unit stride in n
+
     bool hasSetupError = true;  // default is true to indicate no setup was executed
 
+    //! memory spanned by the inputs of a brgemm call in bytes above which the inputs are packed, about the size of a L2 cache
+    static constexpr int64_t packing_threshold = 1 << 20;
+
+    // The packed inputs live in a thread-local scratch of the executing thread, which is independent of the thread count at setup,
+    // of nested parallelism and of concurrent executions of the same operation
+    Packing packing;
+    int64_t packed_bytes_in0 = 0;  // bytes of the packed in0 of a brgemm call
+    int64_t packed_bytes_in1 = 0;  // bytes of the packed in1 of a brgemm call
+
+    bool isPacked = false;  // default is to read the inputs of the brgemm in place
+
     /**
      * @brief Validates that exactly one m primitive dimension and one n primitive dimension exists.
+     * A reduce instead has exactly one k primitive dimension and either one m or one n primitive dimension.
      *
      * @param dim The dimension types to search through.
      * @param exec The execution types to search through.
+     * @param main_prim The main primitive of the tensor operation.
      * @return true The configuration is a valid primitive setup.
      * @return false The configuration is NOT a valid primitive setup.
      */
-    bool isValidPrimConfig(const std::span<const TensorConfig::dim_t> &dim, const std::span<const TensorConfig::exec_t> &exec);
+    bool isValidPrimConfig(const std::span<const TensorConfig::dim_t> &dim, const std::span<const TensorConfig::exec_t> &exec,
+                           const TensorConfig::prim_t main_prim);
 
     /**
      * @brief Validates that the strides of the m primitives and n primitives dimension are unit strides.
+     * A brgemm may instead write a row-major output with a unit stride in n, the first input of a binary may broadcast the m dimension
+     * with a stride of zero. A reduce keeps a m dimension of unit strides or reduces a k dimension of unit stride in in0.
      *
      * @param dim The dimension types to search through.
      * @param exec The execution types to search through.
@@ -100,16 +125,19 @@ namespace mini_jit
 
     /**
      * @brief Checks if the K dimension is valid for the given primitive.
+     * The inputs of a brgemm need a unit stride in either of their primitive dimensions.
      *
      * @param dim The dimension types to search through.
      * @param exec The execution types to search through.
+     * @param strides_in0 The strides of the first input.
      * @param strides_in1 The strides of the second input.
      * @param prim The primitive i.e. Gemm or Brgemm to be executed.
      * @return true The configuration is a valid setup.
      * @return false The configuration is NOT a valid setup.
      */
     bool isValidKDim(const std::span<const TensorConfig::dim_t> &dim, const std::span<const TensorConfig::exec_t> &exec,
-                     const std::span<const int64_t> &strides_in1, const TensorConfig::prim_t prim);
+                     const std::span<const int64_t> &strides_in0, const std::span<const int64_t> &strides_in1,
+                     const TensorConfig::prim_t prim);
 
     /**
      * @brief Checks if the configuration is sorted such that the primitives are last.
@@ -127,9 +155,88 @@ namespace mini_jit
      * @param prim The primitive that is generated.
      * @param dim_sizes The sizes of each dimension.
      * @param isTranspose Indicates if the unary is executes a tranpose operation.
+     * @param dtype The data type of the tensor elements.
      * @return Unary::error_t
      */
-    Unary::error_t generateUnary(Unary &unary, TensorConfig::prim_t prim, const std::span<const int64_t> &dim_sizes, bool isTranspose);
+    Unary::error_t generateUnary(Unary &unary, TensorConfig::prim_t prim, const std::span<const int64_t> &dim_sizes, bool isTranspose,
+                                 TensorConfig::dtype_t dtype);
+
+    /**
+     * @brief Generates the binary kernel.
+     * An input with a m-stride of zero holds a single element per column that is broadcast by the kernel.
+     *
+     * @param binary The binary used for generation.
+     * @param prim The primitive that is generated.
+     * @param dim_sizes The sizes of each dimension.
+     * @param strides_in0 The strides of the first input.
+     * @param strides_in1 The strides of the second input.
+     * @param dtype The data type of the tensor elements.
+     * @param activation The activation applied to the output, i.e. a fused last touch relu.
+     * @return Binary::error_t
+     */
+    Binary::error_t generateBinary(Binary &binary, TensorConfig::prim_t prim, const std::span<const int64_t> &dim_sizes,
+                                   const std::span<const int64_t> &strides_in0, const std::span<const int64_t> &strides_in1,
+                                   TensorConfig::dtype_t dtype, Binary::activation_t activation);
+
+    /**
+     * @brief Generates the reduce kernel.
+     * A m primitive dimension is kept and the k primitive dimension is reduced across the columns, otherwise the k primitive dimension
+     * is reduced within the columns of the n primitive dimension.
+     *
+     * @param reduce The reduce used for generation.
+     * @param prim The primitive that is generated.
+     * @param dim_types The dimension types of the configuration.
+     * @param dim_sizes The sizes of each dimension.
+     * @param accumulate True if the kernel combines the reduction with the output.
+     * @param dtype The data type of the tensor elements.
+     * @return Reduce::error_t
+     */
+    Reduce::error_t generateReduce(Reduce &reduce, TensorConfig::prim_t prim, const std::span<const TensorConfig::dim_t> &dim_types,
+                                   const std::span<const int64_t> &dim_sizes, bool accumulate, TensorConfig::dtype_t dtype);
+
+    /**
+     * @brief Generates the normalization kernel, each column of the m primitive dimension is normalized.
+     *
+     * @param normalization The normalization used for generation.
+     * @param prim The primitive that is generated.
+     * @param dim_sizes The sizes of each dimension.
+     * @param dtype The data type of the tensor elements.
+     * @return Normalization::error_t
+     */
+    Normalization::error_t generateNormalization(Normalization &normalization, TensorConfig::prim_t prim,
+                                                 const std::span<const int64_t> &dim_sizes, TensorConfig::dtype_t dtype);
+
+    /**
+     * @brief Generates the brgemm kernel.
+     * If the memory spanned by the inputs exceeds packing_threshold, the inputs are packed and the kernel reads the packed inputs.
+     *
+     * @param brgemm The brgemm used for generation.
+     * @param dim_sizes The sizes of each dimension.
+     * @param strides_in0 The strides of the first input.
+     * @param strides_in1 The strides of the second input.
+     * @param br_size The batch-reduce size, 1 for a gemm.
+     * @param dtype The data type of the tensor elements.
+     * @param beta The scaling of the output, zero overwrites the output.
+     * @param epilogue The activation applied to the output.
+     * @return Brgemm::error_t
+     */
+    Brgemm::error_t generateBrgemm(Brgemm &brgemm, const std::span<const int64_t> &dim_sizes, const std::span<const int64_t> &strides_in0,
+                                   const std::span<const int64_t> &strides_in1, int64_t br_size, Brgemm::dtype_t dtype, double beta,
+                                   Brgemm::epilogue_t epilogue);
+
+    /**
+     * General-purpose loop implementation of an execution, see execute_dimension.
+     *
+     * @param index_dimension      Dimension index of the loop which is executed.
+     * @param ptr_in0      Pointer to the first input tensor's data.
+     * @param ptr_in1      Pointer to the second input tensor's data (use nullptr if unary).
+     * @param ptr_out      Pointer to the output tensor's data.
+     * @param first_access True if first time accessing data of output tensor.
+     * @param last_access  True if last time accessing data of output tensor.
+     * @param execution    Unique id of the execution, the packed inputs of a thread are only reused within the same execution.
+     **/
+    void execute_dimension(int64_t index_dimension, char const *ptr_in0, char const *ptr_in1, char *ptr_out, bool first_access,
+                           bool last_access, uint64_t execution);
 
   public:
     /**
@@ -163,6 +270,43 @@ namespace mini_jit
      */
     static bool isUnary(TensorConfig::prim_t prim);
 
+    /**
+     * @brief Indicates if a primitive is one of the activations of the Unary generator, i.e. exp, sigmoid, tanh, gelu_erf, gelu_tanh or
+     * silu.
+     *
+     * @param prim The primitive to check.
+     * @return true The primitive is an activation.
+     * @return false The primitive is NOT an activation.
+     */
+    static bool isActivation(TensorConfig::prim_t prim);
+
+    /**
+     * @brief Indicates if a primitive fits the Binary generator, i.e. add, sub, mul, max or min.
+     *
+     * @param prim The primitive to check.
+     * @return true The primitive is a binary.
+     * @return false The primitive is NOT a binary.
+     */
+    static bool isBinary(TensorConfig::prim_t prim);
+
+    /**
+     * @brief Indicates if a primitive fits the Reduce generator, i.e. reduce_sum, reduce_max or reduce_mean.
+     *
+     * @param prim The primitive to check.
+     * @return true The primitive is a reduce.
+     * @return false The primitive is NOT a reduce.
+     */
+    static bool isReduce(TensorConfig::prim_t prim);
+
+    /**
+     * @brief Indicates if a primitive fits the Normalization generator, i.e. softmax, layer_norm or rms_norm.
+     *
+     * @param prim The primitive to check.
+     * @return true The primitive is a normalization.
+     * @return false The primitive is NOT a normalization.
+     */
+    static bool isNormalization(TensorConfig::prim_t prim);
+
     /**
      * @brief Indicates if a primitive fits the Brgemm generator.
      *
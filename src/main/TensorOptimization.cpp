@@ -10,11 +10,12 @@
 void mini_jit::TensorOptimization::_reorder_helper_adjust_index(int32_t index, int32_t adjust_index, int32_t &primitive_m,
                                                                 int32_t &primitive_n, int32_t &primitive_k1, int32_t &primitive_k2)
 {
-  release_assert(primitive_m != primitive_n, "Expected primitive index m and n to be unequal.");
-  release_assert(primitive_m != primitive_k1, "Expected primitive index m and k1 to be unequal.");
-  release_assert(primitive_m != primitive_k2, "Expected primitive index m and k2 to be unequal.");
-  release_assert(primitive_n != primitive_k1, "Expected primitive index n and k1 to be unequal.");
-  release_assert(primitive_n != primitive_k2, "Expected primitive index n and k2 to be unequal.");
+  // A reduce has either a m or a n primitive, hence two primitives may both be missing
+  release_assert(primitive_m == -1 || primitive_m != primitive_n, "Expected primitive index m and n to be unequal.");
+  release_assert(primitive_m == -1 || primitive_m != primitive_k1, "Expected primitive index m and k1 to be unequal.");
+  release_assert(primitive_m == -1 || primitive_m != primitive_k2, "Expected primitive index m and k2 to be unequal.");
+  release_assert(primitive_n == -1 || primitive_n != primitive_k1, "Expected primitive index n and k1 to be unequal.");
+  release_assert(primitive_n == -1 || primitive_n != primitive_k2, "Expected primitive index n and k2 to be unequal.");
   release_assert(primitive_k1 == -1 || primitive_k2 == -1 || primitive_k1 != primitive_k2,
                  "Expected primitive index k1 and k2 to be unequal.");
 
@@ -48,6 +49,78 @@ void mini_jit::TensorOptimization::_primitive_identification(TensorConfig &confi
   release_assert(config.dim_types.size() == config.strides_in1.size(), "Expected the dimension types size to match the strides_in1 size.");
   release_assert(config.dim_types.size() == config.strides_out.size(), "Expected the dimension types size to match the strides_out size.");
 
+  // A reduce combines the k dimension with the smallest stride of in0, a unit-stride k is reduced within the columns of the n dimension
+  // with the smallest stride of out, otherwise the columns are reduced into a m dimension of unit strides
+  if (TensorOperation::isReduce(config.main))
+  {
+    int32_t primitive_k = -1;
+    int32_t primitive_c = -1;
+    for (size_t i = 0; i < config.dim_types.size(); ++i)
+    {
+      if (config.dim_types[i] == TensorConfig::dim_t::k && (primitive_k == -1 || config.strides_in0[i] < config.strides_in0[primitive_k]))
+      {
+        primitive_k = i;
+      }
+    }
+    if (primitive_k == -1)
+    {
+      return;
+    }
+
+    const bool isUnitK = config.strides_in0[primitive_k] == 1;
+    for (size_t i = 0; i < config.dim_types.size(); ++i)
+    {
+      if (config.dim_types[i] != TensorConfig::dim_t::c)
+      {
+        continue;
+      }
+
+      if ((isUnitK && (primitive_c == -1 || config.strides_out[i] < config.strides_out[primitive_c])) ||
+          (!isUnitK && config.strides_in0[i] == 1 && config.strides_out[i] == 1))
+      {
+        primitive_c = i;
+      }
+    }
+    if (primitive_c == -1)
+    {
+      return;
+    }
+
+    config.exec_types[primitive_k] = TensorConfig::exec_t::prim;
+    config.exec_types[primitive_c] = TensorConfig::exec_t::prim;
+    config.dim_types[primitive_c] = isUnitK ? TensorConfig::dim_t::n : TensorConfig::dim_t::m;
+    return;
+  }
+
+  // A normalization keeps the normalized m dimension with the smallest stride of in0, the columns are the c dimension with the smallest
+  // stride of out
+  if (TensorOperation::isNormalization(config.main))
+  {
+    int32_t primitive_m = -1;
+    int32_t primitive_c = -1;
+    for (size_t i = 0; i < config.dim_types.size(); ++i)
+    {
+      if (config.dim_types[i] == TensorConfig::dim_t::m && (primitive_m == -1 || config.strides_in0[i] < config.strides_in0[primitive_m]))
+      {
+        primitive_m = i;
+      }
+      else if (config.dim_types[i] == TensorConfig::dim_t::c &&
+               (primitive_c == -1 || config.strides_out[i] < config.strides_out[primitive_c]))
+      {
+        primitive_c = i;
+      }
+    }
+    if (primitive_m == -1 || primitive_c == -1)
+    {
+      return;
+    }
+
+    config.exec_types[primitive_m] = TensorConfig::exec_t::prim;
+    config.exec_types[primitive_c] = TensorConfig::exec_t::prim;
+    config.dim_types[primitive_c] = TensorConfig::dim_t::n;
+    return;
+  }
+
   int32_t primitive_m =
     TensorOperation::findMatch(config.dim_types, config.exec_types, mini_jit::TensorConfig::dim_t::m, mini_jit::TensorConfig::exec_t::prim);
   int32_t primitive_n =
@@ -71,6 +144,31 @@ void mini_jit::TensorOptimization::_primitive_identification(TensorConfig &confi
   bool fixed_n = primitive_n != -1;
   bool fixed_k2 = primitive_k2 != -1;
 
+  // k1 = unit stride of in1, or unit stride of in0 if only the first input is stored row-major, otherwise the smallest stride of in1
+  if (primitive_k1 == -1 && TensorOperation::isBrgemm(config.main))
+  {
+    auto find_smallest_stride_k = [&config, primitive_k2](std::vector<int64_t> const &strides)
+    {
+      int32_t index = -1;
+      for (size_t i = 0; i < config.dim_types.size(); ++i)
+      {
+        if (config.dim_types[i] == TensorConfig::dim_t::k && static_cast<int32_t>(i) != primitive_k2 &&
+            (index == -1 || strides[i] < strides[index]))
+        {
+          index = i;
+        }
+      }
+      return index;
+    };
+
+    primitive_k1 = find_smallest_stride_k(config.strides_in1);
+    int32_t primitive_k1_in0 = find_smallest_stride_k(config.strides_in0);
+    if (primitive_k1 != -1 && config.strides_in1[primitive_k1] != 1 && config.strides_in0[primitive_k1_in0] == 1)
+    {
+      primitive_k1 = primitive_k1_in0;
+    }
+  }
+
   for (auto [iDim, iStrideIn0, iStrideIn1, iStrideOut] =
          std::tuple{config.dim_types.begin(), config.strides_in0.begin(), config.strides_in1.begin(), config.strides_out.begin()};
        iDim != config.dim_types.end(); ++iDim, ++iStrideIn0, ++iStrideIn1, ++iStrideOut)
@@ -142,6 +240,38 @@ void mini_jit::TensorOptimization::_primitive_identification(TensorConfig &confi
         primitive_n = index;
       }
     }
+    else if (TensorOperation::isBinary(config.main) && *iDim == TensorConfig::dim_t::c)
+    {
+      int32_t index = std::distance(config.dim_types.begin(), iDim);
+      // m-dim = unit stride of out, the inputs may broadcast the m-dim with a stride of zero
+      if (*iStrideOut == 1 && primitive_m == -1)
+      {
+        primitive_m = index;
+      }
+      // n-dim = next largest stride of out
+      else if (primitive_n == -1 || config.strides_out[primitive_n] > *iStrideOut)
+      {
+        primitive_n = index;
+      }
+    }
+  }
+
+  // m = unit stride of out if in0 is stored row-major, otherwise the smallest stride of in0
+  if (primitive_m == -1 && TensorOperation::isBrgemm(config.main))
+  {
+    for (size_t i = 0; i < config.dim_types.size(); ++i)
+    {
+      if (config.dim_types[i] != TensorConfig::dim_t::m)
+      {
+        continue;
+      }
+
+      if (primitive_m == -1 || config.strides_out[i] == 1 ||
+          (config.strides_out[primitive_m] != 1 && config.strides_in0[i] < config.strides_in0[primitive_m]))
+      {
+        primitive_m = i;
+      }
+    }
   }
 
   // m and n are always needed because the output has MxN
@@ -364,7 +494,7 @@ void mini_jit::TensorOptimization::_dimension_reordering_fusing(TensorConfig &co
   }
   if (primitive_m != -1)
   {
-    int32_t new_index = config.dim_types.size() - 2 - (primitive_k1 != -1);
+    int32_t new_index = config.dim_types.size() - 1 - (primitive_n != -1) - (primitive_k1 != -1);
     _swap_elements(config, primitive_m, new_index);
     _reorder_helper_adjust_index(new_index, primitive_m, primitive_m, primitive_n, primitive_k1, primitive_k2);
     primitive_m = new_index;
@@ -465,8 +595,10 @@ void mini_jit::TensorOptimization::_dimension_splitting(TensorConfig &config)
 {
   for (size_t i = 0; i < config.dim_sizes.size(); ++i)
   {
+    // A normalization needs all elements of its m dimension in a single call of the primitive
     int64_t size = config.dim_sizes[i];
-    if (size >= fuse_split_dimension_size)
+    if (size >= fuse_split_dimension_size &&
+        !(TensorOperation::isNormalization(config.main) && config.dim_types[i] == TensorConfig::dim_t::m))
     {
       int64_t best_dominator = -1;
       for (int64_t d = std::floor(std::sqrt(size)); d > 1; --d)
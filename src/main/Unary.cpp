@@ -1,4 +1,6 @@
 #include "Unary.h"
+#include "Cpu.h"
+#include "KernelCache.h"
 #include "kernels/unary/unary_all.h"
 #include "release_assert.h"
 #include <format>
@@ -6,65 +8,150 @@
 
 mini_jit::Unary::error_t mini_jit::Unary::generate(uint32_t m, uint32_t n, uint32_t trans_b, dtype_t dtype, ptype_t ptype)
 {
-  if (dtype != dtype_t::fp32)
+  if (dtype != dtype_t::fp32 && dtype != dtype_t::fp64 && dtype != dtype_t::fp16)
   {
     return error_t::err_wrong_dtype;
   }
+  // The fp16 relu compares with the half-precision fmax, the zero and identity only move bits
+  if (dtype == dtype_t::fp16 && ptype == ptype_t::relu && !Cpu::has_fp16())
+  {
+    return error_t::err_wrong_dtype;
+  }
+  const bool is_activation = ptype != ptype_t::zero && ptype != ptype_t::identity && ptype != ptype_t::relu;
+  if (is_activation && dtype != dtype_t::fp32)
+  {
+    return error_t::err_wrong_dtype;
+  }
+  if (is_activation && trans_b != 0)
+  {
+    return error_t::err_row_major_order_not_supported;
+  }
   if (m == 0 || n == 0)
   {
     return error_t::err_wrong_dimension;
   }
 
-  switch (ptype)
+  std::string key =
+    std::format("unary_m{}_n{}_tb{}_dtype{}_ptype{}", m, n, trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype));
+
+  // The SVE kernels are column-major, a row-major zero is the column-major zero of the transposed shape
+  const bool use_sve = Cpu::is_sve_enabled() && dtype != dtype_t::fp16 && !is_activation &&
+                       (trans_b == 0 || (trans_b == 1 && ptype == ptype_t::zero));
+  if (use_sve)
   {
-  case ptype_t::zero:
-    if (trans_b == 0)  // Column major format
-    {
-      fill_with_zero_unary_column_major_fp32(m, n);
-    }
-    else if (trans_b == 1)  // Row major format
-    {
-      fill_with_zero_unary_column_major_fp32(n, m);
-    }
-    else
-    {
-      throw std::logic_error(std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'",
-                                         m, n, trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
-    }
-    break;
+    key += "_sve";
+  }
 
-  case ptype_t::identity:
-    if (trans_b == 0 || trans_b == 1)
-    {
-      identity_unary_fp32(m, n, trans_b);
-    }
-    else
+  native_kernel = KernelCache::instance().get_or_generate(
+    key,
+    [&](mini_jit::Kernel &native_kernel)
     {
-      throw std::logic_error(std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'",
-                                         m, n, trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
-    }
-    break;
+      if (use_sve)
+      {
+        if (trans_b == 1)
+        {
+          sve_unary(native_kernel, n, m, dtype, ptype);
+        }
+        else
+        {
+          sve_unary(native_kernel, m, n, dtype, ptype);
+        }
+        return;
+      }
 
-  case ptype_t::relu:
-    if (trans_b == 0 || trans_b == 1)
-    {
-      relu_unary_fp32(m, n, trans_b);
-    }
-    else
-    {
-      throw std::logic_error(std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'",
-                                         m, n, trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
-    }
+      switch (ptype)
+      {
+      case ptype_t::zero:
+        if (trans_b == 0 && dtype == dtype_t::fp16)
+        {
+          fill_with_zero_unary_column_major_fp16(native_kernel, m, n);
+        }
+        else if (trans_b == 1 && dtype == dtype_t::fp16)
+        {
+          fill_with_zero_unary_column_major_fp16(native_kernel, n, m);
+        }
+        else if (trans_b == 0 && dtype == dtype_t::fp64)
+        {
+          fill_with_zero_unary_column_major_fp64(native_kernel, m, n);
+        }
+        else if (trans_b == 1 && dtype == dtype_t::fp64)
+        {
+          fill_with_zero_unary_column_major_fp64(native_kernel, n, m);
+        }
+        else if (trans_b == 0)  // Column major format
+        {
+          fill_with_zero_unary_column_major_fp32(native_kernel, m, n);
+        }
+        else if (trans_b == 1)  // Row major format
+        {
+          fill_with_zero_unary_column_major_fp32(native_kernel, n, m);
+        }
+        else
+        {
+          throw std::logic_error(
+            std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'", m, n,
+                        trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
+        }
+        break;
 
-    break;
+      case ptype_t::identity:
+        if ((trans_b == 0 || trans_b == 1) && dtype == dtype_t::fp16)
+        {
+          identity_unary_fp16(native_kernel, m, n, trans_b);
+        }
+        else if ((trans_b == 0 || trans_b == 1) && dtype == dtype_t::fp64)
+        {
+          identity_unary_fp64(native_kernel, m, n, trans_b);
+        }
+        else if (trans_b == 0 || trans_b == 1)
+        {
+          identity_unary_fp32(native_kernel, m, n, trans_b);
+        }
+        else
+        {
+          throw std::logic_error(
+            std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'", m, n,
+                        trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
+        }
+        break;
 
-  default:
-    release_assert(false, "Found unhandled ptype_t");
-    break;
-  }
+      case ptype_t::relu:
+        if ((trans_b == 0 || trans_b == 1) && dtype == dtype_t::fp16)
+        {
+          relu_unary_fp16(native_kernel, m, n, trans_b);
+        }
+        else if ((trans_b == 0 || trans_b == 1) && dtype == dtype_t::fp64)
+        {
+          relu_unary_fp64(native_kernel, m, n, trans_b);
+        }
+        else if (trans_b == 0 || trans_b == 1)
+        {
+          relu_unary_fp32(native_kernel, m, n, trans_b);
+        }
+        else
+        {
+          throw std::logic_error(
+            std::format("Unhandled parameter combination found: m='{}', n='{}', trans_b='{}', dtype = '{}', ptype = '{}'", m, n,
+                        trans_b, static_cast<int32_t>(dtype), static_cast<int32_t>(ptype)));
+        }
 
-  native_kernel.set_kernel();
-  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel.get_kernel()));
+        break;
+
+      case ptype_t::exp:
+      case ptype_t::sigmoid:
+      case ptype_t::tanh:
+      case ptype_t::gelu_erf:
+      case ptype_t::gelu_tanh:
+      case ptype_t::silu:
+        activation_unary_fp32(native_kernel, m, n, ptype);
+        break;
+
+      default:
+        release_assert(false, "Found unhandled ptype_t");
+        break;
+      }
+    });
+  kernel = reinterpret_cast<kernel_t>(const_cast<void *>(native_kernel->get_kernel()));
 
   return error_t::success;
 }
@@ -74,39 +161,152 @@ mini_jit::Unary::kernel_t mini_jit::Unary::get_kernel() const
   return kernel;
 }
 
-void mini_jit::Unary::fill_with_zero_unary_column_major_fp32(uint32_t m, uint32_t n)
+void mini_jit::Unary::fill_with_zero_unary_column_major_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n)
 {
+  native_kernel.set_name(std::format("unary_zero_m{}_n{}", m, n));
   kernels::unary_zero(native_kernel, m / 16, n, m % 16);  // logic of zero_16m_n combined with rest processing
   return;
 }
 
-void mini_jit::Unary::identity_unary_fp32(uint32_t m, uint32_t n, uint32_t trans_b)
+void mini_jit::Unary::identity_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
 {
   if (trans_b == 1)
   {
+    native_kernel.set_name(std::format("unary_identity_transpose_m{}_n{}", m, n));
     kernels::unary_identity_transpose(native_kernel, m, n);
   }
   else
   {
+    native_kernel.set_name(std::format("unary_identity_m{}_n{}", m, n));
     kernels::unary_identity(native_kernel, m, n);  // logic of zero_16m_n combined with rest processing
   }
   return;
 }
 
-void mini_jit::Unary::relu_unary_fp32(uint32_t m, uint32_t n, uint32_t trans_b)
+void mini_jit::Unary::relu_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
 {
   if (trans_b == 1)
   {
+    native_kernel.set_name(std::format("unary_relu_transpose_m{}_n{}", m, n));
     kernels::unary_relu_transpose(native_kernel, m, n);
   }
   else
   {
+    native_kernel.set_name(std::format("unary_relu_m{}_n{}", m, n));
     kernels::unary_relu(native_kernel, m, n);  // logic of zero_16m_n combined with rest processing
   }
   return;
 }
 
+void mini_jit::Unary::fill_with_zero_unary_column_major_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n)
+{
+  native_kernel.set_name(std::format("unary_zero_fp64_m{}_n{}", m, n));
+  kernels::unary_zero_fp64(native_kernel, m, n);
+}
+
+void mini_jit::Unary::identity_unary_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
+{
+  if (trans_b == 1)
+  {
+    native_kernel.set_name(std::format("unary_identity_transpose_fp64_m{}_n{}", m, n));
+    kernels::unary_identity_transpose_fp64(native_kernel, m, n);
+  }
+  else
+  {
+    native_kernel.set_name(std::format("unary_identity_fp64_m{}_n{}", m, n));
+    kernels::unary_identity_fp64(native_kernel, m, n);
+  }
+}
+
+void mini_jit::Unary::relu_unary_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
+{
+  if (trans_b == 1)
+  {
+    native_kernel.set_name(std::format("unary_relu_transpose_fp64_m{}_n{}", m, n));
+    kernels::unary_relu_transpose_fp64(native_kernel, m, n);
+  }
+  else
+  {
+    native_kernel.set_name(std::format("unary_relu_fp64_m{}_n{}", m, n));
+    kernels::unary_relu_fp64(native_kernel, m, n);
+  }
+}
+
+void mini_jit::Unary::fill_with_zero_unary_column_major_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n)
+{
+  native_kernel.set_name(std::format("unary_zero_fp16_m{}_n{}", m, n));
+  kernels::unary_zero_fp16(native_kernel, m, n);
+}
+
+void mini_jit::Unary::identity_unary_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
+{
+  if (trans_b == 1)
+  {
+    native_kernel.set_name(std::format("unary_identity_transpose_fp16_m{}_n{}", m, n));
+    kernels::unary_identity_transpose_fp16(native_kernel, m, n);
+  }
+  else
+  {
+    native_kernel.set_name(std::format("unary_identity_fp16_m{}_n{}", m, n));
+    kernels::unary_identity_fp16(native_kernel, m, n);
+  }
+}
+
+void mini_jit::Unary::relu_unary_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b)
+{
+  if (trans_b == 1)
+  {
+    native_kernel.set_name(std::format("unary_relu_transpose_fp16_m{}_n{}", m, n));
+    kernels::unary_relu_transpose_fp16(native_kernel, m, n);
+  }
+  else
+  {
+    native_kernel.set_name(std::format("unary_relu_fp16_m{}_n{}", m, n));
+    kernels::unary_relu_fp16(native_kernel, m, n);
+  }
+}
+
+void mini_jit::Unary::activation_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, ptype_t ptype)
+{
+  // The activations follow relu in ptype_t in the order of unary_activation_t
+  const auto activation = static_cast<kernels::unary_activation_t>(static_cast<uint32_t>(ptype) - static_cast<uint32_t>(ptype_t::exp));
+  constexpr char const *names[] = {"exp", "sigmoid", "tanh", "gelu_erf", "gelu_tanh", "silu"};
+  native_kernel.set_name(std::format("unary_{}_m{}_n{}", names[static_cast<uint32_t>(activation)], m, n));
+  kernels::unary_activation(native_kernel, m, n, activation);
+}
+
+void mini_jit::Unary::sve_unary(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, dtype_t dtype, ptype_t ptype)
+{
+  const kernels::dtype_t kernel_dtype = dtype == dtype_t::fp64 ? kernels::dtype_t::fp64 : kernels::dtype_t::fp32;
+  char const *suffix = dtype == dtype_t::fp64 ? "_fp64" : "";
+
+  switch (ptype)
+  {
+  case ptype_t::zero:
+    native_kernel.set_name(std::format("unary_zero_sve{}_m{}_n{}", suffix, m, n));
+    kernels::unary_zero_sve(native_kernel, m, n, kernel_dtype);
+    break;
+
+  case ptype_t::identity:
+    native_kernel.set_name(std::format("unary_identity_sve{}_m{}_n{}", suffix, m, n));
+    kernels::unary_identity_sve(native_kernel, m, n, kernel_dtype);
+    break;
+
+  case ptype_t::relu:
+    native_kernel.set_name(std::format("unary_relu_sve{}_m{}_n{}", suffix, m, n));
+    kernels::unary_relu_sve(native_kernel, m, n, kernel_dtype);
+    break;
+
+  default:
+    release_assert(false, "Found unhandled ptype_t");
+    break;
+  }
+}
+
 void mini_jit::Unary::write_kernel_to_file(const char *path) const
 {
-  native_kernel.write(path);
+  if (native_kernel != nullptr)
+  {
+    native_kernel->write(path);
+  }
 }
\ No newline at end of file
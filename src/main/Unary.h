@@ -3,6 +3,7 @@
 
 #include "Kernel.h"
 #include <cstdint>
+#include <memory>
 
 namespace mini_jit
 {
@@ -26,15 +27,22 @@ public:
   enum class dtype_t : uint32_t
   {
     fp32 = 0,
-    fp64 = 1
+    fp64 = 1,
+    fp16 = 2  // the relu requires Cpu::has_fp16, otherwise generate returns err_wrong_dtype
   };
 
-  /// primitive type
+  /// primitive type, the activations from exp on are fp32 only and B is column-major, see kernels::unary_activation_t for their errors
   enum class ptype_t : uint32_t
   {
     zero = 0,
     identity = 1,
-    relu = 2
+    relu = 2,
+    exp = 3,
+    sigmoid = 4,
+    tanh = 5,
+    gelu_erf = 6,
+    gelu_tanh = 7,
+    silu = 8,
   };
 
   /// error codes
@@ -43,41 +51,126 @@ public:
     success = 0,
     err_wrong_dtype = 1,
     err_wrong_dimension = 2,
+    err_row_major_order_not_supported = 3,
   };
 
 private:
   kernel_t kernel = nullptr;
-  mini_jit::Kernel native_kernel;
+  std::shared_ptr<mini_jit::Kernel> native_kernel;
 
   /**
    * @brief Fills the kernel with a suitable zero unary in column major format, and fp32 datatype
    *
+   * @param native_kernel The kernel to add instructions too.
    * @param m numbers of rows in A and B.
    * @param n numbers of columns in A and B.
    */
-  void fill_with_zero_unary_column_major_fp32(uint32_t m, uint32_t n);
+  void fill_with_zero_unary_column_major_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n);
 
   /**
    * @brief Does a identity unary on a matrix in column major format, and fp32 datatype
    *
+   * @param native_kernel The kernel to add instructions too.
    * @param m numbers of rows in A and B.
    * @param n numbers of columns in A and B.
    * @param trans_b transpose A (0 no, 1 yes)
    */
-  void identity_unary_fp32(uint32_t m, uint32_t n, uint32_t trans_b);
+  void identity_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
 
   /**
    * @brief Does a relu unary on a matrix in column major format, and fp32 datatype
    *
+   * @param native_kernel The kernel to add instructions too.
    * @param m numbers of rows in A and B.
    * @param n numbers of columns in A and B.
    * @param trans_b transpose A (0 no, 1 yes)
    */
-  void relu_unary_fp32(uint32_t m, uint32_t n, uint32_t trans_b);
+  void relu_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
+
+  /**
+   * @brief Fills the kernel with a suitable zero unary in column major format, and fp64 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   */
+  void fill_with_zero_unary_column_major_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n);
+
+  /**
+   * @brief Does a identity unary on a matrix in column major format, and fp64 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   * @param trans_b transpose A (0 no, 1 yes)
+   */
+  void identity_unary_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
+
+  /**
+   * @brief Does a relu unary on a matrix in column major format, and fp64 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   * @param trans_b transpose A (0 no, 1 yes)
+   */
+  void relu_unary_fp64(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
+
+  /**
+   * @brief Fills the kernel with a suitable zero unary in column major format, and fp16 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   */
+  void fill_with_zero_unary_column_major_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n);
+
+  /**
+   * @brief Does a identity unary on a matrix in column major format, and fp16 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   * @param trans_b transpose A (0 no, 1 yes)
+   */
+  void identity_unary_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
+
+  /**
+   * @brief Does a relu unary on a matrix in column major format, and fp16 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   * @param trans_b transpose A (0 no, 1 yes)
+   */
+  void relu_unary_fp16(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, uint32_t trans_b);
+
+  /**
+   * @brief Does an activation unary on a matrix in column major format, and fp32 datatype
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in A and B.
+   * @param n numbers of columns in A and B.
+   * @param ptype Primitive type of the activation.
+   */
+  void activation_unary_fp32(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, ptype_t ptype);
+
+  /**
+   * @brief Does a unary on a matrix in column major format with the vector-length agnostic SVE kernels.
+   *
+   * @param native_kernel The kernel to add instructions too.
+   * @param m numbers of rows in B.
+   * @param n numbers of columns in B.
+   * @param dtype Data type of the matrices.
+   * @param ptype Primitive type.
+   */
+  void sve_unary(mini_jit::Kernel &native_kernel, uint32_t m, uint32_t n, dtype_t dtype, ptype_t ptype);
 
 public:
   /**
    * @brief Generate a kernel for a unary primitive.
+   * If SVE is enabled, see Cpu::is_sve_enabled, a column-major B and a zero into any B are generated with the SVE kernels, fp16 is
+   * always generated with the NEON kernels, as are the activations.
    * @param m       Number of rows in A and B.
    * @param n       Number of columns in A and B.
    * @param trans_b 0 if B is stored in column-major order, 1 if B is stored in row-major order.
@@ -4,5 +4,6 @@
 #include "base/base_all.h"
 #include "register.h"
 #include "simd_fp/simd_fp_all.h"
+#include "sve/sve_all.h"
 
 #endif  // MINI_JIT_ARM_INSTRUCTIONS_ARM_ALL_H
\ No newline at end of file
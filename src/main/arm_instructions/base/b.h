@@ -0,0 +1,66 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_BASE_B_H
+#define MINI_JIT_ARM_INSTRUCTIONS_BASE_B_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+
+    /// @brief Condition of a conditional branch, the SVE aliases test the flags set by predicate instructions such as whilelt
+    enum class Condition : uint32_t
+    {
+      eq = 0b0000,
+      ne = 0b0001,
+      hs = 0b0010,
+      lo = 0b0011,
+      mi = 0b0100,
+      pl = 0b0101,
+      vs = 0b0110,
+      vc = 0b0111,
+      hi = 0b1000,
+      ls = 0b1001,
+      ge = 0b1010,
+      lt = 0b1011,
+      gt = 0b1100,
+      le = 0b1101,
+      al = 0b1110,
+
+      none = eq,   //!< no active element
+      any = ne,    //!< an active element
+      first = mi,  //!< the first element is active
+      last = lo,   //!< the last element is active
+    };
+
+    constexpr uint32_t b(const int32_t imm26)
+    {
+      release_assert((imm26 & mask2) == 0b00, "imm26 should be multiple of 4");
+      release_assert(imm26 <= (128 * 1024 * 1024 - 4), "imm26 has a maximum of 128MB - 4 (= 134217724)");
+      release_assert(imm26 >= (-128 * 1024 * 1024), "imm26 has a minimum of -128MB (= -134217728)");
+
+      uint32_t b = 0;
+      b |= 0b000101 << 26;
+      b |= ((imm26 >> 2) & mask26) << 0;
+      return b;
+    }
+
+    constexpr uint32_t b(const Condition cond, const int32_t imm19)
+    {
+      release_assert((imm19 & mask2) == 0b00, "imm19 should be multiple of 4");
+      release_assert(imm19 <= (1024 * 1024), "imm19 has a maximum of 1MB (= 1048576)");
+      release_assert(imm19 >= (-1024 * 1024), "imm19 has a minimum of -1MB (= -1048576)");
+
+      uint32_t b = 0;
+      b |= 0b01010100 << 24;
+      b |= ((imm19 >> 2) & mask19) << 5;
+      b |= (static_cast<uint32_t>(cond) & mask4) << 0;
+      return b;
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_BASE_B_H
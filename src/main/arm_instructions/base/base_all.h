@@ -3,15 +3,19 @@
 
 #include "../register/general_purpose.h"
 #include "add.h"
+#include "b.h"
 #include "cbnz.h"
 #include "ldp.h"
 #include "ldr.h"
 #include "lsl.h"
 #include "madd.h"
 #include "mov.h"
+#include "movk.h"
 #include "movn.h"
 #include "movz.h"
+#include "nop.h"
 #include "orr.h"
+#include "prfm.h"
 #include "ret.h"
 #include "stp.h"
 #include "sub.h"
@@ -0,0 +1,19 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_BASE_NOP_H
+#define MINI_JIT_ARM_INSTRUCTIONS_BASE_NOP_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+
+    constexpr uint32_t nop()
+    {
+      return 0b1101010100'0'00'011'0010'0000'000'11111;
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_BASE_NOP_H
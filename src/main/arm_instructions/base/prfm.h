@@ -0,0 +1,83 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_BASE_PRFM_H
+#define MINI_JIT_ARM_INSTRUCTIONS_BASE_PRFM_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+
+    /// @brief Represents the prefetch operation, i.e. load or store, the targeted cache level and the retention policy
+    enum class PrefetchOp : uint32_t
+    {
+      PLDL1KEEP = 0b00000,
+      PLDL1STRM = 0b00001,
+      PLDL2KEEP = 0b00010,
+      PLDL2STRM = 0b00011,
+      PLDL3KEEP = 0b00100,
+      PLDL3STRM = 0b00101,
+      PSTL1KEEP = 0b10000,
+      PSTL1STRM = 0b10001,
+      PSTL2KEEP = 0b10010,
+      PSTL2STRM = 0b10011,
+      PSTL3KEEP = 0b10100,
+      PSTL3STRM = 0b10101,
+    };
+
+    namespace internal
+    {
+
+      constexpr uint32_t prfmImmediateOffset(const PrefetchOp op, const uint32_t Rn, const uint32_t imm12)
+      {
+        release_assert(((Rn & mask5) == Rn), "Rn is only allowed to have a size of 5 bit.");
+        release_assert((((imm12 >> 3) & mask12) == (imm12 >> 3)), "imm12 is only allowed to have a size of 12 bit after shift i.e. 32760.");
+        release_assert(((imm12 & mask3) == 0), "imm12 should be multiple of 8.");
+
+        uint32_t prfm = 0;
+        prfm |= 0b1111100110 << 22;
+        prfm |= ((imm12 >> 3) & mask12) << 10;  // <pimm>/8
+        prfm |= (Rn & mask5) << 5;
+        prfm |= (static_cast<uint32_t>(op) & mask5) << 0;
+        return prfm;
+      }
+
+      constexpr uint32_t prfmRegisterOffset(const PrefetchOp op, const uint32_t Rn, const uint32_t Rm)
+      {
+        release_assert(((Rn & mask5) == Rn), "Rn is only allowed to have a size of 5 bit.");
+        release_assert(((Rm & mask5) == Rm), "Rm is only allowed to have a size of 5 bit.");
+
+        uint32_t prfm = 0;
+        prfm |= 0b11111000101 << 21;
+        prfm |= (Rm & mask5) << 16;
+        prfm |= 0b011 << 13;  // option LSL
+        prfm |= 0b0 << 12;    // no shift
+        prfm |= 0b10 << 10;
+        prfm |= (Rn & mask5) << 5;
+        prfm |= (static_cast<uint32_t>(op) & mask5) << 0;
+        return prfm;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t prfm(const PrefetchOp op, const R64Bit Xn)
+    {
+      return internal::prfmImmediateOffset(op, static_cast<uint32_t>(Xn), 0);
+    }
+
+    constexpr uint32_t prfmOffset(const PrefetchOp op, const R64Bit Xn, const uint32_t imm12)
+    {
+      return internal::prfmImmediateOffset(op, static_cast<uint32_t>(Xn), imm12);
+    }
+
+    constexpr uint32_t prfm(const PrefetchOp op, const R64Bit Xn, const R64Bit Xm)
+    {
+      return internal::prfmRegisterOffset(op, static_cast<uint32_t>(Xn), static_cast<uint32_t>(Xm));
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_BASE_PRFM_H
@@ -27,11 +27,13 @@ namespace mini_jit
     const uint32_t mask17 = 0b1'1111'1111'1111'1111;
     const uint32_t mask18 = 0b11'1111'1111'1111'1111;
     const uint32_t mask19 = 0b111'1111'1111'1111'1111;
+    const uint32_t mask26 = 0b11'1111'1111'1111'1111'1111'1111;
 
   }  // namespace arm_instructions
 }  // namespace mini_jit
 
 #include "register/general_purpose.h"
+#include "register/scalable.h"
 #include "register/vector.h"
 
 #endif  // MINI_JIT_ARM_INSTRUCTIONS_REGISTER_H
\ No newline at end of file
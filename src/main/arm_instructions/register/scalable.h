@@ -0,0 +1,330 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SCALABLE_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SCALABLE_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+
+    /// @brief Scalable vector register Z0 - Z31 of SVE, the lower 128 bits are the vector registers V0 - V31
+    enum class ZScalable : uint32_t
+    {
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z0 = 0,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z1 = 1,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z2 = 2,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z3 = 3,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z4 = 4,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z5 = 5,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z6 = 6,
+
+      /// @brief scalable vector parameter/result register (caller-saved)
+      z7 = 7,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z8 = 8,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z9 = 9,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z10 = 10,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z11 = 11,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z12 = 12,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z13 = 13,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z14 = 14,
+
+      /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+      z15 = 15,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z16 = 16,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z17 = 17,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z18 = 18,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z19 = 19,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z20 = 20,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z21 = 21,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z22 = 22,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z23 = 23,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z24 = 24,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z25 = 25,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z26 = 26,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z27 = 27,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z28 = 28,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z29 = 29,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z30 = 30,
+
+      /// @brief scalable vector scratch register (caller-saved)
+      z31 = 31,
+    };
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z0 = ZScalable::z0;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z1 = ZScalable::z1;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z2 = ZScalable::z2;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z3 = ZScalable::z3;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z4 = ZScalable::z4;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z5 = ZScalable::z5;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z6 = ZScalable::z6;
+
+    /// @brief scalable vector parameter/result register (caller-saved)
+    const ZScalable z7 = ZScalable::z7;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z8 = ZScalable::z8;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z9 = ZScalable::z9;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z10 = ZScalable::z10;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z11 = ZScalable::z11;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z12 = ZScalable::z12;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z13 = ZScalable::z13;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z14 = ZScalable::z14;
+
+    /// @brief scalable vector scratch register (callee-saved, lower 64 bits)
+    const ZScalable z15 = ZScalable::z15;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z16 = ZScalable::z16;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z17 = ZScalable::z17;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z18 = ZScalable::z18;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z19 = ZScalable::z19;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z20 = ZScalable::z20;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z21 = ZScalable::z21;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z22 = ZScalable::z22;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z23 = ZScalable::z23;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z24 = ZScalable::z24;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z25 = ZScalable::z25;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z26 = ZScalable::z26;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z27 = ZScalable::z27;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z28 = ZScalable::z28;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z29 = ZScalable::z29;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z30 = ZScalable::z30;
+
+    /// @brief scalable vector scratch register (caller-saved)
+    const ZScalable z31 = ZScalable::z31;
+
+    /// @brief Predicate register P0 - P15 of SVE, a bit per byte of a scalable vector register
+    enum class PPredicate : uint32_t
+    {
+      /// @brief predicate parameter/result register (caller-saved)
+      p0 = 0,
+
+      /// @brief predicate parameter/result register (caller-saved)
+      p1 = 1,
+
+      /// @brief predicate parameter/result register (caller-saved)
+      p2 = 2,
+
+      /// @brief predicate parameter/result register (caller-saved)
+      p3 = 3,
+
+      /// @brief predicate scratch register (caller-saved)
+      p4 = 4,
+
+      /// @brief predicate scratch register (caller-saved)
+      p5 = 5,
+
+      /// @brief predicate scratch register (caller-saved)
+      p6 = 6,
+
+      /// @brief predicate scratch register (caller-saved)
+      p7 = 7,
+
+      /// @brief predicate scratch register (caller-saved)
+      p8 = 8,
+
+      /// @brief predicate scratch register (caller-saved)
+      p9 = 9,
+
+      /// @brief predicate scratch register (caller-saved)
+      p10 = 10,
+
+      /// @brief predicate scratch register (caller-saved)
+      p11 = 11,
+
+      /// @brief predicate scratch register (caller-saved)
+      p12 = 12,
+
+      /// @brief predicate scratch register (caller-saved)
+      p13 = 13,
+
+      /// @brief predicate scratch register (caller-saved)
+      p14 = 14,
+
+      /// @brief predicate scratch register (caller-saved)
+      p15 = 15,
+    };
+
+    /// @brief predicate parameter/result register (caller-saved)
+    const PPredicate p0 = PPredicate::p0;
+
+    /// @brief predicate parameter/result register (caller-saved)
+    const PPredicate p1 = PPredicate::p1;
+
+    /// @brief predicate parameter/result register (caller-saved)
+    const PPredicate p2 = PPredicate::p2;
+
+    /// @brief predicate parameter/result register (caller-saved)
+    const PPredicate p3 = PPredicate::p3;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p4 = PPredicate::p4;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p5 = PPredicate::p5;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p6 = PPredicate::p6;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p7 = PPredicate::p7;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p8 = PPredicate::p8;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p9 = PPredicate::p9;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p10 = PPredicate::p10;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p11 = PPredicate::p11;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p12 = PPredicate::p12;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p13 = PPredicate::p13;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p14 = PPredicate::p14;
+
+    /// @brief predicate scratch register (caller-saved)
+    const PPredicate p15 = PPredicate::p15;
+
+    /// @brief Use word (32 Bit) sized elements of a scalable vector.
+    enum class ZType32Bit : uint32_t
+    {
+      /// @brief Use word (32 Bit) sized elements of a scalable vector.
+      tS
+    };
+
+    /// @brief Use double word (64 Bit) sized elements of a scalable vector.
+    enum class ZType64Bit : uint32_t
+    {
+      /// @brief Use double word (64 Bit) sized elements of a scalable vector.
+      tD
+    };
+
+    /// @brief Use word (32 Bit) sized elements of a scalable vector.
+    const ZType32Bit ts = ZType32Bit::tS;
+
+    /// @brief Use double word (64 Bit) sized elements of a scalable vector.
+    const ZType64Bit td = ZType64Bit::tD;
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SCALABLE_H
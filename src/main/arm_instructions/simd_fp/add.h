@@ -0,0 +1,79 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_ADD_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_ADD_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class addVectorSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+      enum class addVectorQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t addVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const addVectorSizeType size_type,
+                                   const addVectorQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t add = 0;
+        add |= 0b0 << 31;
+        add |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        add |= 0b001110 << 24;
+        add |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        add |= 0b1 << 21;
+        add |= (Vm & mask5) << 16;
+        add |= 0b100001 << 10;
+        add |= (Vn & mask5) << 5;
+        add |= (Vd & mask5) << 0;
+        return add;
+      }
+
+    }  // namespace internal
+
+    /**
+     * add Vd.2s, Vn.2s, Vm.2s, adds the integer lanes.
+     */
+    constexpr uint32_t add(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                           const VType2x32Bit)
+    {
+      return internal::addVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                 internal::addVectorSizeType::size32, internal::addVectorQType::q0);
+    }
+
+    /**
+     * add Vd.4s, Vn.4s, Vm.4s, adds the integer lanes.
+     */
+    constexpr uint32_t add(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                           const VType4x32Bit)
+    {
+      return internal::addVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                 internal::addVectorSizeType::size32, internal::addVectorQType::q1);
+    }
+
+    /**
+     * add Vd.2d, Vn.2d, Vm.2d, adds the integer lanes.
+     */
+    constexpr uint32_t add(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                           const VType2x64Bit)
+    {
+      return internal::addVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                 internal::addVectorSizeType::size64, internal::addVectorQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_ADD_H
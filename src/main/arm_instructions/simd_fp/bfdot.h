@@ -0,0 +1,104 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFDOT_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFDOT_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class bfdotQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t _bfdotVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const bfdotQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t bfdot = 0;
+        bfdot |= 0b0 << 31;
+        bfdot |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        bfdot |= 0b1'01110'010 << 21;
+        bfdot |= (Vm & mask5) << 16;
+        bfdot |= 0b111111 << 10;
+        bfdot |= (Vn & mask5) << 5;
+        bfdot |= (Vd & mask5) << 0;
+        return bfdot;
+      }
+
+      constexpr uint32_t _bfdotByElement(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const uint32_t index,
+                                         const bfdotQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+        release_assert(index <= 3, "The index of the bfloat16 pair is only allowed to be 0 - 3.");
+
+        // The index of the pair is encoded by H:L
+        uint32_t bfdot = 0;
+        bfdot |= 0b0 << 31;
+        bfdot |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        bfdot |= 0b0'01111'01 << 22;
+        bfdot |= (index & mask1) << 21;  // L
+        bfdot |= (Vm & mask5) << 16;
+        bfdot |= 0b1111 << 12;
+        bfdot |= ((index >> 1) & mask1) << 11;  // H
+        bfdot |= 0b0 << 10;
+        bfdot |= (Vn & mask5) << 5;
+        bfdot |= (Vd & mask5) << 0;
+        return bfdot;
+      }
+
+    }  // namespace internal
+
+    /**
+     * bfdot Vd.2s, Vn.4h, Vm.4h, adds the dot product of the two bfloat16 pairs of each lane to the single-precision lanes of Vd.
+     */
+    constexpr uint32_t bfdot(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType4x16Bit, const VGeneral Vm,
+                             const VType4x16Bit)
+    {
+      return internal::_bfdotVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                    internal::bfdotQType::q0);
+    }
+
+    /**
+     * bfdot Vd.4s, Vn.8h, Vm.8h, adds the dot product of the two bfloat16 pairs of each lane to the single-precision lanes of Vd.
+     */
+    constexpr uint32_t bfdot(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType8x16Bit, const VGeneral Vm,
+                             const VType8x16Bit)
+    {
+      return internal::_bfdotVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                    internal::bfdotQType::q1);
+    }
+
+    /**
+     * bfdot Vd.2s, Vn.4h, Vm.2h[index], adds the dot product of each bfloat16 pair of Vn with the pair index of Vm to the lanes of Vd.
+     */
+    constexpr uint32_t bfdot(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType4x16Bit, const VGeneral Vm,
+                             const uint32_t index)
+    {
+      return internal::_bfdotByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                       internal::bfdotQType::q0);
+    }
+
+    /**
+     * bfdot Vd.4s, Vn.8h, Vm.2h[index], adds the dot product of each bfloat16 pair of Vn with the pair index of Vm to the lanes of Vd.
+     */
+    constexpr uint32_t bfdot(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType8x16Bit, const VGeneral Vm,
+                             const uint32_t index)
+    {
+      return internal::_bfdotByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                       internal::bfdotQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFDOT_H
@@ -0,0 +1,43 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFMMLA_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFMMLA_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      constexpr uint32_t _bfmmla(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t bfmmla = 0;
+        bfmmla |= 0b0110'1110'010 << 21;
+        bfmmla |= (Vm & mask5) << 16;
+        bfmmla |= 0b111011 << 10;
+        bfmmla |= (Vn & mask5) << 5;
+        bfmmla |= (Vd & mask5) << 0;
+        return bfmmla;
+      }
+
+    }  // namespace internal
+
+    /**
+     * bfmmla Vd.4s, Vn.8h, Vm.8h, accumulates the 2x4 bfloat16 rows of Vn times the transposed 2x4 bfloat16 rows of Vm into the row-major
+     * 2x2 single-precision matrix Vd, i.e. Vd[2 * i + j] += sum_k(Vn[4 * i + k] * Vm[4 * j + k]).
+     */
+    constexpr uint32_t bfmmla(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType8x16Bit, const VGeneral Vm,
+                              const VType8x16Bit)
+    {
+      return internal::_bfmmla(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm));
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_BFMMLA_H
@@ -0,0 +1,70 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_DUP_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_DUP_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class dupQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t dupElement(const uint32_t Vd, const uint32_t Vn, const uint32_t index, const bool isDoublePrecision,
+                                    const dupQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        // index and element size encoded in imm5, i.e. xx100 for single and x1000 for double precision
+        uint32_t imm5 = 0;
+        if (isDoublePrecision)
+        {
+          release_assert(index <= 1, "Index should be less equal than 1, for double precision.");
+          release_assert(q_type == dupQType::q1, "1D is not a valid arrangement for dup.");
+          imm5 = (index << 4) | 0b1000;
+        }
+        else
+        {
+          release_assert(index <= 3, "Index should be less equal than 3, for single precision.");
+          imm5 = (index << 3) | 0b100;
+        }
+
+        uint32_t dup = 0;
+        dup |= 0b0 << 31;
+        dup |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        dup |= 0b001110000 << 21;
+        dup |= (imm5 & mask5) << 16;
+        dup |= 0b000001 << 10;
+        dup |= (Vn & mask5) << 5;
+        dup |= (Vd & mask5) << 0;
+        return dup;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t dup(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const uint32_t index)
+    {
+      return internal::dupElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), index, false, internal::dupQType::q0);
+    }
+
+    constexpr uint32_t dup(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const uint32_t index)
+    {
+      return internal::dupElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), index, false, internal::dupQType::q1);
+    }
+
+    constexpr uint32_t dup(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const uint32_t index)
+    {
+      return internal::dupElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), index, true, internal::dupQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_DUP_H
@@ -0,0 +1,72 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FABS_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FABS_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fabsSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fabsQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fabsVector(const uint32_t Vd, const uint32_t Vn, const fabsSzType sz_type, const fabsQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fabs = 0;
+        fabs |= 0b0 << 31;
+        fabs |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fabs |= 0b001110'1 << 23;
+        fabs |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fabs |= 0b10000'01111'10 << 10;
+        fabs |= (Vn & mask5) << 5;
+        fabs |= (Vd & mask5) << 0;
+        return fabs;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fabs Vd.2s, Vn.2s, clears the sign bit of the lanes.
+     */
+    constexpr uint32_t fabs(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::fabsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fabsSzType::sz0,
+                                  internal::fabsQType::q0);
+    }
+
+    /**
+     * fabs Vd.4s, Vn.4s, clears the sign bit of the lanes.
+     */
+    constexpr uint32_t fabs(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fabsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fabsSzType::sz0,
+                                  internal::fabsQType::q1);
+    }
+
+    /**
+     * fabs Vd.2d, Vn.2d, clears the sign bit of the lanes.
+     */
+    constexpr uint32_t fabs(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fabsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fabsSzType::sz1,
+                                  internal::fabsQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FABS_H
@@ -0,0 +1,109 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADD_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADD_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class faddSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class faddQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+      enum class faddFType : uint32_t
+      {
+        ftype00 = 0b00,
+        ftype01 = 0b01,
+        ftype11 = 0b11,
+      };
+
+      constexpr uint32_t faddVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const faddSzType sz_type,
+                                    const faddQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fadd = 0;
+        fadd |= 0b0 << 31;
+        fadd |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fadd |= 0b001110001 << 21;  // 0011100x1 sz!
+        fadd |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fadd |= (Vm & mask5) << 16;
+        fadd |= 0b110101 << 10;
+        fadd |= (Vn & mask5) << 5;
+        fadd |= (Vd & mask5) << 0;
+        return fadd;
+      }
+
+      constexpr uint32_t faddScalar(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const faddFType f_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fadd = 0;
+        fadd |= 0b00011110001 << 21;  // 00011110ftype1 ftype (2 bits)!
+        fadd |= (static_cast<uint32_t>(f_type) & mask2) << 22;
+        fadd |= (Vm & mask5) << 16;
+        fadd |= 0b001010 << 10;
+        fadd |= (Vn & mask5) << 5;
+        fadd |= (Vd & mask5) << 0;
+        return fadd;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t fadd(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::faddVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddSzType::sz0, internal::faddQType::q0);
+    }
+
+    constexpr uint32_t fadd(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::faddVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddSzType::sz0, internal::faddQType::q1);
+    }
+
+    constexpr uint32_t fadd(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::faddVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddSzType::sz1, internal::faddQType::q1);
+    }
+
+    constexpr uint32_t fadd(const V16Bit Vd, const V16Bit Vn, const V16Bit Vm)
+    {
+      return internal::faddScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddFType::ftype11);
+    }
+
+    constexpr uint32_t fadd(const V32Bit Vd, const V32Bit Vn, const V32Bit Vm)
+    {
+      return internal::faddScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddFType::ftype00);
+    }
+
+    constexpr uint32_t fadd(const V64Bit Vd, const V64Bit Vn, const V64Bit Vm)
+    {
+      return internal::faddScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddFType::ftype01);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADD_H
\ No newline at end of file
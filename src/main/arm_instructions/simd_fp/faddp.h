@@ -0,0 +1,110 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADDP_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADDP_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class faddpSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class faddpQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t faddpVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const faddpSzType sz_type,
+                                    const faddpQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t faddp = 0;
+        faddp |= 0b0 << 31;
+        faddp |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        faddp |= 0b101110001 << 21;  // 1011100x1 sz!
+        faddp |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        faddp |= (Vm & mask5) << 16;
+        faddp |= 0b110101 << 10;
+        faddp |= (Vn & mask5) << 5;
+        faddp |= (Vd & mask5) << 0;
+        return faddp;
+      }
+
+      constexpr uint32_t faddpScalar(const uint32_t Vd, const uint32_t Vn, const faddpSzType sz_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t faddp = 0;
+        faddp |= 0b011111100 << 23;
+        faddp |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        faddp |= 0b11000 << 17;
+        faddp |= 0b01101 << 12;
+        faddp |= 0b10 << 10;
+        faddp |= (Vn & mask5) << 5;
+        faddp |= (Vd & mask5) << 0;
+        return faddp;
+      }
+
+    }  // namespace internal
+
+    /**
+     * faddp Vd.2s, Vn.2s, Vm.2s, adds the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t faddp(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::faddpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddpSzType::sz0, internal::faddpQType::q0);
+    }
+
+    /**
+     * faddp Vd.4s, Vn.4s, Vm.4s, adds the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t faddp(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::faddpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddpSzType::sz0, internal::faddpQType::q1);
+    }
+
+    /**
+     * faddp Vd.2d, Vn.2d, Vm.2d, adds the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t faddp(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::faddpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::faddpSzType::sz1, internal::faddpQType::q1);
+    }
+
+    /**
+     * faddp Sd, Vn.2s, adds the of the two lanes of Vn.
+     */
+    constexpr uint32_t faddp(const V32Bit Vd, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::faddpScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::faddpSzType::sz0);
+    }
+
+    /**
+     * faddp Dd, Vn.2d, adds the of the two lanes of Vn.
+     */
+    constexpr uint32_t faddp(const V64Bit Vd, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::faddpScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::faddpSzType::sz1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FADDP_H
\ No newline at end of file
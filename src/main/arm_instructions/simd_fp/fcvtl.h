@@ -0,0 +1,82 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTL_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTL_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fcvtlSzType : uint32_t
+      {
+        sz0 = 0b0,  // half precision to single precision
+        sz1 = 0b1   // single precision to double precision
+      };
+      enum class fcvtlQType : uint32_t
+      {
+        q0 = 0b0,  // fcvtl reads the lower half of Vn
+        q1 = 0b1   // fcvtl2 reads the upper half of Vn
+      };
+
+      constexpr uint32_t fcvtlVector(const uint32_t Vd, const uint32_t Vn, const fcvtlSzType sz_type, const fcvtlQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fcvtl = 0;
+        fcvtl |= 0b0 << 31;
+        fcvtl |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fcvtl |= 0b0011100 << 23;
+        fcvtl |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fcvtl |= 0b10000'10111'10 << 10;
+        fcvtl |= (Vn & mask5) << 5;
+        fcvtl |= (Vd & mask5) << 0;
+        return fcvtl;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fcvtl Vd.4s, Vn.4h, widens the lower four half-precision values to single precision.
+     */
+    constexpr uint32_t fcvtl(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x16Bit)
+    {
+      return internal::fcvtlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtlSzType::sz0,
+                                   internal::fcvtlQType::q0);
+    }
+
+    /**
+     * fcvtl Vd.2d, Vn.2s, widens the lower two single-precision values to double precision.
+     */
+    constexpr uint32_t fcvtl(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::fcvtlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtlSzType::sz1,
+                                   internal::fcvtlQType::q0);
+    }
+
+    /**
+     * fcvtl2 Vd.4s, Vn.8h, widens the upper four half-precision values to single precision.
+     */
+    constexpr uint32_t fcvtl2(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType8x16Bit)
+    {
+      return internal::fcvtlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtlSzType::sz0,
+                                   internal::fcvtlQType::q1);
+    }
+
+    /**
+     * fcvtl2 Vd.2d, Vn.4s, widens the upper two single-precision values to double precision.
+     */
+    constexpr uint32_t fcvtl2(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fcvtlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtlSzType::sz1,
+                                   internal::fcvtlQType::q1);
+    }
+
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTL_H
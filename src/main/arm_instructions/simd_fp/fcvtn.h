@@ -0,0 +1,82 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTN_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTN_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fcvtnSzType : uint32_t
+      {
+        sz0 = 0b0,  // single precision to half precision
+        sz1 = 0b1   // double precision to single precision
+      };
+      enum class fcvtnQType : uint32_t
+      {
+        q0 = 0b0,  // fcvtn writes the lower half and zeros the upper half of Vd
+        q1 = 0b1   // fcvtn2 writes the upper half and keeps the lower half of Vd
+      };
+
+      constexpr uint32_t fcvtnVector(const uint32_t Vd, const uint32_t Vn, const fcvtnSzType sz_type, const fcvtnQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fcvtn = 0;
+        fcvtn |= 0b0 << 31;
+        fcvtn |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fcvtn |= 0b0011100 << 23;
+        fcvtn |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fcvtn |= 0b10000'10110'10 << 10;
+        fcvtn |= (Vn & mask5) << 5;
+        fcvtn |= (Vd & mask5) << 0;
+        return fcvtn;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fcvtn Vd.4h, Vn.4s, narrows the single-precision values to half precision and zeros the upper half of Vd.
+     */
+    constexpr uint32_t fcvtn(const VGeneral Vd, const VType4x16Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fcvtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnSzType::sz0,
+                                   internal::fcvtnQType::q0);
+    }
+
+    /**
+     * fcvtn Vd.2s, Vn.2d, narrows the double-precision values to single precision and zeros the upper half of Vd.
+     */
+    constexpr uint32_t fcvtn(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fcvtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnSzType::sz1,
+                                   internal::fcvtnQType::q0);
+    }
+
+    /**
+     * fcvtn2 Vd.8h, Vn.4s, narrows the single-precision values into the upper half-precision values of Vd.
+     */
+    constexpr uint32_t fcvtn2(const VGeneral Vd, const VType8x16Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fcvtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnSzType::sz0,
+                                   internal::fcvtnQType::q1);
+    }
+
+    /**
+     * fcvtn2 Vd.4s, Vn.2d, narrows the double-precision values into the upper single-precision values of Vd.
+     */
+    constexpr uint32_t fcvtn2(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fcvtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnSzType::sz1,
+                                   internal::fcvtnQType::q1);
+    }
+
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTN_H
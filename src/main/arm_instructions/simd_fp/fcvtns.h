@@ -0,0 +1,75 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTNS_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTNS_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fcvtnsSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fcvtnsQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fcvtnsVector(const uint32_t Vd, const uint32_t Vn, const fcvtnsSzType sz_type, const fcvtnsQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fcvtns = 0;
+        fcvtns |= 0b0 << 31;
+        fcvtns |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fcvtns |= 0b001110'0 << 23;
+        fcvtns |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fcvtns |= 0b10000'11010'10 << 10;
+        fcvtns |= (Vn & mask5) << 5;
+        fcvtns |= (Vd & mask5) << 0;
+        return fcvtns;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fcvtns Vd.2s, Vn.2s, converts the floating-point lanes to signed integer lanes of the same size, rounding to nearest with ties
+     * to even and saturating.
+     */
+    constexpr uint32_t fcvtns(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::fcvtnsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnsSzType::sz0,
+                                  internal::fcvtnsQType::q0);
+    }
+
+    /**
+     * fcvtns Vd.4s, Vn.4s, converts the floating-point lanes to signed integer lanes of the same size, rounding to nearest with ties
+     * to even and saturating.
+     */
+    constexpr uint32_t fcvtns(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fcvtnsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnsSzType::sz0,
+                                  internal::fcvtnsQType::q1);
+    }
+
+    /**
+     * fcvtns Vd.2d, Vn.2d, converts the floating-point lanes to signed integer lanes of the same size, rounding to nearest with ties
+     * to even and saturating.
+     */
+    constexpr uint32_t fcvtns(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fcvtnsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fcvtnsSzType::sz1,
+                                  internal::fcvtnsQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FCVTNS_H
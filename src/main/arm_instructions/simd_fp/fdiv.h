@@ -0,0 +1,79 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FDIV_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FDIV_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fdivSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fdivQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fdivVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fdivSzType sz_type,
+                                    const fdivQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fdiv = 0;
+        fdiv |= 0b0 << 31;
+        fdiv |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fdiv |= 0b1011100 << 23;
+        fdiv |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fdiv |= 0b1 << 21;
+        fdiv |= (Vm & mask5) << 16;
+        fdiv |= 0b111111 << 10;
+        fdiv |= (Vn & mask5) << 5;
+        fdiv |= (Vd & mask5) << 0;
+        return fdiv;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fdiv Vd.2s, Vn.2s, Vm.2s, divides the lanes of Vn by the lanes of Vm.
+     */
+    constexpr uint32_t fdiv(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fdivVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fdivSzType::sz0, internal::fdivQType::q0);
+    }
+
+    /**
+     * fdiv Vd.4s, Vn.4s, Vm.4s, divides the lanes of Vn by the lanes of Vm.
+     */
+    constexpr uint32_t fdiv(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fdivVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fdivSzType::sz0, internal::fdivQType::q1);
+    }
+
+    /**
+     * fdiv Vd.2d, Vn.2d, Vm.2d, divides the lanes of Vn by the lanes of Vm.
+     */
+    constexpr uint32_t fdiv(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fdivVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fdivSzType::sz1, internal::fdivQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FDIV_H
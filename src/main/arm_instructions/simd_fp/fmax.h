@@ -47,6 +47,23 @@ namespace mini_jit
         return fmax;
       }
 
+      constexpr uint32_t fmaxHalfVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fmaxQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmax = 0;
+        fmax |= 0b0 << 31;
+        fmax |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmax |= 0b001110010 << 21;
+        fmax |= (Vm & mask5) << 16;
+        fmax |= 0b001101 << 10;
+        fmax |= (Vn & mask5) << 5;
+        fmax |= (Vd & mask5) << 0;
+        return fmax;
+      }
+
       constexpr uint32_t fmaxScalar(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fmaxFType f_type)
       {
         release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
@@ -65,6 +82,20 @@ namespace mini_jit
 
     }  // namespace internal
 
+    constexpr uint32_t fmax(const VGeneral Vd, const VType4x16Bit, const VGeneral Vn, const VType4x16Bit, const VGeneral Vm,
+                            const VType4x16Bit)
+    {
+      return internal::fmaxHalfVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                      internal::fmaxQType::q0);
+    }
+
+    constexpr uint32_t fmax(const VGeneral Vd, const VType8x16Bit, const VGeneral Vn, const VType8x16Bit, const VGeneral Vm,
+                            const VType8x16Bit)
+    {
+      return internal::fmaxHalfVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                      internal::fmaxQType::q1);
+    }
+
     constexpr uint32_t fmax(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
                             const VType2x32Bit)
     {
@@ -104,6 +135,6 @@ namespace mini_jit
                                   internal::fmaxFType::ftype01);
     }
   }  // namespace arm_instructions
-}  // namespace mini_jit
+}    // namespace mini_jit
 
 #endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMAX_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMAXP_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMAXP_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fmaxpSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fmaxpQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fmaxpVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fmaxpSzType sz_type,
+                                    const fmaxpQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmaxp = 0;
+        fmaxp |= 0b0 << 31;
+        fmaxp |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmaxp |= 0b101110001 << 21;  // 1011100x1 sz!
+        fmaxp |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmaxp |= (Vm & mask5) << 16;
+        fmaxp |= 0b111101 << 10;
+        fmaxp |= (Vn & mask5) << 5;
+        fmaxp |= (Vd & mask5) << 0;
+        return fmaxp;
+      }
+
+      constexpr uint32_t fmaxpScalar(const uint32_t Vd, const uint32_t Vn, const fmaxpSzType sz_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fmaxp = 0;
+        fmaxp |= 0b011111100 << 23;
+        fmaxp |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmaxp |= 0b11000 << 17;
+        fmaxp |= 0b01111 << 12;
+        fmaxp |= 0b10 << 10;
+        fmaxp |= (Vn & mask5) << 5;
+        fmaxp |= (Vd & mask5) << 0;
+        return fmaxp;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fmaxp Vd.2s, Vn.2s, Vm.2s, takes the maximum of the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t fmaxp(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fmaxpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmaxpSzType::sz0, internal::fmaxpQType::q0);
+    }
+
+    /**
+     * fmaxp Vd.4s, Vn.4s, Vm.4s, takes the maximum of the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t fmaxp(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fmaxpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmaxpSzType::sz0, internal::fmaxpQType::q1);
+    }
+
+    /**
+     * fmaxp Vd.2d, Vn.2d, Vm.2d, takes the maximum of the adjacent pairs of lanes of the concatenation of Vn and Vm.
+     */
+    constexpr uint32_t fmaxp(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fmaxpVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmaxpSzType::sz1, internal::fmaxpQType::q1);
+    }
+
+    /**
+     * fmaxp Sd, Vn.2s, takes the maximum of the two lanes of Vn.
+     */
+    constexpr uint32_t fmaxp(const V32Bit Vd, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::fmaxpScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fmaxpSzType::sz0);
+    }
+
+    /**
+     * fmaxp Dd, Vn.2d, takes the maximum of the two lanes of Vn.
+     */
+    constexpr uint32_t fmaxp(const V64Bit Vd, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fmaxpScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fmaxpSzType::sz1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMAXP_H
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMIN_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMIN_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fminSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fminQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+      enum class fminFType : uint32_t
+      {
+        ftype00 = 0b00,
+        ftype01 = 0b01,
+        ftype11 = 0b11,
+      };
+
+      constexpr uint32_t fminVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fminSzType sz_type,
+                                    const fminQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmin = 0;
+        fmin |= 0b0 << 31;
+        fmin |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmin |= 0b001110101 << 21;  // 0011101x1 sz!
+        fmin |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmin |= (Vm & mask5) << 16;
+        fmin |= 0b111101 << 10;
+        fmin |= (Vn & mask5) << 5;
+        fmin |= (Vd & mask5) << 0;
+        return fmin;
+      }
+
+      constexpr uint32_t fminScalar(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fminFType f_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmin = 0;
+        fmin |= 0b00011110001 << 21;  // 00011110ftype1 ftype (2 bits)!
+        fmin |= (static_cast<uint32_t>(f_type) & mask2) << 22;
+        fmin |= (Vm & mask5) << 16;
+        fmin |= 0b010110 << 10;
+        fmin |= (Vn & mask5) << 5;
+        fmin |= (Vd & mask5) << 0;
+        return fmin;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t fmin(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fminVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminSzType::sz0, internal::fminQType::q0);
+    }
+
+    constexpr uint32_t fmin(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fminVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminSzType::sz0, internal::fminQType::q1);
+    }
+
+    constexpr uint32_t fmin(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fminVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminSzType::sz1, internal::fminQType::q1);
+    }
+
+    constexpr uint32_t fmin(const V16Bit Vd, const V16Bit Vn, const V16Bit Vm)
+    {
+      return internal::fminScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminFType::ftype11);
+    }
+
+    constexpr uint32_t fmin(const V32Bit Vd, const V32Bit Vn, const V32Bit Vm)
+    {
+      return internal::fminScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminFType::ftype00);
+    }
+
+    constexpr uint32_t fmin(const V64Bit Vd, const V64Bit Vn, const V64Bit Vm)
+    {
+      return internal::fminScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fminFType::ftype01);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMIN_H
\ No newline at end of file
@@ -229,6 +229,25 @@ namespace mini_jit
         return fmla;
       }
 
+      constexpr uint32_t fmlaVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const bool isDoublePrecision, const uint32_t Q)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmla = 0;
+        fmla |= 0b0 << 31;
+        fmla |= (Q & mask1) << 30;
+        fmla |= 0b0011100 << 23;
+        fmla |= (isDoublePrecision & mask1) << 22;
+        fmla |= 0b1 << 21;
+        fmla |= (Vm & mask5) << 16;
+        fmla |= 0b110011 << 10;
+        fmla |= (Vn & mask5) << 5;
+        fmla |= (Vd & mask5) << 0;
+        return fmla;
+      }
+
     }  // namespace internal
 
     constexpr uint32_t fmla(const V16Bit Hd, const V16Bit Hn, const VGeneral Vm, const uint32_t index)
@@ -273,6 +292,33 @@ namespace mini_jit
                                                         static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index);
     }
 
+    /**
+     * fmla Vd.2s, Vn.2s, Vm.2s, adds the products of the lanes of Vn and Vm to the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmla(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fmlaVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), false, 0b0);
+    }
+
+    /**
+     * fmla Vd.4s, Vn.4s, Vm.4s, adds the products of the lanes of Vn and Vm to the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmla(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fmlaVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), false, 0b1);
+    }
+
+    /**
+     * fmla Vd.2d, Vn.2d, Vm.2d, adds the products of the lanes of Vn and Vm to the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmla(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fmlaVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), true, 0b1);
+    }
+
   }  // namespace arm_instructions
 }  // namespace mini_jit
 
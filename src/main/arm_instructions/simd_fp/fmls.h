@@ -0,0 +1,79 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMLS_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMLS_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fmlsSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fmlsQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fmlsVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fmlsSzType sz_type,
+                                    const fmlsQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmls = 0;
+        fmls |= 0b0 << 31;
+        fmls |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmls |= 0b0011101 << 23;
+        fmls |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmls |= 0b1 << 21;
+        fmls |= (Vm & mask5) << 16;
+        fmls |= 0b110011 << 10;
+        fmls |= (Vn & mask5) << 5;
+        fmls |= (Vd & mask5) << 0;
+        return fmls;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fmls Vd.2s, Vn.2s, Vm.2s, subtracts the products of the lanes of Vn and Vm from the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmls(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fmlsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmlsSzType::sz0, internal::fmlsQType::q0);
+    }
+
+    /**
+     * fmls Vd.4s, Vn.4s, Vm.4s, subtracts the products of the lanes of Vn and Vm from the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmls(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fmlsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmlsSzType::sz0, internal::fmlsQType::q1);
+    }
+
+    /**
+     * fmls Vd.2d, Vn.2d, Vm.2d, subtracts the products of the lanes of Vn and Vm from the lanes of Vd without intermediate rounding.
+     */
+    constexpr uint32_t fmls(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fmlsVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmlsSzType::sz1, internal::fmlsQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMLS_H
@@ -0,0 +1,65 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMOV_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMOV_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+
+    namespace internal
+    {
+      enum class fmovFType : uint32_t
+      {
+        ftype00 = 0b00,
+        ftype01 = 0b01,
+      };
+
+      constexpr uint32_t fmovGeneral(const uint32_t Rd, const uint32_t Rn, const fmovFType f_type, bool is64bit, bool toGeneral)
+      {
+        release_assert((Rd & mask5) == Rd, "Rd is only allowed to have a size of 5 bit.");
+        release_assert((Rn & mask5) == Rn, "Rn is only allowed to have a size of 5 bit.");
+
+        uint32_t fmov = 0;
+        fmov |= (is64bit & mask1) << 31;
+        fmov |= 0b0011110 << 24;
+        fmov |= (static_cast<uint32_t>(f_type) & mask2) << 22;
+        fmov |= 0b1 << 21;
+        fmov |= 0b00 << 19;  // rmode
+        fmov |= 0b11 << 17;
+        fmov |= ((!toGeneral) & mask1) << 16;  // opcode 110 to general, 111 from general
+        fmov |= 0b000000 << 10;
+        fmov |= (Rn & mask5) << 5;
+        fmov |= (Rd & mask5) << 0;
+        return fmov;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t fmov(const V32Bit Sd, const R32Bit Wn)
+    {
+      return internal::fmovGeneral(static_cast<uint32_t>(Sd), static_cast<uint32_t>(Wn), internal::fmovFType::ftype00, false, false);
+    }
+
+    constexpr uint32_t fmov(const V64Bit Dd, const R64Bit Xn)
+    {
+      return internal::fmovGeneral(static_cast<uint32_t>(Dd), static_cast<uint32_t>(Xn), internal::fmovFType::ftype01, true, false);
+    }
+
+    constexpr uint32_t fmov(const R32Bit Wd, const V32Bit Sn)
+    {
+      return internal::fmovGeneral(static_cast<uint32_t>(Wd), static_cast<uint32_t>(Sn), internal::fmovFType::ftype00, false, true);
+    }
+
+    constexpr uint32_t fmov(const R64Bit Xd, const V64Bit Dn)
+    {
+      return internal::fmovGeneral(static_cast<uint32_t>(Xd), static_cast<uint32_t>(Dn), internal::fmovFType::ftype01, true, true);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMOV_H
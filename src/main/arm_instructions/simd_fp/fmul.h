@@ -0,0 +1,127 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMUL_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMUL_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fmulSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fmulQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fmulVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fmulSzType sz_type,
+                                    const fmulQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmul = 0;
+        fmul |= 0b0 << 31;
+        fmul |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmul |= 0b101110001 << 21;  // 1011100x1 sz!
+        fmul |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmul |= (Vm & mask5) << 16;
+        fmul |= 0b110111 << 10;
+        fmul |= (Vn & mask5) << 5;
+        fmul |= (Vd & mask5) << 0;
+        return fmul;
+      }
+
+      constexpr uint32_t fmulByElement(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const uint32_t index,
+                                       const fmulSzType sz_type, const fmulQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        // index encoded in H:L for single precision and in H for double precision
+        uint32_t L = 0;
+        uint32_t H = 0;
+        if (sz_type == fmulSzType::sz1)
+        {
+          release_assert(index <= 1, "Index should be less equal than 1, for double precision.");
+          H = index & mask1;
+        }
+        else
+        {
+          release_assert(index <= 3, "Index should be less equal than 3, for single precision.");
+          L = index & mask1;
+          H = (index >> 1) & mask1;
+        }
+
+        uint32_t fmul = 0;
+        fmul |= 0b0 << 31;
+        fmul |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fmul |= 0b0011111 << 23;
+        fmul |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fmul |= (L & mask1) << 21;
+        fmul |= (Vm & mask5) << 16;
+        fmul |= 0b1001 << 12;
+        fmul |= (H & mask1) << 11;
+        fmul |= 0b0 << 10;
+        fmul |= (Vn & mask5) << 5;
+        fmul |= (Vd & mask5) << 0;
+        return fmul;
+      }
+
+    }  // namespace internal
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fmulVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmulSzType::sz0, internal::fmulQType::q0);
+    }
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fmulVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmulSzType::sz0, internal::fmulQType::q1);
+    }
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fmulVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fmulSzType::sz1, internal::fmulQType::q1);
+    }
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const uint32_t index)
+    {
+      return internal::fmulByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                     internal::fmulSzType::sz0, internal::fmulQType::q0);
+    }
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const uint32_t index)
+    {
+      return internal::fmulByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                     internal::fmulSzType::sz0, internal::fmulQType::q1);
+    }
+
+    constexpr uint32_t fmul(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const uint32_t index)
+    {
+      return internal::fmulByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                     internal::fmulSzType::sz1, internal::fmulQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FMUL_H
@@ -0,0 +1,72 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSQRT_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSQRT_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fsqrtSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fsqrtQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t fsqrtVector(const uint32_t Vd, const uint32_t Vn, const fsqrtSzType sz_type, const fsqrtQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t fsqrt = 0;
+        fsqrt |= 0b0 << 31;
+        fsqrt |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fsqrt |= 0b1011101 << 23;
+        fsqrt |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fsqrt |= 0b100001111110 << 10;
+        fsqrt |= (Vn & mask5) << 5;
+        fsqrt |= (Vd & mask5) << 0;
+        return fsqrt;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fsqrt Vd.2s, Vn.2s, computes the square root of the lanes of Vn.
+     */
+    constexpr uint32_t fsqrt(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::fsqrtVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fsqrtSzType::sz0,
+                                   internal::fsqrtQType::q0);
+    }
+
+    /**
+     * fsqrt Vd.4s, Vn.4s, computes the square root of the lanes of Vn.
+     */
+    constexpr uint32_t fsqrt(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::fsqrtVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fsqrtSzType::sz0,
+                                   internal::fsqrtQType::q1);
+    }
+
+    /**
+     * fsqrt Vd.2d, Vn.2d, computes the square root of the lanes of Vn.
+     */
+    constexpr uint32_t fsqrt(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::fsqrtVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::fsqrtSzType::sz1,
+                                   internal::fsqrtQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSQRT_H
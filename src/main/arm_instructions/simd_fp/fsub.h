@@ -0,0 +1,127 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSUB_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSUB_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fsubSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class fsubQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+      enum class fsubFType : uint32_t
+      {
+        ftype00 = 0b00,
+        ftype01 = 0b01,
+        ftype11 = 0b11,
+      };
+
+      constexpr uint32_t fsubVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fsubSzType sz_type,
+                                    const fsubQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fsub = 0;
+        fsub |= 0b0 << 31;
+        fsub |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        fsub |= 0b001110101 << 21;  // 0011101x1 sz!
+        fsub |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        fsub |= (Vm & mask5) << 16;
+        fsub |= 0b110101 << 10;
+        fsub |= (Vn & mask5) << 5;
+        fsub |= (Vd & mask5) << 0;
+        return fsub;
+      }
+
+      constexpr uint32_t fsubScalar(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const fsubFType f_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t fsub = 0;
+        fsub |= 0b00011110001 << 21;  // 00011110ftype1 ftype (2 bits)!
+        fsub |= (static_cast<uint32_t>(f_type) & mask2) << 22;
+        fsub |= (Vm & mask5) << 16;
+        fsub |= 0b001110 << 10;
+        fsub |= (Vn & mask5) << 5;
+        fsub |= (Vd & mask5) << 0;
+        return fsub;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fsub Vd.2s, Vn.2s, Vm.2s, subtracts the lanes of Vm from the lanes of Vn.
+     */
+    constexpr uint32_t fsub(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const VGeneral Vm,
+                            const VType2x32Bit)
+    {
+      return internal::fsubVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubSzType::sz0, internal::fsubQType::q0);
+    }
+
+    /**
+     * fsub Vd.4s, Vn.4s, Vm.4s, subtracts the lanes of Vm from the lanes of Vn.
+     */
+    constexpr uint32_t fsub(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const VGeneral Vm,
+                            const VType4x32Bit)
+    {
+      return internal::fsubVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubSzType::sz0, internal::fsubQType::q1);
+    }
+
+    /**
+     * fsub Vd.2d, Vn.2d, Vm.2d, subtracts the lanes of Vm from the lanes of Vn.
+     */
+    constexpr uint32_t fsub(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const VGeneral Vm,
+                            const VType2x64Bit)
+    {
+      return internal::fsubVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubSzType::sz1, internal::fsubQType::q1);
+    }
+
+    /**
+     * fsub Hd, Hn, Hm.
+     */
+    constexpr uint32_t fsub(const V16Bit Vd, const V16Bit Vn, const V16Bit Vm)
+    {
+      return internal::fsubScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubFType::ftype11);
+    }
+
+    /**
+     * fsub Sd, Sn, Sm.
+     */
+    constexpr uint32_t fsub(const V32Bit Vd, const V32Bit Vn, const V32Bit Vm)
+    {
+      return internal::fsubScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubFType::ftype00);
+    }
+
+    /**
+     * fsub Dd, Dn, Dm.
+     */
+    constexpr uint32_t fsub(const V64Bit Vd, const V64Bit Vn, const V64Bit Vm)
+    {
+      return internal::fsubScalar(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                  internal::fsubFType::ftype01);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_FSUB_H
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_INS_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_INS_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      constexpr uint32_t insGeneral(const uint32_t Vd, const uint32_t Rn, const uint32_t imm5)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Rn & mask5) == Rn, "Rn is only allowed to have a size of 5 bit.");
+
+        uint32_t ins = 0;
+        ins |= 0b01001110000 << 21;
+        ins |= (imm5 & mask5) << 16;
+        ins |= 0b000111 << 10;
+        ins |= (Rn & mask5) << 5;
+        ins |= (Vd & mask5) << 0;
+        return ins;
+      }
+
+    }  // namespace internal
+
+    /**
+     * ins Vd.s[index], Wn (alias mov), copies the general-purpose register into a lane, the other lanes are unchanged.
+     */
+    constexpr uint32_t ins(const VGeneral Vd, const VType4x32Bit, const uint32_t index, const R32Bit Wn)
+    {
+      release_assert(index <= 3, "Index should be less equal than 3, for single precision.");
+      return internal::insGeneral(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Wn), (index << 3) | 0b100);
+    }
+
+    /**
+     * ins Vd.d[index], Xn (alias mov), copies the general-purpose register into a lane, the other lane is unchanged.
+     */
+    constexpr uint32_t ins(const VGeneral Vd, const VType2x64Bit, const uint32_t index, const R64Bit Xn)
+    {
+      release_assert(index <= 1, "Index should be less equal than 1, for double precision.");
+      return internal::insGeneral(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Xn), (index << 4) | 0b1000);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_INS_H
@@ -0,0 +1,72 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SCVTF_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SCVTF_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class scvtfSzType : uint32_t
+      {
+        sz0 = 0b0,
+        sz1 = 0b1
+      };
+      enum class scvtfQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t scvtfVector(const uint32_t Vd, const uint32_t Vn, const scvtfSzType sz_type, const scvtfQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t scvtf = 0;
+        scvtf |= 0b0 << 31;
+        scvtf |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        scvtf |= 0b001110'0 << 23;
+        scvtf |= (static_cast<uint32_t>(sz_type) & mask1) << 22;
+        scvtf |= 0b10000'11101'10 << 10;
+        scvtf |= (Vn & mask5) << 5;
+        scvtf |= (Vd & mask5) << 0;
+        return scvtf;
+      }
+
+    }  // namespace internal
+
+    /**
+     * scvtf Vd.2s, Vn.2s, converts the signed integer lanes to floating-point lanes of the same size, rounding to nearest.
+     */
+    constexpr uint32_t scvtf(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit)
+    {
+      return internal::scvtfVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::scvtfSzType::sz0,
+                                  internal::scvtfQType::q0);
+    }
+
+    /**
+     * scvtf Vd.4s, Vn.4s, converts the signed integer lanes to floating-point lanes of the same size, rounding to nearest.
+     */
+    constexpr uint32_t scvtf(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::scvtfVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::scvtfSzType::sz0,
+                                  internal::scvtfQType::q1);
+    }
+
+    /**
+     * scvtf Vd.2d, Vn.2d, converts the signed integer lanes to floating-point lanes of the same size, rounding to nearest.
+     */
+    constexpr uint32_t scvtf(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::scvtfVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::scvtfSzType::sz1,
+                                  internal::scvtfQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SCVTF_H
@@ -0,0 +1,69 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SHL_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SHL_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class shlQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t shlVector(const uint32_t Vd, const uint32_t Vn, const uint32_t shift, const uint32_t element_bits,
+                                   const shlQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert(shift < element_bits, "The shift must be less than the bits of an element.");
+
+        // immh:immb holds the element size plus the shift, i.e. 01xxxxx for words and 1xxxxxx for doublewords
+        const uint32_t imm = element_bits + shift;
+
+        uint32_t shl = 0;
+        shl |= 0b0 << 31;
+        shl |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        shl |= 0b0011110 << 23;
+        shl |= (imm & mask7) << 16;
+        shl |= 0b010101 << 10;
+        shl |= (Vn & mask5) << 5;
+        shl |= (Vd & mask5) << 0;
+        return shl;
+      }
+
+    }  // namespace internal
+
+    /**
+     * shl Vd.2s, Vn.2s, #shift, shifts the integer lanes left by shift bits.
+     */
+    constexpr uint32_t shl(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x32Bit, const uint32_t shift)
+    {
+      return internal::shlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), shift, 32, internal::shlQType::q0);
+    }
+
+    /**
+     * shl Vd.4s, Vn.4s, #shift, shifts the integer lanes left by shift bits.
+     */
+    constexpr uint32_t shl(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType4x32Bit, const uint32_t shift)
+    {
+      return internal::shlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), shift, 32, internal::shlQType::q1);
+    }
+
+    /**
+     * shl Vd.2d, Vn.2d, #shift, shifts the integer lanes left by shift bits.
+     */
+    constexpr uint32_t shl(const VGeneral Vd, const VType2x64Bit, const VGeneral Vn, const VType2x64Bit, const uint32_t shift)
+    {
+      return internal::shlVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), shift, 64, internal::shlQType::q1);
+    }
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SHL_H
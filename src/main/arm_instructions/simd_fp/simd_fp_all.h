@@ -3,17 +3,43 @@
 
 #include "../register/general_purpose.h"
 #include "../register/vector.h"
+#include "add.h"
+#include "bfdot.h"
+#include "bfmmla.h"
+#include "dup.h"
 #include "eor.h"
+#include "fabs.h"
+#include "fadd.h"
+#include "faddp.h"
+#include "fcvtl.h"
+#include "fcvtn.h"
+#include "fcvtns.h"
+#include "fdiv.h"
+#include "ins.h"
 #include "fmla.h"
+#include "fmls.h"
+#include "fmov.h"
+#include "fmul.h"
+#include "fsqrt.h"
+#include "fsub.h"
 #include "ld1.h"
 #include "ldp.h"
 #include "ldr.h"
+#include "scvtf.h"
+#include "sdot.h"
+#include "shl.h"
+#include "smmla.h"
+#include "sqxtn.h"
 #include "st1.h"
 #include "stp.h"
 #include "str.h"
 #include "fmax.h"
+#include "fmaxp.h"
+#include "fmin.h"
 #include "trn1.h"
 #include "trn2.h"
+#include "udot.h"
+#include "ummla.h"
 #include "zip1.h"
 #include "zip2.h"
 
@@ -0,0 +1,100 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SQXTN_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SQXTN_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class sqxtnSizeType : uint32_t
+      {
+        size8 = 0b00,
+        size16 = 0b01,
+        size32 = 0b10
+      };
+      enum class sqxtnQType : uint32_t
+      {
+        q0 = 0b0,  // sqxtn writes the lower half and zeros the upper half
+        q1 = 0b1   // sqxtn2 writes the upper half and keeps the lower half
+      };
+
+      constexpr uint32_t sqxtnVector(const uint32_t Vd, const uint32_t Vn, const sqxtnSizeType size_type, const sqxtnQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+
+        uint32_t sqxtn = 0;
+        sqxtn |= 0b0 << 31;
+        sqxtn |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        sqxtn |= 0b001110 << 24;
+        sqxtn |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        sqxtn |= 0b10000'10100'10 << 10;
+        sqxtn |= (Vn & mask5) << 5;
+        sqxtn |= (Vd & mask5) << 0;
+        return sqxtn;
+      }
+
+    }  // namespace internal
+
+    /**
+     * sqxtn Vd.8b, Vn.8h, narrows the signed halfwords to bytes with saturation.
+     */
+    constexpr uint32_t sqxtn(const VGeneral Vd, const VType8x8Bit, const VGeneral Vn, const VType8x16Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size8,
+                                   internal::sqxtnQType::q0);
+    }
+
+    /**
+     * sqxtn Vd.4h, Vn.4s, narrows the signed words to halfwords with saturation.
+     */
+    constexpr uint32_t sqxtn(const VGeneral Vd, const VType4x16Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size16,
+                                   internal::sqxtnQType::q0);
+    }
+
+    /**
+     * sqxtn Vd.2s, Vn.2d, narrows the signed doublewords to words with saturation.
+     */
+    constexpr uint32_t sqxtn(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size32,
+                                   internal::sqxtnQType::q0);
+    }
+
+    /**
+     * sqxtn2 Vd.16b, Vn.8h, narrows the signed halfwords into the upper bytes of Vd with saturation.
+     */
+    constexpr uint32_t sqxtn2(const VGeneral Vd, const VType16x8Bit, const VGeneral Vn, const VType8x16Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size8,
+                                   internal::sqxtnQType::q1);
+    }
+
+    /**
+     * sqxtn2 Vd.8h, Vn.4s, narrows the signed words into the upper halfwords of Vd with saturation.
+     */
+    constexpr uint32_t sqxtn2(const VGeneral Vd, const VType8x16Bit, const VGeneral Vn, const VType4x32Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size16,
+                                   internal::sqxtnQType::q1);
+    }
+
+    /**
+     * sqxtn2 Vd.4s, Vn.2d, narrows the signed doublewords into the upper words of Vd with saturation.
+     */
+    constexpr uint32_t sqxtn2(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType2x64Bit)
+    {
+      return internal::sqxtnVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), internal::sqxtnSizeType::size32,
+                                   internal::sqxtnQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_SQXTN_H
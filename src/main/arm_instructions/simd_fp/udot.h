@@ -0,0 +1,104 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UDOT_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UDOT_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class udotQType : uint32_t
+      {
+        q0 = 0b0,
+        q1 = 0b1
+      };
+
+      constexpr uint32_t _udotVector(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const udotQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t udot = 0;
+        udot |= 0b0 << 31;
+        udot |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        udot |= 0b1'01110'100 << 21;
+        udot |= (Vm & mask5) << 16;
+        udot |= 0b100101 << 10;
+        udot |= (Vn & mask5) << 5;
+        udot |= (Vd & mask5) << 0;
+        return udot;
+      }
+
+      constexpr uint32_t _udotByElement(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm, const uint32_t index,
+                                        const udotQType q_type)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+        release_assert(index <= 3, "The index of the group of four bytes is only allowed to be 0 - 3.");
+
+        // The index of the group is encoded by H:L
+        uint32_t udot = 0;
+        udot |= 0b0 << 31;
+        udot |= (static_cast<uint32_t>(q_type) & mask1) << 30;
+        udot |= 0b1'01111'10 << 22;
+        udot |= (index & mask1) << 21;  // L
+        udot |= (Vm & mask5) << 16;
+        udot |= 0b1110 << 12;
+        udot |= ((index >> 1) & mask1) << 11;  // H
+        udot |= 0b0 << 10;
+        udot |= (Vn & mask5) << 5;
+        udot |= (Vd & mask5) << 0;
+        return udot;
+      }
+
+    }  // namespace internal
+
+    /**
+     * udot Vd.2s, Vn.8b, Vm.8b, adds the dot product of the four unsigned bytes of each lane to the 32-bit lanes of Vd.
+     */
+    constexpr uint32_t udot(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType8x8Bit, const VGeneral Vm,
+                            const VType8x8Bit)
+    {
+      return internal::_udotVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                   internal::udotQType::q0);
+    }
+
+    /**
+     * udot Vd.4s, Vn.16b, Vm.16b, adds the dot product of the four unsigned bytes of each lane to the 32-bit lanes of Vd.
+     */
+    constexpr uint32_t udot(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType16x8Bit, const VGeneral Vm,
+                            const VType16x8Bit)
+    {
+      return internal::_udotVector(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm),
+                                   internal::udotQType::q1);
+    }
+
+    /**
+     * udot Vd.2s, Vn.8b, Vm.4b[index], adds the dot product of each group of four unsigned bytes of Vn with the group index of Vm.
+     */
+    constexpr uint32_t udot(const VGeneral Vd, const VType2x32Bit, const VGeneral Vn, const VType8x8Bit, const VGeneral Vm,
+                            const uint32_t index)
+    {
+      return internal::_udotByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                      internal::udotQType::q0);
+    }
+
+    /**
+     * udot Vd.4s, Vn.16b, Vm.4b[index], adds the dot product of each group of four unsigned bytes of Vn with the group index of Vm.
+     */
+    constexpr uint32_t udot(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType16x8Bit, const VGeneral Vm,
+                            const uint32_t index)
+    {
+      return internal::_udotByElement(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm), index,
+                                      internal::udotQType::q1);
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UDOT_H
@@ -0,0 +1,43 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UMMLA_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UMMLA_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      constexpr uint32_t _ummla(const uint32_t Vd, const uint32_t Vn, const uint32_t Vm)
+      {
+        release_assert((Vd & mask5) == Vd, "Vd is only allowed to have a size of 5 bit.");
+        release_assert((Vn & mask5) == Vn, "Vn is only allowed to have a size of 5 bit.");
+        release_assert((Vm & mask5) == Vm, "Vm is only allowed to have a size of 5 bit.");
+
+        uint32_t ummla = 0;
+        ummla |= 0b0'1'1'01110'100 << 21;
+        ummla |= (Vm & mask5) << 16;
+        ummla |= 0b101001 << 10;
+        ummla |= (Vn & mask5) << 5;
+        ummla |= (Vd & mask5) << 0;
+        return ummla;
+      }
+
+    }  // namespace internal
+
+    /**
+     * ummla Vd.4s, Vn.16b, Vm.16b, accumulates the 2x8 unsigned bytes of Vn times the transposed 2x8 unsigned bytes of Vm into the
+     * row-major 2x2 32-bit matrix Vd, i.e. Vd[2 * i + j] += sum_k(Vn[8 * i + k] * Vm[8 * j + k]).
+     */
+    constexpr uint32_t ummla(const VGeneral Vd, const VType4x32Bit, const VGeneral Vn, const VType16x8Bit, const VGeneral Vm,
+                             const VType16x8Bit)
+    {
+      return internal::_ummla(static_cast<uint32_t>(Vd), static_cast<uint32_t>(Vn), static_cast<uint32_t>(Vm));
+    }
+  }  // namespace arm_instructions
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SIMD_FP_UMMLA_H
@@ -0,0 +1,43 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_ADDVL_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_ADDVL_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      constexpr uint32_t addvl(const uint32_t Xd, const uint32_t Xn, const int32_t imm)
+      {
+        release_assert((Xd & mask5) == Xd, "Xd is only allowed to have a size of 5 bit.");
+        release_assert((Xn & mask5) == Xn, "Xn is only allowed to have a size of 5 bit.");
+        release_assert(imm >= -32 && imm <= 31, "imm has to be in the range of -32 to 31 vector lengths.");
+
+        uint32_t addvl = 0;
+        addvl |= 0b000001000 << 23;
+        addvl |= 0b01 << 21;
+        addvl |= (Xn & mask5) << 16;
+        addvl |= 0b01010 << 11;
+        addvl |= (static_cast<uint32_t>(imm) & mask6) << 5;
+        addvl |= (Xd & mask5) << 0;
+        return addvl;
+      }
+
+    }  // namespace internal
+
+    /**
+     * addvl Xd, Xn, #imm, adds imm times the vector length in bytes, Xd and Xn may be the stack pointer.
+     */
+    constexpr uint32_t addvl(const R64Bit Xd, const R64Bit Xn, const int32_t imm)
+    {
+      return internal::addvl(static_cast<uint32_t>(Xd), static_cast<uint32_t>(Xn), imm);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_ADDVL_H
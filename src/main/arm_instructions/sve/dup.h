@@ -0,0 +1,59 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_DUP_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_DUP_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class dupScalableSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t dupScalableImmediate(const uint32_t Zd, const int32_t imm, const dupScalableSizeType size_type)
+      {
+        release_assert((Zd & mask5) == Zd, "Zd is only allowed to have a size of 5 bit.");
+        release_assert(imm >= -128 && imm <= 127, "imm is only allowed to be a signed 8 bit value.");
+
+        // unshifted immediate, i.e. sh = 0
+        uint32_t dup = 0;
+        dup |= 0b00100101 << 24;
+        dup |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        dup |= 0b111 << 19;
+        dup |= 0b00 << 17;  // opc
+        dup |= 0b011 << 14;
+        dup |= 0b0 << 13;  // sh
+        dup |= (static_cast<uint32_t>(imm) & mask8) << 5;
+        dup |= (Zd & mask5) << 0;
+        return dup;
+      }
+
+    }  // namespace internal
+
+    /**
+     * dup Zd.s, #imm, broadcasts the signed 8 bit integer imm to all elements, i.e. #0 sets the vector to +0.0.
+     */
+    constexpr uint32_t dup(const ZScalable Zd, const ZType32Bit, const int32_t imm)
+    {
+      return internal::dupScalableImmediate(static_cast<uint32_t>(Zd), imm, internal::dupScalableSizeType::size32);
+    }
+
+    /**
+     * dup Zd.d, #imm, broadcasts the signed 8 bit integer imm to all elements, i.e. #0 sets the vector to +0.0.
+     */
+    constexpr uint32_t dup(const ZScalable Zd, const ZType64Bit, const int32_t imm)
+    {
+      return internal::dupScalableImmediate(static_cast<uint32_t>(Zd), imm, internal::dupScalableSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_DUP_H
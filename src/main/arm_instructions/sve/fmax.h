@@ -0,0 +1,62 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_FMAX_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_FMAX_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fmaxScalableSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t fmaxScalableImmediate(const uint32_t Zdn, const uint32_t Pg, const double imm, const fmaxScalableSizeType size_type)
+      {
+        release_assert((Zdn & mask5) == Zdn, "Zdn is only allowed to have a size of 5 bit.");
+        release_assert((Pg & mask3) == Pg, "Pg is only allowed to be one of p0 - p7.");
+        release_assert(imm == 0.0 || imm == 1.0, "imm is only allowed to be 0.0 or 1.0.");
+
+        uint32_t fmax = 0;
+        fmax |= 0b01100101 << 24;
+        fmax |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        fmax |= 0b011 << 19;
+        fmax |= 0b110 << 16;  // opc
+        fmax |= 0b100 << 13;
+        fmax |= (Pg & mask3) << 10;
+        fmax |= 0b0000 << 6;
+        fmax |= (imm == 1.0 ? 0b1 : 0b0) << 5;  // i1
+        fmax |= (Zdn & mask5) << 0;
+        return fmax;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fmax Zdn.s, Pg/m, Zdn.s, #imm with imm 0.0 or 1.0, inactive elements of Zdn are unchanged.
+     */
+    constexpr uint32_t fmax(const ZScalable Zdn, const ZType32Bit, const PPredicate Pg, const double imm)
+    {
+      return internal::fmaxScalableImmediate(static_cast<uint32_t>(Zdn), static_cast<uint32_t>(Pg), imm,
+                                             internal::fmaxScalableSizeType::size32);
+    }
+
+    /**
+     * fmax Zdn.d, Pg/m, Zdn.d, #imm with imm 0.0 or 1.0, inactive elements of Zdn are unchanged.
+     */
+    constexpr uint32_t fmax(const ZScalable Zdn, const ZType64Bit, const PPredicate Pg, const double imm)
+    {
+      return internal::fmaxScalableImmediate(static_cast<uint32_t>(Zdn), static_cast<uint32_t>(Pg), imm,
+                                             internal::fmaxScalableSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_FMAX_H
@@ -0,0 +1,63 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_FMLA_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_FMLA_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class fmlaScalableSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t fmlaScalable(const uint32_t Zda, const uint32_t Pg, const uint32_t Zn, const uint32_t Zm,
+                                      const fmlaScalableSizeType size_type)
+      {
+        release_assert((Zda & mask5) == Zda, "Zda is only allowed to have a size of 5 bit.");
+        release_assert((Pg & mask3) == Pg, "Pg is only allowed to be one of p0 - p7.");
+        release_assert((Zn & mask5) == Zn, "Zn is only allowed to have a size of 5 bit.");
+        release_assert((Zm & mask5) == Zm, "Zm is only allowed to have a size of 5 bit.");
+
+        uint32_t fmla = 0;
+        fmla |= 0b01100101 << 24;
+        fmla |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        fmla |= 0b1 << 21;
+        fmla |= (Zm & mask5) << 16;
+        fmla |= 0b000 << 13;  // opc
+        fmla |= (Pg & mask3) << 10;
+        fmla |= (Zn & mask5) << 5;
+        fmla |= (Zda & mask5) << 0;
+        return fmla;
+      }
+
+    }  // namespace internal
+
+    /**
+     * fmla Zda.s, Pg/m, Zn.s, Zm.s, inactive elements of Zda are unchanged.
+     */
+    constexpr uint32_t fmla(const ZScalable Zda, const ZType32Bit, const PPredicate Pg, const ZScalable Zn, const ZScalable Zm)
+    {
+      return internal::fmlaScalable(static_cast<uint32_t>(Zda), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Zn),
+                                    static_cast<uint32_t>(Zm), internal::fmlaScalableSizeType::size32);
+    }
+
+    /**
+     * fmla Zda.d, Pg/m, Zn.d, Zm.d, inactive elements of Zda are unchanged.
+     */
+    constexpr uint32_t fmla(const ZScalable Zda, const ZType64Bit, const PPredicate Pg, const ZScalable Zn, const ZScalable Zm)
+    {
+      return internal::fmlaScalable(static_cast<uint32_t>(Zda), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Zn),
+                                    static_cast<uint32_t>(Zm), internal::fmlaScalableSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_FMLA_H
@@ -0,0 +1,59 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_INC_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_INC_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class incSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t incScalar(const uint32_t Xdn, const uint32_t multiplier, const incSizeType size_type)
+      {
+        release_assert((Xdn & mask5) == Xdn, "Xdn is only allowed to have a size of 5 bit.");
+        release_assert(multiplier >= 1 && multiplier <= 16, "multiplier has to be in the range of 1 to 16.");
+
+        // pattern ALL, i.e. the number of elements in the vector length
+        uint32_t inc = 0;
+        inc |= 0b00000100 << 24;
+        inc |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        inc |= 0b11 << 20;
+        inc |= ((multiplier - 1) & mask4) << 16;  // imm4
+        inc |= 0b11100 << 11;
+        inc |= 0b0 << 10;  // D
+        inc |= 0b11111 << 5;
+        inc |= (Xdn & mask5) << 0;
+        return inc;
+      }
+
+    }  // namespace internal
+
+    /**
+     * incw Xdn, all, mul #multiplier, adds multiplier times the number of words in the vector length.
+     */
+    constexpr uint32_t incw(const R64Bit Xdn, const uint32_t multiplier = 1)
+    {
+      return internal::incScalar(static_cast<uint32_t>(Xdn), multiplier, internal::incSizeType::size32);
+    }
+
+    /**
+     * incd Xdn, all, mul #multiplier, adds multiplier times the number of double words in the vector length.
+     */
+    constexpr uint32_t incd(const R64Bit Xdn, const uint32_t multiplier = 1)
+    {
+      return internal::incScalar(static_cast<uint32_t>(Xdn), multiplier, internal::incSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_INC_H
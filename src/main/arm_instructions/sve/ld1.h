@@ -0,0 +1,63 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class ld1DtypeType : uint32_t
+      {
+        word = 0b1010,
+        doubleword = 0b1111
+      };
+
+      constexpr uint32_t ld1ScalarImm(const uint32_t Zt, const uint32_t Pg, const uint32_t Xn, const int32_t imm,
+                                      const ld1DtypeType dtype_type)
+      {
+        release_assert((Zt & mask5) == Zt, "Zt is only allowed to have a size of 5 bit.");
+        release_assert((Pg & mask3) == Pg, "Pg is only allowed to be one of p0 - p7.");
+        release_assert((Xn & mask5) == Xn, "Xn is only allowed to have a size of 5 bit.");
+        release_assert(imm >= -8 && imm <= 7, "imm has to be in the range of -8 to 7 vector lengths.");
+
+        uint32_t ld1 = 0;
+        ld1 |= 0b1010010 << 25;
+        ld1 |= (static_cast<uint32_t>(dtype_type) & mask4) << 21;
+        ld1 |= 0b0 << 20;
+        ld1 |= (static_cast<uint32_t>(imm) & mask4) << 16;
+        ld1 |= 0b101 << 13;
+        ld1 |= (Pg & mask3) << 10;
+        ld1 |= (Xn & mask5) << 5;
+        ld1 |= (Zt & mask5) << 0;
+        return ld1;
+      }
+
+    }  // namespace internal
+
+    /**
+     * ld1w {Zt.s}, Pg/z, [Xn, #imm, mul vl], inactive elements are set to zero.
+     */
+    constexpr uint32_t ld1w(const ZScalable Zt, const ZType32Bit, const PPredicate Pg, const R64Bit Xn, const int32_t imm = 0)
+    {
+      return internal::ld1ScalarImm(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), imm,
+                                    internal::ld1DtypeType::word);
+    }
+
+    /**
+     * ld1d {Zt.d}, Pg/z, [Xn, #imm, mul vl], inactive elements are set to zero.
+     */
+    constexpr uint32_t ld1d(const ZScalable Zt, const ZType64Bit, const PPredicate Pg, const R64Bit Xn, const int32_t imm = 0)
+    {
+      return internal::ld1ScalarImm(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), imm,
+                                    internal::ld1DtypeType::doubleword);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1_H
@@ -0,0 +1,67 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1R_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1R_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class ld1rDtypeType : uint32_t
+      {
+        word = 0b1010,
+        doubleword = 0b1111
+      };
+
+      constexpr uint32_t ld1r(const uint32_t Zt, const uint32_t Pg, const uint32_t Xn, const uint32_t offset, const ld1rDtypeType dtype_type)
+      {
+        const uint32_t element_size = dtype_type == ld1rDtypeType::word ? 4 : 8;
+        release_assert((Zt & mask5) == Zt, "Zt is only allowed to have a size of 5 bit.");
+        release_assert((Pg & mask3) == Pg, "Pg is only allowed to be one of p0 - p7.");
+        release_assert((Xn & mask5) == Xn, "Xn is only allowed to have a size of 5 bit.");
+        release_assert(offset % element_size == 0, "offset has to be a multiple of the element size.");
+        release_assert(offset / element_size <= mask6, "offset is only allowed to be 63 elements.");
+
+        // dtype is split into dtypeh in bits 24:23 and dtypel in bits 14:13
+        const uint32_t dtype = static_cast<uint32_t>(dtype_type);
+        uint32_t ld1r = 0;
+        ld1r |= 0b1000010 << 25;
+        ld1r |= ((dtype >> 2) & mask2) << 23;
+        ld1r |= 0b1 << 22;
+        ld1r |= ((offset / element_size) & mask6) << 16;
+        ld1r |= 0b1 << 15;
+        ld1r |= (dtype & mask2) << 13;
+        ld1r |= (Pg & mask3) << 10;
+        ld1r |= (Xn & mask5) << 5;
+        ld1r |= (Zt & mask5) << 0;
+        return ld1r;
+      }
+
+    }  // namespace internal
+
+    /**
+     * ld1rw {Zt.s}, Pg/z, [Xn, #offset], broadcasts the word at Xn + offset to the active elements.
+     */
+    constexpr uint32_t ld1rw(const ZScalable Zt, const ZType32Bit, const PPredicate Pg, const R64Bit Xn, const uint32_t offset = 0)
+    {
+      return internal::ld1r(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), offset,
+                            internal::ld1rDtypeType::word);
+    }
+
+    /**
+     * ld1rd {Zt.d}, Pg/z, [Xn, #offset], broadcasts the double word at Xn + offset to the active elements.
+     */
+    constexpr uint32_t ld1rd(const ZScalable Zt, const ZType64Bit, const PPredicate Pg, const R64Bit Xn, const uint32_t offset = 0)
+    {
+      return internal::ld1r(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), offset,
+                            internal::ld1rDtypeType::doubleword);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_LD1R_H
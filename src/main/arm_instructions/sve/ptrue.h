@@ -0,0 +1,57 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_PTRUE_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_PTRUE_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class ptrueSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t ptrue(const uint32_t Pd, const ptrueSizeType size_type)
+      {
+        release_assert((Pd & mask4) == Pd, "Pd is only allowed to have a size of 4 bit.");
+
+        // pattern ALL, i.e. all elements of the vector length are active
+        uint32_t ptrue = 0;
+        ptrue |= 0b00100101 << 24;
+        ptrue |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        ptrue |= 0b011000 << 16;
+        ptrue |= 0b111000 << 10;
+        ptrue |= 0b11111 << 5;
+        ptrue |= 0b0 << 4;
+        ptrue |= (Pd & mask4) << 0;
+        return ptrue;
+      }
+
+    }  // namespace internal
+
+    /**
+     * ptrue Pd.s, all elements of the vector length are active.
+     */
+    constexpr uint32_t ptrue(const PPredicate Pd, const ZType32Bit)
+    {
+      return internal::ptrue(static_cast<uint32_t>(Pd), internal::ptrueSizeType::size32);
+    }
+
+    /**
+     * ptrue Pd.d, all elements of the vector length are active.
+     */
+    constexpr uint32_t ptrue(const PPredicate Pd, const ZType64Bit)
+    {
+      return internal::ptrue(static_cast<uint32_t>(Pd), internal::ptrueSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_PTRUE_H
@@ -0,0 +1,64 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_ST1_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_ST1_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class st1SizeType : uint32_t
+      {
+        word = 0b1010,
+        doubleword = 0b1111
+      };
+
+      constexpr uint32_t st1ScalarImm(const uint32_t Zt, const uint32_t Pg, const uint32_t Xn, const int32_t imm,
+                                      const st1SizeType size_type)
+      {
+        release_assert((Zt & mask5) == Zt, "Zt is only allowed to have a size of 5 bit.");
+        release_assert((Pg & mask3) == Pg, "Pg is only allowed to be one of p0 - p7.");
+        release_assert((Xn & mask5) == Xn, "Xn is only allowed to have a size of 5 bit.");
+        release_assert(imm >= -8 && imm <= 7, "imm has to be in the range of -8 to 7 vector lengths.");
+
+        // msz:size of the memory and the vector elements
+        uint32_t st1 = 0;
+        st1 |= 0b1110010 << 25;
+        st1 |= (static_cast<uint32_t>(size_type) & mask4) << 21;
+        st1 |= 0b0 << 20;
+        st1 |= (static_cast<uint32_t>(imm) & mask4) << 16;
+        st1 |= 0b111 << 13;
+        st1 |= (Pg & mask3) << 10;
+        st1 |= (Xn & mask5) << 5;
+        st1 |= (Zt & mask5) << 0;
+        return st1;
+      }
+
+    }  // namespace internal
+
+    /**
+     * st1w {Zt.s}, Pg, [Xn, #imm, mul vl], inactive elements are not written.
+     */
+    constexpr uint32_t st1w(const ZScalable Zt, const ZType32Bit, const PPredicate Pg, const R64Bit Xn, const int32_t imm = 0)
+    {
+      return internal::st1ScalarImm(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), imm,
+                                    internal::st1SizeType::word);
+    }
+
+    /**
+     * st1d {Zt.d}, Pg, [Xn, #imm, mul vl], inactive elements are not written.
+     */
+    constexpr uint32_t st1d(const ZScalable Zt, const ZType64Bit, const PPredicate Pg, const R64Bit Xn, const int32_t imm = 0)
+    {
+      return internal::st1ScalarImm(static_cast<uint32_t>(Zt), static_cast<uint32_t>(Pg), static_cast<uint32_t>(Xn), imm,
+                                    internal::st1SizeType::doubleword);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_ST1_H
@@ -0,0 +1,17 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_ALL_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_ALL_H
+
+#include "../register/general_purpose.h"
+#include "../register/scalable.h"
+#include "addvl.h"
+#include "dup.h"
+#include "fmax.h"
+#include "fmla.h"
+#include "inc.h"
+#include "ld1.h"
+#include "ld1r.h"
+#include "ptrue.h"
+#include "st1.h"
+#include "whilelt.h"
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_ALL_H
@@ -0,0 +1,65 @@
+#ifndef MINI_JIT_ARM_INSTRUCTIONS_SVE_WHILELT_H
+#define MINI_JIT_ARM_INSTRUCTIONS_SVE_WHILELT_H
+
+#include "../../release_assert.h"
+#include "../register.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace arm_instructions
+  {
+    namespace internal
+    {
+      enum class whileltSizeType : uint32_t
+      {
+        size32 = 0b10,
+        size64 = 0b11
+      };
+
+      constexpr uint32_t whilelt(const uint32_t Pd, const uint32_t Xn, const uint32_t Xm, const whileltSizeType size_type)
+      {
+        release_assert((Pd & mask4) == Pd, "Pd is only allowed to have a size of 4 bit.");
+        release_assert((Xn & mask5) == Xn, "Xn is only allowed to have a size of 5 bit.");
+        release_assert((Xm & mask5) == Xm, "Xm is only allowed to have a size of 5 bit.");
+
+        // signed comparison of 64 bit registers
+        uint32_t whilelt = 0;
+        whilelt |= 0b00100101 << 24;
+        whilelt |= (static_cast<uint32_t>(size_type) & mask2) << 22;
+        whilelt |= 0b1 << 21;
+        whilelt |= (Xm & mask5) << 16;
+        whilelt |= 0b000 << 13;
+        whilelt |= 0b1 << 12;  // sf
+        whilelt |= 0b0 << 11;  // U
+        whilelt |= 0b1 << 10;  // lt
+        whilelt |= (Xn & mask5) << 5;
+        whilelt |= 0b0 << 4;  // eq
+        whilelt |= (Pd & mask4) << 0;
+        return whilelt;
+      }
+
+    }  // namespace internal
+
+    /**
+     * Element i of Pd is active if Xn + i < Xm, sets the flags for the SVE conditions, e.g. Condition::first.
+     */
+    constexpr uint32_t whilelt(const PPredicate Pd, const ZType32Bit, const R64Bit Xn, const R64Bit Xm)
+    {
+      return internal::whilelt(static_cast<uint32_t>(Pd), static_cast<uint32_t>(Xn), static_cast<uint32_t>(Xm),
+                               internal::whileltSizeType::size32);
+    }
+
+    /**
+     * Element i of Pd is active if Xn + i < Xm, sets the flags for the SVE conditions, e.g. Condition::first.
+     */
+    constexpr uint32_t whilelt(const PPredicate Pd, const ZType64Bit, const R64Bit Xn, const R64Bit Xm)
+    {
+      return internal::whilelt(static_cast<uint32_t>(Pd), static_cast<uint32_t>(Xn), static_cast<uint32_t>(Xm),
+                               internal::whileltSizeType::size64);
+    }
+
+  }  // namespace arm_instructions
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_ARM_INSTRUCTIONS_SVE_WHILELT_H
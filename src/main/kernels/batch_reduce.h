@@ -0,0 +1,21 @@
+#ifndef MINI_JIT_KERNELS_BATCH_REDUCE_H
+#define MINI_JIT_KERNELS_BATCH_REDUCE_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /// location of the A and B blocks of a batch-reduce matmul, i.e. the meaning of the first two and the last two kernel arguments
+    enum class batch_reduce_t : uint32_t
+    {
+      stride = 0,   //!< blocks i are at a + i * br_stride_a and b + i * br_stride_b
+      address = 1,  //!< a and b are arrays of br_size block pointers, there are no stride arguments
+      offset = 2,   //!< blocks i are at a + offsets_a[i] and b + offsets_b[i], the offsets are given in elements
+    };
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BATCH_REDUCE_H
@@ -0,0 +1,259 @@
+#include "binary.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+#include "../row_piece.h"
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::activation_t;
+  using mini_jit::kernels::binary_op_t;
+  using mini_jit::kernels::dtype_t;
+
+  //! registers of a column of A, B and C in an iteration, the broadcast rows of A and B are held by v30 and v31
+  constexpr uint32_t first_a = 0;
+  constexpr uint32_t first_b = 4;
+  constexpr uint32_t first_c = 16;
+  constexpr uint32_t zero_register = 29;  // zeros of the relu
+  constexpr uint32_t broadcast_register_a = 30;
+  constexpr uint32_t broadcast_register_b = 31;
+
+  /**
+   * @brief Gets the vector instruction of the operation on all lanes of the registers.
+   *
+   * @param op The elementwise operation.
+   * @param dtype The data type of the lanes.
+   * @param d The destination register.
+   * @param n The register of A.
+   * @param m The register of B.
+   * @return The instruction.
+   */
+  uint32_t operation(const binary_op_t op, const dtype_t dtype, const uint32_t d, const uint32_t n, const uint32_t m)
+  {
+    const VGeneral vd = static_cast<VGeneral>(d);
+    const VGeneral vn = static_cast<VGeneral>(n);
+    const VGeneral vm = static_cast<VGeneral>(m);
+
+    if (dtype == dtype_t::fp64)
+    {
+      switch (op)
+      {
+      case binary_op_t::add:
+        return fadd(vd, t2d, vn, t2d, vm, t2d);
+      case binary_op_t::sub:
+        return fsub(vd, t2d, vn, t2d, vm, t2d);
+      case binary_op_t::mul:
+        return fmul(vd, t2d, vn, t2d, vm, t2d);
+      case binary_op_t::max:
+        return fmax(vd, t2d, vn, t2d, vm, t2d);
+      case binary_op_t::min:
+        return fmin(vd, t2d, vn, t2d, vm, t2d);
+      }
+    }
+
+    switch (op)
+    {
+    case binary_op_t::add:
+      return fadd(vd, t4s, vn, t4s, vm, t4s);
+    case binary_op_t::sub:
+      return fsub(vd, t4s, vn, t4s, vm, t4s);
+    case binary_op_t::mul:
+      return fmul(vd, t4s, vn, t4s, vm, t4s);
+    case binary_op_t::max:
+      return fmax(vd, t4s, vn, t4s, vm, t4s);
+    case binary_op_t::min:
+      return fmin(vd, t4s, vn, t4s, vm, t4s);
+    }
+
+    release_assert(false, "Found unhandled binary_op_t.");
+    return 0;
+  }
+
+  /**
+   * @brief Loads or stores four consecutive q registers and increments the address by 64 bytes.
+   *
+   * @param is_store True for st1, false for ld1.
+   * @param first The first of the four registers.
+   * @param base The register holding the address.
+   * @param dtype The data type of the lanes.
+   * @return The instruction.
+   */
+  uint32_t transfer_block(const bool is_store, const uint32_t first, const R64Bit base, const dtype_t dtype)
+  {
+    const VGeneral v0 = static_cast<VGeneral>(first);
+    const VGeneral v1 = static_cast<VGeneral>(first + 1);
+    const VGeneral v2 = static_cast<VGeneral>(first + 2);
+    const VGeneral v3 = static_cast<VGeneral>(first + 3);
+
+    if (dtype == dtype_t::fp64)
+    {
+      return is_store ? st1Post(v0, t2d, v1, t2d, v2, t2d, v3, t2d, base, 64)   // st1 {v0.2d-v3.2d}, [base], #64
+                      : ld1Post(v0, t2d, v1, t2d, v2, t2d, v3, t2d, base, 64);  // ld1 {v0.2d-v3.2d}, [base], #64
+    }
+    return is_store ? st1Post(v0, t4s, v1, t4s, v2, t4s, v3, t4s, base, 64)   // st1 {v0.4s-v3.4s}, [base], #64
+                    : ld1Post(v0, t4s, v1, t4s, v2, t4s, v3, t4s, base, 64);  // ld1 {v0.4s-v3.4s}, [base], #64
+  }
+
+  /**
+   * @brief Loads the single element of a broadcast column and duplicates it into all lanes of the register.
+   *
+   * @param vRegister The register that holds the broadcast.
+   * @param base The register holding the address of the column.
+   * @param dtype The data type of the element.
+   * @return The instructions.
+   */
+  std::vector<uint32_t> load_broadcast(const uint32_t vRegister, const R64Bit base, const dtype_t dtype)
+  {
+    const VGeneral v = static_cast<VGeneral>(vRegister);
+    if (dtype == dtype_t::fp64)
+    {
+      return {
+        ldr(static_cast<V64Bit>(vRegister), base),  // ldr d<v>, [base]
+        dup(v, t2d, v, 0),                          // dup v<v>.2d, v<v>.d[0]
+      };
+    }
+    return {
+      ldr(static_cast<V32Bit>(vRegister), base),  // ldr s<v>, [base]
+      dup(v, t4s, v, 0),                          // dup v<v>.4s, v<v>.s[0]
+    };
+  }
+}  // namespace
+
+void mini_jit::kernels::binary(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const binary_op_t op, const dtype_t dtype,
+                               const bool broadcast_a, const bool broadcast_b, const activation_t activation)
+{
+  release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+  release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+  release_assert(activation == activation_t::none || activation == activation_t::relu, "The binary kernel only supports a relu.");
+
+  const uint32_t shift = get_dtype_shift(dtype);
+  const uint32_t lanes = get_dtype_lanes(dtype);
+  const uint32_t m_loop = m / (4 * lanes);
+  const uint32_t m_rest = m % (4 * lanes);
+
+  // Operand registers of the i-th register of a column
+  auto register_a = [&](uint32_t i) { return broadcast_a ? broadcast_register_a : first_a + i; };
+  auto register_b = [&](uint32_t i) { return broadcast_b ? broadcast_register_b : first_b + i; };
+
+  mini_jit::Assembler assembler(kernel);
+
+  // Computes the i-th register of a column of C, followed by the activation
+  auto add_operation = [&](uint32_t i)
+  {
+    assembler.add(operation(op, dtype, first_c + i, register_a(i), register_b(i)));
+    if (activation == activation_t::relu)
+    {
+      assembler.add(operation(binary_op_t::max, dtype, first_c + i, first_c + i, zero_register));  // fmax v<c>, v<c>, v29
+    }
+  };
+
+  assembler.add({
+    /**
+     * @param x0 = a pointer to column-major matrix A (Input).
+     * @param x1 = b pointer to column-major matrix B (Input).
+     * @param x2 = c pointer to column-major matrix C (Output).
+     * @param x3 = lda leading dimension of A, zero broadcasts the first column.
+     * @param x4 = ldb leading dimension of B, zero broadcasts the first column.
+     * @param x5 = ldc leading dimension of C.
+     */
+
+    // Offset the used leading dimension by the size of the elements
+    lsl(x3, x3, shift),  // x3 * sizeof(element)
+    lsl(x4, x4, shift),  // x4 * sizeof(element)
+    lsl(x5, x5, shift),  // x5 * sizeof(element)
+
+    mov(x8, x0),   // column of a
+    mov(x9, x1),   // column of b
+    mov(x10, x2),  // column of c
+
+    mov(x16, n),  // x16 iterator for the n loop
+  });
+  if (activation == activation_t::relu)
+  {
+    const VGeneral zero = static_cast<VGeneral>(zero_register);
+    assembler.add(eor(zero, t16b, zero, t16b, zero, t16b));  // eor v29.16b, v29.16b, v29.16b
+  }
+
+  assembler.label("binary_loop_over_N");
+  assembler.add({
+    mov(x11, x8),   // current row of a
+    mov(x12, x9),   // current row of b
+    mov(x13, x10),  // current row of c
+  });
+  if (broadcast_a)
+  {
+    assembler.add(load_broadcast(broadcast_register_a, x8, dtype));
+  }
+  if (broadcast_b)
+  {
+    assembler.add(load_broadcast(broadcast_register_b, x9, dtype));
+  }
+
+  if (m_loop > 0)
+  {
+    assembler.add(mov(x17, m_loop));  // x17 iterator for the m loop
+    assembler.label("binary_loop_over_M");
+    if (!broadcast_a)
+    {
+      assembler.add(transfer_block(false, first_a, x11, dtype));
+    }
+    if (!broadcast_b)
+    {
+      assembler.add(transfer_block(false, first_b, x12, dtype));
+    }
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      add_operation(i);
+    }
+    assembler.add({
+      transfer_block(true, first_c, x13, dtype),
+      sub(x17, x17, 1),  // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "binary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+  }
+
+  // Whole q registers of the rest, the remaining elements in a single partial register
+  for (uint32_t i = 0; i < m_rest / lanes; ++i)
+  {
+    if (!broadcast_a)
+    {
+      assembler.add(ldrPost(static_cast<V128Bit>(first_a + i), x11, 16));  // ldr q<a>, [x11], #16
+    }
+    if (!broadcast_b)
+    {
+      assembler.add(ldrPost(static_cast<V128Bit>(first_b + i), x12, 16));  // ldr q<b>, [x12], #16
+    }
+    add_operation(i);
+    assembler.add(strPost(static_cast<V128Bit>(first_c + i), x13, 16));  // str q<c>, [x13], #16
+  }
+  if (m_rest % lanes != 0)
+  {
+    const row_piece_t piece = {0, (m_rest % lanes) << shift};
+    if (!broadcast_a)
+    {
+      assembler.add(load_piece(first_a, x11, piece));  // x14 holds the addresses of inserted lanes
+    }
+    if (!broadcast_b)
+    {
+      assembler.add(load_piece(first_b, x12, piece));
+    }
+    add_operation(0);
+    assembler.add(store_piece(first_c, x13, piece));
+  }
+
+  assembler.add({
+    add(x8, x8, x3),    // next column of a
+    add(x9, x9, x4),    // next column of b
+    add(x10, x10, x5),  // next column of c
+    sub(x16, x16, 1),   // sub x16, x16, #1
+  });
+  assembler.add(cbnz(x16, 0), "binary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+  assembler.add(ret());
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("binary.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,47 @@
+#ifndef MINI_JIT_KERNELS_BINARY_H
+#define MINI_JIT_KERNELS_BINARY_H
+
+#include "../../Kernel.h"
+#include "../dtype.h"
+#include "../epilogue.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /// elementwise operation of the binary kernel, max and min propagate NaN
+    enum class binary_op_t : uint32_t
+    {
+      add = 0,  //!< C := A + B
+      sub = 1,  //!< C := A - B
+      mul = 2,  //!< C := A * B
+      max = 3,  //!< C := max(A, B)
+      min = 4,  //!< C := min(A, B)
+    };
+
+    /**
+     * @brief Generates a M x N binary kernel that combines the elements of two column-major matrices into a third one.
+     * Each iteration loads four q registers of a column of A and B, the rest of a column is processed as q registers followed by a
+     * single partial register, see row_piece.h.
+     * A broadcast input holds a single element per column, i.e. its rows have the stride zero, which is loaded once per column and
+     * duplicated into v30 for A and v31 for B. A broadcast of the columns, i.e. a column stride of zero, needs no code, the kernel is
+     * called with a leading dimension of zero.
+     * A ReLU activation is applied to the results in the registers before they are stored, the zeros are held by v29.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A, B and C.
+     * @param n The columns of A, B and C.
+     * @param op The elementwise operation.
+     * @param dtype The data type of the elements.
+     * @param broadcast_a True if A holds a single row that is broadcast to the m rows.
+     * @param broadcast_b True if B holds a single row that is broadcast to the m rows.
+     * @param activation The activation applied to C, either none or relu.
+     */
+    void binary(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const binary_op_t op, const dtype_t dtype,
+                const bool broadcast_a, const bool broadcast_b, const activation_t activation = activation_t::none);
+
+  }  // namespace kernels
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_BINARY_H
@@ -0,0 +1,358 @@
+#include "br_matmul_bf16.h"
+#include "../Assembler.h"
+#include "../Kernel.h"
+#include "../arm_instructions/arm_all.h"
+#include "row_piece.h"
+#include <bit>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::br_matmul_bf16_k_block;
+  using mini_jit::kernels::br_matmul_bf16_mr;
+  using mini_jit::kernels::br_matmul_bf16_nr;
+  using mini_jit::kernels::get_row_pieces;
+  using mini_jit::kernels::load_piece;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::store_piece;
+
+  //! bytes of a 2x4 bfloat16 block of A or B, i.e. of the q register read by bfmmla
+  constexpr uint32_t pair_bytes = 16;
+
+  //! bytes of a strip of A or B per block of k
+  constexpr uint32_t k_block_bytes = br_matmul_bf16_mr / 2 * pair_bytes;
+  static_assert(k_block_bytes == br_matmul_bf16_nr / 2 * pair_bytes, "The strips of A and B advance equally per block of k.");
+
+  //! first register of the pairs of rows of A, the accumulators use v0 to v15
+  constexpr uint32_t a_register = 16;
+
+  //! first register of the pairs of columns of B
+  constexpr uint32_t b_register = a_register + br_matmul_bf16_mr / 2;
+
+  //! registers of a column of the C block while it is converted from or to the layout of the accumulators
+  constexpr uint32_t column_register = b_register + br_matmul_bf16_nr / 2;
+
+  /**
+   * Emits the blocks of the bf16 kernel.
+   * The accumulator of the pair of rows p and the pair of columns q holds the column-major 2x2 block of C, i.e. its lower half holds the
+   * first and its upper half the second column of the pair, hence zip1 and zip2 on the doublewords convert between the accumulators and
+   * the columns of C.
+   */
+  class Bf16BlockEmitter
+  {
+  private:
+    mini_jit::Assembler &assembler;
+    const uint32_t k_blocks;
+    const uint32_t br_size;
+    const double beta;
+
+    //! number of emitted loops, makes the labels of each loop unique
+    uint32_t loop_count = 0;
+
+    std::string get_label(char const *name)
+    {
+      return std::format("{}_{}", name, loop_count++);
+    }
+
+    static VGeneral v(uint32_t index)
+    {
+      return static_cast<VGeneral>(index);
+    }
+
+    static VGeneral acc(uint32_t p, uint32_t q)
+    {
+      return v(p + q * br_matmul_bf16_mr / 2);
+    }
+
+    /**
+     * Gets the accumulator that holds the second pair of rows of a piece, which is the first pair if the piece holds at most two rows.
+     */
+    static VGeneral second_acc(uint32_t piece, uint32_t row_pairs, uint32_t q)
+    {
+      return 2 * piece + 1 < row_pairs ? acc(2 * piece + 1, q) : acc(2 * piece, q);
+    }
+
+    /**
+     * Loads the accumulators of the C block, x13 and x15 point to the columns of a pair of columns, x14 is used as temporary.
+     */
+    void add_c_load(std::vector<row_piece_t> const &pieces, uint32_t row_pairs, uint32_t cols)
+    {
+      const VGeneral first = v(column_register);
+      const VGeneral second = v(column_register + 1);
+
+      assembler.add(mov(x13, x2));  // mov x13, x2 // first column of c
+      for (uint32_t q = 0; 2 * q < cols; ++q)
+      {
+        const bool has_second = 2 * q + 1 < cols;
+        if (has_second)
+        {
+          assembler.add(add(x15, x13, x5));  // add x15, x13, x5 // second column of the pair
+        }
+        else
+        {
+          assembler.add(eor(second, t16b, second, t16b, second, t16b));  // eor v<second>.16b, v<second>.16b, v<second>.16b
+        }
+
+        for (uint32_t i = 0; i < pieces.size(); ++i)
+        {
+          assembler.add(load_piece(column_register, x13, pieces[i]));
+          if (has_second)
+          {
+            assembler.add(load_piece(column_register + 1, x15, pieces[i]));
+          }
+          assembler.add(zip1(acc(2 * i, q), t2d, first, t2d, second, t2d));  // zip1 v<acc>.2d, v<first>.2d, v<second>.2d
+          if (2 * i + 1 < row_pairs)
+          {
+            assembler.add(zip2(acc(2 * i + 1, q), t2d, first, t2d, second, t2d));  // zip2 v<acc>.2d, v<first>.2d, v<second>.2d
+          }
+        }
+
+        if (has_second && 2 * q + 2 < cols)
+        {
+          assembler.add(add(x13, x15, x5));  // add x13, x15, x5 // next pair of columns
+        }
+      }
+    }
+
+    /**
+     * Stores the accumulators to the C block, x13 and x15 point to the columns of a pair of columns, x14 is used as temporary.
+     */
+    void add_c_store(std::vector<row_piece_t> const &pieces, uint32_t row_pairs, uint32_t cols)
+    {
+      const VGeneral first = v(column_register);
+      const VGeneral second = v(column_register + 1);
+
+      assembler.add(mov(x13, x2));  // mov x13, x2 // first column of c
+      for (uint32_t q = 0; 2 * q < cols; ++q)
+      {
+        const bool has_second = 2 * q + 1 < cols;
+        if (has_second)
+        {
+          assembler.add(add(x15, x13, x5));  // add x15, x13, x5 // second column of the pair
+        }
+
+        for (uint32_t i = 0; i < pieces.size(); ++i)
+        {
+          const VGeneral lower = acc(2 * i, q);
+          const VGeneral upper = second_acc(i, row_pairs, q);
+          assembler.add(zip1(first, t2d, lower, t2d, upper, t2d));  // zip1 v<first>.2d, v<lower>.2d, v<upper>.2d
+          assembler.add(store_piece(column_register, x13, pieces[i]));
+          if (has_second)
+          {
+            assembler.add(zip2(second, t2d, lower, t2d, upper, t2d));  // zip2 v<second>.2d, v<lower>.2d, v<upper>.2d
+            assembler.add(store_piece(column_register + 1, x15, pieces[i]));
+          }
+        }
+
+        if (has_second && 2 * q + 2 < cols)
+        {
+          assembler.add(add(x13, x15, x5));  // add x13, x15, x5 // next pair of columns
+        }
+      }
+    }
+
+  public:
+    Bf16BlockEmitter(mini_jit::Assembler &assembler, uint32_t k_blocks, uint32_t br_size, double beta)
+        : assembler(assembler), k_blocks(k_blocks), br_size(br_size), beta(beta)
+    {
+    }
+
+    /**
+     * Emits a block of rows x cols elements of C.
+     * x8 points to the strip of A, x9 to the strip of B and x2 to the block of C.
+     * Only the pairs of rows and columns that hold elements of the block are multiplied, the padding of the strips is zero.
+     */
+    void add_block(uint32_t rows, uint32_t cols)
+    {
+      const uint32_t row_pairs = (rows + 1) / 2;
+      const uint32_t col_pairs = (cols + 1) / 2;
+      const std::vector<row_piece_t> pieces = get_row_pieces(rows, sizeof(float));
+
+      if (beta != 0)
+      {
+        add_c_load(pieces, row_pairs, cols);
+      }
+      else
+      {
+        for (uint32_t q = 0; q < col_pairs; ++q)
+        {
+          for (uint32_t p = 0; p < row_pairs; ++p)
+          {
+            assembler.add(eor(acc(p, q), t16b, acc(p, q), t16b, acc(p, q), t16b));  // eor v<acc>.16b, v<acc>.16b, v<acc>.16b
+          }
+        }
+      }
+
+      assembler.add({
+        mov(x11, x8),       // mov x11, x8 // a of the current batch
+        mov(x12, x9),       // mov x12, x9 // b of the current batch
+        mov(x19, br_size),  // mov x19, #br_size // x19 iterator for the batch dimension
+      });
+
+      std::string batch_label = get_label("matmul_loop_batch_dimension");
+      assembler.label(batch_label);
+      assembler.add({
+        mov(x13, x11),       // mov x13, x11 // current block of k of a
+        mov(x1, x12),        // mov x1, x12 // current block of k of b
+        mov(x15, k_blocks),  // mov x15, #k_blocks // x15 iterator for K loop
+      });
+
+      std::string k_label = get_label("matmul_loop_over_K");
+      assembler.label(k_label);
+      for (uint32_t p = 0; p < row_pairs; ++p)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(a_register + p), x13, p * pair_bytes));  // ldr q<a_p>, [x13, #p*16]
+      }
+      for (uint32_t q = 0; q < col_pairs; ++q)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(b_register + q), x1, q * pair_bytes));  // ldr q<b_q>, [x1, #q*16]
+      }
+      for (uint32_t q = 0; q < col_pairs; ++q)
+      {
+        for (uint32_t p = 0; p < row_pairs; ++p)
+        {
+          // The columns of B are the rows of the 2x2 result, hence the accumulator holds a column-major block of C
+          assembler.add(bfmmla(acc(p, q), t4s, v(b_register + q), t8h, v(a_register + p), t8h));  // bfmmla v<acc>.4s, v<b_q>.8h, v<a_p>.8h
+        }
+      }
+
+      assembler.add({
+        add(x13, x13, k_block_bytes),  // add x13, x13, #k_block_bytes // next block of k of a
+        add(x1, x1, k_block_bytes),    // add x1, x1, #k_block_bytes // next block of k of b
+        sub(x15, x15, 1),              // sub x15, x15, #1
+      });
+      assembler.add(cbnz(x15, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x15, matmul_loop_over_K
+
+      assembler.add({
+        add(x11, x11, x6),  // add x11, x11, x6 // next batch of a
+        add(x12, x12, x7),  // add x12, x12, x7 // next batch of b
+        sub(x19, x19, 1),   // sub x19, x19, #1
+      });
+      assembler.add(cbnz(x19, 0), batch_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x19, matmul_loop_batch_dimension
+
+      add_c_store(pieces, row_pairs, cols);
+    }
+
+    /**
+     * Emits the loop over the M blocks of the current N block with cols columns followed by the block of the remaining rows.
+     * x9 points to the strip of B and x10 to the N block of C, x3 holds the bytes of a strip of A.
+     */
+    void add_m_pass(uint32_t m, uint32_t cols)
+    {
+      const uint32_t m_loop = m / br_matmul_bf16_mr;
+      const uint32_t m_rest = m % br_matmul_bf16_mr;
+
+      assembler.add({
+        mov(x8, x0),   // mov x8, x0 // strip of a of the current M block
+        mov(x2, x10),  // mov x2, x10 // c of the current M block
+      });
+
+      if (m_loop > 0)
+      {
+        std::string m_label = get_label("matmul_loop_over_M");
+        assembler.add(mov(x16, m_loop));  // mov x16, #m_loop // x16 iterator for M loop
+        assembler.label(m_label);
+
+        add_block(br_matmul_bf16_mr, cols);
+
+        assembler.add({
+          add(x8, x8, x3),                                 // add x8, x8, x3 // next strip of a
+          add(x2, x2, br_matmul_bf16_mr * sizeof(float)),  // add x2, x2, #mr*4 // next M block of c
+          sub(x16, x16, 1),                                // sub x16, x16, #1
+        });
+        assembler.add(cbnz(x16, 0), m_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x16, matmul_loop_over_M
+      }
+
+      if (m_rest > 0)
+      {
+        add_block(m_rest, cols);
+      }
+    }
+  };
+}  // namespace
+
+void mini_jit::kernels::br_matmul_bf16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k,
+                                       const uint32_t br_size, const double beta)
+{
+  using namespace mini_jit::arm_instructions;
+
+  release_assert(m != 0, "Cannot proccess matrix with m of 0.");
+  release_assert(n != 0, "Cannot proccess matrix with n of 0.");
+  release_assert(k != 0, "Cannot proccess matrix with k of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+  release_assert(beta == 0 || beta == 1, "The bf16 kernel only supports a beta of zero or one.");
+
+  const uint32_t k_blocks = br_matmul_bf16_padded_k(k) / br_matmul_bf16_k_block;
+  const uint32_t n_loop = n / br_matmul_bf16_nr;
+  const uint32_t n_rest = n % br_matmul_bf16_nr;
+
+  // A strip holds k_blocks blocks of k_block_bytes
+  constexpr uint32_t k_block_shift = std::countr_zero(k_block_bytes);
+  static_assert((1u << k_block_shift) == k_block_bytes, "The bytes of a block of k must be a power of two.");
+
+  Assembler assembler(kernel);
+  Bf16BlockEmitter emitter(assembler, k_blocks, br_size, beta);
+
+  assembler.add({
+    // Procedural Call Standard
+    // save callee-saved registers
+    stpPre(x19, x20, sp, -16),  // stp x19, x20, [sp, #-16]!
+    stpPre(d8, d9, sp, -16),    // stp  d8,  d9, [sp, #-16]!
+    stpPre(d10, d11, sp, -16),  // stp d10, d11, [sp, #-16]!
+    stpPre(d12, d13, sp, -16),  // stp d12, d13, [sp, #-16]!
+    stpPre(d14, d15, sp, -16),  // stp d14, d15, [sp, #-16]!
+
+    // The packed strips replace the leading dimensions of A and B by the bytes of a strip
+    mov(x3, k_blocks),           // mov x3, #k_blocks
+    lsl(x3, x3, k_block_shift),  // lsl x3, x3, #k_block_shift // bytes of a strip of a
+    mov(x4, x3),                 // mov x4, x3 // bytes of a strip of b
+    lsl(x5, x5, 2),              // lsl x5, x5, #2 // x5 * sizeof(float)
+    lsl(x6, x6, 1),              // lsl x6, x6, #1 // x6 * sizeof(bf16)
+    lsl(x7, x7, 1),              // lsl x7, x7, #1 // x7 * sizeof(bf16)
+
+    mov(x9, x1),   // mov x9, x1 // strip of b of the current N block
+    mov(x10, x2),  // mov x10, x2 // c of the current N block
+  });
+
+  if (n_loop > 0)
+  {
+    assembler.add(mov(x17, n_loop));  // mov x17, #n_loop // x17 iterator for N loop
+    assembler.label("matmul_loop_over_N");
+
+    emitter.add_m_pass(m, br_matmul_bf16_nr);
+
+    assembler.add({
+      add(x9, x9, x4),              // add x9, x9, x4 // next strip of b
+      mov(x14, br_matmul_bf16_nr),  // mov x14, #nr
+      madd(x10, x5, x14, x10),      // madd x10, x5, x14, x10 // next N block of c
+      sub(x17, x17, 1),             // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "matmul_loop_over_N", Assembler::relocation_t::imm19);  // cbnz x17, matmul_loop_over_N
+  }
+
+  if (n_rest > 0)
+  {
+    emitter.add_m_pass(m, n_rest);
+  }
+
+  assembler.add({
+    // Procedural Call Standard
+    // restore callee-saved registers
+    ldpPost(d14, d15, sp, 16),  // ldp d14, d15, [sp], #16
+    ldpPost(d12, d13, sp, 16),  // ldp d12, d13, [sp], #16
+    ldpPost(d10, d11, sp, 16),  // ldp d10, d11, [sp], #16
+    ldpPost(d8, d9, sp, 16),    // ldp  d8,  d9, [sp], #16
+    ldpPost(x19, x20, sp, 16),  // ldp x19, x20, [sp], #16
+
+    ret()  // ret
+  });
+
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("br_matmul_bf16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
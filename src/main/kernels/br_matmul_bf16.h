@@ -0,0 +1,56 @@
+#ifndef MINI_JIT_KERNELS_BR_MATMUL_BF16_H
+#define MINI_JIT_KERNELS_BR_MATMUL_BF16_H
+
+#include "../Kernel.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    //! rows of the register block of the bf16 kernel, i.e. of a strip of the packed A
+    constexpr uint32_t br_matmul_bf16_mr = 8;
+
+    //! columns of the register block of the bf16 kernel, i.e. of a strip of the packed B
+    constexpr uint32_t br_matmul_bf16_nr = 8;
+
+    //! consecutive k of a row of A or a column of B that are multiplied by a single bfmmla
+    constexpr uint32_t br_matmul_bf16_k_block = 4;
+
+    /**
+     * @brief Gets the k of the packed operands, i.e. k rounded up to a multiple of br_matmul_bf16_k_block.
+     *
+     * @param k The columns of A and rows of B.
+     * @return The k including the zero padding of the packed operands.
+     */
+    constexpr uint32_t br_matmul_bf16_padded_k(const uint32_t k)
+    {
+      return (k + br_matmul_bf16_k_block - 1) / br_matmul_bf16_k_block * br_matmul_bf16_k_block;
+    }
+
+    /**
+     * @brief Generates an M x N x K batch-reduce matmul kernel with bfloat16 inputs and a single-precision C.
+     * The products are accumulated in single precision by bfmmla, which multiplies a 2x4 block of A with a 4x2 block of B.
+     * Both inputs are read in the interleaved layout of Packing:
+     * - A consists of strips of br_matmul_bf16_mr rows, a strip holds for each block of four k and each pair of rows the four values
+     *   of the first row followed by the four values of the second row.
+     * - B consists of strips of br_matmul_bf16_nr columns, a strip holds for each block of four k and each pair of columns the four
+     *   values of the first column followed by the four values of the second column.
+     * The strips are padded with zeros to full pairs and to a multiple of four k, the kernel only writes the m x n block of C.
+     * The leading dimensions of A and B are not used, the strides of the batch are the sizes of the packed matrices in elements.
+     * The kernel computes C = sum_i(A_i * B_i) + beta * C for a column-major C.
+     *
+     * @param kernel The kernel to add instructions to.
+     * @param m The rows of A and C.
+     * @param n The columns of B and C.
+     * @param k The columns of A and rows of B.
+     * @param br_size number of batch dimensions.
+     * @param beta The scaling of C, either 0 to overwrite C or 1 to accumulate into C.
+     */
+    void br_matmul_bf16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k, const uint32_t br_size,
+                        const double beta = 1);
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BR_MATMUL_BF16_H
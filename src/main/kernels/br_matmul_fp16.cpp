@@ -0,0 +1,418 @@
+#include "br_matmul_fp16.h"
+#include "../Assembler.h"
+#include "../Kernel.h"
+#include "../arm_instructions/arm_all.h"
+#include "row_piece.h"
+#include <cstdint>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::br_matmul_fp16_mr;
+  using mini_jit::kernels::br_matmul_fp16_nr;
+  using mini_jit::kernels::fp16_accumulation_t;
+  using mini_jit::kernels::get_row_pieces;
+  using mini_jit::kernels::load_piece;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::store_piece;
+
+  //! bytes of a half-precision element
+  constexpr uint32_t fp16_bytes = 2;
+
+  //! k of a column of B that are loaded by a single q register and multiplied by element
+  constexpr uint32_t k_unroll = 8;
+
+  //! first register of the columns of B, the columns are widened into b_register + nr for the upper four k
+  constexpr uint32_t b_register = 0;
+
+  //! first register of the column of A in half precision
+  constexpr uint32_t a_register = 8;
+
+  //! first register of the column of A widened to single precision
+  constexpr uint32_t a_wide_register = 10;
+
+  //! register of a column of C in half precision while it is widened or narrowed
+  constexpr uint32_t c_register = 14;
+
+  //! first accumulator, the accumulators use v16 to v31
+  constexpr uint32_t acc_register = 16;
+
+  /**
+   * Emits the blocks of the fp16 kernel.
+   * Each column of the C block is held by two half-precision or four single-precision accumulators.
+   */
+  class Fp16BlockEmitter
+  {
+  private:
+    mini_jit::Assembler &assembler;
+    const uint32_t k_loop;
+    const uint32_t k_rest;
+    const uint32_t br_size;
+    const bool is_fp32;
+    const double beta;
+
+    //! number of emitted loops, makes the labels of each loop unique
+    uint32_t loop_count = 0;
+
+    std::string get_label(char const *name)
+    {
+      return std::format("{}_{}", name, loop_count++);
+    }
+
+    static VGeneral v(uint32_t index)
+    {
+      return static_cast<VGeneral>(index);
+    }
+
+    /**
+     * Gets the accumulator of the vector i of the column j, a vector holds eight half-precision or four single-precision rows.
+     */
+    VGeneral acc(uint32_t i, uint32_t j) const
+    {
+      return v(acc_register + i + j * (is_fp32 ? 4 : 2));
+    }
+
+    /**
+     * Gets the number of accumulators of a column of rows elements.
+     */
+    uint32_t get_vectors(uint32_t rows) const
+    {
+      const uint32_t lanes = is_fp32 ? 4 : 8;
+      return (rows + lanes - 1) / lanes;
+    }
+
+    /**
+     * Loads (beta 1) or zeros (beta 0) the accumulators of the C block, x13 points to the column of C and x14 is used as temporary.
+     */
+    void add_c_load(std::vector<row_piece_t> const &pieces, uint32_t rows, uint32_t cols)
+    {
+      if (beta == 0)
+      {
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          for (uint32_t i = 0; i < get_vectors(rows); ++i)
+          {
+            assembler.add(eor(acc(i, j), t16b, acc(i, j), t16b, acc(i, j), t16b));  // eor v<acc>.16b, v<acc>.16b, v<acc>.16b
+          }
+        }
+        return;
+      }
+
+      assembler.add(mov(x13, x2));  // mov x13, x2 // first column of c
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t p = 0; p < pieces.size(); ++p)
+        {
+          if (!is_fp32)
+          {
+            assembler.add(load_piece(static_cast<uint32_t>(acc(p, j)), x13, pieces[p]));
+            continue;
+          }
+
+          assembler.add(load_piece(c_register, x13, pieces[p]));
+          assembler.add(fcvtl(acc(2 * p, j), t4s, v(c_register), t4h));  // fcvtl v<acc>.4s, v<c>.4h
+          if (2 * p + 1 < get_vectors(rows))
+          {
+            assembler.add(fcvtl2(acc(2 * p + 1, j), t4s, v(c_register), t8h));  // fcvtl2 v<acc>.4s, v<c>.8h
+          }
+        }
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next column of c
+        }
+      }
+    }
+
+    /**
+     * Stores the accumulators to the C block, x13 points to the column of C and x14 is used as temporary.
+     */
+    void add_c_store(std::vector<row_piece_t> const &pieces, uint32_t rows, uint32_t cols)
+    {
+      assembler.add(mov(x13, x2));  // mov x13, x2 // first column of c
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t p = 0; p < pieces.size(); ++p)
+        {
+          if (!is_fp32)
+          {
+            assembler.add(store_piece(static_cast<uint32_t>(acc(p, j)), x13, pieces[p]));
+            continue;
+          }
+
+          assembler.add(fcvtn(v(c_register), t4h, acc(2 * p, j), t4s));  // fcvtn v<c>.4h, v<acc>.4s
+          if (2 * p + 1 < get_vectors(rows))
+          {
+            assembler.add(fcvtn2(v(c_register), t8h, acc(2 * p + 1, j), t4s));  // fcvtn2 v<c>.8h, v<acc>.4s
+          }
+          assembler.add(store_piece(c_register, x13, pieces[p]));
+        }
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next column of c
+        }
+      }
+    }
+
+    /**
+     * Loads the current k of the columns of B, either a q register of eight k or a h register of a single k.
+     * x1 points to the current k of the first column and is advanced, x15 is used for the columns.
+     */
+    void add_b_load(uint32_t cols, bool is_unrolled)
+    {
+      assembler.add(mov(x15, x1));  // mov x15, x1 // current k of the first column of b
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        const uint32_t b = b_register + j;
+        assembler.add(is_unrolled ? ldrOffset(static_cast<V128Bit>(b), x15, 0)   // ldr q<b>, [x15]
+                                  : ldrOffset(static_cast<V16Bit>(b), x15, 0));  // ldr h<b>, [x15]
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x15, x15, x4));  // add x15, x15, x4 // next column of b
+        }
+      }
+      assembler.add(add(x1, x1, (is_unrolled ? k_unroll : 1) * fp16_bytes));  // add x1, x1, #k*2 // next k of b
+
+      if (!is_fp32)
+      {
+        return;
+      }
+
+      // The upper four k are widened first, the lower four k replace the half-precision column
+      const uint32_t nr = br_matmul_fp16_nr(fp16_accumulation_t::fp32);
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        const VGeneral b = v(b_register + j);
+        if (is_unrolled)
+        {
+          assembler.add(fcvtl2(v(b_register + nr + j), t4s, b, t8h));  // fcvtl2 v<b+nr>.4s, v<b>.8h
+        }
+        assembler.add(fcvtl(b, t4s, b, t4h));  // fcvtl v<b>.4s, v<b>.4h
+      }
+    }
+
+    /**
+     * Loads the current column of A and multiplies it with the element index of the columns of B.
+     * x13 points to the current column of A and is advanced to the next one, x14 is used as temporary.
+     */
+    void add_k_step(std::vector<row_piece_t> const &pieces, uint32_t rows, uint32_t cols, uint32_t index)
+    {
+      for (uint32_t p = 0; p < pieces.size(); ++p)
+      {
+        assembler.add(load_piece(a_register + p, x13, pieces[p]));
+      }
+      assembler.add(add(x13, x13, x3));  // add x13, x13, x3 // next column of a
+
+      if (!is_fp32)
+      {
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          for (uint32_t i = 0; i < pieces.size(); ++i)
+          {
+            // fmla v<acc>.8h, v<a_i>.8h, v<b_j>.h[index]
+            assembler.add(fmla(acc(i, j), t8h, v(a_register + i), t8h, v(b_register + j), index));
+          }
+        }
+        return;
+      }
+
+      const uint32_t vectors = get_vectors(rows);
+      for (uint32_t i = 0; i < vectors; ++i)
+      {
+        const VGeneral a = v(a_register + i / 2);
+        assembler.add(i % 2 == 0 ? fcvtl(v(a_wide_register + i), t4s, a, t4h)     // fcvtl v<a_wide>.4s, v<a>.4h
+                                 : fcvtl2(v(a_wide_register + i), t4s, a, t8h));  // fcvtl2 v<a_wide>.4s, v<a>.8h
+      }
+
+      // The lower four k of the columns of B are held by b_register + j, the upper four k by b_register + nr + j
+      const uint32_t nr = br_matmul_fp16_nr(fp16_accumulation_t::fp32);
+      const uint32_t b_offset = index < 4 ? 0 : nr;
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t i = 0; i < vectors; ++i)
+        {
+          // fmla v<acc>.4s, v<a_wide_i>.4s, v<b_j>.s[index%4]
+          assembler.add(fmla(acc(i, j), t4s, v(a_wide_register + i), t4s, v(b_register + b_offset + j), index % 4));
+        }
+      }
+    }
+
+  public:
+    Fp16BlockEmitter(mini_jit::Assembler &assembler, uint32_t k, uint32_t br_size, fp16_accumulation_t accumulation, double beta)
+        : assembler(assembler), k_loop(k / k_unroll), k_rest(k % k_unroll), br_size(br_size),
+          is_fp32(accumulation == fp16_accumulation_t::fp32), beta(beta)
+    {
+    }
+
+    /**
+     * Emits a block of rows x cols elements of C.
+     * x8 points to the rows of A, x9 to the columns of B and x2 to the block of C.
+     */
+    void add_block(uint32_t rows, uint32_t cols)
+    {
+      const std::vector<row_piece_t> pieces = get_row_pieces(rows, fp16_bytes);
+
+      add_c_load(pieces, rows, cols);
+
+      assembler.add({
+        mov(x11, x8),       // mov x11, x8 // a of the current batch
+        mov(x12, x9),       // mov x12, x9 // b of the current batch
+        mov(x19, br_size),  // mov x19, #br_size // x19 iterator for the batch dimension
+      });
+
+      std::string batch_label = get_label("matmul_loop_batch_dimension");
+      assembler.label(batch_label);
+      assembler.add({
+        mov(x13, x11),  // mov x13, x11 // current column of a
+        mov(x1, x12),   // mov x1, x12 // current k of the first column of b
+      });
+
+      if (k_loop > 0)
+      {
+        assembler.add(mov(x20, k_loop));  // mov x20, #k_loop // x20 iterator for K loop
+        std::string k_label = get_label("matmul_loop_over_K");
+        assembler.label(k_label);
+
+        add_b_load(cols, true);
+        for (uint32_t kk = 0; kk < k_unroll; ++kk)
+        {
+          add_k_step(pieces, rows, cols, kk);
+        }
+
+        assembler.add(sub(x20, x20, 1));                                                 // sub x20, x20, #1
+        assembler.add(cbnz(x20, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x20, matmul_loop_over_K
+      }
+
+      for (uint32_t kk = 0; kk < k_rest; ++kk)
+      {
+        add_b_load(cols, false);
+        add_k_step(pieces, rows, cols, 0);
+      }
+
+      assembler.add({
+        add(x11, x11, x6),  // add x11, x11, x6 // next batch of a
+        add(x12, x12, x7),  // add x12, x12, x7 // next batch of b
+        sub(x19, x19, 1),   // sub x19, x19, #1
+      });
+      assembler.add(cbnz(x19, 0), batch_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x19, matmul_loop_batch_dimension
+
+      add_c_store(pieces, rows, cols);
+    }
+
+    /**
+     * Emits the loop over the M blocks of the current N block with cols columns followed by the block of the remaining rows.
+     * x9 points to the columns of B and x10 to the N block of C.
+     */
+    void add_m_pass(uint32_t m, uint32_t cols)
+    {
+      const uint32_t m_loop = m / br_matmul_fp16_mr;
+      const uint32_t m_rest = m % br_matmul_fp16_mr;
+
+      assembler.add({
+        mov(x8, x0),   // mov x8, x0 // a of the current M block
+        mov(x2, x10),  // mov x2, x10 // c of the current M block
+      });
+
+      if (m_loop > 0)
+      {
+        std::string m_label = get_label("matmul_loop_over_M");
+        assembler.add(mov(x16, m_loop));  // mov x16, #m_loop // x16 iterator for M loop
+        assembler.label(m_label);
+
+        add_block(br_matmul_fp16_mr, cols);
+
+        assembler.add({
+          add(x8, x8, br_matmul_fp16_mr * fp16_bytes),  // add x8, x8, #mr*2 // next M block of a
+          add(x2, x2, br_matmul_fp16_mr * fp16_bytes),  // add x2, x2, #mr*2 // next M block of c
+          sub(x16, x16, 1),                             // sub x16, x16, #1
+        });
+        assembler.add(cbnz(x16, 0), m_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x16, matmul_loop_over_M
+      }
+
+      if (m_rest > 0)
+      {
+        add_block(m_rest, cols);
+      }
+    }
+  };
+}  // namespace
+
+void mini_jit::kernels::br_matmul_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k,
+                                       const uint32_t br_size, const fp16_accumulation_t accumulation, const double beta)
+{
+  using namespace mini_jit::arm_instructions;
+
+  release_assert(m != 0, "Cannot proccess matrix with m of 0.");
+  release_assert(n != 0, "Cannot proccess matrix with n of 0.");
+  release_assert(k != 0, "Cannot proccess matrix with k of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+  release_assert(beta == 0 || beta == 1, "The fp16 kernel only supports a beta of zero or one.");
+
+  const uint32_t nr = br_matmul_fp16_nr(accumulation);
+  const uint32_t n_loop = n / nr;
+  const uint32_t n_rest = n % nr;
+
+  Assembler assembler(kernel);
+  Fp16BlockEmitter emitter(assembler, k, br_size, accumulation, beta);
+
+  assembler.add({
+    // Procedural Call Standard
+    // save callee-saved registers
+    stpPre(x19, x20, sp, -16),  // stp x19, x20, [sp, #-16]!
+    stpPre(d8, d9, sp, -16),    // stp  d8,  d9, [sp, #-16]!
+    stpPre(d10, d11, sp, -16),  // stp d10, d11, [sp, #-16]!
+    stpPre(d12, d13, sp, -16),  // stp d12, d13, [sp, #-16]!
+    stpPre(d14, d15, sp, -16),  // stp d14, d15, [sp, #-16]!
+
+    // Strides in bytes
+    lsl(x3, x3, 1),  // lsl x3, x3, #1 // x3 * sizeof(fp16)
+    lsl(x4, x4, 1),  // lsl x4, x4, #1 // x4 * sizeof(fp16)
+    lsl(x5, x5, 1),  // lsl x5, x5, #1 // x5 * sizeof(fp16)
+    lsl(x6, x6, 1),  // lsl x6, x6, #1 // x6 * sizeof(fp16)
+    lsl(x7, x7, 1),  // lsl x7, x7, #1 // x7 * sizeof(fp16)
+
+    mov(x9, x1),   // mov x9, x1 // b of the current N block
+    mov(x10, x2),  // mov x10, x2 // c of the current N block
+  });
+
+  if (n_loop > 0)
+  {
+    assembler.add(mov(x17, n_loop));  // mov x17, #n_loop // x17 iterator for N loop
+    assembler.label("matmul_loop_over_N");
+
+    emitter.add_m_pass(m, nr);
+
+    assembler.add({
+      mov(x14, nr),             // mov x14, #nr
+      madd(x9, x4, x14, x9),    // madd x9, x4, x14, x9 // next N block of b
+      madd(x10, x5, x14, x10),  // madd x10, x5, x14, x10 // next N block of c
+      sub(x17, x17, 1),         // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "matmul_loop_over_N", Assembler::relocation_t::imm19);  // cbnz x17, matmul_loop_over_N
+  }
+
+  if (n_rest > 0)
+  {
+    emitter.add_m_pass(m, n_rest);
+  }
+
+  assembler.add({
+    // Procedural Call Standard
+    // restore callee-saved registers
+    ldpPost(d14, d15, sp, 16),  // ldp d14, d15, [sp], #16
+    ldpPost(d12, d13, sp, 16),  // ldp d12, d13, [sp], #16
+    ldpPost(d10, d11, sp, 16),  // ldp d10, d11, [sp], #16
+    ldpPost(d8, d9, sp, 16),    // ldp  d8,  d9, [sp], #16
+    ldpPost(x19, x20, sp, 16),  // ldp x19, x20, [sp], #16
+
+    ret()  // ret
+  });
+
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("br_matmul_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,56 @@
+#ifndef MINI_JIT_KERNELS_BR_MATMUL_FP16_H
+#define MINI_JIT_KERNELS_BR_MATMUL_FP16_H
+
+#include "../Kernel.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /// precision of the accumulators of the fp16 kernels
+    enum class fp16_accumulation_t : uint32_t
+    {
+      fp16 = 0,  //!< fmla on eight half-precision lanes, requires the half-precision arithmetic of Armv8.2
+      fp32 = 1,  //!< fmla on four single-precision lanes of the operands widened by fcvtl, runs on every Armv8 processor
+    };
+
+    //! rows of the register block of the fp16 kernels
+    constexpr uint32_t br_matmul_fp16_mr = 16;
+
+    /**
+     * @brief Gets the columns of the register block of the fp16 kernels.
+     *
+     * @param accumulation The precision of the accumulators.
+     * @return 8 for half-precision and 4 for single-precision accumulators, i.e. the accumulators use 16 registers either way.
+     */
+    constexpr uint32_t br_matmul_fp16_nr(const fp16_accumulation_t accumulation)
+    {
+      return accumulation == fp16_accumulation_t::fp16 ? 8 : 4;
+    }
+
+    /**
+     * @brief Generates an M x N x K batch-reduce matmul kernel with half-precision A, B and C.
+     * The matrices are column-major and read in place, the leading dimensions and the strides of the batch are given in elements.
+     * The loop over K is unrolled by eight: each column of B contributes eight k with a single q register load and each k of the block
+     * is multiplied by element.
+     * Half-precision accumulators hold eight rows per register and halve the registers and instructions of a single-precision block.
+     * Single-precision accumulators widen the columns of A and B with fcvtl and narrow C with fcvtn, which avoids the rounding of
+     * every partial sum to half precision.
+     * The kernel computes C = sum_i(A_i * B_i) + beta * C.
+     *
+     * @param kernel The kernel to add instructions to.
+     * @param m The rows of A and C.
+     * @param n The columns of B and C.
+     * @param k The columns of A and rows of B.
+     * @param br_size number of batch dimensions.
+     * @param accumulation The precision of the accumulators.
+     * @param beta The scaling of C, either 0 to overwrite C or 1 to accumulate into C.
+     */
+    void br_matmul_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k, const uint32_t br_size,
+                        const fp16_accumulation_t accumulation, const double beta = 1);
+
+  }     // namespace kernels
+}       // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BR_MATMUL_FP16_H
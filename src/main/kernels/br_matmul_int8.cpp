@@ -0,0 +1,474 @@
+#include "br_matmul_int8.h"
+#include "../Assembler.h"
+#include "../Kernel.h"
+#include "../arm_instructions/arm_all.h"
+#include "row_piece.h"
+#include <bit>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::br_matmul_int8_k_block;
+  using mini_jit::kernels::br_matmul_int8_mr;
+  using mini_jit::kernels::br_matmul_int8_nr;
+  using mini_jit::kernels::epilogue_t;
+  using mini_jit::kernels::get_row_pieces;
+  using mini_jit::kernels::int8_instruction_t;
+  using mini_jit::kernels::load_piece;
+  using mini_jit::kernels::requantize_t;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::store_piece;
+
+  //! first register of the rows of A, the accumulators use v0 to v15
+  constexpr uint32_t a_register = 16;
+
+  //! first register of the columns of B
+  constexpr uint32_t b_register = a_register + 4;
+
+  //! registers of the two groups of four rows of a column of C while it is converted from the layout of smmla and ummla
+  constexpr uint32_t column_register = b_register + 4;
+
+  //! scale of the requantization in its first lane
+  constexpr uint32_t scale_register = column_register + 2;
+
+  //! zero point of the requantization in all lanes
+  constexpr uint32_t zero_point_register = scale_register + 1;
+
+  //! registers of a column of C while it is loaded or requantized
+  constexpr uint32_t work_register = zero_point_register + 1;
+
+  /**
+   * Emits the blocks of the int8 kernels.
+   * The sdot and udot accumulator of the group of four rows h and the column j holds the four rows of the column of C.
+   * The smmla and ummla accumulator of the pair of rows p and the pair of columns q holds the column-major 2x2 block of C, i.e. its lower
+   * half holds the first and its upper half the second column of the pair, hence zip1 and zip2 on the doublewords convert the
+   * accumulators into the columns of C.
+   */
+  class Int8BlockEmitter
+  {
+  private:
+    mini_jit::Assembler &assembler;
+    const uint32_t k_blocks;
+    const uint32_t br_size;
+    const bool is_signed;
+    const int8_instruction_t instruction;
+    const double beta;
+    const bool is_requantized;
+
+    //! number of emitted loops, makes the labels of each loop unique
+    uint32_t loop_count = 0;
+
+    std::string get_label(char const *name)
+    {
+      return std::format("{}_{}", name, loop_count++);
+    }
+
+    static VGeneral v(uint32_t index)
+    {
+      return static_cast<VGeneral>(index);
+    }
+
+    /**
+     * Gets the sdot and udot accumulator of the rows 4 * h to 4 * h + 3 of the column j.
+     */
+    static VGeneral dot_acc(uint32_t h, uint32_t j)
+    {
+      return v(h + 2 * j);
+    }
+
+    /**
+     * Gets the smmla and ummla accumulator of the rows 2 * p and 2 * p + 1 of the columns 2 * q and 2 * q + 1.
+     */
+    static VGeneral mmla_acc(uint32_t p, uint32_t q)
+    {
+      return v(p + 4 * q);
+    }
+
+    /**
+     * Gets the register that holds the rows 4 * h to 4 * h + 3 of the column j, the smmla and ummla accumulators are zipped into
+     * v<column_register + h>.
+     */
+    VGeneral add_column_quad(uint32_t h, uint32_t j, uint32_t row_pairs)
+    {
+      if (instruction == int8_instruction_t::dot)
+      {
+        return dot_acc(h, j);
+      }
+
+      const VGeneral column = v(column_register + h);
+      const VGeneral lower = mmla_acc(2 * h, j / 2);
+      const VGeneral upper = 2 * h + 1 < row_pairs ? mmla_acc(2 * h + 1, j / 2) : lower;
+      if (j % 2 == 0)
+      {
+        assembler.add(zip1(column, t2d, lower, t2d, upper, t2d));  // zip1 v<column>.2d, v<lower>.2d, v<upper>.2d
+      }
+      else
+      {
+        assembler.add(zip2(column, t2d, lower, t2d, upper, t2d));  // zip2 v<column>.2d, v<lower>.2d, v<upper>.2d
+      }
+      return column;
+    }
+
+    /**
+     * Stores the rows of v<vRegister> as bytes to x13, x14 is used as temporary for the address of lanes that are not the first.
+     */
+    void add_byte_store(uint32_t vRegister, uint32_t rows)
+    {
+      if (rows == 8)
+      {
+        assembler.add(strOffset(static_cast<V64Bit>(vRegister), x13, 0));  // str d<v>, [x13]
+        return;
+      }
+
+      // The rows are split into aligned pieces of four, two and one bytes
+      uint32_t offset = 0;
+      for (uint32_t bytes = 4; bytes != 0; bytes /= 2)
+      {
+        if ((rows & bytes) == 0)
+        {
+          continue;
+        }
+
+        if (offset == 0)
+        {
+          assembler.add(bytes == 4   ? strOffset(static_cast<V32Bit>(vRegister), x13, 0)   // str s<v>, [x13]
+                        : bytes == 2 ? strOffset(static_cast<V16Bit>(vRegister), x13, 0)   // str h<v>, [x13]
+                                     : strOffset(static_cast<V8Bit>(vRegister), x13, 0));  // str b<v>, [x13]
+        }
+        else
+        {
+          assembler.add(add(x14, x13, offset));                                            // add x14, x13, #offset
+          assembler.add(bytes == 2 ? st1(static_cast<V16Bit>(vRegister), offset / 2, x14)  // st1 {v<v>.h}[offset/2], [x14]
+                                   : st1(static_cast<V8Bit>(vRegister), offset, x14));     // st1 {v<v>.b}[offset], [x14]
+        }
+        offset += bytes;
+      }
+    }
+
+    /**
+     * Stores a column of the accumulators to x13, x14 is used as temporary.
+     */
+    void add_column_store(uint32_t j, uint32_t rows, uint32_t row_pairs, std::vector<row_piece_t> const &pieces)
+    {
+      const VGeneral work = v(work_register);
+
+      if (!is_requantized)
+      {
+        for (uint32_t h = 0; h < pieces.size(); ++h)
+        {
+          const VGeneral quad = add_column_quad(h, j, row_pairs);
+          if (beta != 0)
+          {
+            assembler.add(load_piece(work_register, x13, pieces[h]));
+            assembler.add(add(quad, t4s, quad, t4s, work, t4s));  // add v<quad>.4s, v<quad>.4s, v<work>.4s
+          }
+          assembler.add(store_piece(static_cast<uint32_t>(quad), x13, pieces[h]));
+        }
+        return;
+      }
+
+      // The accumulators are scaled in single precision, rounded to nearest and narrowed with saturation to int8
+      for (uint32_t h = 0; h < pieces.size(); ++h)
+      {
+        const VGeneral quad = add_column_quad(h, j, row_pairs);
+        const VGeneral converted = v(work_register + h);
+        assembler.add({
+          scvtf(converted, t4s, quad, t4s),                                   // scvtf v<converted>.4s, v<quad>.4s
+          fmul(converted, t4s, converted, t4s, v(scale_register), 0),         // fmul v<converted>.4s, v<converted>.4s, v<scale>.s[0]
+          fadd(converted, t4s, converted, t4s, v(zero_point_register), t4s),  // fadd v<converted>.4s, v<converted>.4s, v<zero_point>.4s
+          fcvtns(converted, t4s, converted, t4s),                             // fcvtns v<converted>.4s, v<converted>.4s
+        });
+      }
+
+      assembler.add(sqxtn(work, t4h, work, t4s));  // sqxtn v<work>.4h, v<work>.4s
+      if (pieces.size() > 1)
+      {
+        assembler.add(sqxtn2(work, t8h, v(work_register + 1), t4s));  // sqxtn2 v<work>.8h, v<work+1>.4s
+      }
+      assembler.add(sqxtn(work, t8b, work, t8h));  // sqxtn v<work>.8b, v<work>.8h
+      add_byte_store(work_register, rows);
+    }
+
+    /**
+     * Emits the multiplications of a block of k with sdot or udot, x13 points to the block of A and x1 to the block of B.
+     */
+    void add_dot_k_block(uint32_t quads, uint32_t cols)
+    {
+      for (uint32_t h = 0; h < quads; ++h)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(a_register + h), x13, h * 16));  // ldr q<a_h>, [x13, #h*16]
+      }
+      for (uint32_t g = 0; 4 * g < cols; ++g)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(b_register + g), x1, g * 16));  // ldr q<b_g>, [x1, #g*16]
+      }
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t h = 0; h < quads; ++h)
+        {
+          // Each lane of A holds the four k of a row, the group j % 4 of B holds the four k of the column j
+          const VGeneral a = v(a_register + h);
+          const VGeneral b = v(b_register + j / 4);
+          assembler.add(is_signed ? sdot(dot_acc(h, j), t4s, a, t16b, b, j % 4)    // sdot v<acc>.4s, v<a_h>.16b, v<b>.4b[j%4]
+                                  : udot(dot_acc(h, j), t4s, a, t16b, b, j % 4));  // udot v<acc>.4s, v<a_h>.16b, v<b>.4b[j%4]
+        }
+      }
+    }
+
+    /**
+     * Emits the multiplications of a block of k with smmla or ummla, x13 points to the block of A and x1 to the block of B.
+     */
+    void add_mmla_k_block(uint32_t row_pairs, uint32_t col_pairs)
+    {
+      for (uint32_t p = 0; p < row_pairs; ++p)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(a_register + p), x13, p * 16));  // ldr q<a_p>, [x13, #p*16]
+      }
+      for (uint32_t q = 0; q < col_pairs; ++q)
+      {
+        assembler.add(ldrOffset(static_cast<V128Bit>(b_register + q), x1, q * 16));  // ldr q<b_q>, [x1, #q*16]
+      }
+      for (uint32_t q = 0; q < col_pairs; ++q)
+      {
+        for (uint32_t p = 0; p < row_pairs; ++p)
+        {
+          // The columns of B are the rows of the 2x2 result, hence the accumulator holds a column-major block of C
+          const VGeneral a = v(a_register + p);
+          const VGeneral b = v(b_register + q);
+          assembler.add(is_signed ? smmla(mmla_acc(p, q), t4s, b, t16b, a, t16b)    // smmla v<acc>.4s, v<b_q>.16b, v<a_p>.16b
+                                  : ummla(mmla_acc(p, q), t4s, b, t16b, a, t16b));  // ummla v<acc>.4s, v<b_q>.16b, v<a_p>.16b
+        }
+      }
+    }
+
+  public:
+    Int8BlockEmitter(mini_jit::Assembler &assembler, uint32_t k_blocks, uint32_t br_size, bool is_signed, int8_instruction_t instruction,
+                     double beta, bool is_requantized)
+        : assembler(assembler), k_blocks(k_blocks), br_size(br_size), is_signed(is_signed), instruction(instruction), beta(beta),
+          is_requantized(is_requantized)
+    {
+    }
+
+    /**
+     * Gets the bytes of an element of C.
+     */
+    uint32_t get_c_size() const
+    {
+      return is_requantized ? sizeof(int8_t) : sizeof(int32_t);
+    }
+
+    /**
+     * Emits a block of rows x cols elements of C.
+     * x8 points to the strip of A, x9 to the strip of B and x2 to the block of C.
+     * Only the rows and columns that hold elements of the block are multiplied, the padding of the strips is zero.
+     */
+    void add_block(uint32_t rows, uint32_t cols)
+    {
+      const uint32_t quads = (rows + 3) / 4;
+      const uint32_t row_pairs = (rows + 1) / 2;
+      const uint32_t col_pairs = (cols + 1) / 2;
+      const uint32_t k_block_bytes = br_matmul_int8_mr * br_matmul_int8_k_block(instruction);
+      const std::vector<row_piece_t> pieces = get_row_pieces(rows, sizeof(int32_t));
+
+      // The accumulators start at zero, C is added while storing
+      const uint32_t acc_count = instruction == int8_instruction_t::dot ? 2 * cols : 4 * col_pairs;
+      for (uint32_t acc = 0; acc < acc_count; ++acc)
+      {
+        assembler.add(eor(v(acc), t16b, v(acc), t16b, v(acc), t16b));  // eor v<acc>.16b, v<acc>.16b, v<acc>.16b
+      }
+
+      assembler.add({
+        mov(x11, x8),       // mov x11, x8 // a of the current batch
+        mov(x12, x9),       // mov x12, x9 // b of the current batch
+        mov(x19, br_size),  // mov x19, #br_size // x19 iterator for the batch dimension
+      });
+
+      std::string batch_label = get_label("matmul_loop_batch_dimension");
+      assembler.label(batch_label);
+      assembler.add({
+        mov(x13, x11),       // mov x13, x11 // current block of k of a
+        mov(x1, x12),        // mov x1, x12 // current block of k of b
+        mov(x15, k_blocks),  // mov x15, #k_blocks // x15 iterator for K loop
+      });
+
+      std::string k_label = get_label("matmul_loop_over_K");
+      assembler.label(k_label);
+      if (instruction == int8_instruction_t::dot)
+      {
+        add_dot_k_block(quads, cols);
+      }
+      else
+      {
+        add_mmla_k_block(row_pairs, col_pairs);
+      }
+
+      assembler.add({
+        add(x13, x13, k_block_bytes),  // add x13, x13, #k_block_bytes // next block of k of a
+        add(x1, x1, k_block_bytes),    // add x1, x1, #k_block_bytes // next block of k of b
+        sub(x15, x15, 1),              // sub x15, x15, #1
+      });
+      assembler.add(cbnz(x15, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x15, matmul_loop_over_K
+
+      assembler.add({
+        add(x11, x11, x6),  // add x11, x11, x6 // next batch of a
+        add(x12, x12, x7),  // add x12, x12, x7 // next batch of b
+        sub(x19, x19, 1),   // sub x19, x19, #1
+      });
+      assembler.add(cbnz(x19, 0), batch_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x19, matmul_loop_batch_dimension
+
+      assembler.add(mov(x13, x2));  // mov x13, x2 // first column of c
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        add_column_store(j, rows, row_pairs, pieces);
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next column of c
+        }
+      }
+    }
+
+    /**
+     * Emits the loop over the M blocks of the current N block with cols columns followed by the block of the remaining rows.
+     * x9 points to the strip of B and x10 to the N block of C, x3 holds the bytes of a strip of A.
+     */
+    void add_m_pass(uint32_t m, uint32_t cols)
+    {
+      const uint32_t m_loop = m / br_matmul_int8_mr;
+      const uint32_t m_rest = m % br_matmul_int8_mr;
+
+      assembler.add({
+        mov(x8, x0),   // mov x8, x0 // strip of a of the current M block
+        mov(x2, x10),  // mov x2, x10 // c of the current M block
+      });
+
+      if (m_loop > 0)
+      {
+        std::string m_label = get_label("matmul_loop_over_M");
+        assembler.add(mov(x16, m_loop));  // mov x16, #m_loop // x16 iterator for M loop
+        assembler.label(m_label);
+
+        add_block(br_matmul_int8_mr, cols);
+
+        assembler.add({
+          add(x8, x8, x3),                                // add x8, x8, x3 // next strip of a
+          add(x2, x2, br_matmul_int8_mr * get_c_size()),  // add x2, x2, #mr*c_size // next M block of c
+          sub(x16, x16, 1),                               // sub x16, x16, #1
+        });
+        assembler.add(cbnz(x16, 0), m_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x16, matmul_loop_over_M
+      }
+
+      if (m_rest > 0)
+      {
+        add_block(m_rest, cols);
+      }
+    }
+  };
+}  // namespace
+
+void mini_jit::kernels::br_matmul_int8(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k,
+                                       const uint32_t br_size, const bool is_signed, const int8_instruction_t instruction,
+                                       const double beta, const epilogue_t epilogue)
+{
+  using namespace mini_jit::arm_instructions;
+
+  release_assert(m != 0, "Cannot proccess matrix with m of 0.");
+  release_assert(n != 0, "Cannot proccess matrix with n of 0.");
+  release_assert(k != 0, "Cannot proccess matrix with k of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+  release_assert(beta == 0 || beta == 1, "The int8 kernels only support a beta of zero or one.");
+  release_assert(epilogue.bias == bias_t::none && epilogue.activation == activation_t::none,
+                 "The int8 kernels only support a requantization epilogue.");
+
+  const bool is_requantized = epilogue.requantize == requantize_t::s8;
+  release_assert(!is_requantized || beta == 0, "A requantized C cannot be accumulated.");
+
+  const uint32_t k_blocks = br_matmul_int8_padded_k(k, instruction) / br_matmul_int8_k_block(instruction);
+  const uint32_t n_loop = n / br_matmul_int8_nr;
+  const uint32_t n_rest = n % br_matmul_int8_nr;
+
+  // A strip holds k_blocks blocks of k_block_bytes
+  const uint32_t k_block_shift = std::countr_zero(br_matmul_int8_mr * br_matmul_int8_k_block(instruction));
+
+  Assembler assembler(kernel);
+  Int8BlockEmitter emitter(assembler, k_blocks, br_size, is_signed, instruction, beta, is_requantized);
+
+  assembler.add({
+    // Procedural Call Standard
+    // save callee-saved registers
+    stpPre(x19, x20, sp, -16),  // stp x19, x20, [sp, #-16]!
+    stpPre(d8, d9, sp, -16),    // stp  d8,  d9, [sp, #-16]!
+    stpPre(d10, d11, sp, -16),  // stp d10, d11, [sp, #-16]!
+    stpPre(d12, d13, sp, -16),  // stp d12, d13, [sp, #-16]!
+    stpPre(d14, d15, sp, -16),  // stp d14, d15, [sp, #-16]!
+
+    // The packed strips replace the leading dimensions of A and B by the bytes of a strip, the strides of the batch are bytes
+    mov(x3, k_blocks),           // mov x3, #k_blocks
+    lsl(x3, x3, k_block_shift),  // lsl x3, x3, #k_block_shift // bytes of a strip of a
+    mov(x4, x3),                 // mov x4, x3 // bytes of a strip of b
+
+    mov(x9, x1),   // mov x9, x1 // strip of b of the current N block
+    mov(x10, x2),  // mov x10, x2 // c of the current N block
+  });
+
+  if (is_requantized)
+  {
+    const uint32_t scale_bits = std::bit_cast<uint32_t>(static_cast<float>(epilogue.scale));
+    const uint32_t zero_point_bits = std::bit_cast<uint32_t>(static_cast<float>(epilogue.zero_point));
+    const VGeneral zero_point = static_cast<VGeneral>(zero_point_register);
+    assembler.add({
+      movz(w14, scale_bits & 0xffff),                       // movz w14, #scale[15:0]
+      movk(w14, scale_bits >> 16, 16),                      // movk w14, #scale[31:16], lsl #16
+      fmov(static_cast<V32Bit>(scale_register), w14),       // fmov s<scale>, w14
+      movz(w14, zero_point_bits & 0xffff),                  // movz w14, #zero_point[15:0]
+      movk(w14, zero_point_bits >> 16, 16),                 // movk w14, #zero_point[31:16], lsl #16
+      fmov(static_cast<V32Bit>(zero_point_register), w14),  // fmov s<zero_point>, w14
+      dup(zero_point, t4s, zero_point, 0),                  // dup v<zero_point>.4s, v<zero_point>.s[0]
+    });
+  }
+  else
+  {
+    assembler.add(lsl(x5, x5, 2));  // lsl x5, x5, #2 // x5 * sizeof(int32_t)
+  }
+
+  if (n_loop > 0)
+  {
+    assembler.add(mov(x17, n_loop));  // mov x17, #n_loop // x17 iterator for N loop
+    assembler.label("matmul_loop_over_N");
+
+    emitter.add_m_pass(m, br_matmul_int8_nr);
+
+    assembler.add({
+      add(x9, x9, x4),              // add x9, x9, x4 // next strip of b
+      mov(x14, br_matmul_int8_nr),  // mov x14, #nr
+      madd(x10, x5, x14, x10),      // madd x10, x5, x14, x10 // next N block of c
+      sub(x17, x17, 1),             // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "matmul_loop_over_N", Assembler::relocation_t::imm19);  // cbnz x17, matmul_loop_over_N
+  }
+
+  if (n_rest > 0)
+  {
+    emitter.add_m_pass(m, n_rest);
+  }
+
+  assembler.add({
+    // Procedural Call Standard
+    // restore callee-saved registers
+    ldpPost(d14, d15, sp, 16),  // ldp d14, d15, [sp], #16
+    ldpPost(d12, d13, sp, 16),  // ldp d12, d13, [sp], #16
+    ldpPost(d10, d11, sp, 16),  // ldp d10, d11, [sp], #16
+    ldpPost(d8, d9, sp, 16),    // ldp  d8,  d9, [sp], #16
+    ldpPost(x19, x20, sp, 16),  // ldp x19, x20, [sp], #16
+
+    ret()  // ret
+  });
+
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("br_matmul_int8.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,77 @@
+#ifndef MINI_JIT_KERNELS_BR_MATMUL_INT8_H
+#define MINI_JIT_KERNELS_BR_MATMUL_INT8_H
+
+#include "../Kernel.h"
+#include "epilogue.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    //! rows of the register block of the int8 kernels, i.e. of a strip of the packed A
+    constexpr uint32_t br_matmul_int8_mr = 8;
+
+    //! columns of the register block of the int8 kernels, i.e. of a strip of the packed B
+    constexpr uint32_t br_matmul_int8_nr = 8;
+
+    /// instructions that multiply the int8 blocks, each reads its own interleaved layout
+    enum class int8_instruction_t : uint32_t
+    {
+      dot = 0,   //!< sdot or udot by element, a block of k holds four consecutive k of each row of A or column of B
+      mmla = 1,  //!< smmla or ummla, a block of k holds eight consecutive k of each row of A or column of B
+    };
+
+    /**
+     * @brief Gets the consecutive k of a row of A or a column of B that are multiplied by a single instruction.
+     *
+     * @param instruction The instruction that multiplies the blocks.
+     * @return 4 for sdot and udot, 8 for smmla and ummla.
+     */
+    constexpr uint32_t br_matmul_int8_k_block(const int8_instruction_t instruction)
+    {
+      return instruction == int8_instruction_t::mmla ? 8 : 4;
+    }
+
+    /**
+     * @brief Gets the k of the packed operands, i.e. k rounded up to a multiple of br_matmul_int8_k_block.
+     *
+     * @param k The columns of A and rows of B.
+     * @param instruction The instruction that multiplies the blocks.
+     * @return The k including the zero padding of the packed operands.
+     */
+    constexpr uint32_t br_matmul_int8_padded_k(const uint32_t k, const int8_instruction_t instruction)
+    {
+      const uint32_t k_block = br_matmul_int8_k_block(instruction);
+      return (k + k_block - 1) / k_block * k_block;
+    }
+
+    /**
+     * @brief Generates an M x N x K batch-reduce matmul kernel with int8 inputs and 32-bit integer accumulators.
+     * Both inputs are read in the interleaved layout of Packing: A consists of strips of br_matmul_int8_mr rows and B of strips of
+     * br_matmul_int8_nr columns, a strip holds for each block of br_matmul_int8_k_block k the consecutive k of its first row or
+     * column, followed by those of the second one and so on.
+     * The sdot and udot kernel multiplies four rows of A with a single column of B per instruction.
+     * The smmla and ummla kernel multiplies a 2x8 block of A with a 8x2 block of B per instruction, which doubles the products per
+     * instruction but requires the Int8 matrix multiplication extension.
+     * The strips are padded with zeros to a multiple of the block of k, the kernel only writes the m x n block of C.
+     * The leading dimensions of A and B are not used, the strides of the batch are the sizes of the packed matrices in elements.
+     * The kernel computes C = sum_i(A_i * B_i) + beta * C for a column-major int32 C. A requantization stores an int8 C instead.
+     *
+     * @param kernel The kernel to add instructions to.
+     * @param m The rows of A and C.
+     * @param n The columns of B and C.
+     * @param k The columns of A and rows of B.
+     * @param br_size number of batch dimensions.
+     * @param is_signed True for signed inputs and sdot or smmla, false for unsigned inputs and udot or ummla.
+     * @param instruction The instruction that multiplies the blocks.
+     * @param beta The scaling of C, either 0 to overwrite C or 1 to accumulate into C. A requantization requires 0.
+     * @param epilogue The requantization of the accumulators, the bias and activation are not supported.
+     */
+    void br_matmul_int8(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const uint32_t k, const uint32_t br_size,
+                        const bool is_signed, const int8_instruction_t instruction, const double beta = 1, const epilogue_t epilogue = {});
+
+  }     // namespace kernels
+}       // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BR_MATMUL_INT8_H
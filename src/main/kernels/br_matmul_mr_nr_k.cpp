@@ -0,0 +1,1101 @@
+#include "br_matmul_mr_nr_k.h"
+#include "../Assembler.h"
+#include "../Kernel.h"
+#include "../arm_instructions/arm_all.h"
+#include "row_piece.h"
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::activation_t;
+  using mini_jit::kernels::batch_reduce_t;
+  using mini_jit::kernels::bias_t;
+  using mini_jit::kernels::dtype_t;
+  using mini_jit::kernels::epilogue_t;
+  using mini_jit::kernels::get_row_pieces;
+  using mini_jit::kernels::load_piece;
+  using mini_jit::kernels::packing_t;
+  using mini_jit::kernels::prefetch_t;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::store_piece;
+
+  //! size of a cache line in bytes, the granularity of the prefetches
+  constexpr uint32_t cache_line_size = 64;
+
+  /**
+   * Emits the blocks of the kernel, each block keeps its part of C in the accumulators over the batch and k loops.
+   */
+  class BlockEmitter
+  {
+  private:
+    mini_jit::Assembler &assembler;
+    const uint32_t k_loop;
+    const uint32_t br_size;
+    const dtype_t dtype;
+    const uint32_t element_size;
+    const uint32_t lanes;
+    const bool trans_a;
+    const bool trans_b;
+    const bool trans_c;
+    const double alpha;
+    const double beta;
+    const epilogue_t epilogue;
+    const prefetch_t prefetch;
+    const batch_reduce_t batch_reduce;
+    const packing_t packing;
+
+    //! number of emitted loops, makes the labels and patch points of each loop unique
+    uint32_t loop_count = 0;
+
+    std::string get_label(char const *name)
+    {
+      return std::format("{}_{}", name, loop_count++);
+    }
+
+    /**
+     * Emits dst = base + count * stride, where the stride is the leading dimension ld if use_ld is set and the element size otherwise.
+     * x14 is used as temporary for multiples of the leading dimension.
+     */
+    void add_offset(R64Bit dst, R64Bit base, bool use_ld, R64Bit ld, uint32_t count)
+    {
+      if (count == 0)
+      {
+        assembler.add(mov(dst, base));  // mov dst, base
+      }
+      else if (!use_ld)
+      {
+        release_assert(count * element_size < 4096, "The offset does not fit into the immediate of add.");
+        assembler.add(add(dst, base, count * element_size));  // add dst, base, #count*element_size
+      }
+      else if (count == 1)
+      {
+        assembler.add(add(dst, base, ld));  // add dst, base, ld
+      }
+      else
+      {
+        assembler.add({
+          mov(x14, count),           // mov x14, #count
+          madd(dst, ld, x14, base),  // madd dst, ld, x14, base
+        });
+      }
+    }
+
+    /**
+     * Emits a prefetch of each cache line of the given number of bytes at base + offset.
+     */
+    void add_prefetch(PrefetchOp op, R64Bit base, uint32_t offset, uint32_t bytes)
+    {
+      // The immediate of prfm is a multiple of 8
+      offset = (offset + 7) / 8 * 8;
+      for (uint32_t line = 0; line < bytes; line += cache_line_size)
+      {
+        assembler.add(prfmOffset(op, base, offset + line));  // prfm <op>, [base, #offset+line]
+      }
+    }
+
+    /**
+     * Emits v<vRegister>[0] = value, the bits of the value are built in x14 and moved into the vector register.
+     */
+    void add_scalar(uint32_t vRegister, double value)
+    {
+      if (dtype == dtype_t::fp64)
+      {
+        const uint64_t bits = std::bit_cast<uint64_t>(value);
+        assembler.add(movz(x14, bits & 0xffff));  // movz x14, #bits[15:0]
+        for (uint32_t shift = 16; shift < 64; shift += 16)
+        {
+          if (((bits >> shift) & 0xffff) != 0)
+          {
+            assembler.add(movk(x14, (bits >> shift) & 0xffff, shift));  // movk x14, #bits[shift+15:shift], lsl #shift
+          }
+        }
+        assembler.add(fmov(static_cast<V64Bit>(vRegister), x14));  // fmov d<v>, x14
+      }
+      else
+      {
+        const uint32_t bits = std::bit_cast<uint32_t>(static_cast<float>(value));
+        assembler.add(movz(w14, bits & 0xffff));  // movz w14, #bits[15:0]
+        if ((bits >> 16) != 0)
+        {
+          assembler.add(movk(w14, bits >> 16, 16));  // movk w14, #bits[31:16], lsl #16
+        }
+        assembler.add(fmov(static_cast<V32Bit>(vRegister), w14));  // fmov s<v>, w14
+      }
+    }
+
+    /**
+     * Emits v<vRegister> = value in all lanes.
+     */
+    void add_broadcast(uint32_t vRegister, double value)
+    {
+      const VGeneral v = static_cast<VGeneral>(vRegister);
+      add_scalar(vRegister, value);
+      if (dtype == dtype_t::fp64)
+      {
+        assembler.add(dup(v, t2d, v, 0));  // dup v<v>.2d, v<v>.d[0]
+      }
+      else
+      {
+        assembler.add(dup(v, t4s, v, 0));  // dup v<v>.4s, v<v>.s[0]
+      }
+    }
+
+    /**
+     * Multiplies the accumulators [0, count) with the scalar in v<scale>[0].
+     */
+    void add_scale(uint32_t count, uint32_t scale)
+    {
+      for (uint32_t acc = 0; acc < count; ++acc)
+      {
+        const VGeneral v = static_cast<VGeneral>(acc);
+        if (dtype == dtype_t::fp64)
+        {
+          assembler.add(fmul(v, t2d, v, t2d, static_cast<VGeneral>(scale), 0));  // fmul v<acc>.2d, v<acc>.2d, v<scale>.d[0]
+        }
+        else
+        {
+          assembler.add(fmul(v, t4s, v, t4s, static_cast<VGeneral>(scale), 0));  // fmul v<acc>.4s, v<acc>.4s, v<scale>.s[0]
+        }
+      }
+    }
+
+    /**
+     * Gets the largest number of columns of a block whose columns consist of the given number of pieces.
+     * A transposed A needs a register of B per column and two sets of registers to transpose the rows of A.
+     */
+    uint32_t get_max_columns(uint32_t piece_count) const
+    {
+      if (trans_a)
+      {
+        return (32 - 2 * lanes) / (piece_count + 1);
+      }
+      return (32 - 1 - piece_count) / piece_count;
+    }
+
+    /**
+     * Loads the C block into the accumulators or stores the accumulators back to the C block.
+     * A row-major C is moved lane by lane, walking the columns of each row with x14.
+     */
+    void add_c_transfer(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols, bool is_store)
+    {
+      const uint32_t m_vectors = pieces.size();
+      add_offset(x13, x2, !trans_c, x5, col_begin);  // column col_begin of the c block
+
+      if (!trans_c)
+      {
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          for (uint32_t i = 0; i < m_vectors; ++i)
+          {
+            const uint32_t acc = i + j * m_vectors;
+            assembler.add(is_store ? store_piece(acc, x13, pieces[i]) : load_piece(acc, x13, pieces[i]));
+          }
+          if (j + 1 < cols)
+          {
+            assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next column of c
+          }
+        }
+        return;
+      }
+
+      for (uint32_t i = 0; i < m_vectors; ++i)
+      {
+        const uint32_t rows = pieces[i].bytes / element_size;
+        for (uint32_t lane = 0; lane < rows; ++lane)
+        {
+          assembler.add(mov(x14, x13));  // mov x14, x13 // first column of the row of c
+          for (uint32_t j = 0; j < cols; ++j)
+          {
+            const uint32_t acc = i + j * m_vectors;
+            if (dtype == dtype_t::fp64)
+            {
+              // ld1/st1 {v<acc>.d}[lane], [x14], #8
+              assembler.add(is_store ? st1Post(static_cast<V64Bit>(acc), lane, x14, element_size)
+                                     : ld1Post(static_cast<V64Bit>(acc), lane, x14, element_size));
+            }
+            else
+            {
+              // ld1/st1 {v<acc>.s}[lane], [x14], #4
+              assembler.add(is_store ? st1Post(static_cast<V32Bit>(acc), lane, x14, element_size)
+                                     : ld1Post(static_cast<V32Bit>(acc), lane, x14, element_size));
+            }
+          }
+          if (i + 1 < m_vectors || lane + 1 < rows)
+          {
+            assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next row of c
+          }
+        }
+      }
+    }
+
+    /**
+     * Adds beta * C to the accumulators, v<scale> and v<scale+1> are free registers behind the accumulators.
+     * A row-major C is gathered lane by lane into v<scale+1>, walking the rows of each piece with x14.
+     */
+    void add_c_accumulate(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols, uint32_t scale)
+    {
+      const uint32_t m_vectors = pieces.size();
+      const VGeneral c = static_cast<VGeneral>(scale + 1);
+
+      release_assert(scale + 1 < 32, "The block does not fit into the vector registers.");
+
+      add_scalar(scale, beta);
+      add_offset(x13, x2, !trans_c, x5, col_begin);  // column col_begin of the c block
+
+      auto add_fmla = [&](uint32_t acc)
+      {
+        if (dtype == dtype_t::fp64)
+        {
+          // fmla v<acc>.2d, v<c>.2d, v<scale>.d[0]
+          assembler.add(fmla(static_cast<VGeneral>(acc), t2d, c, t2d, static_cast<VGeneral>(scale), 0));
+        }
+        else
+        {
+          // fmla v<acc>.4s, v<c>.4s, v<scale>.s[0]
+          assembler.add(fmla(static_cast<VGeneral>(acc), t4s, c, t4s, static_cast<VGeneral>(scale), 0));
+        }
+      };
+
+      if (!trans_c)
+      {
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          for (uint32_t i = 0; i < m_vectors; ++i)
+          {
+            assembler.add(load_piece(scale + 1, x13, pieces[i]));
+            add_fmla(i + j * m_vectors);
+          }
+          if (j + 1 < cols)
+          {
+            assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next column of c
+          }
+        }
+        return;
+      }
+
+      for (uint32_t i = 0; i < m_vectors; ++i)
+      {
+        const uint32_t rows = pieces[i].bytes / element_size;
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          add_offset(x14, x13, false, x5, j);  // column j of the first row of the piece
+          for (uint32_t lane = 0; lane < rows; ++lane)
+          {
+            if (dtype == dtype_t::fp64)
+            {
+              assembler.add(ld1Post(static_cast<V64Bit>(scale + 1), lane, x14, x5));  // ld1 {v<c>.d}[lane], [x14], x5
+            }
+            else
+            {
+              assembler.add(ld1Post(static_cast<V32Bit>(scale + 1), lane, x14, x5));  // ld1 {v<c>.s}[lane], [x14], x5
+            }
+          }
+          add_fmla(i + j * m_vectors);
+        }
+        for (uint32_t lane = 0; i + 1 < m_vectors && lane < rows; ++lane)
+        {
+          assembler.add(add(x13, x13, x5));  // add x13, x13, x5 // next row of c
+        }
+      }
+    }
+
+    /**
+     * Initializes the accumulators of the block.
+     * C is only loaded if it is not scaled afterwards by alpha, otherwise the accumulators start from zero.
+     */
+    void add_c_init(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols)
+    {
+      const uint32_t acc_count = pieces.size() * cols;
+      if (alpha == 1 && beta != 0)
+      {
+        add_c_transfer(pieces, col_begin, cols, false);
+        if (beta != 1)
+        {
+          add_scalar(acc_count, beta);
+          add_scale(acc_count, acc_count);
+        }
+        return;
+      }
+
+      for (uint32_t acc = 0; acc < acc_count; ++acc)
+      {
+        const VGeneral v = static_cast<VGeneral>(acc);
+        assembler.add(eor(v, t16b, v, t16b, v, t16b));  // eor v<acc>.16b, v<acc>.16b, v<acc>.16b
+      }
+    }
+
+    /**
+     * Applies alpha and beta to the accumulators of the block and stores them to C.
+     */
+    void add_c_finish(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols)
+    {
+      const uint32_t acc_count = pieces.size() * cols;
+      if (alpha != 1)
+      {
+        add_scalar(acc_count, alpha);
+        add_scale(acc_count, acc_count);
+        if (beta != 0)
+        {
+          add_c_accumulate(pieces, col_begin, cols, acc_count);
+        }
+      }
+
+      add_c_epilogue(pieces, col_begin, cols);
+      add_c_transfer(pieces, col_begin, cols, true);
+    }
+
+    /**
+     * Adds the bias to the accumulators of the block and applies the activation.
+     * x22 points to the row bias of the current M block and x21 to the column bias of the current N block.
+     */
+    void add_c_epilogue(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols)
+    {
+      const uint32_t m_vectors = pieces.size();
+      const uint32_t acc_count = m_vectors * cols;
+
+      release_assert(acc_count + 1 < 32, "The block does not fit into the vector registers.");
+
+      // Emits v<acc> = op(v<acc>, v<src>) for all lanes
+      auto add_lanewise = [&](auto op, uint32_t acc, uint32_t src)
+      {
+        const VGeneral v = static_cast<VGeneral>(acc);
+        if (dtype == dtype_t::fp64)
+        {
+          assembler.add(op(v, t2d, v, t2d, static_cast<VGeneral>(src), t2d));  // op v<acc>.2d, v<acc>.2d, v<src>.2d
+        }
+        else
+        {
+          assembler.add(op(v, t4s, v, t4s, static_cast<VGeneral>(src), t4s));  // op v<acc>.4s, v<acc>.4s, v<src>.4s
+        }
+      };
+      auto op_fadd = [](auto... args) { return fadd(args...); };
+      auto op_fmax = [](auto... args) { return fmax(args...); };
+      auto op_fmin = [](auto... args) { return fmin(args...); };
+
+      if (epilogue.bias == bias_t::row)
+      {
+        for (uint32_t i = 0; i < m_vectors; ++i)
+        {
+          assembler.add(load_piece(acc_count, x22, pieces[i]));
+          for (uint32_t j = 0; j < cols; ++j)
+          {
+            add_lanewise(op_fadd, i + j * m_vectors, acc_count);
+          }
+        }
+      }
+      else if (epilogue.bias == bias_t::column)
+      {
+        const VGeneral bias = static_cast<VGeneral>(acc_count);
+        for (uint32_t j = 0; j < cols; ++j)
+        {
+          assembler.add(load_piece(acc_count, x21, row_piece_t{(col_begin + j) * element_size, element_size}));
+          if (dtype == dtype_t::fp64)
+          {
+            assembler.add(dup(bias, t2d, bias, 0));  // dup v<bias>.2d, v<bias>.d[0]
+          }
+          else
+          {
+            assembler.add(dup(bias, t4s, bias, 0));  // dup v<bias>.4s, v<bias>.s[0]
+          }
+          for (uint32_t i = 0; i < m_vectors; ++i)
+          {
+            add_lanewise(op_fadd, i + j * m_vectors, acc_count);
+          }
+        }
+      }
+
+      if (epilogue.activation == activation_t::relu)
+      {
+        const VGeneral zero = static_cast<VGeneral>(acc_count);
+        assembler.add(eor(zero, t16b, zero, t16b, zero, t16b));  // eor v<zero>.16b, v<zero>.16b, v<zero>.16b
+        for (uint32_t acc = 0; acc < acc_count; ++acc)
+        {
+          add_lanewise(op_fmax, acc, acc_count);
+        }
+      }
+      else if (epilogue.activation == activation_t::clamp)
+      {
+        add_broadcast(acc_count, epilogue.clamp_min);
+        add_broadcast(acc_count + 1, epilogue.clamp_max);
+        for (uint32_t acc = 0; acc < acc_count; ++acc)
+        {
+          add_lanewise(op_fmax, acc, acc_count);
+          add_lanewise(op_fmin, acc, acc_count + 1);
+        }
+      }
+    }
+
+    /**
+     * Emits the k loop for a column-major A, multiplying a column of A with each scalar of the row of B.
+     * x13 points to the current column of A and x1 to the current row of B.
+     */
+    void add_k_loop(std::vector<row_piece_t> const &pieces, uint32_t cols)
+    {
+      // Vector registers: the accumulators of the C block, followed by the A column and the alternating B scalars
+      const uint32_t m_vectors = pieces.size();
+      const uint32_t a_register = m_vectors * cols;
+      const uint32_t b_register = a_register + m_vectors;
+      const uint32_t b_register_count = std::min(2u, 32 - b_register);
+
+      release_assert(b_register < 32, "The block does not fit into the vector registers.");
+
+      // Packed strips are k_loop elements apart, hence only the k loop of unpacked operands can be patched
+      if (!packing.a && !packing.b)
+      {
+        assembler.patch_point(get_label("k_loop"));
+      }
+      assembler.add(mov(x15, k_loop));  // mov x15, #k_loop // x15 iterator for K loop
+
+      std::string k_label = get_label("matmul_loop_over_K");
+      assembler.label(k_label);
+
+      // Load a column of A
+      for (uint32_t i = 0; i < m_vectors; ++i)
+      {
+        assembler.add(load_piece(a_register + i, x13, pieces[i]));
+      }
+      if (prefetch.a != 0)
+      {
+        assembler.add(add(x14, x13, x23));  // add x14, x13, x23 // column of a prefetch.a iterations ahead
+        add_prefetch(PrefetchOp::PLDL1KEEP, x14, 0, pieces.back().offset + pieces.back().bytes);
+      }
+      assembler.add(add(x13, x13, x3));  // add x13, x13, x3 // next column of a
+      if (!trans_b)
+      {
+        assembler.add(mov(x14, x1));  // mov x14, x1 // first column of b
+      }
+
+      // Multiply the column of A with each scalar of the row of B
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        const uint32_t b = b_register + j % b_register_count;
+        if (trans_b)
+        {
+          // The row of a transposed B is contiguous
+          assembler.add(load_piece(b, x1, row_piece_t{j * element_size, element_size}));  // ldr s<b>/d<b>, [x1, #j*element_size]
+        }
+        else
+        {
+          assembler.add(load_piece(b, x14, row_piece_t{0, element_size}));  // ldr s<b>/d<b>, [x14]
+          if (prefetch.b != 0)
+          {
+            add_prefetch(PrefetchOp::PLDL1KEEP, x14, prefetch.b * element_size, element_size);
+          }
+          if (j + 1 < cols)
+          {
+            assembler.add(add(x14, x14, x4));  // add x14, x14, x4 // next column of b
+          }
+        }
+
+        for (uint32_t i = 0; i < m_vectors; ++i)
+        {
+          const VGeneral acc = static_cast<VGeneral>(i + j * m_vectors);
+          const VGeneral a = static_cast<VGeneral>(a_register + i);
+          if (dtype == dtype_t::fp64)
+          {
+            assembler.add(fmla(acc, t2d, a, t2d, static_cast<VGeneral>(b), 0));  // fmla v<acc>.2d, v<a>.2d, v<b>.d[0]
+          }
+          else
+          {
+            assembler.add(fmla(acc, t4s, a, t4s, static_cast<VGeneral>(b), 0));  // fmla v<acc>.4s, v<a>.4s, v<b>.s[0]
+          }
+        }
+      }
+
+      if (trans_b)
+      {
+        if (prefetch.b != 0)
+        {
+          assembler.add(add(x14, x1, x24));  // add x14, x1, x24 // row of b prefetch.b iterations ahead
+          add_prefetch(PrefetchOp::PLDL1KEEP, x14, 0, cols * element_size);
+        }
+        assembler.add(add(x1, x1, x4));  // add x1, x1, x4 // next row of b
+      }
+      else
+      {
+        assembler.add(add(x1, x1, element_size));  // add x1, x1, #element_size // next row of b
+      }
+      assembler.add(sub(x15, x15, 1));                                                 // sub x15, x15, #1
+      assembler.add(cbnz(x15, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x15, matmul_loop_over_K
+    }
+
+    /**
+     * Emits width iterations of the k loop for a transposed A, whose rows are contiguous in k.
+     * The rows of each piece are loaded as width k values and transposed in registers into width columns of A.
+     * x13 points to the current k of the first row of A, x1 to the current row of B and x20 walks the rows of A.
+     */
+    void add_k_chunk_trans_a(std::vector<row_piece_t> const &pieces, uint32_t cols, uint32_t width)
+    {
+      // Vector registers: the accumulators of the C block, followed by a register of B per column, the rows of A and the temporaries
+      const uint32_t m_vectors = pieces.size();
+      const uint32_t b_register = m_vectors * cols;
+      const uint32_t row_register = b_register + cols;
+      const uint32_t tmp_register = row_register + lanes;
+      const row_piece_t chunk{0, width * element_size};
+      auto row = [row_register](uint32_t r) { return static_cast<VGeneral>(row_register + r); };
+      auto tmp = [tmp_register](uint32_t t) { return static_cast<VGeneral>(tmp_register + t); };
+
+      release_assert(tmp_register + lanes <= 32, "The block does not fit into the vector registers.");
+
+      // Load width k values of each column of B
+      assembler.add(mov(x14, x1));  // mov x14, x1 // first column of b
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        assembler.add(load_piece(b_register + j, x14, chunk));
+        if (prefetch.b != 0)
+        {
+          add_prefetch(PrefetchOp::PLDL1KEEP, x14, prefetch.b * element_size, chunk.bytes);
+        }
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x14, x14, x4));  // add x14, x14, x4 // next column of b
+        }
+      }
+
+      assembler.add(mov(x20, x13));  // mov x20, x13 // first row of a
+      for (uint32_t i = 0; i < m_vectors; ++i)
+      {
+        // Missing rows of a partial piece only end up in lanes that are never stored
+        const uint32_t rows = pieces[i].bytes / element_size;
+        for (uint32_t r = 0; r < rows; ++r)
+        {
+          assembler.add(load_piece(row_register + r, x20, chunk));
+          if (prefetch.a != 0)
+          {
+            add_prefetch(PrefetchOp::PLDL1KEEP, x20, prefetch.a * element_size, chunk.bytes);
+          }
+          if (i + 1 < m_vectors || r + 1 < rows)
+          {
+            assembler.add(add(x20, x20, x3));  // add x20, x20, x3 // next row of a
+          }
+        }
+
+        // Transpose the rows into the columns a_q of the piece
+        std::vector<VGeneral> columns;
+        if (dtype == dtype_t::fp64)
+        {
+          assembler.add(trn1(tmp(0), t2d, row(0), t2d, row(1), t2d));  // trn1 v<t0>.2d, v<r0>.2d, v<r1>.2d
+          columns.push_back(tmp(0));
+          if (width > 1)
+          {
+            assembler.add(trn2(tmp(1), t2d, row(0), t2d, row(1), t2d));  // trn2 v<t1>.2d, v<r0>.2d, v<r1>.2d
+            columns.push_back(tmp(1));
+          }
+        }
+        else
+        {
+          assembler.add({
+            trn1(tmp(0), t4s, row(0), t4s, row(1), t4s),  // trn1 v<t0>.4s, v<r0>.4s, v<r1>.4s
+            trn1(tmp(2), t4s, row(2), t4s, row(3), t4s),  // trn1 v<t2>.4s, v<r2>.4s, v<r3>.4s
+          });
+          if (width > 1)
+          {
+            assembler.add({
+              trn2(tmp(1), t4s, row(0), t4s, row(1), t4s),  // trn2 v<t1>.4s, v<r0>.4s, v<r1>.4s
+              trn2(tmp(3), t4s, row(2), t4s, row(3), t4s),  // trn2 v<t3>.4s, v<r2>.4s, v<r3>.4s
+            });
+          }
+
+          // The rows are no longer needed, hence the columns replace them
+          assembler.add(trn1(row(0), t2d, tmp(0), t2d, tmp(2), t2d));  // trn1 v<r0>.2d, v<t0>.2d, v<t2>.2d // a_0
+          columns.push_back(row(0));
+          if (width > 1)
+          {
+            assembler.add(trn1(row(1), t2d, tmp(1), t2d, tmp(3), t2d));  // trn1 v<r1>.2d, v<t1>.2d, v<t3>.2d // a_1
+            columns.push_back(row(1));
+          }
+          if (width > 2)
+          {
+            assembler.add({
+              trn2(row(2), t2d, tmp(0), t2d, tmp(2), t2d),  // trn2 v<r2>.2d, v<t0>.2d, v<t2>.2d // a_2
+              trn2(row(3), t2d, tmp(1), t2d, tmp(3), t2d),  // trn2 v<r3>.2d, v<t1>.2d, v<t3>.2d // a_3
+            });
+            columns.push_back(row(2));
+            columns.push_back(row(3));
+          }
+        }
+
+        for (uint32_t q = 0; q < width; ++q)
+        {
+          for (uint32_t j = 0; j < cols; ++j)
+          {
+            const VGeneral acc = static_cast<VGeneral>(i + j * m_vectors);
+            const VGeneral b = static_cast<VGeneral>(b_register + j);
+            if (dtype == dtype_t::fp64)
+            {
+              assembler.add(fmla(acc, t2d, columns[q], t2d, b, q));  // fmla v<acc>.2d, v<a_q>.2d, v<b>.d[q]
+            }
+            else
+            {
+              assembler.add(fmla(acc, t4s, columns[q], t4s, b, q));  // fmla v<acc>.4s, v<a_q>.4s, v<b>.s[q]
+            }
+          }
+        }
+      }
+
+      assembler.add({
+        add(x13, x13, chunk.bytes),  // add x13, x13, #width*element_size // next k of a
+        add(x1, x1, chunk.bytes),    // add x1, x1, #width*element_size // next row of b
+      });
+    }
+
+    /**
+     * Emits the k loop for a transposed A in chunks of a full vector register of k values, followed by the remaining k values.
+     */
+    void add_k_loop_trans_a(std::vector<row_piece_t> const &pieces, uint32_t cols)
+    {
+      const uint32_t k_chunks = k_loop / lanes;
+      if (k_chunks > 0)
+      {
+        assembler.add(mov(x15, k_chunks));  // mov x15, #k_chunks // x15 iterator for K loop
+
+        std::string k_label = get_label("matmul_loop_over_K");
+        assembler.label(k_label);
+        add_k_chunk_trans_a(pieces, cols, lanes);
+        assembler.add(sub(x15, x15, 1));                                                 // sub x15, x15, #1
+        assembler.add(cbnz(x15, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x15, matmul_loop_over_K
+      }
+
+      uint32_t k_rest = k_loop % lanes;
+      for (uint32_t width : {2u, 1u})
+      {
+        if (k_rest >= width)
+        {
+          add_k_chunk_trans_a(pieces, cols, width);
+          k_rest -= width;
+        }
+      }
+    }
+
+  public:
+    BlockEmitter(mini_jit::Assembler &assembler, uint32_t k_loop, uint32_t br_size, dtype_t dtype, bool trans_a, bool trans_b,
+                 bool trans_c, double alpha, double beta, epilogue_t epilogue, prefetch_t prefetch,
+                 batch_reduce_t batch_reduce, packing_t packing)
+        : assembler(assembler), k_loop(k_loop), br_size(br_size), dtype(dtype), element_size(mini_jit::kernels::get_dtype_size(dtype)),
+          lanes(mini_jit::kernels::get_dtype_lanes(dtype)), trans_a(trans_a), trans_b(trans_b), trans_c(trans_c), alpha(alpha), beta(beta),
+          epilogue(epilogue), prefetch(prefetch), batch_reduce(batch_reduce), packing(packing)
+    {
+      release_assert(!(trans_a && (trans_b || trans_c)), "A transposed A is only supported with a column-major B and C.");
+    }
+
+    /**
+     * Emits a block of the rows given by the pieces and the columns [col_begin, col_begin + cols) of the current N block.
+     * x8 points to the rows of A, x9 to the N block of B and x2 to the rows of the N block of C.
+     * For an address batch-reduce x8 and x9 are byte offsets into the blocks, whose pointers are listed by x0 and x26.
+     * For an offset batch-reduce x6 and x7 list the element offsets of the blocks from x8 and x9.
+     */
+    void add_block(std::vector<row_piece_t> const &pieces, uint32_t col_begin, uint32_t cols)
+    {
+      // Initialize the accumulators with the C block or zero
+      add_c_init(pieces, col_begin, cols);
+
+      if (batch_reduce == batch_reduce_t::stride)
+      {
+        assembler.add(mov(x11, x8));                   // mov x11, x8 // a of the current batch
+        add_offset(x12, x9, !trans_b, x4, col_begin);  // b of the current batch at column col_begin
+      }
+      else
+      {
+        // x11 and x12 walk the lists of A and B, x25 holds the column col_begin of B
+        const bool is_address = batch_reduce == batch_reduce_t::address;
+        assembler.add({
+          mov(x11, is_address ? x0 : x6),   // mov x11, x0/x6 // list of a
+          mov(x12, is_address ? x26 : x7),  // mov x12, x26/x7 // list of b
+        });
+        add_offset(x25, x9, !trans_b, x4, col_begin);  // column col_begin of b
+      }
+      assembler.patch_point(get_label("br_size"));
+      assembler.add(mov(x19, br_size));  // mov x19, #br_size // x19 iterator for the batch dimension
+
+      std::string batch_label = get_label("matmul_loop_batch_dimension");
+      assembler.label(batch_label);
+      if (batch_reduce == batch_reduce_t::stride)
+      {
+        assembler.add({
+          mov(x13, x11),  // mov x13, x11 // current column of a
+          mov(x1, x12),   // mov x1, x12 // current row of b
+        });
+      }
+      else if (batch_reduce == batch_reduce_t::address)
+      {
+        assembler.add({
+          ldrPost(x13, x11, 8),  // ldr x13, [x11], #8 // block of a
+          add(x13, x13, x8),     // add x13, x13, x8 // current column of a
+          ldrPost(x1, x12, 8),   // ldr x1, [x12], #8 // block of b
+          add(x1, x1, x25),      // add x1, x1, x25 // current row of b
+        });
+      }
+      else
+      {
+        const uint32_t shift = get_dtype_shift(dtype);
+        assembler.add({
+          ldrPost(x14, x11, 8),           // ldr x14, [x11], #8 // offset of the block of a
+          add(x13, x8, x14, LSL, shift),  // add x13, x8, x14, lsl #shift // current column of a
+          ldrPost(x14, x12, 8),           // ldr x14, [x12], #8 // offset of the block of b
+          add(x1, x25, x14, LSL, shift),  // add x1, x25, x14, lsl #shift // current row of b
+        });
+      }
+
+      if (trans_a)
+      {
+        add_k_loop_trans_a(pieces, cols);
+      }
+      else
+      {
+        add_k_loop(pieces, cols);
+      }
+
+      if (batch_reduce == batch_reduce_t::stride)
+      {
+        assembler.add({
+          add(x11, x11, x6),  // add x11, x11, x6 // next batch of a
+          add(x12, x12, x7),  // add x12, x12, x7 // next batch of b
+        });
+      }
+      assembler.add(sub(x19, x19, 1));                                                     // sub x19, x19, #1
+      assembler.add(cbnz(x19, 0), batch_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x19, matmul_loop_batch_dimension
+
+      // Scale the accumulators and store them back to the C block
+      add_c_finish(pieces, col_begin, cols);
+    }
+
+    /**
+     * Emits the blocks of the given rows over cols columns, split into as many blocks as needed to fit into the registers.
+     */
+    void add_blocks(uint32_t rows, uint32_t cols)
+    {
+      std::vector<row_piece_t> pieces = get_row_pieces(rows, element_size);
+      const uint32_t max_columns = get_max_columns(pieces.size());
+      release_assert(max_columns != 0, "The block does not fit into the vector registers.");
+      for (uint32_t col_begin = 0; col_begin < cols; col_begin += max_columns)
+      {
+        add_block(pieces, col_begin, std::min(max_columns, cols - col_begin));
+      }
+    }
+
+    /**
+     * Emits the prefetches of the C block of the next M block with mr rows and cols columns into L2.
+     * The block is only stored for a beta of zero, otherwise it is loaded.
+     */
+    void add_c_prefetch(uint32_t mr, uint32_t cols)
+    {
+      const PrefetchOp op = beta != 0 ? PrefetchOp::PLDL2KEEP : PrefetchOp::PSTL2KEEP;
+      const uint32_t lines = trans_c ? mr : cols;
+      const uint32_t bytes = (trans_c ? cols : mr) * element_size;
+
+      add_offset(x14, x2, trans_c, x5, mr);  // c of the next M block
+      for (uint32_t line = 0; line < lines; ++line)
+      {
+        add_prefetch(op, x14, 0, bytes);
+        if (line + 1 < lines)
+        {
+          assembler.add(add(x14, x14, x5));  // add x14, x14, x5 // next column or row of c
+        }
+      }
+    }
+
+    /**
+     * Emits the loop over the M blocks of the current N block with cols columns, followed by the block of the remaining rows.
+     */
+    void add_m_pass(uint32_t mr, uint32_t m, uint32_t cols)
+    {
+      const uint32_t m_loop = m / mr;
+      const uint32_t m_rest = m % mr;
+
+      if (batch_reduce == batch_reduce_t::address)
+      {
+        assembler.add(mov(x8, 0u));  // mov x8, #0 // offset of the current M block in the blocks of a
+      }
+      else
+      {
+        assembler.add(mov(x8, x0));  // mov x8, x0 // a of the current M block
+      }
+      assembler.add(mov(x2, x10));  // mov x2, x10 // c of the current M block
+      if (epilogue.bias == bias_t::row)
+      {
+        assembler.add(mov(x22, x21));  // mov x22, x21 // row bias of the current M block
+      }
+
+      if (m_loop > 0)
+      {
+        std::string m_label = get_label("matmul_loop_over_M");
+        assembler.patch_point(get_label("m_loop"));
+        assembler.add(mov(x16, m_loop));  // mov x16, #m_loop // x16 iterator for M loop
+        assembler.label(m_label);
+
+        if (prefetch.c)
+        {
+          add_c_prefetch(mr, cols);
+        }
+        add_blocks(mr, cols);
+
+        add_offset(x2, x2, trans_c, x5, mr);  // next M block of c
+        if (packing.a)
+        {
+          add_offset(x8, x8, true, x3, k_loop);  // next strip of a
+        }
+        else
+        {
+          add_offset(x8, x8, trans_a, x3, mr);  // next M block of a
+        }
+        if (epilogue.bias == bias_t::row)
+        {
+          add_offset(x22, x22, false, x5, mr);  // next M block of the row bias
+        }
+        assembler.add(sub(x16, x16, 1));                                                 // sub x16, x16, #1
+        assembler.add(cbnz(x16, 0), m_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x16, matmul_loop_over_M
+      }
+
+      if (m_rest > 0)
+      {
+        add_blocks(m_rest, cols);
+      }
+    }
+
+    /**
+     * Emits the step of x9, x10 and the column bias in x21 to the next N block of B and C with nr columns.
+     */
+    void add_next_n_block(uint32_t nr)
+    {
+      if (packing.b)
+      {
+        add_offset(x9, x9, true, x4, k_loop);  // next strip of b
+      }
+      else
+      {
+        add_offset(x9, x9, !trans_b, x4, nr);  // next N block of b
+      }
+      add_offset(x10, x10, !trans_c, x5, nr);  // next N block of c
+      if (epilogue.bias == bias_t::column)
+      {
+        add_offset(x21, x21, false, x5, nr);  // next N block of the column bias
+      }
+    }
+  };
+}  // namespace
+
+void mini_jit::kernels::br_matmul_mr_nr_k(mini_jit::Kernel &kernel, const uint32_t mr, const uint32_t nr, const uint32_t m,
+                                          const uint32_t n, const uint32_t k_loop, const uint32_t br_size, const dtype_t dtype,
+                                          const bool trans_a, const bool trans_b, const bool trans_c, const double alpha,
+                                          const double beta, const epilogue_t epilogue, const prefetch_t prefetch,
+                                          const batch_reduce_t batch_reduce, const packing_t packing)
+{
+  using namespace mini_jit::arm_instructions;
+
+  const uint32_t lanes = get_dtype_lanes(dtype);
+  const uint32_t shift = get_dtype_shift(dtype);
+
+  release_assert(mr != 0 && mr % lanes == 0, "The rows of the register block must be a multiple of the lanes of a vector register.");
+  release_assert(nr != 0 && nr <= br_matmul_mr_nr_k_max_nr(mr, dtype), "The register block does not fit into the vector registers.");
+  release_assert(m != 0, "Cannot proccess matrix with m of 0.");
+  release_assert(n != 0, "Cannot proccess matrix with n of 0.");
+  release_assert(k_loop != 0, "Cannot proccess matrix with k loop of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+  release_assert(batch_reduce == batch_reduce_t::stride || epilogue.bias == bias_t::none,
+                 "A bias is only supported with a stride batch-reduce.");
+
+  // With at least two transposed operands the kernel computes C^T = B^T A^T, which leaves at most one transposed operand
+  const bool swap_operands = (trans_a + trans_b + trans_c) >= 2;
+  release_assert(!packing.a || (!trans_a && !swap_operands), "A packed A requires a column-major A and at most one transposed operand.");
+  release_assert(!packing.b || (trans_b && !trans_a && !trans_c), "A packed B requires a row-major B with a column-major A and C.");
+  const uint32_t m_kernel = swap_operands ? n : m;
+  const uint32_t n_kernel = swap_operands ? m : n;
+
+  const uint32_t n_loop = n_kernel / nr;
+  const uint32_t n_rest = n_kernel % nr;
+
+  // The rows of C^T are the columns of C
+  epilogue_t epilogue_kernel = epilogue;
+  if (swap_operands && epilogue.bias != bias_t::none)
+  {
+    epilogue_kernel.bias = epilogue.bias == bias_t::row ? bias_t::column : bias_t::row;
+  }
+  const bool has_bias = epilogue.bias != bias_t::none;
+
+  // A and B swap their roles, too
+  const bool trans_a_kernel = swap_operands ? !trans_b : trans_a;
+  const bool trans_b_kernel = swap_operands ? !trans_a : trans_b;
+  const prefetch_t prefetch_kernel = swap_operands ? prefetch_t{prefetch.b, prefetch.a, prefetch.c} : prefetch;
+
+  // The distances of a column-major A and a row-major B are multiples of the leading dimension, held in x23 and x24
+  const bool has_prefetch_offsets = (prefetch_kernel.a != 0 && !trans_a_kernel) || (prefetch_kernel.b != 0 && trans_b_kernel);
+
+  Assembler assembler(kernel);
+  BlockEmitter emitter(assembler, k_loop, br_size, dtype, trans_a_kernel, trans_b_kernel, swap_operands ? !trans_c : trans_c, alpha, beta,
+                       epilogue_kernel, prefetch_kernel, batch_reduce, packing);
+
+  assembler.add({
+    // Procedural Call Standard
+    // save callee-saved registers
+    stpPre(x19, x20, sp, -16),  // stp x19, x20, [sp, #-16]!
+    stpPre(d8, d9, sp, -16),    // stp  d8,  d9, [sp, #-16]!
+    stpPre(d10, d11, sp, -16),  // stp d10, d11, [sp, #-16]!
+    stpPre(d12, d13, sp, -16),  // stp d12, d13, [sp, #-16]!
+    stpPre(d14, d15, sp, -16),  // stp d14, d15, [sp, #-16]!
+  });
+
+  if (has_bias)
+  {
+    assembler.add({
+      stpPre(x21, x22, sp, -16),  // stp x21, x22, [sp, #-16]!
+      ldrOffset(x21, sp, 96),     // ldr x21, [sp, #96] // bias, the ninth argument above the six saved pairs
+    });
+  }
+
+  if (has_prefetch_offsets)
+  {
+    assembler.add(stpPre(x23, x24, sp, -16));  // stp x23, x24, [sp, #-16]!
+  }
+
+  if (batch_reduce != batch_reduce_t::stride)
+  {
+    assembler.add(stpPre(x25, x26, sp, -16));  // stp x25, x26, [sp, #-16]!
+  }
+
+  if (swap_operands)
+  {
+    assembler.add({
+      // Swap the roles of A and B
+      mov(x14, x0),  // mov x14, x0
+      mov(x0, x1),   // mov x0, x1
+      mov(x1, x14),  // mov x1, x14
+      mov(x14, x3),  // mov x14, x3
+      mov(x3, x4),   // mov x3, x4
+      mov(x4, x14),  // mov x4, x14
+      mov(x14, x6),  // mov x14, x6
+      mov(x6, x7),   // mov x6, x7
+      mov(x7, x14),  // mov x7, x14
+    });
+  }
+
+  assembler.add({
+    // Offset the used leading dimension by the size of the elements
+    lsl(x3, x3, shift),  // lsl x3, x3, #shift // x3 * sizeof(element)
+    lsl(x4, x4, shift),  // lsl x4, x4, #shift // x4 * sizeof(element)
+    lsl(x5, x5, shift),  // lsl x5, x5, #shift // x5 * sizeof(element)
+  });
+
+  if (batch_reduce == batch_reduce_t::stride)
+  {
+    assembler.add({
+      lsl(x6, x6, shift),  // lsl x6, x6, #shift // x6 * sizeof(element)
+      lsl(x7, x7, shift),  // lsl x7, x7, #shift // x7 * sizeof(element)
+    });
+  }
+
+  if (batch_reduce == batch_reduce_t::address)
+  {
+    assembler.add({
+      mov(x26, x1),  // mov x26, x1 // list of b
+      mov(x9, 0u),   // mov x9, #0 // offset of the current N block in the blocks of b
+    });
+  }
+  else
+  {
+    assembler.add(mov(x9, x1));  // mov x9, x1 // b of the current N block
+  }
+  assembler.add(mov(x10, x2));  // mov x10, x2 // c of the current N block
+
+  if (prefetch_kernel.a != 0 && !trans_a_kernel)
+  {
+    assembler.add({
+      mov(x14, prefetch_kernel.a),  // mov x14, #prefetch.a
+      madd(x23, x3, x14, xzr),      // madd x23, x3, x14, xzr // x23 = prefetch.a * lda
+    });
+  }
+  if (prefetch_kernel.b != 0 && trans_b_kernel)
+  {
+    assembler.add({
+      mov(x14, prefetch_kernel.b),  // mov x14, #prefetch.b
+      madd(x24, x4, x14, xzr),      // madd x24, x4, x14, xzr // x24 = prefetch.b * ldb
+    });
+  }
+
+  if (n_loop > 0)
+  {
+    assembler.patch_point("n_loop");
+    assembler.add(mov(x17, n_loop));  // mov x17, #n_loop // x17 iterator for N loop
+    assembler.label("matmul_loop_over_N");
+
+    emitter.add_m_pass(mr, m_kernel, nr);
+    emitter.add_next_n_block(nr);
+
+    assembler.add(sub(x17, x17, 1));                                                    // sub x17, x17, #1
+    assembler.add(cbnz(x17, 0), "matmul_loop_over_N", Assembler::relocation_t::imm19);  // cbnz x17, matmul_loop_over_N
+  }
+
+  if (n_rest > 0)
+  {
+    emitter.add_m_pass(mr, m_kernel, n_rest);
+  }
+
+  if (batch_reduce != batch_reduce_t::stride)
+  {
+    assembler.add(ldpPost(x25, x26, sp, 16));  // ldp x25, x26, [sp], #16
+  }
+
+  if (has_prefetch_offsets)
+  {
+    assembler.add(ldpPost(x23, x24, sp, 16));  // ldp x23, x24, [sp], #16
+  }
+
+  if (has_bias)
+  {
+    assembler.add(ldpPost(x21, x22, sp, 16));  // ldp x21, x22, [sp], #16
+  }
+
+  assembler.add({
+    // Procedural Call Standard
+    // restore callee-saved registers
+    ldpPost(d14, d15, sp, 16),  // ldp d14, d15, [sp], #16
+    ldpPost(d12, d13, sp, 16),  // ldp d12, d13, [sp], #16
+    ldpPost(d10, d11, sp, 16),  // ldp d10, d11, [sp], #16
+    ldpPost(d8, d9, sp, 16),    // ldp  d8,  d9, [sp], #16
+    ldpPost(x19, x20, sp, 16),  // ldp x19, x20, [sp], #16
+
+    ret()  // ret
+  });
+
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("br_matmul_mr_nr_k.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::br_matmul_mr_nr_k_patch_loops(mini_jit::Kernel &kernel, const uint32_t m_loop, const uint32_t n_loop,
+                                                      const uint32_t k_loop, const uint32_t br_size)
+{
+  using namespace mini_jit::arm_instructions;
+
+  release_assert(m_loop != 0, "Cannot proccess matrix with m loop of 0.");
+  release_assert(n_loop != 0, "Cannot proccess matrix with n loop of 0.");
+  release_assert(k_loop != 0, "Cannot proccess matrix with k loop of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+
+  // Each block has its own batch and k loop and each N block its own M loop, the patch points of a loop share the name as prefix
+  auto patch_loop = [&kernel](std::string_view name, uint32_t instruction)
+  {
+    bool found = false;
+    for (auto const &[patch_name, index] : kernel.get_patch_points())
+    {
+      if (patch_name.starts_with(name))
+      {
+        kernel.patch(index, instruction);
+        found = true;
+      }
+    }
+    release_assert(found, "The kernel has no patch point of the loop.");
+  };
+
+  patch_loop("br_size", mov(x19, br_size));
+  patch_loop("n_loop", mov(x17, n_loop));
+  patch_loop("m_loop", mov(x16, m_loop));
+  patch_loop("k_loop", mov(x15, k_loop));
+}
@@ -0,0 +1,84 @@
+#ifndef MINI_JIT_KERNELS_BR_MATMUL_MR_NR_K_H
+#define MINI_JIT_KERNELS_BR_MATMUL_MR_NR_K_H
+
+#include "../Kernel.h"
+#include "batch_reduce.h"
+#include "dtype.h"
+#include "epilogue.h"
+#include "packing.h"
+#include "prefetch.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /**
+     * @brief Gets the largest number of columns of a register block with mr rows.
+     * A block holds mr/lanes * nr accumulators, mr/lanes registers of A and at least one register of B.
+     *
+     * @param mr The rows of the register block, a multiple of the lanes of a q register, i.e. 4 for fp32 and 2 for fp64.
+     * @param dtype The data type of the matrices.
+     * @return The largest nr that fits into the 32 vector registers.
+     */
+    constexpr uint32_t br_matmul_mr_nr_k_max_nr(const uint32_t mr, const dtype_t dtype = dtype_t::fp32)
+    {
+      const uint32_t m_vectors = mr / get_dtype_lanes(dtype);
+      return (32 - 1 - m_vectors) / m_vectors;
+    }
+
+    /**
+     * @brief Generates a M x N x K batch-reduce matmul kernel with a configurable register block.
+     * The C block of mr x nr stays in registers over the batch and k loops.
+     * Rows and columns that do not fill a whole block are processed by smaller blocks at the end of each loop.
+     * Transposed operands are read and written in place. If at least two operands are transposed, the kernel computes C^T = B^T A^T
+     * instead, i.e. mr and nr then block the columns and rows of C.
+     * The kernel computes C = alpha * sum_i(A_i * B_i) + beta * C, C is not loaded for a beta of zero.
+     * The epilogue adds the bias and applies the activation before the accumulators are stored.
+     * A bias is passed as ninth argument after br_stride_b, i.e. on the stack.
+     * The blocks of the batch are either equally spaced by the strides or listed by pointers or offsets, see batch_reduce_t.
+     * A packed A or B is read strip by strip in the layout of packing_t, which requires a column-major A or a row-major B and C.
+     *
+     * @param kernel The kernel to add instructions to.
+     * @param mr The rows of the register block, a multiple of the lanes of a q register.
+     * @param nr The columns of the register block, at most br_matmul_mr_nr_k_max_nr(mr, dtype).
+     * @param m The rows of A and C.
+     * @param n The columns of B and C.
+     * @param k_loop The loops in the k dimensions.
+     * @param br_size number of batch dimensions.
+     * @param dtype The data type of the matrices.
+     * @param trans_a True if A is stored row-major, i.e. k has unit stride and lda is the stride of the rows.
+     * @param trans_b True if B is stored row-major, i.e. n has unit stride and ldb is the stride of k.
+     * @param trans_c True if C is stored row-major, i.e. n has unit stride and ldc is the stride of the rows.
+     * @param alpha The scaling of the product.
+     * @param beta The scaling of C, zero overwrites C.
+     * @param epilogue The bias and activation applied to the result.
+     * @param prefetch The software prefetches of A, B and the next C block.
+     * @param batch_reduce The location of the blocks of A and B, only a stride batch-reduce supports a bias.
+     * @param packing The packed operands, the strips of A and B have mr rows and nr columns.
+     */
+    void br_matmul_mr_nr_k(mini_jit::Kernel &kernel, const uint32_t mr, const uint32_t nr, const uint32_t m, const uint32_t n,
+                           const uint32_t k_loop, const uint32_t br_size, const dtype_t dtype = dtype_t::fp32, const bool trans_a = false,
+                           const bool trans_b = false, const bool trans_c = false, const double alpha = 1, const double beta = 1,
+                           const epilogue_t epilogue = {}, const prefetch_t prefetch = {},
+                           const batch_reduce_t batch_reduce = batch_reduce_t::stride, const packing_t packing = {});
+
+    /**
+     * @brief Patches the loop counts of a kernel generated by br_matmul_mr_nr_k in place.
+     * The patched kernel is identical to a kernel generated with the new loop counts, as long as the remaining rows and columns
+     * stay the same. The kernel must have been generated with at least one full block in m and n, a column-major A of the kernel
+     * and unpacked operands. If br_matmul_mr_nr_k swapped the operands, m_loop and n_loop count the blocks of C^T.
+     *
+     * @param kernel The kernel generated by br_matmul_mr_nr_k.
+     * @param m_loop The repetitions of the m block of size mr.
+     * @param n_loop The repetitions of the n block of size nr.
+     * @param k_loop The loops in the k dimensions.
+     * @param br_size number of batch dimensions.
+     */
+    void br_matmul_mr_nr_k_patch_loops(mini_jit::Kernel &kernel, const uint32_t m_loop, const uint32_t n_loop, const uint32_t k_loop,
+                                       const uint32_t br_size);
+
+  }     // namespace kernels
+}       // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BR_MATMUL_MR_NR_K_H
@@ -0,0 +1,300 @@
+#include "br_matmul_sve.h"
+#include "../Assembler.h"
+#include "../Kernel.h"
+#include "../arm_instructions/arm_all.h"
+#include <format>
+#include <string>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::dtype_t;
+
+  //! predicate with all elements active, used for the broadcasts of B
+  constexpr PPredicate p_all = p7;
+
+  /**
+   * Emits the blocks of the SVE kernel, the instructions of a data type only differ in their element size.
+   */
+  class SveBlockEmitter
+  {
+  private:
+    mini_jit::Assembler &assembler;
+    const uint32_t m_vectors;
+    const uint32_t k_loop;
+    const uint32_t br_size;
+    const bool is_fp64;
+    const uint32_t element_size;
+    const double beta;
+
+    //! number of emitted loops, makes the labels of each loop unique
+    uint32_t loop_count = 0;
+
+    std::string get_label(char const *name)
+    {
+      return std::format("{}_{}", name, loop_count++);
+    }
+
+    static ZScalable z(uint32_t index)
+    {
+      return static_cast<ZScalable>(index);
+    }
+
+    static PPredicate p(uint32_t index)
+    {
+      return static_cast<PPredicate>(index);
+    }
+
+    uint32_t whilelt_elements(PPredicate Pd, R64Bit Xn, R64Bit Xm)
+    {
+      return is_fp64 ? whilelt(Pd, td, Xn, Xm) : whilelt(Pd, ts, Xn, Xm);
+    }
+
+    uint32_t inc_elements(R64Bit Xdn, uint32_t multiplier)
+    {
+      return is_fp64 ? incd(Xdn, multiplier) : incw(Xdn, multiplier);
+    }
+
+    uint32_t ld1_elements(ZScalable Zt, PPredicate Pg, R64Bit Xn, int32_t imm)
+    {
+      return is_fp64 ? ld1d(Zt, td, Pg, Xn, imm) : ld1w(Zt, ts, Pg, Xn, imm);
+    }
+
+    uint32_t st1_elements(ZScalable Zt, PPredicate Pg, R64Bit Xn, int32_t imm)
+    {
+      return is_fp64 ? st1d(Zt, td, Pg, Xn, imm) : st1w(Zt, ts, Pg, Xn, imm);
+    }
+
+    /**
+     * Emits the predicates p1 to p<m_vectors-1> of the vectors behind the first one, whose predicate p0 is already set.
+     * The row of vector v is x16 + v times the elements of a vector, x14 is used as temporary.
+     */
+    void add_row_predicates()
+    {
+      for (uint32_t v = 1; v < m_vectors; ++v)
+      {
+        assembler.add({
+          mov(x14, x16),                     // mov x14, x16
+          inc_elements(x14, v),              // incw/incd x14, all, mul #v
+          whilelt_elements(p(v), x14, x20),  // whilelt p<v>, x14, x20 // rows of vector v
+        });
+      }
+    }
+
+  public:
+    SveBlockEmitter(mini_jit::Assembler &assembler, uint32_t m_vectors, uint32_t k_loop, uint32_t br_size, dtype_t dtype, double beta)
+        : assembler(assembler), m_vectors(m_vectors), k_loop(k_loop), br_size(br_size), is_fp64(dtype == dtype_t::fp64),
+          element_size(mini_jit::kernels::get_dtype_size(dtype)), beta(beta)
+    {
+    }
+
+    /**
+     * Emits the loop over the M blocks of the current N block with cols columns.
+     * x9 points to the N block of B and x10 to the N block of C, x20 holds m.
+     * Each iteration advances by m_vectors vectors of rows and stops once the first row of the next block is behind m.
+     */
+    void add_m_pass(uint32_t cols)
+    {
+      const uint32_t a_register = m_vectors * cols;
+      const uint32_t b_register = a_register + m_vectors;
+      const uint32_t b_registers = 32 - b_register;
+      auto acc = [this](uint32_t v, uint32_t j) { return z(v + j * m_vectors); };
+
+      release_assert(b_registers >= 1, "The block does not fit into the vector registers.");
+
+      assembler.add({
+        mov(x8, x0),                     // mov x8, x0 // a of the current M block
+        mov(x2, x10),                    // mov x2, x10 // c of the current M block
+        mov(x16, 0u),                    // mov x16, #0 // first row of the current M block
+        whilelt_elements(p0, x16, x20),  // whilelt p0, x16, x20 // rows of the first vector
+      });
+
+      std::string m_label = get_label("matmul_loop_over_M");
+      assembler.label(m_label);
+      add_row_predicates();
+
+      // Initialize the accumulators with the C block or zero
+      if (beta != 0)
+      {
+        assembler.add(mov(x14, x2));  // mov x14, x2 // first column of c
+      }
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t v = 0; v < m_vectors; ++v)
+        {
+          if (beta != 0)
+          {
+            assembler.add(ld1_elements(acc(v, j), p(v), x14, v));  // ld1w/ld1d {z<acc>}, p<v>/z, [x14, #v, mul vl]
+          }
+          else
+          {
+            assembler.add(is_fp64 ? dup(acc(v, j), td, 0) : dup(acc(v, j), ts, 0));  // mov z<acc>, #0
+          }
+        }
+        if (beta != 0 && j + 1 < cols)
+        {
+          assembler.add(add(x14, x14, x5));  // add x14, x14, x5 // next column of c
+        }
+      }
+
+      assembler.add({
+        mov(x11, x8),       // mov x11, x8 // a of the current batch
+        mov(x12, x9),       // mov x12, x9 // b of the current batch
+        mov(x19, br_size),  // mov x19, #br_size // x19 iterator for the batch dimension
+      });
+
+      std::string batch_label = get_label("matmul_loop_batch_dimension");
+      assembler.label(batch_label);
+      assembler.add({
+        mov(x13, x11),     // mov x13, x11 // current column of a
+        mov(x1, x12),      // mov x1, x12 // current row of b
+        mov(x15, k_loop),  // mov x15, #k_loop // x15 iterator for K loop
+      });
+
+      std::string k_label = get_label("matmul_loop_over_K");
+      assembler.label(k_label);
+      for (uint32_t v = 0; v < m_vectors; ++v)
+      {
+        assembler.add(ld1_elements(z(a_register + v), p(v), x13, v));  // ld1w/ld1d {z<a_v>}, p<v>/z, [x13, #v, mul vl]
+      }
+
+      assembler.add(mov(x14, x1));  // mov x14, x1 // first column of b
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        // The broadcasts rotate through the free registers to hide their latency
+        const ZScalable b = z(b_register + j % b_registers);
+        assembler.add(is_fp64 ? ld1rd(b, td, p_all, x14) : ld1rw(b, ts, p_all, x14));  // ld1rw/ld1rd {z<b>}, p7/z, [x14]
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x14, x14, x4));  // add x14, x14, x4 // next column of b
+        }
+        for (uint32_t v = 0; v < m_vectors; ++v)
+        {
+          // Inactive rows keep their value and are never stored
+          const ZScalable a = z(a_register + v);
+          assembler.add(is_fp64 ? fmla(acc(v, j), td, p(v), a, b) : fmla(acc(v, j), ts, p(v), a, b));  // fmla z<acc>, p<v>/m, z<a_v>, z<b>
+        }
+      }
+
+      assembler.add({
+        add(x13, x13, x3),          // add x13, x13, x3 // next column of a
+        add(x1, x1, element_size),  // add x1, x1, #element_size // next row of b
+        sub(x15, x15, 1),           // sub x15, x15, #1
+      });
+      assembler.add(cbnz(x15, 0), k_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x15, matmul_loop_over_K
+
+      assembler.add({
+        add(x11, x11, x6),  // add x11, x11, x6 // next batch of a
+        add(x12, x12, x7),  // add x12, x12, x7 // next batch of b
+        sub(x19, x19, 1),   // sub x19, x19, #1
+      });
+      assembler.add(cbnz(x19, 0), batch_label, mini_jit::Assembler::relocation_t::imm19);  // cbnz x19, matmul_loop_batch_dimension
+
+      // Store the accumulators back to the C block, the predicates mask the rows behind m
+      assembler.add(mov(x14, x2));  // mov x14, x2 // first column of c
+      for (uint32_t j = 0; j < cols; ++j)
+      {
+        for (uint32_t v = 0; v < m_vectors; ++v)
+        {
+          assembler.add(st1_elements(acc(v, j), p(v), x14, v));  // st1w/st1d {z<acc>}, p<v>, [x14, #v, mul vl]
+        }
+        if (j + 1 < cols)
+        {
+          assembler.add(add(x14, x14, x5));  // add x14, x14, x5 // next column of c
+        }
+      }
+
+      const int32_t vectors = static_cast<int32_t>(m_vectors);
+      assembler.add({
+        addvl(x8, x8, vectors),          // addvl x8, x8, #m_vectors // next M block of a
+        addvl(x2, x2, vectors),          // addvl x2, x2, #m_vectors // next M block of c
+        inc_elements(x16, m_vectors),    // incw/incd x16, all, mul #m_vectors // first row of the next M block
+        whilelt_elements(p0, x16, x20),  // whilelt p0, x16, x20 // rows of the first vector
+      });
+      assembler.add(b(Condition::first, 0), m_label, mini_jit::Assembler::relocation_t::imm19);  // b.first matmul_loop_over_M
+    }
+  };
+}  // namespace
+
+void mini_jit::kernels::br_matmul_sve(mini_jit::Kernel &kernel, const uint32_t m_vectors, const uint32_t nr, const uint32_t m,
+                                      const uint32_t n, const uint32_t k_loop, const uint32_t br_size, const dtype_t dtype,
+                                      const double beta)
+{
+  using namespace mini_jit::arm_instructions;
+
+  release_assert(m_vectors != 0 && m_vectors <= 7, "The rows of the register block must be one to seven vectors.");
+  release_assert(nr != 0 && nr <= br_matmul_sve_max_nr(m_vectors), "The register block does not fit into the vector registers.");
+  release_assert(m != 0, "Cannot proccess matrix with m of 0.");
+  release_assert(n != 0, "Cannot proccess matrix with n of 0.");
+  release_assert(k_loop != 0, "Cannot proccess matrix with k loop of 0.");
+  release_assert(br_size != 0, "Cannot proccess batch dimension of 0.");
+  release_assert(beta == 0 || beta == 1, "The SVE kernel only supports a beta of zero or one.");
+
+  const uint32_t shift = get_dtype_shift(dtype);
+  const uint32_t n_loop = n / nr;
+  const uint32_t n_rest = n % nr;
+
+  Assembler assembler(kernel);
+  SveBlockEmitter emitter(assembler, m_vectors, k_loop, br_size, dtype, beta);
+
+  assembler.add({
+    // Procedural Call Standard
+    // save callee-saved registers, the lower 64 bits of z8 to z15 are the d registers
+    stpPre(x19, x20, sp, -16),  // stp x19, x20, [sp, #-16]!
+    stpPre(d8, d9, sp, -16),    // stp  d8,  d9, [sp, #-16]!
+    stpPre(d10, d11, sp, -16),  // stp d10, d11, [sp, #-16]!
+    stpPre(d12, d13, sp, -16),  // stp d12, d13, [sp, #-16]!
+    stpPre(d14, d15, sp, -16),  // stp d14, d15, [sp, #-16]!
+
+    // Offset the used leading dimension by the size of the elements
+    lsl(x3, x3, shift),  // lsl x3, x3, #shift // x3 * sizeof(element)
+    lsl(x4, x4, shift),  // lsl x4, x4, #shift // x4 * sizeof(element)
+    lsl(x5, x5, shift),  // lsl x5, x5, #shift // x5 * sizeof(element)
+    lsl(x6, x6, shift),  // lsl x6, x6, #shift // x6 * sizeof(element)
+    lsl(x7, x7, shift),  // lsl x7, x7, #shift // x7 * sizeof(element)
+
+    mov(x9, x1),                                                   // mov x9, x1 // b of the current N block
+    mov(x10, x2),                                                  // mov x10, x2 // c of the current N block
+    mov(x20, m),                                                   // mov x20, #m // rows of a and c, the bound of the predicates
+    dtype == dtype_t::fp64 ? ptrue(p_all, td) : ptrue(p_all, ts),  // ptrue p7
+  });
+
+  if (n_loop > 0)
+  {
+    assembler.add(mov(x17, n_loop));  // mov x17, #n_loop // x17 iterator for N loop
+    assembler.label("matmul_loop_over_N");
+
+    emitter.add_m_pass(nr);
+
+    assembler.add({
+      mov(x14, nr),             // mov x14, #nr
+      madd(x9, x4, x14, x9),    // madd x9, x4, x14, x9 // next N block of b
+      madd(x10, x5, x14, x10),  // madd x10, x5, x14, x10 // next N block of c
+      sub(x17, x17, 1),         // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "matmul_loop_over_N", Assembler::relocation_t::imm19);  // cbnz x17, matmul_loop_over_N
+  }
+
+  if (n_rest > 0)
+  {
+    emitter.add_m_pass(n_rest);
+  }
+
+  assembler.add({
+    // Procedural Call Standard
+    // restore callee-saved registers
+    ldpPost(d14, d15, sp, 16),  // ldp d14, d15, [sp], #16
+    ldpPost(d12, d13, sp, 16),  // ldp d12, d13, [sp], #16
+    ldpPost(d10, d11, sp, 16),  // ldp d10, d11, [sp], #16
+    ldpPost(d8, d9, sp, 16),    // ldp  d8,  d9, [sp], #16
+    ldpPost(x19, x20, sp, 16),  // ldp x19, x20, [sp], #16
+
+    ret()  // ret
+  });
+
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("br_matmul_sve.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
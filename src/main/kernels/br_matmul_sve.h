@@ -0,0 +1,53 @@
+#ifndef MINI_JIT_KERNELS_BR_MATMUL_SVE_H
+#define MINI_JIT_KERNELS_BR_MATMUL_SVE_H
+
+#include "../Kernel.h"
+#include "dtype.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    //! vectors of the rows of the default register block of the SVE kernel
+    constexpr uint32_t br_matmul_sve_default_m_vectors = 3;
+
+    //! columns of the default register block of the SVE kernel
+    constexpr uint32_t br_matmul_sve_default_nr = 8;
+
+    /**
+     * @brief Gets the largest number of columns of an SVE register block with m_vectors vectors of rows.
+     * A block holds m_vectors * nr accumulators, m_vectors registers of A and at least one register of B.
+     *
+     * @param m_vectors The vectors of rows of the register block.
+     * @return The largest nr that fits into the 32 scalable vector registers.
+     */
+    constexpr uint32_t br_matmul_sve_max_nr(const uint32_t m_vectors)
+    {
+      return (32 - 1 - m_vectors) / m_vectors;
+    }
+
+    /**
+     * @brief Generates a vector-length agnostic M x N x K batch-reduce matmul kernel with the Scalable Vector Extension.
+     * The register block holds m_vectors vectors of rows times nr columns, i.e. its rows scale with the vector length of the machine.
+     * The rows of the last M block are masked by whilelt predicates, hence no remainder code is needed for the rows.
+     * Columns that do not fill a whole block are processed by a smaller block at the end of the N loop.
+     * The kernel computes C = sum_i(A_i * B_i) + beta * C for column-major matrices whose blocks are equally spaced by the strides.
+     *
+     * @param kernel The kernel to add instructions to.
+     * @param m_vectors The vectors of rows of the register block.
+     * @param nr The columns of the register block, at most br_matmul_sve_max_nr(m_vectors).
+     * @param m The rows of A and C.
+     * @param n The columns of B and C.
+     * @param k_loop The loops in the k dimensions.
+     * @param br_size number of batch dimensions.
+     * @param dtype The data type of the matrices.
+     * @param beta The scaling of C, either 0 to overwrite C or 1 to accumulate into C.
+     */
+    void br_matmul_sve(mini_jit::Kernel &kernel, const uint32_t m_vectors, const uint32_t nr, const uint32_t m, const uint32_t n,
+                       const uint32_t k_loop, const uint32_t br_size, const dtype_t dtype = dtype_t::fp32, const double beta = 1);
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_BR_MATMUL_SVE_H
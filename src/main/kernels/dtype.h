@@ -0,0 +1,63 @@
+#ifndef MINI_JIT_KERNELS_DTYPE_H
+#define MINI_JIT_KERNELS_DTYPE_H
+
+#include "../release_assert.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /// data type of the elements a kernel operates on
+    enum class dtype_t : uint32_t
+    {
+      fp32 = 0,
+      fp64 = 1
+    };
+
+    /**
+     * @brief Gets the size of a single element of the data type.
+     *
+     * @param dtype The data type of the elements.
+     * @return The size of an element in bytes.
+     */
+    constexpr uint32_t get_dtype_size(const dtype_t dtype)
+    {
+      switch (dtype)
+      {
+      case dtype_t::fp32:
+        return 4;
+      case dtype_t::fp64:
+        return 8;
+      default:
+        release_assert(false, "Found unhandled dtype_t.");
+        return 0;
+      }
+    }
+
+    /**
+     * @brief Gets the shift that converts a number of elements into a number of bytes.
+     *
+     * @param dtype The data type of the elements.
+     * @return log2 of the size of an element.
+     */
+    constexpr uint32_t get_dtype_shift(const dtype_t dtype)
+    {
+      return dtype == dtype_t::fp64 ? 3 : 2;
+    }
+
+    /**
+     * @brief Gets the number of elements that fit into a 128 bit vector register.
+     *
+     * @param dtype The data type of the elements.
+     * @return The number of lanes of a q register.
+     */
+    constexpr uint32_t get_dtype_lanes(const dtype_t dtype)
+    {
+      return 16 / get_dtype_size(dtype);
+    }
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_DTYPE_H
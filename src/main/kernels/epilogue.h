@@ -0,0 +1,66 @@
+#ifndef MINI_JIT_KERNELS_EPILOGUE_H
+#define MINI_JIT_KERNELS_EPILOGUE_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /// bias that is added to the result of a matmul before it is stored
+    enum class bias_t : uint32_t
+    {
+      none = 0,
+      row = 1,     //!< one value per row of C, i.e. a vector of m elements
+      column = 2,  //!< one value per column of C, i.e. a vector of n elements
+    };
+
+    /// activation that is applied to the result of a matmul before it is stored
+    enum class activation_t : uint32_t
+    {
+      none = 0,
+      relu = 1,   //!< max(x, 0)
+      clamp = 2,  //!< min(max(x, clamp_min), clamp_max)
+    };
+
+    /// conversion of the 32-bit integer accumulators of the int8 kernels before they are stored
+    enum class requantize_t : uint32_t
+    {
+      none = 0,
+      s8 = 1,  //!< saturate_s8(round(scale * x + zero_point)) in single precision, rounding to nearest with ties to even
+    };
+
+    /**
+     * Operations that are applied to the accumulators of a matmul while they are still in the registers.
+     * The bias is added after the scaling by alpha and beta, the activation is applied last.
+     */
+    struct epilogue_t
+    {
+      //! bias added to the result
+      bias_t bias = bias_t::none;
+
+      //! activation applied after the bias
+      activation_t activation = activation_t::none;
+
+      //! lower bound of the clamp activation
+      double clamp_min = 0;
+
+      //! upper bound of the clamp activation
+      double clamp_max = 0;
+
+      //! requantization of the int8 kernels, which stores C as int8 instead of int32
+      requantize_t requantize = requantize_t::none;
+
+      //! scale of the requantization
+      double scale = 1;
+
+      //! zero point of the requantization
+      int32_t zero_point = 0;
+
+      bool operator==(epilogue_t const &) const = default;
+    };
+
+  }     // namespace kernels
+}       // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_EPILOGUE_H
@@ -3,18 +3,6 @@
 
 #include "matmul_16_6_1.h"
 #include "matmul_16_6_k.h"
-#include "matmul_16mRest_4n_k.h"
-#include "matmul_16mRest_lt4nRest_k.h"
-#include "matmul_16m_4n_k.h"
-#include "matmul_16m_lt4nRest_k.h"
-#include "matmul_lt16_4n_k.h"
-#include "matmul_lt16_lt4nRest_k.h"
-
-#include "br_matmul_16mRest_4n_k.h"
-#include "br_matmul_16mRest_lt4nRest_k.h"
-#include "br_matmul_16m_4n_k.h"
-#include "br_matmul_16m_lt4nRest_k.h"
-#include "br_matmul_lt16_4n_k.h"
-#include "br_matmul_lt16_lt4nRest_k.h"
+#include "br_matmul_mr_nr_k.h"
 
 #endif  // MINI_JIT_KERNELS_MATMULS_ALL_H
\ No newline at end of file
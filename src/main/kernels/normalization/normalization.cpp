@@ -0,0 +1,484 @@
+#include "normalization.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+#include "../row_piece.h"
+#include "../unary/activation_chain.h"
+#include <limits>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using namespace mini_jit::kernels::activation;
+  using mini_jit::kernels::normalization_t;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::unary_activation_t;
+
+  //! first of the eight registers that hold a block of the column
+  constexpr uint32_t first_a = 20;
+
+  //! temporaries of the maximum of a softmax block, the exponentials only use the first three temporaries of the chains
+  constexpr uint32_t max_temporaries[] = {5, 6, 7, 11};
+
+  /**
+   * @brief Loads the elements of a partial register and fills the lanes behind them with the lane of a constant.
+   * The lanes are inserted with x14 as temporary for their addresses.
+   *
+   * @param vRegister The register that is loaded.
+   * @param base The register holding the address of the first element.
+   * @param elements The number of elements, less than four.
+   * @param fill The lane whose value fills the register.
+   * @return The instructions.
+   */
+  std::vector<uint32_t> load_filled(const uint32_t vRegister, const R64Bit base, const uint32_t elements, const lane_t fill)
+  {
+    std::vector<uint32_t> instructions = {
+      dup(static_cast<VGeneral>(vRegister), t4s, fill.reg, fill.index),  // dup v<v>.4s, v<fill>.s[i]
+    };
+    for (uint32_t lane = 0; lane < elements; ++lane)
+    {
+      instructions.push_back(add(x14, base, lane * 4));                        // add x14, base, #lane*4
+      instructions.push_back(ld1(static_cast<V32Bit>(vRegister), lane, x14));  // ld1 {v<v>.s}[lane], [x14]
+    }
+    return instructions;
+  }
+
+  /**
+   * @brief Loads the rest of a column that does not fill a block into the registers from v20 upwards, the x10 is incremented by the
+   * whole q registers.
+   *
+   * @param assembler The assembler to add the instructions to.
+   * @param elements The number of elements of the rest.
+   * @param fill The lane that fills a partial register, i.e. a value which does not change the statistics.
+   * @return The number of loaded registers.
+   */
+  uint32_t add_load_rest(mini_jit::Assembler &assembler, const uint32_t elements, const lane_t fill)
+  {
+    for (uint32_t i = 0; i < elements / 4; ++i)
+    {
+      assembler.add(ldrPost(static_cast<V128Bit>(first_a + i), x10, 16));  // ldr q<a>, [x10], #16
+    }
+    if (elements % 4 != 0)
+    {
+      assembler.add(load_filled(first_a + elements / 4, x10, elements % 4, fill));  // x14 holds the addresses of lanes
+    }
+    return (elements + 3) / 4;
+  }
+
+  /**
+   * Generates the softmax of the columns, the exponentials of v0 and v1 are evaluated by two independent chains.
+   */
+  class Softmax
+  {
+  public:
+    explicit Softmax(Constants &constants)
+        : chain_0(Chain(constants, 0, 2).generate(unary_activation_t::exp)),
+          chain_1(Chain(constants, 1, 8).generate(unary_activation_t::exp)),
+          lowest(constants.lane(std::numeric_limits<float>::lowest())), one(constants.broadcast(1.0f))
+    {
+    }
+
+    /**
+     * Computes the maximum of the column in all lanes of v18 and the reciprocal of the sum of the exponentials in all lanes of v19.
+     */
+    void add_statistics(mini_jit::Assembler &assembler, const uint32_t m)
+    {
+      // The lowest float instead of -inf keeps the difference of two maxima finite
+      assembler.add({
+        mov(x10, x8),                                     // current row of a
+        dup(v18, t4s, lowest.reg, lowest.index),          // dup v18.4s, lowest
+        eor(v19, t16b, v19, t16b, v19, t16b),             // eor v19.16b, v19.16b, v19.16b
+      });
+      if (m / 32 > 0)
+      {
+        assembler.add(mov(x17, m / 32));  // x17 iterator for the m loop
+        assembler.label("normalization_statistics_loop_over_M");
+        assembler.add({
+          ld1Post(v20, t4s, v21, t4s, v22, t4s, v23, t4s, x10, 64),  // ld1 {v20.4s-v23.4s}, [x10], #64
+          ld1Post(v24, t4s, v25, t4s, v26, t4s, v27, t4s, x10, 64),  // ld1 {v24.4s-v27.4s}, [x10], #64
+        });
+        add_block(assembler, 8);
+        assembler.add(sub(x17, x17, 1));  // sub x17, x17, #1
+        assembler.add(cbnz(x17, 0), "normalization_statistics_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+      if (m % 32 != 0)
+      {
+        add_block(assembler, add_load_rest(assembler, m % 32, lowest));
+      }
+
+      // Rescales the sums of the lanes to the maximum of the column
+      assembler.add({
+        fmaxp(v5, t4s, v18, t4s, v18, t4s),  // fmaxp v5.4s, v18.4s, v18.4s
+        fmaxp(s5, v5, t2s),                  // fmaxp s5, v5.2s
+        dup(v5, t4s, v5, 0),                 // dup v5.4s, v5.s[0]
+        fsub(v0, t4s, v18, t4s, v5, t4s),    // fsub v0.4s, v18.4s, v5.4s
+        dup(v18, t4s, v5, 0),                // dup v18.4s, v5.s[0]
+      });
+      assembler.add(chain_0);
+      assembler.add({
+        fmul(v19, t4s, v19, t4s, v0, t4s),    // fmul v19.4s, v19.4s, v0.4s
+        faddp(v19, t4s, v19, t4s, v19, t4s),  // faddp v19.4s, v19.4s, v19.4s
+        faddp(s19, v19, t2s),                 // faddp s19, v19.2s
+        dup(v19, t4s, v19, 0),                // dup v19.4s, v19.s[0]
+        fdiv(v19, t4s, one, t4s, v19, t4s),   // fdiv v19.4s, one.4s, v19.4s
+      });
+    }
+
+    /**
+     * Writes exp(x - v18) * v19 for the elements x of the column.
+     */
+    void add_normalize(mini_jit::Assembler &assembler, const uint32_t m)
+    {
+      assembler.add({
+        mov(x10, x8),  // current row of a
+        mov(x11, x9),  // current row of b
+      });
+      if (m / 8 > 0)
+      {
+        assembler.add(mov(x17, m / 8));  // x17 iterator for the m loop
+        assembler.label("normalization_loop_over_M");
+        assembler.add({
+          ld1Post(v0, t4s, v1, t4s, x10, 16 * 2),  // ld1 {v0.4s, v1.4s}, [x10], #32
+          fsub(v0, t4s, v0, t4s, v18, t4s),        // fsub v0.4s, v0.4s, v18.4s
+          fsub(v1, t4s, v1, t4s, v18, t4s),        // fsub v1.4s, v1.4s, v18.4s
+        });
+        assembler.add(interleave(chain_0, chain_1));
+        assembler.add({
+          fmul(v0, t4s, v0, t4s, v19, t4s),        // fmul v0.4s, v0.4s, v19.4s
+          fmul(v1, t4s, v1, t4s, v19, t4s),        // fmul v1.4s, v1.4s, v19.4s
+          st1Post(v0, t4s, v1, t4s, x11, 16 * 2),  // st1 {v0.4s, v1.4s}, [x11], #32
+          sub(x17, x17, 1),                        // sub x17, x17, #1
+        });
+        assembler.add(cbnz(x17, 0), "normalization_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+
+      // Four of the rest in a q register, the remaining elements in a single partial register
+      const uint32_t m_rest = m % 8;
+      if (m_rest >= 4)
+      {
+        assembler.add({
+          ldrPost(q0, x10, 16),               // ldr q0, [x10], #16
+          fsub(v0, t4s, v0, t4s, v18, t4s),  // fsub v0.4s, v0.4s, v18.4s
+        });
+        assembler.add(chain_0);
+        assembler.add({
+          fmul(v0, t4s, v0, t4s, v19, t4s),  // fmul v0.4s, v0.4s, v19.4s
+          strPost(q0, x11, 16),              // str q0, [x11], #16
+        });
+      }
+      if (m_rest % 4 != 0)
+      {
+        const row_piece_t piece = {0, m_rest % 4 * 4};
+        assembler.add(load_piece(0, x10, piece));                      // x14 holds the addresses of inserted lanes
+        assembler.add(fsub(v0, t4s, v0, t4s, v18, t4s));              // fsub v0.4s, v0.4s, v18.4s
+        assembler.add(chain_0);
+        assembler.add(fmul(v0, t4s, v0, t4s, v19, t4s));              // fmul v0.4s, v0.4s, v19.4s
+        assembler.add(store_piece(0, x11, piece));
+      }
+    }
+
+  private:
+    std::vector<uint32_t> chain_0;
+    std::vector<uint32_t> chain_1;
+    lane_t lowest;
+    VGeneral one;
+
+    /**
+     * Updates the maximum and the sum of the lanes by a block in the registers [v20, v20 + count).
+     * The sum is rescaled by exp(old maximum - new maximum) which is evaluated together with the exponentials of the block.
+     */
+    void add_block(mini_jit::Assembler &assembler, const uint32_t count)
+    {
+      // Maximum of the block as a tree, the first level writes the temporaries
+      std::vector<uint32_t> maxima;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        maxima.push_back(first_a + i);
+      }
+      while (maxima.size() > 1)
+      {
+        std::vector<uint32_t> next;
+        for (size_t i = 0; i + 1 < maxima.size(); i += 2)
+        {
+          const uint32_t d = maxima[i] < first_a ? maxima[i] : max_temporaries[i / 2];
+          assembler.add(fmax(static_cast<VGeneral>(d), t4s, static_cast<VGeneral>(maxima[i]), t4s, static_cast<VGeneral>(maxima[i + 1]),
+                             t4s));  // fmax v<d>.4s, v<i>.4s, v<i+1>.4s
+          next.push_back(d);
+        }
+        if (maxima.size() % 2 != 0)
+        {
+          next.push_back(maxima.back());
+        }
+        maxima = next;
+      }
+
+      const VGeneral block_max = static_cast<VGeneral>(maxima[0]);
+      assembler.add({
+        fmax(v5, t4s, v18, t4s, block_max, t4s),  // fmax v5.4s, v18.4s, block_max.4s
+        fsub(v0, t4s, v18, t4s, v5, t4s),         // fsub v0.4s, v18.4s, v5.4s
+        fmax(v18, t4s, v18, t4s, v5, t4s),        // fmax v18.4s, v18.4s, v5.4s
+      });
+
+      // The exponentials of the rescale and of the block in pairs of v0 and v1, the rescale is the first argument in v0
+      for (uint32_t i = 0; i <= count; i += 2)
+      {
+        const bool isPair = i + 1 <= count;
+        if (i > 0)
+        {
+          assembler.add(fsub(v0, t4s, static_cast<VGeneral>(first_a + i - 1), t4s, v18, t4s));  // fsub v0.4s, v<a>.4s, v18.4s
+        }
+        if (isPair)
+        {
+          assembler.add(fsub(v1, t4s, static_cast<VGeneral>(first_a + i), t4s, v18, t4s));  // fsub v1.4s, v<a>.4s, v18.4s
+          assembler.add(interleave(chain_0, chain_1));
+        }
+        else
+        {
+          assembler.add(chain_0);
+        }
+
+        assembler.add(i == 0 ? fmul(v19, t4s, v19, t4s, v0, t4s)    // fmul v19.4s, v19.4s, v0.4s
+                             : fadd(v19, t4s, v19, t4s, v0, t4s));  // fadd v19.4s, v19.4s, v0.4s
+        if (isPair)
+        {
+          assembler.add(fadd(v19, t4s, v19, t4s, v1, t4s));  // fadd v19.4s, v19.4s, v1.4s
+        }
+      }
+    }
+  };
+
+  /**
+   * Generates the layer norm and the rms norm of the columns, the sums of a block of 16 elements are accumulated in v0-v3 and the sums
+   * of the squares in v4-v7.
+   */
+  class Norm
+  {
+  public:
+    Norm(Constants &constants, const normalization_t normalization, const uint32_t m, const float epsilon)
+        : isLayerNorm(normalization == normalization_t::layer_norm), reciprocal_m(constants.lane(1.0f / static_cast<float>(m))),
+          zero_lane(constants.lane(0.0f)), zero(constants.broadcast(0.0f)), one(constants.broadcast(1.0f)),
+          offset(constants.broadcast(epsilon))
+    {
+    }
+
+    /**
+     * Computes the shift of a layer norm in all lanes of v18, the mean of the shifted column in all lanes of v24 and the reciprocal
+     * deviation in all lanes of v19.
+     */
+    void add_statistics(mini_jit::Assembler &assembler, const uint32_t m)
+    {
+      assembler.add(mov(x10, x8));  // current row of a
+      for (uint32_t i = 0; i < 8; ++i)
+      {
+        const VGeneral v = static_cast<VGeneral>(i);
+        assembler.add(eor(v, t16b, v, t16b, v, t16b));  // eor v<i>.16b, v<i>.16b, v<i>.16b
+      }
+
+      // The first element of the column is the shift of a layer norm, the rms norm fills a partial register with zeros
+      lane_t fill = zero_lane;
+      if (isLayerNorm)
+      {
+        assembler.add({
+          ldr(s18, x8),          // ldr s18, [x8]
+          dup(v18, t4s, v18, 0),  // dup v18.4s, v18.s[0]
+        });
+        fill = lane_t{v18, 0};
+      }
+
+      if (m / 16 > 0)
+      {
+        assembler.add(mov(x17, m / 16));  // x17 iterator for the m loop
+        assembler.label("normalization_statistics_loop_over_M");
+        assembler.add(ld1Post(v20, t4s, v21, t4s, v22, t4s, v23, t4s, x10, 64));  // ld1 {v20.4s-v23.4s}, [x10], #64
+        add_accumulate(assembler, 0, 4);
+        assembler.add(sub(x17, x17, 1));  // sub x17, x17, #1
+        assembler.add(cbnz(x17, 0), "normalization_statistics_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+      if (m % 16 != 0)
+      {
+        add_accumulate(assembler, 0, add_load_rest(assembler, m % 16, fill));
+      }
+
+      // Combine the accumulators and their lanes, the first lanes hold the sums of x and x^2 divided by m
+      assembler.add({
+        fadd(v0, t4s, v0, t4s, v1, t4s),                               // fadd v0.4s, v0.4s, v1.4s
+        fadd(v2, t4s, v2, t4s, v3, t4s),                               // fadd v2.4s, v2.4s, v3.4s
+        fadd(v4, t4s, v4, t4s, v5, t4s),                               // fadd v4.4s, v4.4s, v5.4s
+        fadd(v6, t4s, v6, t4s, v7, t4s),                               // fadd v6.4s, v6.4s, v7.4s
+        fadd(v0, t4s, v0, t4s, v2, t4s),                               // fadd v0.4s, v0.4s, v2.4s
+        fadd(v4, t4s, v4, t4s, v6, t4s),                               // fadd v4.4s, v4.4s, v6.4s
+        faddp(v0, t4s, v0, t4s, v4, t4s),                              // faddp v0.4s, v0.4s, v4.4s
+        faddp(v0, t4s, v0, t4s, v0, t4s),                              // faddp v0.4s, v0.4s, v0.4s
+        fmul(v0, t4s, v0, t4s, reciprocal_m.reg, reciprocal_m.index),  // fmul v0.4s, v0.4s, 1/m
+        dup(v4, t4s, v0, 1),                                           // dup v4.4s, v0.s[1]
+      });
+      if (isLayerNorm)
+      {
+        assembler.add({
+          dup(v0, t4s, v0, 0),                // dup v0.4s, v0.s[0]
+          fmls(v4, t4s, v0, t4s, v0, t4s),    // fmls v4.4s, v0.4s, v0.4s
+          fmax(v4, t4s, v4, t4s, zero, t4s),  // fmax v4.4s, v4.4s, 0
+          dup(v24, t4s, v0, 0),               // dup v24.4s, v0.s[0]
+        });
+      }
+      assembler.add({
+        fadd(v4, t4s, v4, t4s, offset, t4s),  // fadd v4.4s, v4.4s, epsilon
+        fsqrt(v4, t4s, v4, t4s),               // fsqrt v4.4s, v4.4s
+        fdiv(v19, t4s, one, t4s, v4, t4s),     // fdiv v19.4s, one.4s, v4.4s
+      });
+    }
+
+    /**
+     * Writes ((x - v18) - v24) * v19 of a layer norm or x * v19 of a rms norm for the elements x of the column.
+     * The shift is subtracted first, i.e. x - K is exact for the elements close to K and the mean is not rounded to the magnitude of x.
+     */
+    void add_normalize(mini_jit::Assembler &assembler, const uint32_t m)
+    {
+      assembler.add({
+        mov(x10, x8),  // current row of a
+        mov(x11, x9),  // current row of b
+      });
+      if (m / 16 > 0)
+      {
+        assembler.add(mov(x17, m / 16));  // x17 iterator for the m loop
+        assembler.label("normalization_loop_over_M");
+        assembler.add(ld1Post(v20, t4s, v21, t4s, v22, t4s, v23, t4s, x10, 64));  // ld1 {v20.4s-v23.4s}, [x10], #64
+        add_scale(assembler, 4);
+        assembler.add(st1Post(v20, t4s, v21, t4s, v22, t4s, v23, t4s, x11, 64));  // st1 {v20.4s-v23.4s}, [x11], #64
+        assembler.add(sub(x17, x17, 1));                                           // sub x17, x17, #1
+        assembler.add(cbnz(x17, 0), "normalization_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+
+      // The rest as q registers followed by a single partial register
+      const std::vector<row_piece_t> pieces = mini_jit::kernels::get_row_pieces(m % 16, 4);
+      for (uint32_t i = 0; i < pieces.size(); ++i)
+      {
+        assembler.add(load_piece(first_a + i, x10, pieces[i]));  // x14 holds the addresses of inserted lanes
+      }
+      add_scale(assembler, pieces.size());
+      for (uint32_t i = 0; i < pieces.size(); ++i)
+      {
+        assembler.add(store_piece(first_a + i, x11, pieces[i]));
+      }
+    }
+
+  private:
+    bool isLayerNorm;
+    lane_t reciprocal_m;
+    lane_t zero_lane;
+    VGeneral zero;
+    VGeneral one;
+    VGeneral offset;
+
+    /**
+     * Adds the registers [v20, v20 + count) to the accumulators from v<first> and their squares to the accumulators from v<first + 4>.
+     * The shift of a layer norm is subtracted first.
+     */
+    void add_accumulate(mini_jit::Assembler &assembler, const uint32_t first, const uint32_t count)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        const VGeneral a = static_cast<VGeneral>(first_a + i);
+        const VGeneral sum = static_cast<VGeneral>(first + i);
+        const VGeneral squares = static_cast<VGeneral>(first + i + 4);
+        if (isLayerNorm)
+        {
+          assembler.add({
+            fsub(a, t4s, a, t4s, v18, t4s),    // fsub v<a>.4s, v<a>.4s, v18.4s
+            fadd(sum, t4s, sum, t4s, a, t4s),  // fadd v<sum>.4s, v<sum>.4s, v<a>.4s
+          });
+        }
+        assembler.add(fmla(squares, t4s, a, t4s, a, t4s));  // fmla v<squares>.4s, v<a>.4s, v<a>.4s
+      }
+    }
+
+    /**
+     * Normalizes the registers [v20, v20 + count).
+     */
+    void add_scale(mini_jit::Assembler &assembler, const uint32_t count)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        const VGeneral a = static_cast<VGeneral>(first_a + i);
+        if (isLayerNorm)
+        {
+          assembler.add({
+            fsub(a, t4s, a, t4s, v18, t4s),  // fsub v<a>.4s, v<a>.4s, v18.4s
+            fsub(a, t4s, a, t4s, v24, t4s),  // fsub v<a>.4s, v<a>.4s, v24.4s
+          });
+        }
+        assembler.add(fmul(a, t4s, a, t4s, v19, t4s));  // fmul v<a>.4s, v<a>.4s, v19.4s
+      }
+    }
+  };
+
+  /**
+   * @brief Generates the loop over the columns, each column is normalized by the statistics pass and the normalize pass of the columns.
+   *
+   * @param kernel The kernel to add instructions too.
+   * @param constants The constants of the columns.
+   * @param columns The Softmax or Norm that generates a column.
+   * @param m The rows of A and B.
+   * @param n The columns of A and B.
+   */
+  template <typename T> void add_columns(mini_jit::Kernel &kernel, const Constants &constants, T &columns, const uint32_t m, const uint32_t n)
+  {
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input).
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of floats
+      lsl(x2, x2, 2),  // x2 * 4 = x2 * sizeof(float)
+      lsl(x3, x3, 2),  // x3 * 4 = x3 * sizeof(float)
+
+      mov(x8, x0),  // column of a
+      mov(x9, x1),  // column of b
+    });
+    assembler.add(constants.load());
+
+    assembler.add(mov(x16, n));  // x16 iterator for the n loop
+    assembler.label("normalization_loop_over_N");
+    columns.add_statistics(assembler, m);
+    columns.add_normalize(assembler, m);
+    assembler.add({
+      add(x8, x8, x2),   // next column of a
+      add(x9, x9, x3),   // next column of b
+      sub(x16, x16, 1),  // sub x16, x16, #1
+    });
+    assembler.add(cbnz(x16, 0), "normalization_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+}  // namespace
+
+void mini_jit::kernels::normalization(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const normalization_t normalization,
+                                      const float epsilon)
+{
+  release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+  release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+  release_assert(normalization <= normalization_t::rms_norm, "Unknown normalization.");
+  release_assert(epsilon >= 0, "The epsilon of a normalization cannot be negative.");
+
+  // The constants of the columns are known before they are loaded
+  Constants constants;
+  if (normalization == normalization_t::softmax)
+  {
+    Softmax softmax(constants);
+    add_columns(kernel, constants, softmax, m, n);
+  }
+  else
+  {
+    Norm norm(constants, normalization, m, epsilon);
+    add_columns(kernel, constants, norm, m, n);
+  }
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("normalization.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
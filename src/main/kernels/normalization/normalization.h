@@ -0,0 +1,43 @@
+#ifndef MINI_JIT_KERNELS_NORMALIZATION_H
+#define MINI_JIT_KERNELS_NORMALIZATION_H
+
+#include "../../Kernel.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /// normalization of a column x of M elements
+    enum class normalization_t : uint32_t
+    {
+      softmax = 0,     //!< exp(x - max(x)) / sum(exp(x - max(x)))
+      layer_norm = 1,  //!< (x - mean(x)) / sqrt(var(x) + epsilon), the biased variance
+      rms_norm = 2,    //!< x / sqrt(mean(x^2) + epsilon)
+    };
+
+    /**
+     * @brief Generates a M x N kernel that normalizes each column of a column-major fp32 matrix A into B, i.e. the normalized dimension
+     * has the unit stride. Each kernel reads a column twice, the first pass computes the statistics in registers and the second pass
+     * writes the normalized column.
+     * The softmax computes the maximum and the sum of the exponentials in the same pass, the online formulation keeps a running maximum
+     * per lane in v18 and rescales the sum in v19 by exp(old maximum - new maximum) after each block of 32 elements. The lanes are
+     * combined at the end of the pass, the exponentials are evaluated by the chains of unary_activation in v0 and v1.
+     * The layer norm sums x - K and (x - K)^2 with the first element K of the column as shift, which avoids the cancellation of
+     * E[x^2] - E[x]^2 for columns with a large mean, and normalizes (x - K) - mean(x - K).
+     * A rest of the column is loaded as q registers followed by a single partial register, the padding lanes are filled with the lowest
+     * float for the softmax and with the shift for the layer norm, see row_piece.h.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B, i.e. the normalized dimension.
+     * @param n The columns of A and B.
+     * @param normalization The normalization of each column.
+     * @param epsilon The value added to the variance of a layer norm or to the mean square of a rms norm, ignored by the softmax.
+     */
+    void normalization(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const normalization_t normalization,
+                       const float epsilon);
+
+  }  // namespace kernels
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_NORMALIZATION_H
@@ -0,0 +1,28 @@
+#ifndef MINI_JIT_KERNELS_PACKING_H
+#define MINI_JIT_KERNELS_PACKING_H
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /**
+     * Packed operands of a matmul kernel with the register block mr x nr.
+     * A packed A is split into strips of mr rows, each strip holds its k columns of mr contiguous elements, i.e. it is column-major with
+     * a leading dimension of mr. A packed B is split into strips of nr columns, each strip holds its k rows of nr contiguous elements,
+     * i.e. it is row-major with a leading dimension of nr. The strips follow each other, the last strip is padded to mr or nr.
+     */
+    struct packing_t
+    {
+      //! A is packed, the leading dimension argument of A is mr
+      bool a = false;
+
+      //! B is packed, the leading dimension argument of B is nr
+      bool b = false;
+
+      bool operator==(packing_t const &) const = default;
+    };
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_PACKING_H
@@ -0,0 +1,32 @@
+#ifndef MINI_JIT_KERNELS_PREFETCH_H
+#define MINI_JIT_KERNELS_PREFETCH_H
+
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+
+    /**
+     * Software prefetches issued by a matmul kernel.
+     * A and B are prefetched into L1 a number of k iterations ahead of their loads. A distance that reaches beyond the last k
+     * iteration prefetches the following batch for the usual layout of a batch stride of lda * k or ldb * n.
+     */
+    struct prefetch_t
+    {
+      //! distance of the prefetches of A in k iterations, zero disables them
+      uint32_t a = 0;
+
+      //! distance of the prefetches of B in k iterations, zero disables them
+      uint32_t b = 0;
+
+      //! prefetches the C block of the next M block into L2 before the k loops of the current block
+      bool c = false;
+
+      bool operator==(prefetch_t const &) const = default;
+    };
+
+  }  // namespace kernels
+}  // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_PREFETCH_H
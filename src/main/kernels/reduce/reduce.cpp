@@ -0,0 +1,364 @@
+#include "reduce.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+#include "../row_piece.h"
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::dtype_t;
+  using mini_jit::kernels::reduce_op_t;
+  using mini_jit::kernels::row_piece_t;
+
+  //! registers of the accumulators and of the loaded values of A and B, the scale is held by v31
+  constexpr uint32_t first_accumulator = 16;
+  constexpr uint32_t first_a = 0;
+  constexpr uint32_t first_b = 4;
+  constexpr uint32_t scale_register = 31;
+
+  /**
+   * @brief Gets the vector instruction of the operation on all lanes of the registers.
+   *
+   * @param op The reduce operation.
+   * @param dtype The data type of the lanes.
+   * @param d The destination register.
+   * @param n The first source register.
+   * @param m The second source register.
+   * @return The instruction.
+   */
+  uint32_t operation(const reduce_op_t op, const dtype_t dtype, const uint32_t d, const uint32_t n, const uint32_t m)
+  {
+    const VGeneral vd = static_cast<VGeneral>(d);
+    const VGeneral vn = static_cast<VGeneral>(n);
+    const VGeneral vm = static_cast<VGeneral>(m);
+
+    if (dtype == dtype_t::fp64)
+    {
+      return op == reduce_op_t::max ? fmax(vd, t2d, vn, t2d, vm, t2d) : fadd(vd, t2d, vn, t2d, vm, t2d);
+    }
+    return op == reduce_op_t::max ? fmax(vd, t4s, vn, t4s, vm, t4s) : fadd(vd, t4s, vn, t4s, vm, t4s);
+  }
+
+  /**
+   * @brief Loads four consecutive q registers and increments the address by 64 bytes.
+   *
+   * @param first The first of the four registers.
+   * @param base The register holding the address.
+   * @param dtype The data type of the lanes.
+   * @return The instruction.
+   */
+  uint32_t load_block(const uint32_t first, const R64Bit base, const dtype_t dtype)
+  {
+    const VGeneral v0 = static_cast<VGeneral>(first);
+    const VGeneral v1 = static_cast<VGeneral>(first + 1);
+    const VGeneral v2 = static_cast<VGeneral>(first + 2);
+    const VGeneral v3 = static_cast<VGeneral>(first + 3);
+
+    if (dtype == dtype_t::fp64)
+    {
+      return ld1Post(v0, t2d, v1, t2d, v2, t2d, v3, t2d, base, 64);  // ld1 {v0.2d-v3.2d}, [base], #64
+    }
+    return ld1Post(v0, t4s, v1, t4s, v2, t4s, v3, t4s, base, 64);  // ld1 {v0.4s-v3.4s}, [base], #64
+  }
+
+  /**
+   * @brief Gets the instructions that reduce the lanes of a register into its first lane, i.e. the s or d register.
+   *
+   * @param op The reduce operation.
+   * @param dtype The data type of the lanes.
+   * @param vRegister The register that is reduced.
+   * @return The instructions.
+   */
+  std::vector<uint32_t> reduce_lanes(const reduce_op_t op, const dtype_t dtype, const uint32_t vRegister)
+  {
+    const VGeneral v = static_cast<VGeneral>(vRegister);
+    if (dtype == dtype_t::fp64)
+    {
+      return {op == reduce_op_t::max ? fmaxp(static_cast<V64Bit>(vRegister), v, t2d)    // fmaxp d<v>, v<v>.2d
+                                     : faddp(static_cast<V64Bit>(vRegister), v, t2d)};  // faddp d<v>, v<v>.2d
+    }
+    if (op == reduce_op_t::max)
+    {
+      return {
+        fmaxp(v, t4s, v, t4s, v, t4s),                  // fmaxp v<v>.4s, v<v>.4s, v<v>.4s
+        fmaxp(static_cast<V32Bit>(vRegister), v, t2s),  // fmaxp s<v>, v<v>.2s
+      };
+    }
+    return {
+      faddp(v, t4s, v, t4s, v, t4s),                  // faddp v<v>.4s, v<v>.4s, v<v>.4s
+      faddp(static_cast<V32Bit>(vRegister), v, t2s),  // faddp s<v>, v<v>.2s
+    };
+  }
+
+  /**
+   * @brief Loads the elements of a partial register and fills the lanes behind them with the first element, which does not change a max.
+   * The lanes are inserted with x14 as temporary for their addresses.
+   *
+   * @param vRegister The register that is loaded.
+   * @param base The register holding the address of the first element.
+   * @param elements The number of elements, less than the lanes of a q register.
+   * @param dtype The data type of the elements.
+   * @return The instructions.
+   */
+  std::vector<uint32_t> load_repeated(const uint32_t vRegister, const R64Bit base, const uint32_t elements, const dtype_t dtype)
+  {
+    const VGeneral v = static_cast<VGeneral>(vRegister);
+    if (dtype == dtype_t::fp64)
+    {
+      release_assert(elements == 1, "A partial register of fp64 holds a single element.");
+      return {
+        ldr(static_cast<V64Bit>(vRegister), base),  // ldr d<v>, [base]
+        dup(v, t2d, v, 0),                          // dup v<v>.2d, v<v>.d[0]
+      };
+    }
+
+    std::vector<uint32_t> instructions = {
+      ldr(static_cast<V32Bit>(vRegister), base),  // ldr s<v>, [base]
+      dup(v, t4s, v, 0),                          // dup v<v>.4s, v<v>.s[0]
+    };
+    for (uint32_t lane = 1; lane < elements; ++lane)
+    {
+      instructions.push_back(add(x14, base, lane * 4));                        // add x14, base, #lane*4
+      instructions.push_back(ld1(static_cast<V32Bit>(vRegister), lane, x14));  // ld1 {v<v>.s}[lane], [x14]
+    }
+    return instructions;
+  }
+
+  /**
+   * @brief Moves the scale into all lanes of v31.
+   *
+   * @param scale The factor of the sums.
+   * @param dtype The data type of the lanes.
+   * @return The instructions.
+   */
+  std::vector<uint32_t> load_scale(const double scale, const dtype_t dtype)
+  {
+    const VGeneral v = static_cast<VGeneral>(scale_register);
+    if (dtype == dtype_t::fp64)
+    {
+      const uint64_t bits = std::bit_cast<uint64_t>(scale);
+      return {
+        movz(x15, bits & 0xffff),                        // movz x15, #bits[15:0]
+        movk(x15, (bits >> 16) & 0xffff, 16),            // movk x15, #bits[31:16], lsl #16
+        movk(x15, (bits >> 32) & 0xffff, 32),            // movk x15, #bits[47:32], lsl #32
+        movk(x15, bits >> 48, 48),                       // movk x15, #bits[63:48], lsl #48
+        fmov(static_cast<V64Bit>(scale_register), x15),  // fmov d31, x15
+        dup(v, t2d, v, 0),                               // dup v31.2d, v31.d[0]
+      };
+    }
+
+    const uint32_t bits = std::bit_cast<uint32_t>(static_cast<float>(scale));
+    return {
+      movz(w15, bits & 0xffff),                        // movz w15, #bits[15:0]
+      movk(w15, bits >> 16, 16),                       // movk w15, #bits[31:16], lsl #16
+      fmov(static_cast<V32Bit>(scale_register), w15),  // fmov s31, w15
+      dup(v, t4s, v, 0),                               // dup v31.4s, v31.s[0]
+    };
+  }
+}  // namespace
+
+void mini_jit::kernels::reduce(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const reduce_op_t op, const dtype_t dtype,
+                               const reduce_axis_t axis, const bool accumulate, const double scale)
+{
+  release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+  release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+  release_assert(op == reduce_op_t::sum || scale == 1, "Only a sum can be scaled.");
+
+  const uint32_t shift = get_dtype_shift(dtype);
+  const uint32_t lanes = get_dtype_lanes(dtype);
+  const uint32_t element_size = get_dtype_size(dtype);
+  const uint32_t m_loop = m / (4 * lanes);
+  const uint32_t m_rest = m % (4 * lanes);
+  const bool isScaled = scale != 1;
+
+  mini_jit::Assembler assembler(kernel);
+  assembler.add({
+    /**
+     * @param x0 = a pointer to column-major matrix A (Input).
+     * @param x1 = b pointer to the row or column B (Output).
+     * @param x2 = lda leading dimension of A.
+     * @param x3 = ldb stride between the elements of a row B, unused by a column B.
+     */
+
+    // Offset the used leading dimension by the size of the elements
+    lsl(x2, x2, shift),  // x2 * sizeof(element)
+    lsl(x3, x3, shift),  // x3 * sizeof(element)
+
+    mov(x8, x0),  // column or block of a
+    mov(x9, x1),  // element or block of b
+  });
+  if (isScaled)
+  {
+    assembler.add(load_scale(scale, dtype));
+  }
+
+  if (axis == reduce_axis_t::m)
+  {
+    assembler.add(mov(x16, n));  // x16 iterator for the n loop
+    assembler.label("reduce_loop_over_N");
+    assembler.add(mov(x11, x8));  // current row of a
+
+    // Number of accumulators that hold a part of the column
+    uint32_t accumulators = 0;
+    if (m_loop > 0)
+    {
+      assembler.add(load_block(first_accumulator, x11, dtype));
+      accumulators = 4;
+    }
+    if (m_loop > 1)
+    {
+      assembler.add(mov(x17, m_loop - 1));  // x17 iterator for the m loop
+      assembler.label("reduce_loop_over_M");
+      assembler.add(load_block(first_a, x11, dtype));
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        assembler.add(operation(op, dtype, first_accumulator + i, first_accumulator + i, first_a + i));
+      }
+      assembler.add(sub(x17, x17, 1));  // sub x17, x17, #1
+      assembler.add(cbnz(x17, 0), "reduce_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    // Whole q registers of the rest, the remaining elements in a single partial register
+    for (uint32_t i = 0; i < m_rest / lanes; ++i)
+    {
+      const bool isAccumulated = i < accumulators;
+      const uint32_t target = isAccumulated ? first_a + i : first_accumulator + i;
+      assembler.add(ldrPost(static_cast<V128Bit>(target), x11, 16));  // ldr q<target>, [x11], #16
+      if (isAccumulated)
+      {
+        assembler.add(operation(op, dtype, first_accumulator + i, first_accumulator + i, target));
+      }
+      accumulators = std::max(accumulators, i + 1);
+    }
+    if (m_rest % lanes != 0)
+    {
+      const uint32_t target = accumulators > 0 ? first_a : first_accumulator;
+      if (op == reduce_op_t::max)
+      {
+        assembler.add(load_repeated(target, x11, m_rest % lanes, dtype));
+      }
+      else
+      {
+        assembler.add(load_piece(target, x11, row_piece_t{0, (m_rest % lanes) * element_size}));  // x14 holds the addresses of lanes
+      }
+      if (accumulators > 0)
+      {
+        assembler.add(operation(op, dtype, first_accumulator, first_accumulator, target));
+      }
+      accumulators = std::max(accumulators, 1u);
+    }
+
+    // Combine the accumulators into v16 and its lanes into the first lane
+    if (accumulators == 4)
+    {
+      assembler.add(operation(op, dtype, first_accumulator + 2, first_accumulator + 2, first_accumulator + 3));
+    }
+    if (accumulators >= 3)
+    {
+      assembler.add(operation(op, dtype, first_accumulator, first_accumulator, first_accumulator + 2));
+    }
+    if (accumulators >= 2)
+    {
+      assembler.add(operation(op, dtype, first_accumulator, first_accumulator, first_accumulator + 1));
+    }
+    assembler.add(reduce_lanes(op, dtype, first_accumulator));
+
+    if (isScaled)
+    {
+      assembler.add(dtype == dtype_t::fp64 ? fmul(v16, t2d, v16, t2d, v31, t2d)    // fmul v16.2d, v16.2d, v31.2d
+                                           : fmul(v16, t4s, v16, t4s, v31, t4s));  // fmul v16.4s, v16.4s, v31.4s
+    }
+    if (accumulate)
+    {
+      assembler.add(dtype == dtype_t::fp64 ? ldr(static_cast<V64Bit>(first_b), x9)    // ldr d4, [x9]
+                                           : ldr(static_cast<V32Bit>(first_b), x9));  // ldr s4, [x9]
+      assembler.add(operation(op, dtype, first_accumulator, first_accumulator, first_b));
+    }
+    assembler.add({
+      dtype == dtype_t::fp64 ? str(static_cast<V64Bit>(first_accumulator), x9)   // str d16, [x9]
+                             : str(static_cast<V32Bit>(first_accumulator), x9),  // str s16, [x9]
+      add(x8, x8, x2),                                                           // next column of a
+      add(x9, x9, x3),                                                           // next element of b
+      sub(x16, x16, 1),                                                          // sub x16, x16, #1
+    });
+    assembler.add(cbnz(x16, 0), "reduce_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+  }
+  else
+  {
+    /**
+     * Reduces the columns of a block of rows of A into v16-v19 and stores the block to B.
+     *
+     * @param pieces The q or partial registers of the block.
+     * @param label The label of the loop over the columns.
+     */
+    auto reduce_block = [&](const std::vector<row_piece_t> &pieces, const std::string &label)
+    {
+      assembler.add(mov(x11, x8));  // current column of a
+      for (uint32_t i = 0; i < pieces.size(); ++i)
+      {
+        assembler.add(load_piece(first_accumulator + i, x11, pieces[i]));  // x14 holds the addresses of lanes
+      }
+
+      if (n > 1)
+      {
+        assembler.add(mov(x16, n - 1));  // x16 iterator for the n loop
+        assembler.label(label);
+        assembler.add(add(x11, x11, x2));  // next column of a
+        for (uint32_t i = 0; i < pieces.size(); ++i)
+        {
+          assembler.add(load_piece(first_a + i, x11, pieces[i]));
+        }
+        for (uint32_t i = 0; i < pieces.size(); ++i)
+        {
+          assembler.add(operation(op, dtype, first_accumulator + i, first_accumulator + i, first_a + i));
+        }
+        assembler.add(sub(x16, x16, 1));  // sub x16, x16, #1
+        assembler.add(cbnz(x16, 0), label, mini_jit::Assembler::relocation_t::imm19);
+      }
+
+      for (uint32_t i = 0; i < pieces.size(); ++i)
+      {
+        if (isScaled)
+        {
+          const VGeneral v = static_cast<VGeneral>(first_accumulator + i);
+          assembler.add(dtype == dtype_t::fp64 ? fmul(v, t2d, v, t2d, v31, t2d)    // fmul v<acc>.2d, v<acc>.2d, v31.2d
+                                               : fmul(v, t4s, v, t4s, v31, t4s));  // fmul v<acc>.4s, v<acc>.4s, v31.4s
+        }
+        if (accumulate)
+        {
+          assembler.add(load_piece(first_b + i, x9, pieces[i]));
+          assembler.add(operation(op, dtype, first_accumulator + i, first_accumulator + i, first_b + i));
+        }
+        assembler.add(store_piece(first_accumulator + i, x9, pieces[i]));
+      }
+    };
+
+    if (m_loop > 0)
+    {
+      assembler.add(mov(x17, m_loop));  // x17 iterator for the m loop
+      assembler.label("reduce_loop_over_M");
+      reduce_block(get_row_pieces(4 * lanes, element_size), "reduce_loop_over_N");
+      assembler.add({
+        add(x8, x8, 64),   // next block of a
+        add(x9, x9, 64),   // next block of b
+        sub(x17, x17, 1),  // sub x17, x17, #1
+      });
+      assembler.add(cbnz(x17, 0), "reduce_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+    }
+    if (m_rest > 0)
+    {
+      reduce_block(get_row_pieces(m_rest, element_size), "reduce_loop_over_N_rest");
+    }
+  }
+
+  assembler.add(ret());
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("reduce.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,49 @@
+#ifndef MINI_JIT_KERNELS_REDUCE_H
+#define MINI_JIT_KERNELS_REDUCE_H
+
+#include "../../Kernel.h"
+#include "../dtype.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /// operation of the reduce kernel, max propagates NaN
+    enum class reduce_op_t : uint32_t
+    {
+      sum = 0,  //!< B := A[0] + ... + A[k-1]
+      max = 1,  //!< B := max(A[0], ..., A[k-1])
+    };
+
+    /// dimension of A that is reduced by the kernel
+    enum class reduce_axis_t : uint32_t
+    {
+      m = 0,  //!< B is a row of N elements, B[j] := op(A[0, j], ..., A[M-1, j])
+      n = 1,  //!< B is a column of M elements, B[i] := op(A[i, 0], ..., A[i, N-1])
+    };
+
+    /**
+     * @brief Generates a kernel that reduces a M x N column-major matrix A along one of its dimensions into B.
+     * The m axis accumulates each column in the four q registers v16-v19 and combines them with faddp or fmaxp across the lanes, a rest
+     * of the column is loaded as q registers followed by a single partial register, see row_piece.h. The partial register of a max
+     * repeats the first element of the column instead of zero lanes.
+     * The n axis accumulates blocks of four q registers over the columns of A, i.e. without any operation across the lanes, and stores
+     * the block as a part of the column B.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A.
+     * @param n The columns of A.
+     * @param op The reduce operation.
+     * @param dtype The data type of the elements.
+     * @param axis The reduced dimension of A.
+     * @param accumulate True if the reduction is combined with the values of B, i.e. B := op(B, reduction of A), false overwrites B.
+     * @param scale The factor of a sum before it is accumulated, e.g. one over the number of elements of a mean, one skips the scaling.
+     */
+    void reduce(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const reduce_op_t op, const dtype_t dtype,
+                const reduce_axis_t axis, const bool accumulate, const double scale);
+
+  }  // namespace kernels
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_REDUCE_H
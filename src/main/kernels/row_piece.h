@@ -0,0 +1,131 @@
+#ifndef MINI_JIT_KERNELS_ROW_PIECE_H
+#define MINI_JIT_KERNELS_ROW_PIECE_H
+
+#include "../arm_instructions/arm_all.h"
+#include "../release_assert.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    //! part of a column of a C block that is held by a single vector register
+    struct row_piece_t
+    {
+      //! offset of the piece from the first row of the block in bytes
+      uint32_t offset;
+
+      //! size of the piece in bytes, 16 for a q, 8 for a d, 4 for a s and 2 for a h register, other even sizes insert lanes behind a
+      //! register, e.g. 12 for a d register with an inserted third .s lane
+      uint32_t bytes;
+    };
+
+    /**
+     * Splits the rows of a block into q registers followed by a single partial register for the rows that do not fill a q register.
+     * The partial loads zero the upper lanes, hence all pieces can be multiplied with the full vector instructions and a remainder of
+     * rows needs as many registers and instructions as a full block of the same size.
+     */
+    inline std::vector<row_piece_t> get_row_pieces(uint32_t rows, uint32_t element_size)
+    {
+      std::vector<row_piece_t> pieces;
+      const uint32_t bytes = rows * element_size;
+      for (uint32_t offset = 0; offset < bytes; offset += 16)
+      {
+        pieces.push_back(row_piece_t{offset, std::min(16u, bytes - offset)});
+      }
+      return pieces;
+    }
+
+    /**
+     * Loads or stores the register of size bytes at base + offset, i.e. a q, d, s or h register.
+     */
+    inline uint32_t transfer_register(bool is_store, uint32_t vRegister, arm_instructions::R64Bit base, uint32_t offset, uint32_t bytes)
+    {
+      using namespace mini_jit::arm_instructions;
+
+      switch (bytes)
+      {
+      case 16:
+        return is_store ? strOffset(static_cast<V128Bit>(vRegister), base, offset)   // str q<v>, [base, #offset]
+                        : ldrOffset(static_cast<V128Bit>(vRegister), base, offset);  // ldr q<v>, [base, #offset]
+      case 8:
+        return is_store ? strOffset(static_cast<V64Bit>(vRegister), base, offset)   // str d<v>, [base, #offset]
+                        : ldrOffset(static_cast<V64Bit>(vRegister), base, offset);  // ldr d<v>, [base, #offset]
+      case 4:
+        return is_store ? strOffset(static_cast<V32Bit>(vRegister), base, offset)   // str s<v>, [base, #offset]
+                        : ldrOffset(static_cast<V32Bit>(vRegister), base, offset);  // ldr s<v>, [base, #offset]
+      default:
+        release_assert(bytes == 2, "A register transfer has to be 16, 8, 4 or 2 bytes.");
+        return is_store ? strOffset(static_cast<V16Bit>(vRegister), base, offset)   // str h<v>, [base, #offset]
+                        : ldrOffset(static_cast<V16Bit>(vRegister), base, offset);  // ldr h<v>, [base, #offset]
+      }
+    }
+
+    /**
+     * Loads or stores a piece of any even size. The largest power of two is transferred as a register and the remainder as
+     * descending lanes, e.g. three floats as d register and a .s lane, seven halves as d register, a .s and a .h lane.
+     * x14 is used as temporary for the addresses of the lanes.
+     */
+    inline std::vector<uint32_t> transfer_piece(bool is_store, uint32_t vRegister, arm_instructions::R64Bit base, row_piece_t piece)
+    {
+      using namespace mini_jit::arm_instructions;
+
+      release_assert(piece.bytes % 2 == 0 && piece.bytes <= 16, "A piece has to be an even number of at most 16 bytes.");
+
+      uint32_t head = 16;
+      while (head > piece.bytes)
+      {
+        head /= 2;
+      }
+      std::vector<uint32_t> instructions = {transfer_register(is_store, vRegister, base, piece.offset, head)};
+      if (head != piece.bytes)
+      {
+        release_assert(base != x14, "The base of a partial piece must not be the temporary x14.");
+      }
+
+      // A remainder follows at most a d register, hence the lanes are .s and .h
+      uint32_t position = head;
+      for (uint32_t lane = head / 2; lane >= 2; lane /= 2)
+      {
+        if (piece.bytes - position < lane)
+        {
+          continue;
+        }
+        instructions.push_back(add(x14, base, piece.offset + position));  // add x14, base, #offset+position
+        if (lane == 4)
+        {
+          instructions.push_back(is_store ? st1(static_cast<V32Bit>(vRegister), position / 4, x14)    // st1 {v<v>.s}[position/4], [x14]
+                                          : ld1(static_cast<V32Bit>(vRegister), position / 4, x14));  // ld1 {v<v>.s}[position/4], [x14]
+        }
+        else
+        {
+          instructions.push_back(is_store ? st1(static_cast<V16Bit>(vRegister), position / 2, x14)    // st1 {v<v>.h}[position/2], [x14]
+                                          : ld1(static_cast<V16Bit>(vRegister), position / 2, x14));  // ld1 {v<v>.h}[position/2], [x14]
+        }
+        position += lane;
+      }
+      return instructions;
+    }
+
+    /**
+     * Loads a piece into v<vRegister>, the lanes behind the piece are zero.
+     * A piece that is not a power of two, e.g. three floats, is loaded as register followed by lane inserts, x14 is used as temporary
+     * for their addresses.
+     */
+    inline std::vector<uint32_t> load_piece(uint32_t vRegister, arm_instructions::R64Bit base, row_piece_t piece)
+    {
+      return transfer_piece(false, vRegister, base, piece);
+    }
+
+    /**
+     * Stores a piece of v<vRegister>, a piece that is not a power of two uses x14 as temporary for the addresses of its lanes.
+     */
+    inline std::vector<uint32_t> store_piece(uint32_t vRegister, arm_instructions::R64Bit base, row_piece_t piece)
+    {
+      return transfer_piece(true, vRegister, base, piece);
+    }
+  }     // namespace kernels
+}       // namespace mini_jit
+#endif  // MINI_JIT_KERNELS_ROW_PIECE_H
@@ -0,0 +1,364 @@
+#ifndef MINI_JIT_KERNELS_UNARY_ACTIVATION_CHAIN_H
+#define MINI_JIT_KERNELS_UNARY_ACTIVATION_CHAIN_H
+
+#include "../../arm_instructions/arm_all.h"
+#include "../../release_assert.h"
+#include "unary_activation.h"
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /**
+     * Building blocks of the fp32 activations that are shared by the kernels which evaluate an activation in registers, e.g. the exp of
+     * a softmax. The constants are loaded once at the start of a kernel, a chain is generated once and added for each register.
+     */
+    namespace activation
+    {
+      using namespace mini_jit::arm_instructions;
+
+      //! first register of the constants, the lanes fill the registers upwards from v14 and the broadcasts downwards from v31
+      constexpr uint32_t first_constant = 14;
+
+      //! lane of a constant register
+      struct lane_t
+      {
+        VGeneral reg;
+        uint32_t index;
+      };
+
+      /**
+       * Collects the constants of an activation. A constant that is used by element, i.e. as operand of fmul, fmla or dup, occupies a
+       * single lane, a constant that is the operand of an instruction without an element form, e.g. fmax or fdiv, occupies a register.
+       */
+      class Constants
+      {
+      public:
+        /**
+         * Gets the register whose lanes all hold the bits.
+         */
+        VGeneral broadcast(uint32_t bits)
+        {
+          return static_cast<VGeneral>(31 - find(broadcasts, bits));
+        }
+
+        /**
+         * Gets the register whose lanes all hold the single-precision value.
+         */
+        VGeneral broadcast(float value)
+        {
+          return broadcast(std::bit_cast<uint32_t>(value));
+        }
+
+        /**
+         * Gets the lane that holds the single-precision value.
+         */
+        lane_t lane(float value)
+        {
+          const uint32_t i = find(lanes, std::bit_cast<uint32_t>(value));
+          return lane_t{static_cast<VGeneral>(first_constant + i / 4), i % 4};
+        }
+
+        /**
+         * Gets the instructions that load the constants, w14 is used as temporary.
+         */
+        std::vector<uint32_t> load() const
+        {
+          release_assert(first_constant + (lanes.size() + 3) / 4 <= 32 - broadcasts.size(), "The constants do not fit into v14 to v31.");
+
+          std::vector<uint32_t> instructions;
+          for (uint32_t i = 0; i < lanes.size(); ++i)
+          {
+            add_bits(instructions, lanes[i]);
+            instructions.push_back(ins(static_cast<VGeneral>(first_constant + i / 4), t4s, i % 4, w14));  // mov v<c>.s[i%4], w14
+          }
+          for (uint32_t i = 0; i < broadcasts.size(); ++i)
+          {
+            const VGeneral v = static_cast<VGeneral>(31 - i);
+            add_bits(instructions, broadcasts[i]);
+            instructions.push_back(fmov(static_cast<V32Bit>(31 - i), w14));  // fmov s<c>, w14
+            instructions.push_back(dup(v, t4s, v, 0));                       // dup v<c>.4s, v<c>.s[0]
+          }
+          return instructions;
+        }
+
+      private:
+        std::vector<uint32_t> broadcasts;
+        std::vector<uint32_t> lanes;
+
+        static uint32_t find(std::vector<uint32_t> &values, uint32_t bits)
+        {
+          for (uint32_t i = 0; i < values.size(); ++i)
+          {
+            if (values[i] == bits)
+            {
+              return i;
+            }
+          }
+          values.push_back(bits);
+          return values.size() - 1;
+        }
+
+        static void add_bits(std::vector<uint32_t> &instructions, uint32_t bits)
+        {
+          instructions.push_back(movz(w14, bits & 0xffff));  // movz w14, #bits[15:0]
+          if ((bits >> 16) != 0)
+          {
+            instructions.push_back(movk(w14, bits >> 16, 16));  // movk w14, #bits[31:16], lsl #16
+          }
+        }
+      };
+
+      /**
+       * Generates the instructions of an activation on a single vector register x with the six temporaries t.
+       * The result overwrites x.
+       */
+      class Chain
+      {
+      public:
+        Chain(Constants &constants, uint32_t x, uint32_t first_temporary) : constants(constants), x(static_cast<VGeneral>(x))
+        {
+          for (uint32_t i = 0; i < 6; ++i)
+          {
+            t[i] = static_cast<VGeneral>(first_temporary + i);
+          }
+        }
+
+        std::vector<uint32_t> generate(unary_activation_t activation)
+        {
+          switch (activation)
+          {
+          case unary_activation_t::exp:
+            add_exp(x, x, t[0], t[1], t[2], false);
+            break;
+          case unary_activation_t::sigmoid:
+          case unary_activation_t::silu:
+            add_mul(t[0], x, -1.0f);
+            add_exp(t[0], t[0], t[1], t[2], t[3], false);
+            add_reciprocal_sum(activation == unary_activation_t::silu ? add_clamp_numerator(t[1]) : constants.broadcast(1.0f), t[0]);
+            break;
+          case unary_activation_t::tanh:
+            add_tanh();
+            break;
+          case unary_activation_t::gelu_erf:
+            add_gelu_erf();
+            break;
+          case unary_activation_t::gelu_tanh:
+            add_gelu_tanh();
+            break;
+          default:
+            release_assert(false, "Unknown activation.");
+          }
+          return std::move(code);
+        }
+
+      private:
+        Constants &constants;
+        VGeneral x;
+        VGeneral t[6];
+        std::vector<uint32_t> code;
+
+        /**
+         * dst = src * value
+         */
+        void add_mul(VGeneral dst, VGeneral src, float value)
+        {
+          const lane_t c = constants.lane(value);
+          code.push_back(fmul(dst, t4s, src, t4s, c.reg, c.index));  // fmul dst.4s, src.4s, v<c>.s[i]
+        }
+
+        /**
+         * Evaluates the polynomial with the coefficients from the highest to the lowest degree at v by Horner's method in a and b.
+         *
+         * @return The register a or b that holds the value of the polynomial.
+         */
+        VGeneral add_horner(VGeneral v, const std::vector<float> &coefficients, VGeneral a, VGeneral b)
+        {
+          // The highest coefficient is multiplied by element, i.e. a = c[1] + v * c[0]
+          lane_t c = constants.lane(coefficients[1]);
+          code.push_back(dup(a, t4s, c.reg, c.index));  // dup a.4s, v<c>.s[i]
+          c = constants.lane(coefficients[0]);
+          code.push_back(fmla(a, t4s, v, t4s, c.reg, c.index));  // fmla a.4s, v.4s, v<c>.s[i]
+
+          for (size_t i = 2; i < coefficients.size(); ++i)
+          {
+            c = constants.lane(coefficients[i]);
+            code.push_back(dup(b, t4s, c.reg, c.index));   // dup b.4s, v<c>.s[i]
+            code.push_back(fmla(b, t4s, a, t4s, v, t4s));  // fmla b.4s, a.4s, v.4s
+            std::swap(a, b);
+          }
+          return a;
+        }
+
+        /**
+         * dst = exp(hi + lo) with the temporaries a and b, the argument hi is overwritten.
+         * Without lo the register lo is used as third temporary.
+         */
+        void add_exp(VGeneral dst, VGeneral hi, VGeneral lo, VGeneral a, VGeneral b, bool has_lo)
+        {
+          // exp(x) = 2^(2n) * exp(r) with n = round(x * log2(e) / 2), the clamp keeps 2^n a normal number
+          const float half_log2e = static_cast<float>(std::numbers::log2e / 2);
+          const double two_ln2 = 2 * std::numbers::ln2;
+          const float two_ln2_hi = static_cast<float>(two_ln2);
+          const float two_ln2_lo = static_cast<float>(two_ln2 - two_ln2_hi);
+
+          code.push_back(fmax(hi, t4s, hi, t4s, constants.broadcast(-104.0f), t4s));  // fmax hi.4s, hi.4s, -104
+          code.push_back(fmin(hi, t4s, hi, t4s, constants.broadcast(89.0f), t4s));    // fmin hi.4s, hi.4s, 89
+          if (has_lo)
+          {
+            code.push_back(fadd(a, t4s, hi, t4s, lo, t4s));  // fadd a.4s, hi.4s, lo.4s
+            add_mul(a, a, half_log2e);
+          }
+          else
+          {
+            add_mul(a, hi, half_log2e);
+          }
+          code.push_back(fcvtns(a, t4s, a, t4s));  // fcvtns a.4s, a.4s
+          code.push_back(scvtf(b, t4s, a, t4s));   // scvtf b.4s, a.4s
+
+          // r = x - 2n * ln(2) in two steps, i.e. |r| <= ln(2) without the rounding of 2 * ln(2)
+          lane_t c = constants.lane(-two_ln2_hi);
+          code.push_back(fmla(hi, t4s, b, t4s, c.reg, c.index));  // fmla hi.4s, b.4s, -2ln2_hi
+          c = constants.lane(-two_ln2_lo);
+          code.push_back(fmla(hi, t4s, b, t4s, c.reg, c.index));  // fmla hi.4s, b.4s, -2ln2_lo
+          if (has_lo)
+          {
+            code.push_back(fadd(hi, t4s, hi, t4s, lo, t4s));  // fadd hi.4s, hi.4s, lo.4s
+          }
+
+          // 2^n has the biased exponent n + 127
+          code.push_back(add(a, t4s, a, t4s, constants.broadcast(127u), t4s));  // add a.4s, a.4s, 127
+          code.push_back(shl(a, t4s, a, t4s, 23));                              // shl a.4s, a.4s, #23
+
+          std::vector<float> taylor;
+          double factorial = 1;
+          for (uint32_t k = 0; k <= 9; ++k)
+          {
+            taylor.insert(taylor.begin(), static_cast<float>(1 / factorial));
+            factorial *= k + 1;
+          }
+          const VGeneral p = add_horner(hi, taylor, b, lo);
+
+          code.push_back(fmul(p, t4s, p, t4s, a, t4s));    // fmul p.4s, p.4s, a.4s
+          code.push_back(fmul(dst, t4s, p, t4s, a, t4s));  // fmul dst.4s, p.4s, a.4s
+        }
+
+        /**
+         * dst = max(x, -104), the numerator of silu and gelu_tanh with the lower bound of the exp argument.
+         * For x below -104 the denominator 1 + exp(-y) overflows to infinity, the clamp gives -0 instead of -inf / inf for x = -inf.
+         *
+         * @return The register dst.
+         */
+        VGeneral add_clamp_numerator(VGeneral dst)
+        {
+          code.push_back(fmax(dst, t4s, x, t4s, constants.broadcast(-104.0f), t4s));  // fmax dst.4s, x.4s, -104
+          return dst;
+        }
+
+        /**
+         * x = numerator / (1 + e)
+         */
+        void add_reciprocal_sum(VGeneral numerator, VGeneral e)
+        {
+          code.push_back(fadd(e, t4s, e, t4s, constants.broadcast(1.0f), t4s));  // fadd e.4s, e.4s, 1
+          code.push_back(fdiv(x, t4s, numerator, t4s, e, t4s));                  // fdiv x.4s, numerator.4s, e.4s
+        }
+
+        /**
+         * tanh(x) = x * P(x^2) / Q(x^2) on x clamped to +-7.9053111, where the result rounds to +-1
+         */
+        void add_tanh()
+        {
+          const float bound = 7.90531110763549805f;
+          code.push_back(fmax(t[0], t4s, x, t4s, constants.broadcast(-bound), t4s));    // fmax t0.4s, x.4s, -bound
+          code.push_back(fmin(t[0], t4s, t[0], t4s, constants.broadcast(bound), t4s));  // fmin t0.4s, t0.4s, bound
+          code.push_back(fmul(t[1], t4s, t[0], t4s, t[0], t4s));                        // fmul t1.4s, t0.4s, t0.4s
+
+          const VGeneral p = add_horner(t[1],
+                                        {-2.76076847742355e-16f, 2.00018790482477e-13f, -8.60467152213735e-11f, 5.12229709037114e-08f,
+                                         1.48572235717979e-05f, 6.37261928875436e-04f, 4.89352455891786e-03f},
+                                        t[2], t[3]);
+          const VGeneral q = add_horner(t[1], {1.19825839466702e-06f, 1.18534705686654e-04f, 2.26843463243900e-03f, 4.89352518554385e-03f},
+                                        t[4], t[5]);
+          code.push_back(fmul(p, t4s, p, t4s, t[0], t4s));  // fmul p.4s, p.4s, t0.4s
+          code.push_back(fdiv(x, t4s, p, t4s, q, t4s));     // fdiv x.4s, p.4s, q.4s
+        }
+
+        /**
+         * gelu(x) = max(x, 0) - |x| * erfc(|x| / sqrt(2)) / 2 with erfc(z) = t * exp(-z^2 + P(t)) and t = 1 / (1 + z / 2).
+         * -z^2 is split into hi + lo without rounding error, the clamp of |x| to 18 keeps z^2 finite and leaves the result unchanged.
+         */
+        void add_gelu_erf()
+        {
+          code.push_back(fabs(t[0], t4s, x, t4s));                                      // fabs t0.4s, x.4s
+          code.push_back(fmin(t[0], t4s, t[0], t4s, constants.broadcast(18.0f), t4s));  // fmin t0.4s, t0.4s, 18
+          add_mul(t[1], t[0], static_cast<float>(std::numbers::sqrt2 / 2));             // z
+
+          lane_t c = constants.lane(1.0f);
+          code.push_back(dup(t[2], t4s, c.reg, c.index));  // dup t2.4s, 1
+          c = constants.lane(0.5f);
+          code.push_back(fmla(t[2], t4s, t[1], t4s, c.reg, c.index));                  // fmla t2.4s, t1.4s, 0.5
+          code.push_back(fdiv(t[2], t4s, constants.broadcast(1.0f), t4s, t[2], t4s));  // t = 1 / (1 + z / 2)
+
+          add_mul(t[3], t[1], -1.0f);                             // -z
+          code.push_back(fmul(t[4], t4s, t[3], t4s, t[1], t4s));  // hi = -z * z
+          add_mul(t[5], t[4], -1.0f);                             // -hi
+          code.push_back(fmla(t[5], t4s, t[3], t4s, t[1], t4s));  // lo = -z * z - hi
+
+          const VGeneral p = add_horner(t[2],
+                                        {0.17087277f, -0.82215223f, 1.48851587f, -1.13520398f, 0.27886807f, -0.18628806f, 0.09678418f,
+                                         0.37409196f, 1.00002368f, -1.26551223f},
+                                        t[1], t[3]);
+          code.push_back(fadd(t[5], t4s, t[5], t4s, p, t4s));  // lo += P(t)
+          add_exp(t[4], t[4], t[5], t[1], t[3], true);
+
+          add_mul(t[2], t[2], -0.5f);
+          code.push_back(fmul(t[2], t4s, t[2], t4s, t[4], t4s));                 // -erfc(z) / 2
+          code.push_back(fmax(x, t4s, x, t4s, constants.broadcast(0.0f), t4s));  // fmax x.4s, x.4s, 0
+          code.push_back(fmla(x, t4s, t[0], t4s, t[2], t4s));                    // fmla x.4s, t0.4s, t2.4s
+        }
+
+        /**
+         * gelu(x) = x / (1 + exp(y)) with y = -2 * sqrt(2 / pi) * (x + 0.044715 * x^3)
+         */
+        void add_gelu_tanh()
+        {
+          const double a = -2 * std::numbers::sqrt2 / std::sqrt(std::numbers::pi);
+
+          code.push_back(fmul(t[0], t4s, x, t4s, x, t4s));  // fmul t0.4s, x.4s, x.4s
+          lane_t c = constants.lane(static_cast<float>(a));
+          code.push_back(dup(t[1], t4s, c.reg, c.index));  // dup t1.4s, a
+          c = constants.lane(static_cast<float>(a * 0.044715));
+          code.push_back(fmla(t[1], t4s, t[0], t4s, c.reg, c.index));  // fmla t1.4s, t0.4s, b
+          code.push_back(fmul(t[1], t4s, t[1], t4s, x, t4s));          // fmul t1.4s, t1.4s, x.4s
+          add_exp(t[1], t[1], t[0], t[2], t[3], false);
+          add_reciprocal_sum(add_clamp_numerator(t[0]), t[1]);
+        }
+      };
+
+      /**
+       * Interleaves the instructions of two independent chains.
+       */
+      inline std::vector<uint32_t> interleave(const std::vector<uint32_t> &first, const std::vector<uint32_t> &second)
+      {
+        release_assert(first.size() == second.size(), "The chains have to have the same number of instructions.");
+
+        std::vector<uint32_t> instructions;
+        for (size_t i = 0; i < first.size(); ++i)
+        {
+          instructions.push_back(first[i]);
+          instructions.push_back(second[i]);
+        }
+        return instructions;
+      }
+    }  // namespace activation
+  }    // namespace kernels
+}      // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_UNARY_ACTIVATION_CHAIN_H
@@ -0,0 +1,93 @@
+#include "unary_activation.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+#include "../row_piece.h"
+#include "activation_chain.h"
+#include <vector>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using namespace mini_jit::kernels::activation;
+}  // namespace
+
+void mini_jit::kernels::unary_activation(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const unary_activation_t activation)
+{
+  release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+  release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+  const uint32_t m_loop = m / 8;
+  const uint32_t m_rest = m % 8;
+
+  // v0 with the temporaries v2 to v7 and v1 with the temporaries v8 to v13
+  Constants constants;
+  const std::vector<uint32_t> chain_0 = Chain(constants, 0, 2).generate(activation);
+  const std::vector<uint32_t> chain_1 = Chain(constants, 1, 8).generate(activation);
+
+  mini_jit::Assembler assembler(kernel);
+  assembler.add({
+    /**
+     * @param x0 = a pointer to column-major matrix A (Input).
+     * @param x1 = b pointer to column-major matrix B (Output).
+     * @param x2 = lda leading dimension of A.
+     * @param x3 = ldb leading dimension of B.
+     */
+
+    // Offset the used leading dimension by the size of floats
+    lsl(x2, x2, 2),  // x2 * 4 = x2 * sizeof(float)
+    lsl(x3, x3, 2),  // x3 * 4 = x3 * sizeof(float)
+
+    mov(x8, x0),  // column of a
+    mov(x9, x1),  // column of b
+  });
+  assembler.add(constants.load());
+
+  assembler.add(mov(x16, n));  // x16 iterator for the n loop
+  assembler.label("unary_loop_over_N");
+  assembler.add({
+    mov(x10, x8),  // current row of a
+    mov(x11, x9),  // current row of b
+  });
+
+  if (m_loop > 0)
+  {
+    assembler.add(mov(x17, m_loop));  // x17 iterator for the m loop
+    assembler.label("unary_loop_over_M");
+    assembler.add(ld1Post(v0, t4s, v1, t4s, x10, 16 * 2));  // ld1 {v0.4s, v1.4s}, [x10], #32
+    assembler.add(interleave(chain_0, chain_1));
+    assembler.add({
+      st1Post(v0, t4s, v1, t4s, x11, 16 * 2),  // st1 {v0.4s, v1.4s}, [x11], #32
+      sub(x17, x17, 1),                        // sub x17, x17, #1
+    });
+    assembler.add(cbnz(x17, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+  }
+
+  // Four of the rest in a q register, the remaining elements in a single partial register
+  if (m_rest >= 4)
+  {
+    assembler.add(ldrPost(q0, x10, 16));  // ldr q0, [x10], #16
+    assembler.add(chain_0);
+    assembler.add(strPost(q0, x11, 16));  // str q0, [x11], #16
+  }
+  if (m_rest % 4 != 0)
+  {
+    const row_piece_t piece = {0, m_rest % 4 * 4};
+    assembler.add(load_piece(0, x10, piece));  // x14 holds the addresses of inserted lanes
+    assembler.add(chain_0);
+    assembler.add(store_piece(0, x11, piece));
+  }
+
+  assembler.add({
+    add(x8, x8, x2),   // next column of a
+    add(x9, x9, x3),   // next column of b
+    sub(x16, x16, 1),  // sub x16, x16, #1
+  });
+  assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+  assembler.add(ret());
+  assembler.finalize();
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_activation.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,45 @@
+#ifndef MINI_JIT_KERNELS_UNARY_ACTIVATION_H
+#define MINI_JIT_KERNELS_UNARY_ACTIVATION_H
+
+#include "../../Kernel.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /**
+     * Activation functions of unary_activation with the maximum error in units in the last place (ULP) of the single-precision
+     * result, measured against a double-precision reference on the given range.
+     * The errors of the GELUs grow in their negative tails, where the result is the product of x and a small factor whose relative
+     * error follows the absolute error of its argument, e.g. about 200 ULP at -12.
+     * NaN propagates, silu and gelu_tanh of -inf are -0.
+     */
+    enum class unary_activation_t : uint32_t
+    {
+      exp = 0,        //!< exp(x), at most 2 ULP on [-87.3, 88.7], subnormal results below and infinity above
+      sigmoid = 1,    //!< 1 / (1 + exp(-x)), at most 3 ULP on [-87, inf) and zero below -89
+      tanh = 2,       //!< rational approximation of tanh(x), at most 5 ULP on (-inf, inf)
+      gelu_erf = 3,   //!< x / 2 * (1 + erf(x / sqrt(2))), at most 8 ULP on [-2, inf) and 22 ULP on [-4, inf)
+      gelu_tanh = 4,  //!< x / 2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))), at most 6 ULP on [-2, inf) and 18 ULP on [-4, inf)
+      silu = 5,       //!< x / (1 + exp(-x)), at most 3 ULP on [-87, inf)
+    };
+
+    /**
+     * @brief Generates a M x N unary kernel that applies an activation function to the fp32 elements of column-major matrices.
+     * exp splits x into 2n * ln(2) + r with |r| <= ln(2), evaluates the Taylor polynomial of degree 9 on r and multiplies twice by 2^n,
+     * which keeps the subnormal results and overflows to infinity. sigmoid, silu and gelu_tanh divide by 1 + exp(-y), gelu_erf
+     * evaluates erfc with the rational approximation of Numerical Recipes and tanh the rational function of Eigen.
+     * Each iteration computes eight elements of a column in two independent chains, the constants are held in v14 to v31.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B.
+     * @param n The columns of A and B.
+     * @param activation The function that is applied to each element.
+     */
+    void unary_activation(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const unary_activation_t activation);
+
+  }  // namespace kernels
+}    // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_UNARY_ACTIVATION_H
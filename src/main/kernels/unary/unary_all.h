@@ -1,10 +1,14 @@
 #ifndef MINI_JIT_KERNELS_UNARY_ALL_H
 #define MINI_JIT_KERNELS_UNARY_ALL_H
 
+#include "unary_activation.h"
+#include "unary_fp16.h"
+#include "unary_fp64.h"
 #include "unary_identity.h"
 #include "unary_identity_transpose.h"
 #include "unary_relu.h"
 #include "unary_relu_transpose.h"
+#include "unary_sve.h"
 #include "unary_zero.h"
 #include "unary_zero_16m_n.h"
 
@@ -0,0 +1,312 @@
+#include "unary_fp16.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+#include "../row_piece.h"
+#include <format>
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::load_piece;
+  using mini_jit::kernels::row_piece_t;
+  using mini_jit::kernels::store_piece;
+
+  //! operation applied to each element
+  enum class op_t
+  {
+    zero,
+    identity,
+    relu
+  };
+
+  /**
+   * Applies the operation to the vector registers [first, first + count) that hold the loaded elements.
+   * v31 holds zeros to compute the relu with fmax.
+   */
+  void add_operation(mini_jit::Assembler &assembler, op_t op, uint32_t first, uint32_t count)
+  {
+    if (op != op_t::relu)
+    {
+      return;
+    }
+
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+      VGeneral v = static_cast<VGeneral>(i);
+      assembler.add(fmax(v, t8h, v, t8h, v31, t8h));  // fmax v<i>.8h, v<i>.8h, v31.8h
+    }
+  }
+
+  /**
+   * Generates B := op(A) on column-major M x N matrices, 32 elements of a column per iteration.
+   */
+  void add_column_major(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, op_t op)
+  {
+    release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+    release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+    const uint32_t m_loop = m / 32;
+    const uint32_t m_rest = m % 32;
+
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input). Unused for zero unary kernel.
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A. Unused for zero unary kernel.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of halves
+      lsl(x2, x2, 1),  // x2 * 2 = x2 * sizeof(fp16)
+      lsl(x3, x3, 1),  // x3 * 2 = x3 * sizeof(fp16)
+
+      mov(x8, x0),  // column of a
+      mov(x9, x1),  // column of b
+
+      eor(v31, t16b, v31, t16b, v31, t16b),  // Zero the v31 register to use fmax vector
+    });
+
+    if (op == op_t::zero)
+    {
+      assembler.add({
+        eor(v0, t16b, v0, t16b, v0, t16b),  // Zero the v0 register
+        eor(v1, t16b, v1, t16b, v1, t16b),  // Zero the v1 register
+        eor(v2, t16b, v2, t16b, v2, t16b),  // Zero the v2 register
+        eor(v3, t16b, v3, t16b, v3, t16b),  // Zero the v3 register
+      });
+    }
+
+    assembler.add(mov(x16, n));  // x16 iterator for the n loop
+    assembler.label("unary_loop_over_N");
+    assembler.add({
+      mov(x10, x8),  // current row of a
+      mov(x11, x9),  // current row of b
+    });
+
+    if (m_loop > 0)
+    {
+      assembler.add(mov(x17, m_loop));  // x17 iterator for the m loop
+      assembler.label("unary_loop_over_M");
+      if (op != op_t::zero)
+      {
+        assembler.add(ld1Post(v0, t8h, v1, t8h, v2, t8h, v3, t8h, x10, 16 * 4));  // ld1 {v0.8h-v3.8h}, [x10], #64
+      }
+      add_operation(assembler, op, 0, 4);
+      assembler.add({
+        st1Post(v0, t8h, v1, t8h, v2, t8h, v3, t8h, x11, 16 * 4),  // st1 {v0.8h-v3.8h}, [x11], #64
+        sub(x17, x17, 1),                                          // sub x17, x17, #1
+      });
+      assembler.add(cbnz(x17, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    // Eights of the rest in q registers, the remaining elements in a single partial register
+    for (uint32_t i = 0; i < m_rest / 8; ++i)
+    {
+      if (op != op_t::zero)
+      {
+        assembler.add(ldrPost(static_cast<V128Bit>(i), x10, 16));  // ldr q<i>, [x10], #16
+      }
+      add_operation(assembler, op, i, 1);
+      assembler.add(strPost(static_cast<V128Bit>(i), x11, 16));  // str q<i>, [x11], #16
+    }
+    if (m_rest % 8 != 0)
+    {
+      const row_piece_t piece = {0, m_rest % 8 * 2};
+      if (op != op_t::zero)
+      {
+        assembler.add(load_piece(3, x10, piece));  // x14 holds the addresses of inserted lanes
+      }
+      add_operation(assembler, op, 3, 1);
+      assembler.add(store_piece(3, x11, piece));
+    }
+
+    assembler.add({
+      add(x8, x8, x2),   // next column of a
+      add(x9, x9, x3),   // next column of b
+      sub(x16, x16, 1),  // sub x16, x16, #1
+    });
+    assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+
+  /**
+   * Generates B := op(A)^T for a column-major M x N matrix A, i.e. B is a column-major N x M matrix.
+   * Blocks of 4x4 elements are transposed in registers with trn1 and trn2 on the halves followed by the pairs of halves.
+   */
+  void add_transpose(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, op_t op)
+  {
+    release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+    release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+    const uint32_t m_loop = m / 4;
+    const uint32_t n_loop = n / 4;
+
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input).
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of halves
+      lsl(x2, x2, 1),  // x2 * 2 = x2 * sizeof(fp16)
+      lsl(x3, x3, 1),  // x3 * 2 = x3 * sizeof(fp16)
+
+      mov(x8, x0),  // column quad of a
+      mov(x9, x1),  // row quad of b
+
+      eor(v31, t16b, v31, t16b, v31, t16b),  // Zero the v31 register to use fmax vector
+    });
+
+    if (n_loop > 0)
+    {
+      assembler.add(mov(x16, n_loop));  // x16 iterator for the column quads of a
+      assembler.label("unary_loop_over_N");
+      assembler.add({
+        mov(x10, x8),       // first column of the quad of a
+        add(x12, x10, x2),  // second column of the quad of a
+        add(x13, x12, x2),  // third column of the quad of a
+        add(x15, x13, x2),  // fourth column of the quad of a
+        mov(x11, x9),       // column of b
+      });
+
+      if (m_loop > 0)
+      {
+        assembler.add(mov(x17, m_loop));  // x17 iterator for the row quads of a
+        assembler.label("unary_loop_over_M");
+        assembler.add({
+          ldrPost(d0, x10, 8),              // ldr d0, [x10], #8 // a[i:i+3, j]
+          ldrPost(d1, x12, 8),              // ldr d1, [x12], #8 // a[i:i+3, j+1]
+          ldrPost(d2, x13, 8),              // ldr d2, [x13], #8 // a[i:i+3, j+2]
+          ldrPost(d3, x15, 8),              // ldr d3, [x15], #8 // a[i:i+3, j+3]
+          trn1(v4, t4h, v0, t4h, v1, t4h),  // trn1 v4.4h, v0.4h, v1.4h // a[i, j:j+1], a[i+2, j:j+1]
+          trn2(v5, t4h, v0, t4h, v1, t4h),  // trn2 v5.4h, v0.4h, v1.4h // a[i+1, j:j+1], a[i+3, j:j+1]
+          trn1(v6, t4h, v2, t4h, v3, t4h),  // trn1 v6.4h, v2.4h, v3.4h // a[i, j+2:j+3], a[i+2, j+2:j+3]
+          trn2(v7, t4h, v2, t4h, v3, t4h),  // trn2 v7.4h, v2.4h, v3.4h // a[i+1, j+2:j+3], a[i+3, j+2:j+3]
+          trn1(v0, t2s, v4, t2s, v6, t2s),  // trn1 v0.2s, v4.2s, v6.2s // a[i, j:j+3]
+          trn1(v1, t2s, v5, t2s, v7, t2s),  // trn1 v1.2s, v5.2s, v7.2s // a[i+1, j:j+3]
+          trn2(v2, t2s, v4, t2s, v6, t2s),  // trn2 v2.2s, v4.2s, v6.2s // a[i+2, j:j+3]
+          trn2(v3, t2s, v5, t2s, v7, t2s),  // trn2 v3.2s, v5.2s, v7.2s // a[i+3, j:j+3]
+        });
+        add_operation(assembler, op, 0, 4);
+        assembler.add({
+          str(d0, x11),       // str d0, [x11] // b[j:j+3, i]
+          add(x11, x11, x3),  // next column of b
+          str(d1, x11),       // str d1, [x11] // b[j:j+3, i+1]
+          add(x11, x11, x3),  // next column of b
+          str(d2, x11),       // str d2, [x11] // b[j:j+3, i+2]
+          add(x11, x11, x3),  // next column of b
+          str(d3, x11),       // str d3, [x11] // b[j:j+3, i+3]
+          add(x11, x11, x3),  // next column of b
+          sub(x17, x17, 1),   // sub x17, x17, #1
+        });
+        assembler.add(cbnz(x17, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+
+      for (uint32_t i = 0; i < m % 4; ++i)
+      {
+        assembler.add({
+          ldrPost(h0, x10, 2),              // ldr h0, [x10], #2 // a[i, j]
+          ldrPost(h1, x12, 2),              // ldr h1, [x12], #2 // a[i, j+1]
+          ldrPost(h2, x13, 2),              // ldr h2, [x13], #2 // a[i, j+2]
+          ldrPost(h3, x15, 2),              // ldr h3, [x15], #2 // a[i, j+3]
+          trn1(v4, t4h, v0, t4h, v1, t4h),  // trn1 v4.4h, v0.4h, v1.4h // a[i, j:j+1]
+          trn1(v6, t4h, v2, t4h, v3, t4h),  // trn1 v6.4h, v2.4h, v3.4h // a[i, j+2:j+3]
+          trn1(v0, t2s, v4, t2s, v6, t2s),  // trn1 v0.2s, v4.2s, v6.2s // a[i, j:j+3]
+        });
+        add_operation(assembler, op, 0, 1);
+        assembler.add({
+          str(d0, x11),       // str d0, [x11] // b[j:j+3, i]
+          add(x11, x11, x3),  // next column of b
+        });
+      }
+
+      assembler.add({
+        add(x8, x8, x2),   // next column quad of a
+        add(x8, x8, x2),   // next column quad of a
+        add(x8, x8, x2),   // next column quad of a
+        add(x8, x8, x2),   // next column quad of a
+        add(x9, x9, 8),    // next row quad of b
+        sub(x16, x16, 1),  // sub x16, x16, #1
+      });
+      assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    // Each of the last columns of a becomes one of the last rows of b
+    for (uint32_t j = 0; j < n % 4; ++j)
+    {
+      std::string label = std::format("unary_loop_over_M_rest_{}", j);
+      assembler.add({
+        mov(x10, x8),  // last column of a
+        mov(x11, x9),  // last row of b
+        mov(x17, m),   // x17 iterator for the rows of a
+      });
+      assembler.label(label);
+      assembler.add(ldrPost(h0, x10, 2));  // ldr h0, [x10], #2
+      add_operation(assembler, op, 0, 1);
+      assembler.add({
+        str(h0, x11),       // str h0, [x11]
+        add(x11, x11, x3),  // next column of b
+        sub(x17, x17, 1),   // sub x17, x17, #1
+      });
+      assembler.add(cbnz(x17, 0), label, mini_jit::Assembler::relocation_t::imm19);
+      assembler.add({
+        add(x8, x8, x2),  // next column of a
+        add(x9, x9, 2),   // next row of b
+      });
+    }
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+}  // namespace
+
+void mini_jit::kernels::unary_zero_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::zero);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_zero_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_identity_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::identity);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_identity_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_relu_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::relu);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_relu_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_identity_transpose_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_transpose(kernel, m, n, op_t::identity);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_identity_transpose_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_relu_transpose_fp16(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_transpose(kernel, m, n, op_t::relu);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_relu_transpose_fp16.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
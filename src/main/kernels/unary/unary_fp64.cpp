@@ -0,0 +1,278 @@
+#include "unary_fp64.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+
+  //! operation applied to each element
+  enum class op_t
+  {
+    zero,
+    identity,
+    relu
+  };
+
+  /**
+   * Applies the operation to the vector registers [first, first + count) that hold the loaded elements.
+   * v31 holds zeros to compute the relu with fmax.
+   */
+  void add_operation(mini_jit::Assembler &assembler, op_t op, uint32_t first, uint32_t count)
+  {
+    if (op != op_t::relu)
+    {
+      return;
+    }
+
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+      VGeneral v = static_cast<VGeneral>(i);
+      assembler.add(fmax(v, t2d, v, t2d, v31, t2d));  // fmax v<i>.2d, v<i>.2d, v31.2d
+    }
+  }
+
+  /**
+   * Generates B := op(A) on column-major M x N matrices, eight elements of a column per iteration.
+   */
+  void add_column_major(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, op_t op)
+  {
+    release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+    release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+    const uint32_t m_loop = m / 8;
+    const uint32_t m_rest = m % 8;
+
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input). Unused for zero unary kernel.
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A. Unused for zero unary kernel.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of doubles
+      lsl(x2, x2, 3),  // x2 * 8 = x2 * sizeof(double)
+      lsl(x3, x3, 3),  // x3 * 8 = x3 * sizeof(double)
+
+      mov(x8, x0),  // column of a
+      mov(x9, x1),  // column of b
+
+      eor(v31, t16b, v31, t16b, v31, t16b),  // Zero the v31 register to use fmax vector
+    });
+
+    if (op == op_t::zero)
+    {
+      assembler.add({
+        eor(v0, t16b, v0, t16b, v0, t16b),  // Zero the v0 register
+        eor(v1, t16b, v1, t16b, v1, t16b),  // Zero the v1 register
+        eor(v2, t16b, v2, t16b, v2, t16b),  // Zero the v2 register
+        eor(v3, t16b, v3, t16b, v3, t16b),  // Zero the v3 register
+      });
+    }
+
+    assembler.add(mov(x16, n));  // x16 iterator for the n loop
+    assembler.label("unary_loop_over_N");
+    assembler.add({
+      mov(x10, x8),  // current row of a
+      mov(x11, x9),  // current row of b
+    });
+
+    if (m_loop > 0)
+    {
+      assembler.add(mov(x17, m_loop));  // x17 iterator for the m loop
+      assembler.label("unary_loop_over_M");
+      if (op != op_t::zero)
+      {
+        assembler.add(ld1Post(v0, t2d, v1, t2d, v2, t2d, v3, t2d, x10, 8 * 8));  // ld1 {v0.2d-v3.2d}, [x10], #64
+      }
+      add_operation(assembler, op, 0, 4);
+      assembler.add({
+        st1Post(v0, t2d, v1, t2d, v2, t2d, v3, t2d, x11, 8 * 8),  // st1 {v0.2d-v3.2d}, [x11], #64
+        sub(x17, x17, 1),                                         // sub x17, x17, #1
+      });
+      assembler.add(cbnz(x17, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    // Pairs of the rest in q registers, a single remaining element in a d register
+    for (uint32_t i = 0; i < m_rest / 2; ++i)
+    {
+      if (op != op_t::zero)
+      {
+        assembler.add(ldrPost(static_cast<V128Bit>(i), x10, 16));  // ldr q<i>, [x10], #16
+      }
+      add_operation(assembler, op, i, 1);
+      assembler.add(strPost(static_cast<V128Bit>(i), x11, 16));  // str q<i>, [x11], #16
+    }
+    if (m_rest % 2 == 1)
+    {
+      if (op != op_t::zero)
+      {
+        assembler.add(ldr(d3, x10));  // ldr d3, [x10]
+      }
+      add_operation(assembler, op, 3, 1);
+      assembler.add(str(d3, x11));  // str d3, [x11]
+    }
+
+    assembler.add({
+      add(x8, x8, x2),   // next column of a
+      add(x9, x9, x3),   // next column of b
+      sub(x16, x16, 1),  // sub x16, x16, #1
+    });
+    assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+
+  /**
+   * Generates B := op(A)^T for a column-major M x N matrix A, i.e. B is a column-major N x M matrix.
+   * Blocks of 2x2 elements are transposed in registers with trn1 and trn2.
+   */
+  void add_transpose(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, op_t op)
+  {
+    release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+    release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+    const uint32_t m_loop = m / 2;
+    const uint32_t n_loop = n / 2;
+
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input).
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of doubles
+      lsl(x2, x2, 3),  // x2 * 8 = x2 * sizeof(double)
+      lsl(x3, x3, 3),  // x3 * 8 = x3 * sizeof(double)
+
+      mov(x8, x0),  // column pair of a
+      mov(x9, x1),  // row pair of b
+
+      eor(v31, t16b, v31, t16b, v31, t16b),  // Zero the v31 register to use fmax vector
+    });
+
+    if (n_loop > 0)
+    {
+      assembler.add(mov(x16, n_loop));  // x16 iterator for the column pairs of a
+      assembler.label("unary_loop_over_N");
+      assembler.add({
+        mov(x10, x8),      // first column of the pair of a
+        add(x12, x8, x2),  // second column of the pair of a
+        mov(x11, x9),      // column of b
+      });
+
+      if (m_loop > 0)
+      {
+        assembler.add(mov(x17, m_loop));  // x17 iterator for the row pairs of a
+        assembler.label("unary_loop_over_M");
+        assembler.add({
+          ldrPost(q0, x10, 16),             // ldr q0, [x10], #16 // a[i:i+1, j]
+          ldrPost(q1, x12, 16),             // ldr q1, [x12], #16 // a[i:i+1, j+1]
+          trn1(v2, t2d, v0, t2d, v1, t2d),  // trn1 v2.2d, v0.2d, v1.2d // a[i, j:j+1]
+          trn2(v3, t2d, v0, t2d, v1, t2d),  // trn2 v3.2d, v0.2d, v1.2d // a[i+1, j:j+1]
+        });
+        add_operation(assembler, op, 2, 2);
+        assembler.add({
+          str(q2, x11),       // str q2, [x11] // b[j:j+1, i]
+          add(x11, x11, x3),  // next column of b
+          str(q3, x11),       // str q3, [x11] // b[j:j+1, i+1]
+          add(x11, x11, x3),  // next column of b
+          sub(x17, x17, 1),   // sub x17, x17, #1
+        });
+        assembler.add(cbnz(x17, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);
+      }
+
+      if (m % 2 == 1)
+      {
+        assembler.add({
+          ldr(d0, x10),                     // ldr d0, [x10] // a[m-1, j]
+          ldr(d1, x12),                     // ldr d1, [x12] // a[m-1, j+1]
+          trn1(v2, t2d, v0, t2d, v1, t2d),  // trn1 v2.2d, v0.2d, v1.2d // a[m-1, j:j+1]
+        });
+        add_operation(assembler, op, 2, 1);
+        assembler.add(str(q2, x11));  // str q2, [x11] // b[j:j+1, m-1]
+      }
+
+      assembler.add({
+        add(x8, x8, x2),   // next column pair of a
+        add(x8, x8, x2),   // next column pair of a
+        add(x9, x9, 16),   // next row pair of b
+        sub(x16, x16, 1),  // sub x16, x16, #1
+      });
+      assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    if (n % 2 == 1)
+    {
+      // The last column of a becomes the last row of b
+      assembler.add({
+        mov(x10, x8),  // last column of a
+        mov(x11, x9),  // last row of b
+        mov(x17, m),   // x17 iterator for the rows of a
+      });
+      assembler.label("unary_loop_over_M_rest");
+      assembler.add(ldrPost(d0, x10, 8));  // ldr d0, [x10], #8
+      add_operation(assembler, op, 0, 1);
+      assembler.add({
+        str(d0, x11),       // str d0, [x11]
+        add(x11, x11, x3),  // next column of b
+        sub(x17, x17, 1),   // sub x17, x17, #1
+      });
+      assembler.add(cbnz(x17, 0), "unary_loop_over_M_rest", mini_jit::Assembler::relocation_t::imm19);
+    }
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+}  // namespace
+
+void mini_jit::kernels::unary_zero_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::zero);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_zero_fp64.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_identity_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::identity);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_identity_fp64.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_relu_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_column_major(kernel, m, n, op_t::relu);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_relu_fp64.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_identity_transpose_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_transpose(kernel, m, n, op_t::identity);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_identity_transpose_fp64.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
+
+void mini_jit::kernels::unary_relu_transpose_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n)
+{
+  add_transpose(kernel, m, n, op_t::relu);
+
+#ifdef SAVE_JITS_TO_FILE
+  kernel.write("unary_relu_transpose_fp64.bin");
+#endif  // SAVE_JITS_TO_FILE
+}
@@ -0,0 +1,59 @@
+#ifndef MINI_JIT_KERNELS_UNARY_FP64_H
+#define MINI_JIT_KERNELS_UNARY_FP64_H
+
+#include "../../Kernel.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /**
+     * @brief Generates a M x N unary zero kernel on fp64 elements.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of B.
+     * @param n The columns of B.
+     */
+    void unary_zero_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n);
+
+    /**
+     * @brief Generates a M x N unary identity kernel on fp64 elements.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B.
+     * @param n The columns of A and B.
+     */
+    void unary_identity_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n);
+
+    /**
+     * @brief Generates a M x N unary relu kernel on fp64 elements.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B.
+     * @param n The columns of A and B.
+     */
+    void unary_relu_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n);
+
+    /**
+     * @brief Generates a M x N unary identity kernel on fp64 elements that stores the transposed matrix in B.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and the columns of B.
+     * @param n The columns of A and the rows of B.
+     */
+    void unary_identity_transpose_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n);
+
+    /**
+     * @brief Generates a M x N unary relu kernel on fp64 elements that stores the transposed matrix in B.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and the columns of B.
+     * @param n The columns of A and the rows of B.
+     */
+    void unary_relu_transpose_fp64(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n);
+
+  }  // namespace kernels
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_UNARY_FP64_H
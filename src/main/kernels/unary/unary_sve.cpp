@@ -0,0 +1,128 @@
+#include "unary_sve.h"
+#include "../../Assembler.h"
+#include "../../arm_instructions/arm_all.h"
+
+namespace
+{
+  using namespace mini_jit::arm_instructions;
+  using mini_jit::kernels::dtype_t;
+
+  //! vectors of a column that are processed per iteration
+  constexpr uint32_t unroll_vectors = 4;
+
+  //! operation applied to each element
+  enum class op_t
+  {
+    zero,
+    identity,
+    relu
+  };
+
+  /**
+   * Generates B := op(A) on column-major M x N matrices, four vectors of a column per iteration.
+   * The rows behind m are masked by whilelt predicates, hence the kernel works for any vector length and needs no remainder code.
+   */
+  void add_column_major(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype, op_t op)
+  {
+    release_assert(m != 0, "Cannot use a matrix with a m of size zero.");
+    release_assert(n != 0, "Cannot use a matrix with a n of size zero.");
+
+    const bool is_fp64 = dtype == dtype_t::fp64;
+    const uint32_t shift = mini_jit::kernels::get_dtype_shift(dtype);
+    auto z = [](uint32_t index) { return static_cast<ZScalable>(index); };
+    auto p = [](uint32_t index) { return static_cast<PPredicate>(index); };
+    auto whilelt_elements = [is_fp64](PPredicate Pd, R64Bit Xn, R64Bit Xm)
+    { return is_fp64 ? whilelt(Pd, td, Xn, Xm) : whilelt(Pd, ts, Xn, Xm); };
+
+    mini_jit::Assembler assembler(kernel);
+    assembler.add({
+      /**
+       * @param x0 = a pointer to column-major matrix A (Input). Unused for zero unary kernel.
+       * @param x1 = b pointer to column-major matrix B (Output).
+       * @param x2 = lda leading dimension of A. Unused for zero unary kernel.
+       * @param x3 = ldb leading dimension of B.
+       */
+
+      // Offset the used leading dimension by the size of the elements
+      lsl(x2, x2, shift),  // x2 * sizeof(element)
+      lsl(x3, x3, shift),  // x3 * sizeof(element)
+
+      mov(x8, x0),  // column of a
+      mov(x9, x1),  // column of b
+      mov(x17, m),  // rows of a and b, the bound of the predicates
+    });
+
+    if (op == op_t::zero)
+    {
+      for (uint32_t i = 0; i < unroll_vectors; ++i)
+      {
+        assembler.add(is_fp64 ? dup(z(i), td, 0) : dup(z(i), ts, 0));  // mov z<i>, #0
+      }
+    }
+
+    assembler.add(mov(x16, n));  // x16 iterator for the n loop
+    assembler.label("unary_loop_over_N");
+    assembler.add({
+      mov(x10, x8),                    // current row of a
+      mov(x11, x9),                    // current row of b
+      mov(x15, 0u),                    // index of the current row
+      whilelt_elements(p0, x15, x17),  // rows of the first vector
+    });
+
+    assembler.label("unary_loop_over_M");
+    for (uint32_t i = 1; i < unroll_vectors; ++i)
+    {
+      assembler.add({
+        is_fp64 ? incd(x15) : incw(x15),   // row of vector i
+        whilelt_elements(p(i), x15, x17),  // rows of vector i
+      });
+    }
+    for (uint32_t i = 0; i < unroll_vectors; ++i)
+    {
+      const int32_t offset = static_cast<int32_t>(i);
+      if (op != op_t::zero)
+      {
+        // ld1 {z<i>}, p<i>/z, [x10, #i, mul vl]
+        assembler.add(is_fp64 ? ld1d(z(i), td, p(i), x10, offset) : ld1w(z(i), ts, p(i), x10, offset));
+      }
+      if (op == op_t::relu)
+      {
+        assembler.add(is_fp64 ? fmax(z(i), td, p(i), 0.0) : fmax(z(i), ts, p(i), 0.0));  // fmax z<i>, p<i>/m, z<i>, #0.0
+      }
+      // st1 {z<i>}, p<i>, [x11, #i, mul vl]
+      assembler.add(is_fp64 ? st1d(z(i), td, p(i), x11, offset) : st1w(z(i), ts, p(i), x11, offset));
+    }
+    assembler.add({
+      addvl(x10, x10, unroll_vectors),  // next vectors of a
+      addvl(x11, x11, unroll_vectors),  // next vectors of b
+      is_fp64 ? incd(x15) : incw(x15),  // row of the next iteration
+      whilelt_elements(p0, x15, x17),   // rows of the first vector
+    });
+    assembler.add(b(Condition::first, 0), "unary_loop_over_M", mini_jit::Assembler::relocation_t::imm19);  // b.first unary_loop_over_M
+
+    assembler.add({
+      add(x8, x8, x2),   // next column of a
+      add(x9, x9, x3),   // next column of b
+      sub(x16, x16, 1),  // sub x16, x16, #1
+    });
+    assembler.add(cbnz(x16, 0), "unary_loop_over_N", mini_jit::Assembler::relocation_t::imm19);
+
+    assembler.add(ret());
+    assembler.finalize();
+  }
+}  // namespace
+
+void mini_jit::kernels::unary_zero_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype)
+{
+  add_column_major(kernel, m, n, dtype, op_t::zero);
+}
+
+void mini_jit::kernels::unary_identity_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype)
+{
+  add_column_major(kernel, m, n, dtype, op_t::identity);
+}
+
+void mini_jit::kernels::unary_relu_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype)
+{
+  add_column_major(kernel, m, n, dtype, op_t::relu);
+}
@@ -0,0 +1,45 @@
+#ifndef MINI_JIT_KERNELS_UNARY_SVE_H
+#define MINI_JIT_KERNELS_UNARY_SVE_H
+
+#include "../../Kernel.h"
+#include "../dtype.h"
+#include <cstdint>
+
+namespace mini_jit
+{
+  namespace kernels
+  {
+    /**
+     * @brief Generates a vector-length agnostic M x N unary zero kernel with the Scalable Vector Extension.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of B.
+     * @param n The columns of B.
+     * @param dtype The data type of the elements.
+     */
+    void unary_zero_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype);
+
+    /**
+     * @brief Generates a vector-length agnostic M x N unary identity kernel with the Scalable Vector Extension.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B.
+     * @param n The columns of A and B.
+     * @param dtype The data type of the elements.
+     */
+    void unary_identity_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype);
+
+    /**
+     * @brief Generates a vector-length agnostic M x N unary relu kernel with the Scalable Vector Extension.
+     *
+     * @param kernel The kernel to add instructions too.
+     * @param m The rows of A and B.
+     * @param n The columns of A and B.
+     * @param dtype The data type of the elements.
+     */
+    void unary_relu_sve(mini_jit::Kernel &kernel, const uint32_t m, const uint32_t n, const dtype_t dtype);
+
+  }  // namespace kernels
+}  // namespace mini_jit
+
+#endif  // MINI_JIT_KERNELS_UNARY_SVE_H
@@ -0,0 +1,61 @@
+#include "../main/Assembler.h"
+#include "../main/Kernel.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test assembler resolves backward branches", "[assembler][correctness]")
+{
+  mini_jit::Kernel kernel;
+  mini_jit::Assembler assembler(kernel);
+
+  assembler.add(mov(x15, 8));
+  assembler.label("loop");
+  assembler.add({sub(x15, x15, 1), add(x0, x0, 4)});
+  assembler.add(cbnz(x15, 0), "loop", mini_jit::Assembler::relocation_t::imm19);
+  assembler.add(ret());
+  assembler.finalize();
+
+  std::vector<uint32_t> expected = {mov(x15, 8), sub(x15, x15, 1), add(x0, x0, 4), cbnz(x15, -2 * 4), ret()};
+  REQUIRE(kernel.get_buffer() == expected);
+  REQUIRE(assembler.get_label_offset("loop") == 4);
+}
+
+TEST_CASE("Test assembler resolves forward branches", "[assembler][correctness]")
+{
+  mini_jit::Kernel kernel;
+  mini_jit::Assembler assembler(kernel);
+
+  assembler.add(cbnz(w1, 0), "skip", mini_jit::Assembler::relocation_t::imm19);
+  assembler.add(b(0), "end", mini_jit::Assembler::relocation_t::imm26);
+  assembler.label("skip");
+  assembler.add(mov(x0, x1));
+  assembler.label("end");
+  assembler.add(ret());
+  assembler.finalize();
+
+  std::vector<uint32_t> expected = {cbnz(w1, 2 * 4), b(2 * 4), mov(x0, x1), ret()};
+  REQUIRE(kernel.get_buffer() == expected);
+}
+
+TEST_CASE("Test assembler aligns with nops", "[assembler][correctness]")
+{
+  mini_jit::Kernel kernel;
+  mini_jit::Assembler assembler(kernel);
+
+  assembler.add(mov(x15, 4));
+  assembler.align(16);
+  assembler.label("loop");
+  assembler.add(sub(x15, x15, 1));
+  assembler.add(cbnz(x15, 0), "loop", mini_jit::Assembler::relocation_t::imm19);
+  assembler.align(16);
+  assembler.add(ret());
+  assembler.finalize();
+
+  std::vector<uint32_t> expected = {mov(x15, 4), nop(), nop(), nop(), sub(x15, x15, 1), cbnz(x15, -1 * 4), nop(), nop(), ret()};
+  REQUIRE(kernel.get_buffer() == expected);
+  REQUIRE(assembler.get_label_offset("loop") % 16 == 0);
+}
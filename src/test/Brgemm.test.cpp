@@ -1,8 +1,14 @@
 #include "BaseGeneration.test.h"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
 
 TEST_CASE("Test gemm generation (1≤M≤64, 1≤N≤64, K∈[1,16,32,64,128],lda=M, ldb=K, and ldc=M) on random data",
           "[generation][correctness][gemm]")
@@ -248,4 +254,335 @@ TEST_CASE("Test gemm generation (1≤M≤64, 1≤N≤64, K∈[1,16,32,64,128], 1
 
   mini_jit::Brgemm::kernel_t kernel = gemm.get_kernel();
   REQUIRE(kernel != nullptr);
-}
\ No newline at end of file
+}
+TEST_CASE("Test fp64 gemm generation (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][fp64]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 1u));
+  auto N = GENERATE(range(1u, 13u + 1u, 1u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+
+  CAPTURE(M, N, K, BatchSize);
+
+  const int64_t lda = M + 3;
+  const int64_t ldb = K + 2;
+  const int64_t ldc = M + 1;
+  const int64_t batch_stride_a = lda * K;
+  const int64_t batch_stride_b = ldb * N;
+
+  std::vector<double> a(batch_stride_a * BatchSize);
+  std::vector<double> b(batch_stride_b * BatchSize);
+  std::vector<double> c(ldc * N);
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    c[i] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+
+  std::vector<double> c_verify = c;
+  for (uint32_t iB = 0; iB < BatchSize; ++iB)
+  {
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          c_verify[iM + iN * ldc] += a[iM + iK * lda + iB * batch_stride_a] * b[iK + iN * ldb + iB * batch_stride_b];
+        }
+      }
+    }
+  }
+
+  mini_jit::Brgemm gemm;
+  mini_jit::Brgemm::error_t error = gemm.generate(M, N, K, BatchSize, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp64);
+  REQUIRE(error == mini_jit::Brgemm::error_t::success);
+
+  gemm.get_kernel()(a.data(), b.data(), c.data(), lda, ldb, ldc, batch_stride_a, batch_stride_b);
+
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    CAPTURE(i, c[i], c_verify[i]);
+    REQUIRE_THAT(c[i], Catch::Matchers::WithinRel(c_verify[i], 1e-12) || Catch::Matchers::WithinAbs(c_verify[i], 1e-12));
+  }
+}
+
+namespace
+{
+  /**
+   * @brief Executes a brgemm with the given transposed operands, scaling, epilogue and prefetches on random data with padded leading
+   * dimensions and compares it against a naive brgemm. For a beta of zero C is filled with NaNs, which must not be read.
+   * An address or offset batch-reduce lists the matrices of the batch in a shuffled order with repetitions from a larger pool.
+   */
+  template <typename T>
+  void run_transposed_brgemm(const uint32_t M, const uint32_t N, const uint32_t K, const uint32_t BatchSize, const uint32_t trans_a,
+                             const uint32_t trans_b, const uint32_t trans_c, const mini_jit::Brgemm::dtype_t dtype, const T epsilon,
+                             const T alpha = 1, const T beta = 1, const mini_jit::Brgemm::epilogue_t epilogue = {},
+                             const mini_jit::Brgemm::prefetch_t prefetch = {},
+                             const mini_jit::Brgemm::batch_reduce_t batch_reduce = mini_jit::Brgemm::batch_reduce_t::stride)
+  {
+    const int64_t lda = (trans_a ? K : M) + 3;
+    const int64_t ldb = (trans_b ? N : K) + 2;
+    const int64_t ldc = (trans_c ? N : M) + 1;
+    const int64_t batch_stride_a = lda * (trans_a ? M : K);
+    const int64_t batch_stride_b = ldb * (trans_b ? K : N);
+
+    const bool is_strided = batch_reduce == mini_jit::Brgemm::batch_reduce_t::stride;
+    const uint32_t pool_size = is_strided ? BatchSize : BatchSize + 2;
+    std::vector<uint32_t> blocks_a(BatchSize);
+    std::vector<uint32_t> blocks_b(BatchSize);
+    for (uint32_t iB = 0; iB < BatchSize; ++iB)
+    {
+      blocks_a[iB] = is_strided ? iB : (iB * 5 + 3) % pool_size;
+      blocks_b[iB] = is_strided ? iB : (BatchSize - iB) / 2;
+    }
+
+    std::vector<T> a(batch_stride_a * pool_size);
+    std::vector<T> b(batch_stride_b * pool_size);
+    std::vector<T> c(ldc * (trans_c ? M : N));
+    std::vector<T> bias(epilogue.bias == mini_jit::Brgemm::bias_t::row ? M : N);
+    for (std::vector<T> *values : {&a, &b, &c, &bias})
+    {
+      for (T &value : *values)
+      {
+        value = static_cast<T>(std::rand()) / RAND_MAX - 0.5;
+      }
+    }
+
+    std::vector<T> c_verify = c;
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        T sum = 0;
+        for (uint32_t iB = 0; iB < BatchSize; ++iB)
+        {
+          for (uint32_t iK = 0; iK < K; ++iK)
+          {
+            T value_a = a[(trans_a ? iK + iM * lda : iM + iK * lda) + blocks_a[iB] * batch_stride_a];
+            T value_b = b[(trans_b ? iN + iK * ldb : iK + iN * ldb) + blocks_b[iB] * batch_stride_b];
+            sum += value_a * value_b;
+          }
+        }
+
+        const size_t index = trans_c ? iN + iM * ldc : iM + iN * ldc;
+        T value = alpha * sum + (beta == 0 ? 0 : beta * c[index]);
+        if (epilogue.bias != mini_jit::Brgemm::bias_t::none)
+        {
+          value += bias[epilogue.bias == mini_jit::Brgemm::bias_t::row ? iM : iN];
+        }
+        if (epilogue.activation == mini_jit::Brgemm::activation_t::relu)
+        {
+          value = std::max<T>(value, 0);
+        }
+        else if (epilogue.activation == mini_jit::Brgemm::activation_t::clamp)
+        {
+          value = std::clamp<T>(value, epilogue.clamp_min, epilogue.clamp_max);
+        }
+        c_verify[index] = value;
+        if (beta == 0)
+        {
+          c[index] = std::numeric_limits<T>::quiet_NaN();
+        }
+      }
+    }
+
+    mini_jit::Brgemm gemm;
+    mini_jit::Brgemm::error_t error =
+      gemm.generate(M, N, K, BatchSize, trans_a, trans_b, trans_c, dtype, alpha, beta, epilogue, prefetch, batch_reduce);
+    REQUIRE(error == mini_jit::Brgemm::error_t::success);
+
+    if (batch_reduce == mini_jit::Brgemm::batch_reduce_t::address)
+    {
+      std::vector<void const *> pointers_a(BatchSize);
+      std::vector<void const *> pointers_b(BatchSize);
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        pointers_a[iB] = a.data() + blocks_a[iB] * batch_stride_a;
+        pointers_b[iB] = b.data() + blocks_b[iB] * batch_stride_b;
+      }
+      gemm.get_kernel_address()(pointers_a.data(), pointers_b.data(), c.data(), lda, ldb, ldc);
+    }
+    else if (batch_reduce == mini_jit::Brgemm::batch_reduce_t::offset)
+    {
+      std::vector<int64_t> offsets_a(BatchSize);
+      std::vector<int64_t> offsets_b(BatchSize);
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        offsets_a[iB] = blocks_a[iB] * batch_stride_a;
+        offsets_b[iB] = blocks_b[iB] * batch_stride_b;
+      }
+      gemm.get_kernel_offset()(a.data(), b.data(), c.data(), lda, ldb, ldc, offsets_a.data(), offsets_b.data());
+    }
+    else if (epilogue.bias != mini_jit::Brgemm::bias_t::none)
+    {
+      gemm.get_kernel_bias()(a.data(), b.data(), c.data(), lda, ldb, ldc, batch_stride_a, batch_stride_b, bias.data());
+    }
+    else
+    {
+      gemm.get_kernel()(a.data(), b.data(), c.data(), lda, ldb, ldc, batch_stride_a, batch_stride_b);
+    }
+
+    for (size_t i = 0; i < c.size(); ++i)
+    {
+      CAPTURE(i, c[i], c_verify[i]);
+      REQUIRE_THAT(c[i], Catch::Matchers::WithinRel(c_verify[i], epsilon) || Catch::Matchers::WithinAbs(c_verify[i], epsilon));
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test transposed gemm generation (1≤M≤37, 1≤N≤13, K∈[1,3,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][transpose]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 3u));
+  auto N = GENERATE(range(1u, 13u + 1u, 2u));
+  auto K = GENERATE(1u, 3u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto trans_c = GENERATE(0u, 1u);
+
+  CAPTURE(M, N, K, BatchSize, trans_a, trans_b, trans_c);
+  run_transposed_brgemm<float>(M, N, K, BatchSize, trans_a, trans_b, trans_c, mini_jit::Brgemm::dtype_t::fp32, 1e-5);
+}
+
+TEST_CASE("Test transposed fp64 gemm generation (1≤M≤37, 1≤N≤13, K∈[1,3,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][transpose][fp64]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 3u));
+  auto N = GENERATE(range(1u, 13u + 1u, 2u));
+  auto K = GENERATE(1u, 3u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto trans_c = GENERATE(0u, 1u);
+
+  CAPTURE(M, N, K, BatchSize, trans_a, trans_b, trans_c);
+  run_transposed_brgemm<double>(M, N, K, BatchSize, trans_a, trans_b, trans_c, mini_jit::Brgemm::dtype_t::fp64, 1e-12);
+}
+
+TEST_CASE("Test scaled gemm generation (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][scaling]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 4u));
+  auto N = GENERATE(range(1u, 13u + 1u, 3u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_c = GENERATE(0u, 1u);
+  auto scaling = GENERATE(std::pair{1.0f, 0.0f}, std::pair{0.5f, 0.0f}, std::pair{1.0f, 2.5f}, std::pair{-1.5f, 0.75f});
+
+  CAPTURE(M, N, K, BatchSize, trans_c, scaling.first, scaling.second);
+  run_transposed_brgemm<float>(M, N, K, BatchSize, 0, 0, trans_c, mini_jit::Brgemm::dtype_t::fp32, 1e-5, scaling.first, scaling.second);
+}
+
+TEST_CASE("Test scaled fp64 gemm generation (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][scaling][fp64]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 4u));
+  auto N = GENERATE(range(1u, 13u + 1u, 3u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto scaling = GENERATE(std::pair{1.0, 0.0}, std::pair{0.5, 0.0}, std::pair{1.0, 2.5}, std::pair{-1.5, 0.75});
+
+  CAPTURE(M, N, K, BatchSize, trans_a, scaling.first, scaling.second);
+  run_transposed_brgemm<double>(M, N, K, BatchSize, trans_a, 0, 0, mini_jit::Brgemm::dtype_t::fp64, 1e-12, scaling.first,
+                                scaling.second);
+}
+
+TEST_CASE("Test gemm generation with epilogue (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][epilogue]")
+{
+  using bias_t = mini_jit::Brgemm::bias_t;
+  using activation_t = mini_jit::Brgemm::activation_t;
+
+  auto M = GENERATE(range(1u, 37u + 1u, 4u));
+  auto N = GENERATE(range(1u, 13u + 1u, 3u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_c = GENERATE(0u, 1u);
+  auto epilogue = GENERATE(mini_jit::Brgemm::epilogue_t{bias_t::row, activation_t::none},
+                           mini_jit::Brgemm::epilogue_t{bias_t::column, activation_t::none},
+                           mini_jit::Brgemm::epilogue_t{bias_t::none, activation_t::relu},
+                           mini_jit::Brgemm::epilogue_t{bias_t::row, activation_t::relu},
+                           mini_jit::Brgemm::epilogue_t{bias_t::column, activation_t::clamp, -0.25, 0.3});
+
+  CAPTURE(M, N, K, BatchSize, trans_a, trans_c, static_cast<uint32_t>(epilogue.bias), static_cast<uint32_t>(epilogue.activation));
+  run_transposed_brgemm<float>(M, N, K, BatchSize, trans_a, 0, trans_c, mini_jit::Brgemm::dtype_t::fp32, 1e-5, 1, 0, epilogue);
+}
+
+TEST_CASE("Test fp64 gemm generation with epilogue (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, and ldc>M) on random data",
+          "[generation][correctness][gemm][epilogue][fp64]")
+{
+  using bias_t = mini_jit::Brgemm::bias_t;
+  using activation_t = mini_jit::Brgemm::activation_t;
+
+  auto M = GENERATE(range(1u, 37u + 1u, 4u));
+  auto N = GENERATE(range(1u, 13u + 1u, 3u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto epilogue = GENERATE(mini_jit::Brgemm::epilogue_t{bias_t::column, activation_t::relu},
+                           mini_jit::Brgemm::epilogue_t{bias_t::row, activation_t::clamp, -0.25, 0.3});
+
+  CAPTURE(M, N, K, BatchSize, trans_b, static_cast<uint32_t>(epilogue.bias), static_cast<uint32_t>(epilogue.activation));
+  run_transposed_brgemm<double>(M, N, K, BatchSize, 0, trans_b, 0, mini_jit::Brgemm::dtype_t::fp64, 1e-12, 1, 1, epilogue);
+}
+
+TEST_CASE("Test gemm generation with prefetches (1≤M≤37, 1≤N≤13, K∈[1,7,64], 1≤BatchSize≤3, lda>M, ldb>K, ldc>M) on random data",
+          "[generation][correctness][gemm][prefetch]")
+{
+  auto M = GENERATE(range(1u, 37u + 1u, 6u));
+  auto N = GENERATE(range(1u, 13u + 1u, 4u));
+  auto K = GENERATE(1u, 7u, 64u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto prefetch = GENERATE(mini_jit::Brgemm::prefetch_t{8, 0, false}, mini_jit::Brgemm::prefetch_t{0, 8, false},
+                           mini_jit::Brgemm::prefetch_t{0, 0, true}, mini_jit::Brgemm::prefetch_t{16, 4, true});
+
+  CAPTURE(M, N, K, BatchSize, trans_a, trans_b, prefetch.a, prefetch.b, prefetch.c);
+  run_transposed_brgemm<float>(M, N, K, BatchSize, trans_a, trans_b, 0, mini_jit::Brgemm::dtype_t::fp32, 1e-4, 1, 1, {}, prefetch);
+}
+
+TEST_CASE("Test address and offset batch-reduce gemm generation (1≤M≤37, 1≤N≤13, K∈[1,7], BatchSize∈[1,4], lda>M, ldb>K, ldc>M)",
+          "[generation][correctness][gemm][batch_reduce]")
+{
+  using batch_reduce_t = mini_jit::Brgemm::batch_reduce_t;
+
+  auto M = GENERATE(range(1u, 37u + 1u, 4u));
+  auto N = GENERATE(range(1u, 13u + 1u, 3u));
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 4u);
+  auto trans = GENERATE(0u, 1u);
+  auto batch_reduce = GENERATE(batch_reduce_t::address, batch_reduce_t::offset);
+
+  CAPTURE(M, N, K, BatchSize, trans, static_cast<uint32_t>(batch_reduce));
+  run_transposed_brgemm<float>(M, N, K, BatchSize, trans, trans, 0, mini_jit::Brgemm::dtype_t::fp32, 1e-5, 1, 1, {}, {}, batch_reduce);
+  run_transposed_brgemm<double>(M, N, K, BatchSize, 0, trans, trans, mini_jit::Brgemm::dtype_t::fp64, 1e-12, 1, 0,
+                                mini_jit::Brgemm::epilogue_t{mini_jit::Brgemm::bias_t::none, mini_jit::Brgemm::activation_t::relu},
+                                mini_jit::Brgemm::prefetch_t{2, 0, true}, batch_reduce);
+}
+
+TEST_CASE("Test gemm generation rejects a bias with an address or offset batch-reduce", "[generation][gemm][batch_reduce]")
+{
+  using batch_reduce_t = mini_jit::Brgemm::batch_reduce_t;
+
+  auto batch_reduce = GENERATE(batch_reduce_t::address, batch_reduce_t::offset);
+
+  CAPTURE(static_cast<uint32_t>(batch_reduce));
+  mini_jit::Brgemm gemm;
+  mini_jit::Brgemm::error_t error =
+    gemm.generate(16, 4, 3, 2, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, 1, 1,
+                  mini_jit::Brgemm::epilogue_t{mini_jit::Brgemm::bias_t::row, mini_jit::Brgemm::activation_t::none}, {}, batch_reduce);
+  REQUIRE(error == mini_jit::Brgemm::error_t::err_batch_reduce_type_not_supported);
+}
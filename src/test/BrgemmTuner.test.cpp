@@ -0,0 +1,133 @@
+#include "../main/BrgemmTuner.h"
+#include "BaseGeneration.test.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Test brgemm tuner candidates fit into the registers", "[tuner][correctness]")
+{
+  using tile_t = mini_jit::Brgemm::tile_t;
+
+  std::vector<tile_t> expected = {tile_t{}, tile_t{4, 24}, tile_t{8, 12}, tile_t{12, 8}, tile_t{16, 6}, tile_t{24, 4}};
+  REQUIRE(mini_jit::BrgemmTuner::get_candidates(48, 24) == expected);
+
+  expected = {tile_t{}, tile_t{4, 7}, tile_t{8, 7}, tile_t{12, 7}, tile_t{24, 1}};
+  REQUIRE(mini_jit::BrgemmTuner::get_candidates(24, 7) == expected);
+
+  expected = {tile_t{}};
+  REQUIRE(mini_jit::BrgemmTuner::get_candidates(13, 7) == expected);
+
+  for (tile_t tile : mini_jit::BrgemmTuner::get_candidates(60, 36))
+  {
+    REQUIRE(mini_jit::Brgemm::is_valid_tile(60, 36, tile));
+  }
+}
+
+TEST_CASE("Test brgemm tuner remembers tiles per shape class", "[tuner][correctness]")
+{
+  mini_jit::BrgemmTuner tuner;
+
+  REQUIRE(tuner.get_tile(48, 24, 64, 1) == mini_jit::Brgemm::tile_t{});
+
+  tuner.set_tile(48, 24, 64, 1, mini_jit::Brgemm::tile_t{8, 12});
+  REQUIRE(tuner.get_size() == 1);
+  REQUIRE(tuner.get_tile(48, 24, 64, 1) == mini_jit::Brgemm::tile_t{8, 12});
+  REQUIRE(tuner.get_tile(48, 24, 40, 1) == mini_jit::Brgemm::tile_t{8, 12});
+  REQUIRE(tuner.get_tile(48, 24, 65, 1) == mini_jit::Brgemm::tile_t{});
+  REQUIRE(tuner.get_tile(48, 24, 64, 2) == mini_jit::Brgemm::tile_t{});
+
+  tuner.clear();
+  REQUIRE(tuner.get_size() == 0);
+  REQUIRE(tuner.get_tile(48, 24, 64, 1) == mini_jit::Brgemm::tile_t{});
+}
+
+TEST_CASE("Test brgemm rejects invalid tiles", "[tuner][correctness]")
+{
+  REQUIRE_FALSE(mini_jit::Brgemm::is_valid_tile(48, 24, mini_jit::Brgemm::tile_t{6, 4}));
+  REQUIRE_FALSE(mini_jit::Brgemm::is_valid_tile(48, 24, mini_jit::Brgemm::tile_t{16, 8}));
+  REQUIRE_FALSE(mini_jit::Brgemm::is_valid_tile(48, 24, mini_jit::Brgemm::tile_t{20, 4}));
+  REQUIRE(mini_jit::Brgemm::is_valid_tile(13, 7, mini_jit::Brgemm::tile_t{}));
+
+  mini_jit::Brgemm gemm;
+  mini_jit::Brgemm::error_t error = gemm.generate(48, 24, 16, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, mini_jit::Brgemm::tile_t{16, 8});
+  REQUIRE(error == mini_jit::Brgemm::error_t::err_wrong_tile);
+}
+
+TEST_CASE("Test gemm generation of all candidate tiles (M=48, N=24, K=17, 1≤BatchSize≤3) on random data",
+          "[generation][correctness][gemm]")
+{
+  const uint32_t M = 48;
+  const uint32_t N = 24;
+  const uint32_t K = 17;
+  auto BatchSize = GENERATE(1u, 2u, 3u);
+
+  for (mini_jit::Brgemm::tile_t tile : mini_jit::BrgemmTuner::get_candidates(M, N))
+  {
+    CAPTURE(BatchSize, tile.m, tile.n);
+
+    GenerationTest generatorTest(M, N, K, BatchSize);
+    generatorTest.SetUp(TestInfill::Random);
+
+    mini_jit::Brgemm gemm;
+    mini_jit::Brgemm::error_t error = gemm.generate(M, N, K, BatchSize, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, tile);
+    REQUIRE(error == mini_jit::Brgemm::error_t::success);
+
+    generatorTest.SetKernel(gemm.get_kernel());
+    generatorTest.RunTest(M, K, M, M * K, K * N);
+  }
+}
+
+TEST_CASE("Test brgemm tuner picks a candidate tile", "[tuner][correctness]")
+{
+  mini_jit::BrgemmTuner tuner(true);
+  tuner.set_min_time(0.0001);
+
+  mini_jit::Brgemm::tile_t tile = tuner.get_tile(24, 12, 16, 2);
+  std::vector<mini_jit::Brgemm::tile_t> candidates = mini_jit::BrgemmTuner::get_candidates(24, 12);
+
+  REQUIRE(std::find(candidates.begin(), candidates.end(), tile) != candidates.end());
+  REQUIRE(tuner.get_size() == 1);
+  REQUIRE(tuner.get_tile(24, 12, 16, 2) == tile);
+}
+
+TEST_CASE("Test brgemm tuner answers lookups while another thread tunes", "[tuner][parallel][correctness]")
+{
+  using clock = std::chrono::steady_clock;
+
+  mini_jit::BrgemmTuner tuner(true);
+  tuner.set_min_time(0.02);
+  tuner.set_tile(24, 12, 16, 2, mini_jit::Brgemm::tile_t{8, 12});
+
+  // 48 x 24 has six candidates, benchmarking them takes at least 120 ms
+  constexpr size_t threadCount = 4;
+  std::vector<mini_jit::Brgemm::tile_t> tiles(threadCount);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadCount; ++i)
+  {
+    threads.emplace_back([&tuner, &tiles, i]() { tiles[i] = tuner.get_tile(48, 24, 64, 1); });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  clock::time_point start = clock::now();
+  mini_jit::Brgemm::tile_t tile = tuner.get_tile(24, 12, 16, 2);
+  double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+
+  REQUIRE(tile == mini_jit::Brgemm::tile_t{8, 12});
+  REQUIRE(seconds < 0.02);
+
+  // the shape class is benchmarked once, all threads get the same tile
+  for (size_t i = 1; i < threadCount; ++i)
+  {
+    REQUIRE(tiles[i] == tiles[0]);
+  }
+  REQUIRE(tuner.get_size() == 2);
+}
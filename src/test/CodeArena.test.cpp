@@ -0,0 +1,204 @@
+#include "../main/CodeArena.h"
+#include "../main/Kernel.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+namespace
+{
+  /**
+   * Gets the permissions of the mapping containing the given address from /proc/self/maps.
+   *
+   * @param address address inside a mapping.
+   * @return permissions of the mapping, e.g. r-xs, or an empty string if the address is not mapped.
+   */
+  std::string get_permissions(void const *address)
+  {
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+      std::istringstream fields(line);
+      uintptr_t begin = 0;
+      uintptr_t end = 0;
+      char separator = '\0';
+      std::string permissions;
+      fields >> std::hex >> begin >> separator >> end >> permissions;
+      if (reinterpret_cast<uintptr_t>(address) >= begin && reinterpret_cast<uintptr_t>(address) < end)
+      {
+        return permissions;
+      }
+    }
+    return "";
+  }
+}  // namespace
+
+TEST_CASE("Test code arena packs kernels into one region", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena arena;
+
+  std::vector<uint32_t> code = {mov(x0, x1), mov(x2, x3), ret()};
+  std::vector<void *> entries;
+  for (int i = 0; i < 100; ++i)
+  {
+    entries.push_back(arena.allocate(code.data(), code.size() * sizeof(uint32_t)));
+  }
+
+  REQUIRE(arena.get_region_count() == 1);
+  for (size_t i = 0; i < entries.size(); ++i)
+  {
+    CAPTURE(i);
+    REQUIRE(reinterpret_cast<uintptr_t>(entries[i]) % mini_jit::CodeArena::entry_alignment == 0);
+    REQUIRE(std::memcmp(entries[i], code.data(), code.size() * sizeof(uint32_t)) == 0);
+    if (i > 0)
+    {
+      REQUIRE(static_cast<char *>(entries[i]) - static_cast<char *>(entries[i - 1]) ==
+              static_cast<std::ptrdiff_t>(mini_jit::CodeArena::entry_alignment));
+    }
+  }
+
+  for (void *entry : entries)
+  {
+    arena.release(entry);
+  }
+  REQUIRE(arena.get_region_count() == 1);
+  REQUIRE(arena.get_used_bytes() == 0);
+}
+
+TEST_CASE("Test code arena frees full regions in bulk", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena arena;
+
+  std::vector<uint32_t> small = {ret()};
+  std::vector<uint32_t> large(mini_jit::CodeArena::region_size / sizeof(uint32_t) + 1, ret());
+
+  void *first = arena.allocate(small.data(), small.size() * sizeof(uint32_t));
+  void *second = arena.allocate(small.data(), small.size() * sizeof(uint32_t));
+  void *big = arena.allocate(large.data(), large.size() * sizeof(uint32_t));
+
+  REQUIRE(arena.get_region_count() == 2);
+  REQUIRE(std::memcmp(big, large.data(), large.size() * sizeof(uint32_t)) == 0);
+
+  arena.release(first);
+  REQUIRE(arena.get_region_count() == 2);
+  arena.release(second);
+  REQUIRE(arena.get_region_count() == 1);
+
+  arena.release(big);
+  REQUIRE(arena.get_region_count() == 1);
+  REQUIRE(arena.get_used_bytes() == 0);
+}
+
+TEST_CASE("Test code arena with huge pages", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena arena;
+  arena.set_use_huge_pages(true);
+
+  std::vector<uint32_t> code = {mov(x0, x1), ret()};
+  void *entry = arena.allocate(code.data(), code.size() * sizeof(uint32_t));
+
+  REQUIRE(reinterpret_cast<uintptr_t>(entry) % mini_jit::CodeArena::region_size == 0);
+  REQUIRE(std::memcmp(entry, code.data(), code.size() * sizeof(uint32_t)) == 0);
+
+  arena.release(entry);
+}
+
+TEST_CASE("Test kernels are placed in the process-wide code arena", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena &arena = mini_jit::CodeArena::instance();
+  REQUIRE(arena.is_enabled());
+
+  mini_jit::Kernel kernel1;
+  mini_jit::Kernel kernel2;
+  kernel1.add({mov(x0, x1), ret()});
+  kernel2.add({mov(x2, x3), ret()});
+  kernel1.set_kernel();
+  kernel2.set_kernel();
+
+  REQUIRE(reinterpret_cast<uintptr_t>(kernel1.get_kernel()) % mini_jit::CodeArena::entry_alignment == 0);
+  REQUIRE(reinterpret_cast<uintptr_t>(kernel2.get_kernel()) % mini_jit::CodeArena::entry_alignment == 0);
+  REQUIRE(std::memcmp(kernel1.get_kernel(), kernel1.get_buffer().data(), kernel1.get_size()) == 0);
+  REQUIRE(std::memcmp(kernel2.get_kernel(), kernel2.get_buffer().data(), kernel2.get_size()) == 0);
+
+  arena.set_enabled(false);
+  mini_jit::Kernel kernel3;
+  kernel3.add({mov(x4, x5), ret()});
+  kernel3.set_kernel();
+  arena.set_enabled(true);
+
+  REQUIRE(std::memcmp(kernel3.get_kernel(), kernel3.get_buffer().data(), kernel3.get_size()) == 0);
+}
+
+TEST_CASE("Test code arena maps code writable and executable separately", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena arena;
+
+  std::vector<uint32_t> code = {mov(x0, x1), mov(x2, x3), ret()};
+  void *entry = arena.allocate(code.data(), code.size() * sizeof(uint32_t));
+  REQUIRE(arena.is_dual_mapped(entry));
+
+  // the executable view is never writable
+  REQUIRE(get_permissions(entry) == "r-xs");
+
+  uint32_t patched = mov(x4, x5);
+  arena.write(entry, sizeof(uint32_t), &patched, sizeof(patched));
+  REQUIRE(static_cast<uint32_t *>(entry)[1] == patched);
+
+  arena.release(entry);
+}
+
+TEST_CASE("Test code arena without dual mapping", "[code_arena][correctness]")
+{
+  mini_jit::CodeArena arena;
+  arena.set_use_dual_mapping(false);
+
+  std::vector<uint32_t> code = {mov(x0, x1), ret()};
+  void *entry = arena.allocate(code.data(), code.size() * sizeof(uint32_t));
+  void *second = arena.allocate(code.data(), code.size() * sizeof(uint32_t));
+  REQUIRE_FALSE(arena.is_dual_mapped(entry));
+  REQUIRE(arena.get_region_count() == 1);
+
+  // each kernel is sealed on its own pages, the rest of the region stays writable but not executable
+  uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  REQUIRE(reinterpret_cast<uintptr_t>(entry) % page_size == 0);
+  REQUIRE(reinterpret_cast<uintptr_t>(second) == reinterpret_cast<uintptr_t>(entry) + page_size);
+  REQUIRE(std::memcmp(second, code.data(), code.size() * sizeof(uint32_t)) == 0);
+  REQUIRE(get_permissions(entry) == "r-xp");
+  REQUIRE(get_permissions(second) == "r-xp");
+  REQUIRE(get_permissions(static_cast<char *>(second) + page_size) == "rw-p");
+  arena.release(second);
+
+  uint32_t patched = mov(x4, x5);
+  arena.write(entry, 0, &patched, sizeof(patched));
+  REQUIRE(static_cast<uint32_t *>(entry)[0] == patched);
+  REQUIRE(get_permissions(entry) == "r-xp");
+
+  // an empty single mapping is released as its sealed pages can not be written again
+  arena.release(entry);
+  REQUIRE(arena.get_region_count() == 0);
+}
+
+TEST_CASE("Test kernel patch updates the executable kernel", "[code_arena][correctness]")
+{
+  mini_jit::Kernel kernel;
+  kernel.add(mov(x0, 1));
+  kernel.add_patch_point("value");
+  kernel.add({mov(x1, 2), ret()});
+  kernel.set_kernel();
+
+  void const *entry = kernel.get_kernel();
+  kernel.patch(kernel.get_patch_point("value"), mov(x1, 3));
+
+  REQUIRE(kernel.get_patch_point("value") == 1);
+  REQUIRE(kernel.get_kernel() == entry);
+  REQUIRE(kernel.get_buffer()[1] == mov(x1, 3));
+  REQUIRE(std::memcmp(kernel.get_kernel(), kernel.get_buffer().data(), kernel.get_size()) == 0);
+}
@@ -0,0 +1,60 @@
+#include "../main/Cpu.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+
+TEST_CASE("Test the SVE detection matches the vector length", "[cpu]")
+{
+  using mini_jit::Cpu;
+
+  const uint32_t bytes = Cpu::get_sve_vector_length();
+  REQUIRE((bytes != 0) == Cpu::has_sve());
+  REQUIRE(bytes % 16 == 0);
+  REQUIRE(bytes <= 256);
+  if (Cpu::is_sve_enabled())
+  {
+    REQUIRE(Cpu::has_sve());
+  }
+}
+
+TEST_CASE("Test setting the SVE vector length", "[cpu]")
+{
+  using mini_jit::Cpu;
+
+  const uint32_t original = Cpu::get_sve_vector_length();
+  REQUIRE_FALSE(Cpu::set_sve_vector_length(24));
+  REQUIRE(Cpu::get_sve_vector_length() == original);
+
+  if (!Cpu::has_sve())
+  {
+    REQUIRE_FALSE(Cpu::set_sve_vector_length(16));
+    return;
+  }
+
+  // 128 bit is the smallest vector length and implemented by all processors with SVE
+  REQUIRE(Cpu::set_sve_vector_length(16));
+  REQUIRE(Cpu::get_sve_vector_length() == 16);
+  REQUIRE(Cpu::set_sve_vector_length(original));
+  REQUIRE(Cpu::get_sve_vector_length() == original);
+}
+
+TEST_CASE("Test the int8 matrix multiplication implies the dot product instructions", "[cpu]")
+{
+  using mini_jit::Cpu;
+
+  // FEAT_I8MM requires Armv8.2 and all processors that implement it also implement FEAT_DotProd
+  if (Cpu::has_i8mm())
+  {
+    REQUIRE(Cpu::has_dotprod());
+  }
+}
+
+TEST_CASE("Test SVE implies the half-precision arithmetic", "[cpu]")
+{
+  using mini_jit::Cpu;
+
+  // FEAT_SVE requires FEAT_FP16
+  if (Cpu::has_sve())
+  {
+    REQUIRE(Cpu::has_fp16());
+  }
+}
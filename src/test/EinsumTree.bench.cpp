@@ -1,11 +1,69 @@
+#include "../main/CodeArena.h"
 #include "../main/EinsumTree.h"
+#include "../main/KernelCache.h"
 #include "../main/release_assert.h"
 #include <benchmark/benchmark.h>
 #include <ctime>
 #include <iostream>
+#include <linux/perf_event.h>
 #include <string>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <utility>
 
+/**
+ * Counts the instruction TLB misses of the calling thread and its new threads through perf events.
+ */
+class ItlbMissCounter
+{
+  int fd = -1;
+
+public:
+  ItlbMissCounter()
+  {
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_ITLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+
+  ~ItlbMissCounter()
+  {
+    if (fd != -1)
+    {
+      close(fd);
+    }
+  }
+
+  bool is_available() const
+  {
+    return fd != -1;
+  }
+
+  void start()
+  {
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+
+  uint64_t stop()
+  {
+    uint64_t count = 0;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) != sizeof(count))
+    {
+      return 0;
+    }
+    return count;
+  }
+};
+
 class EinsumFixture : public benchmark::Fixture
 {
 public:
@@ -253,4 +311,88 @@ BENCHMARK_REGISTER_F(EinsumFixture, BM_tensor_optimization)
   })
   ->Name("BM_einsum_tree_optimize_third_example")
   ->DisplayAggregatesOnly(true)
-  ->MinWarmUpTime(0.3);  // WarmUp in seconds
\ No newline at end of file
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+// ==================================================================
+// Code arena: setup time and instruction TLB misses
+// ==================================================================
+
+BENCHMARK_DEFINE_F(EinsumFixture, BM_einsum_tree_setup)(benchmark::State &state)
+{
+  bool use_arena = state.range(2);
+
+  // every iteration must generate its kernels
+  mini_jit::KernelCache &cache = mini_jit::KernelCache::instance();
+  size_t capacity = cache.get_capacity();
+  cache.set_capacity(0);
+  mini_jit::CodeArena::instance().set_enabled(use_arena);
+
+  for (auto _ : state)
+  {
+    mini_jit::EinsumTree tree(einsum_tree, dim_sizes);
+    mini_jit::EinsumTree::ErrorParse err_parse = optimize_tree ? tree.parse_tree() : tree.parse_tree_no_optimization();
+    release_assert(err_parse == mini_jit::EinsumTree::ErrorParse::None, "Failed to generate the setup");
+    benchmark::DoNotOptimize(tree.get_root());
+  }
+
+  mini_jit::CodeArena::instance().set_enabled(true);
+  cache.set_capacity(capacity);
+  flops = 0;
+}
+
+BENCHMARK_DEFINE_F(EinsumFixture, BM_einsum_tree_itlb)(benchmark::State &state)
+{
+  bool use_arena = state.range(2);
+
+  mini_jit::KernelCache &cache = mini_jit::KernelCache::instance();
+  size_t capacity = cache.get_capacity();
+  cache.set_capacity(0);
+  mini_jit::CodeArena::instance().set_enabled(use_arena);
+
+  mini_jit::EinsumTree tree(einsum_tree, dim_sizes);
+  mini_jit::EinsumTree::ErrorParse err_parse = optimize_tree ? tree.parse_tree() : tree.parse_tree_no_optimization();
+  release_assert(err_parse == mini_jit::EinsumTree::ErrorParse::None, "Failed to generate the setup");
+
+  mini_jit::CodeArena::instance().set_enabled(true);
+  cache.set_capacity(capacity);
+
+  ItlbMissCounter counter;
+  if (counter.is_available())
+  {
+    counter.start();
+  }
+
+  for (auto _ : state)
+  {
+    mini_jit::EinsumTree::ErrorExecute err_execute = tree.execute(tensors);
+    release_assert(err_execute == mini_jit::EinsumTree::ErrorExecute::None, "Failed to execute einsum");
+  }
+
+  if (counter.is_available())
+  {
+    state.counters["iTLB_misses"] = benchmark::Counter(counter.stop(), benchmark::Counter::kAvgIterations);
+  }
+  flops = tensor_flops * state.iterations();
+}
+
+BENCHMARK_REGISTER_F(EinsumFixture, BM_einsum_tree_setup)
+  ->ArgNames({"config", "optimize", "arena"})
+  ->ArgsProduct({
+    {0, 1, 2, 3, 4},  // Selected einsum config
+    {true},           // Optimize
+    {false, true},    // Use code arena
+  })
+  ->Name("BM_einsum_tree_setup")
+  ->DisplayAggregatesOnly(true)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(EinsumFixture, BM_einsum_tree_itlb)
+  ->ArgNames({"config", "optimize", "arena"})
+  ->ArgsProduct({
+    {2, 3, 4},      // Selected einsum config
+    {true},         // Optimize
+    {false, true},  // Use code arena
+  })
+  ->Name("BM_einsum_tree_itlb")
+  ->DisplayAggregatesOnly(true)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
@@ -256,7 +256,7 @@ TEST_CASE("Test einsum tree optimize reorder left", "[einsumtree][optimize][corr
 {
   using namespace mini_jit;
 
-  std::string tree_str = "[1,0],[2,3,0]->[2,3,1]";
+  std::string tree_str = "[1,3,0],[2,0]->[2,3,1]";
   std::vector<int64_t> sorted_dim_sizes{32, 128, 305, 128};
 
   CAPTURE(tree_str);
@@ -275,17 +275,50 @@ TEST_CASE("Test einsum tree optimize reorder left", "[einsumtree][optimize][corr
   INFO(tree.get_root()->to_string());
 
   REQUIRE(tree.get_root()->type == mini_jit::EinsumTree::NodeType::Contraction);
-  REQUIRE(tree.get_root()->left->output_dim_ids.size() == 2);
-  REQUIRE(tree.get_root()->right->output_dim_ids.size() == 3);
+  REQUIRE(tree.get_root()->left->output_dim_ids.size() == 3);
+  REQUIRE(tree.get_root()->right->output_dim_ids.size() == 2);
   REQUIRE(tree.get_root()->output_dim_ids.size() == 3);
   // Inserted node due to reorder
-  REQUIRE(tree.get_root()->left->output_dim_ids[0] == 0);
-  REQUIRE(tree.get_root()->left->output_dim_ids[1] == 1);
+  REQUIRE(tree.get_root()->left->output_dim_ids[0] == 3);
+  REQUIRE(tree.get_root()->left->output_dim_ids[1] == 0);
+  REQUIRE(tree.get_root()->left->output_dim_ids[2] == 1);
   REQUIRE(tree.get_root()->left->type == mini_jit::EinsumTree::NodeType::Transposition);
   // Original leaf node
   REQUIRE(tree.get_root()->left->left != nullptr);
   REQUIRE(tree.get_root()->left->left->output_dim_ids[0] == 1);
-  REQUIRE(tree.get_root()->left->left->output_dim_ids[1] == 0);
+  REQUIRE(tree.get_root()->left->left->output_dim_ids[1] == 3);
+  REQUIRE(tree.get_root()->left->left->output_dim_ids[2] == 0);
+}
+
+TEST_CASE("Test einsum tree optimize keeps row-major leaves", "[einsumtree][optimize][correctness]")
+{
+  using namespace mini_jit;
+
+  std::string tree_str = "[1,0],[3,0,2]->[3,2,1]";
+  std::vector<int64_t> sorted_dim_sizes{32, 128, 305, 128};
+
+  CAPTURE(tree_str);
+  CAPTURE(sorted_dim_sizes);
+
+  EinsumTree tree(tree_str, sorted_dim_sizes);
+
+  mini_jit::EinsumTree::ErrorParse err = tree.parse_tree_no_optimization(false);
+  REQUIRE(err == mini_jit::EinsumTree::ErrorParse::None);
+  REQUIRE(tree.get_root() != nullptr);
+  INFO(tree.get_root()->to_string());
+
+  tree.reorder_left_node(tree.get_root());
+  tree.reorder_right_node(tree.get_root());
+
+  INFO("Optimized");
+  INFO(tree.get_root()->to_string());
+
+  // The brgemm reads the 'mk' left leaf and the 'kn' right leaf directly
+  REQUIRE(tree.get_root()->type == mini_jit::EinsumTree::NodeType::Contraction);
+  REQUIRE(tree.get_root()->left->type == mini_jit::EinsumTree::NodeType::Leaf);
+  REQUIRE(tree.get_root()->left->output_dim_ids == std::vector<int64_t>{1, 0});
+  REQUIRE(tree.get_root()->right->type == mini_jit::EinsumTree::NodeType::Leaf);
+  REQUIRE(tree.get_root()->right->output_dim_ids == std::vector<int64_t>{3, 0, 2});
 }
 
 TEST_CASE("Test einsum tree optimize reorder right", "[einsumtree][optimize][correctness]")
@@ -353,14 +386,10 @@ TEST_CASE("Test einsum tree optimize", "[einsumtree][optimize][correctness]")
   REQUIRE(tree.get_root()->right->output_dim_ids.size() == 3);
   REQUIRE(tree.get_root()->output_dim_ids.size() == 3);
 
-  // Inserted node due to reorder
-  REQUIRE(tree.get_root()->left->output_dim_ids[0] == 0);
-  REQUIRE(tree.get_root()->left->output_dim_ids[1] == 1);
-  REQUIRE(tree.get_root()->left->type == mini_jit::EinsumTree::NodeType::Transposition);
-  // Original leaf node
-  REQUIRE(tree.get_root()->left->left != nullptr);
-  REQUIRE(tree.get_root()->left->left->output_dim_ids[0] == 1);
-  REQUIRE(tree.get_root()->left->left->output_dim_ids[1] == 0);
+  // Row-major left leaf is read directly by the brgemm
+  REQUIRE(tree.get_root()->left->output_dim_ids[0] == 1);
+  REQUIRE(tree.get_root()->left->output_dim_ids[1] == 0);
+  REQUIRE(tree.get_root()->left->type == mini_jit::EinsumTree::NodeType::Leaf);
 
   // Inserted right node due to reorder
   REQUIRE(tree.get_root()->right->output_dim_ids[0] == 2);
@@ -535,8 +564,7 @@ TEST_CASE("Test einsum tree optimize and execute third example", "[einsumtree][e
 
   std::string expected_optimization = "5,6,7,8,9\n"
                                       "├─ 4,6,5,2,9\n"
-                                      "|  ├─ 4,0,9\n"
-                                      "|  |  └─ 4,9,0\n"
+                                      "|  ├─ 4,9,0\n"
                                       "|  └─ 6,5,2,0\n"
                                       "|     ├─ 5,1,0\n"
                                       "|     |  └─ 0,5,1\n"
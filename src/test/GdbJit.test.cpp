@@ -0,0 +1,99 @@
+#include "../main/GdbJit.h"
+#include "../main/Kernel.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <elf.h>
+#include <string>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+namespace
+{
+  bool is_in_gdb_list(void const *code)
+  {
+    for (jit_code_entry *entry = __jit_debug_descriptor.first_entry; entry != nullptr; entry = entry->next_entry)
+    {
+      Elf64_Ehdr header;
+      std::memcpy(&header, entry->symfile_addr, sizeof(header));
+      Elf64_Shdr text;
+      std::memcpy(&text, entry->symfile_addr + header.e_shoff + header.e_shentsize, sizeof(text));
+      if (text.sh_addr == reinterpret_cast<uintptr_t>(code))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+}  // namespace
+
+TEST_CASE("Test gdb jit symbol file describes the kernel", "[gdb_jit][correctness]")
+{
+  std::vector<uint32_t> code = {mov(x0, x1), ret()};
+  std::vector<char> file = mini_jit::GdbJit::create_symbol_file("unary_relu_m16_n4", code.data(), code.size() * sizeof(uint32_t));
+
+  Elf64_Ehdr header;
+  REQUIRE(file.size() >= sizeof(header));
+  std::memcpy(&header, file.data(), sizeof(header));
+  REQUIRE(std::memcmp(header.e_ident, ELFMAG, SELFMAG) == 0);
+  REQUIRE(header.e_machine == EM_AARCH64);
+  REQUIRE(header.e_shoff + header.e_shnum * sizeof(Elf64_Shdr) <= file.size());
+
+  std::vector<Elf64_Shdr> sections(header.e_shnum);
+  std::memcpy(sections.data(), file.data() + header.e_shoff, header.e_shnum * sizeof(Elf64_Shdr));
+  char const *section_names = file.data() + sections[header.e_shstrndx].sh_offset;
+
+  bool found_symbol = false;
+  for (Elf64_Shdr const &section : sections)
+  {
+    if (section.sh_type != SHT_SYMTAB)
+    {
+      continue;
+    }
+
+    REQUIRE(std::string(section_names + section.sh_name) == ".symtab");
+    char const *strings = file.data() + sections[section.sh_link].sh_offset;
+    for (std::size_t i = 0; i < section.sh_size / sizeof(Elf64_Sym); ++i)
+    {
+      Elf64_Sym symbol;
+      std::memcpy(&symbol, file.data() + section.sh_offset + i * sizeof(Elf64_Sym), sizeof(symbol));
+      if (std::string(strings + symbol.st_name) == "unary_relu_m16_n4")
+      {
+        found_symbol = true;
+        REQUIRE(ELF64_ST_TYPE(symbol.st_info) == STT_FUNC);
+        REQUIRE(symbol.st_size == code.size() * sizeof(uint32_t));
+        REQUIRE(std::string(section_names + sections[symbol.st_shndx].sh_name) == ".text");
+        REQUIRE(sections[symbol.st_shndx].sh_addr + symbol.st_value == reinterpret_cast<uintptr_t>(code.data()));
+      }
+    }
+  }
+  REQUIRE(found_symbol);
+}
+
+TEST_CASE("Test kernels are registered with gdb while alive", "[gdb_jit][correctness]")
+{
+  mini_jit::GdbJit &gdb_jit = mini_jit::GdbJit::instance();
+  std::size_t count = gdb_jit.get_registration_count();
+
+  void const *code = nullptr;
+  {
+    mini_jit::Kernel kernel;
+    kernel.set_name("gdb_jit_test");
+    kernel.add({mov(x0, x1), ret()});
+    kernel.set_kernel();
+    code = kernel.get_kernel();
+
+    REQUIRE(gdb_jit.get_registration_count() == count + 1);
+    REQUIRE(is_in_gdb_list(code));
+    REQUIRE(__jit_debug_descriptor.action_flag == 0);
+
+    // re-emitting keeps a single registration
+    kernel.set_kernel();
+    REQUIRE(gdb_jit.get_registration_count() == count + 1);
+  }
+
+  REQUIRE(gdb_jit.get_registration_count() == count);
+  REQUIRE_FALSE(is_in_gdb_list(code));
+}
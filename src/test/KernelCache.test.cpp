@@ -0,0 +1,226 @@
+#include "../main/Brgemm.h"
+#include "../main/KernelCache.h"
+#include "../main/Unary.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+namespace
+{
+  void fill_with_ret(mini_jit::Kernel &kernel)
+  {
+    kernel.add(ret());
+  }
+}  // namespace
+
+TEST_CASE("Test kernel cache returns the same kernel for the same key", "[kernel_cache][correctness]")
+{
+  mini_jit::KernelCache cache(4);
+
+  std::shared_ptr<mini_jit::Kernel> first = cache.get_or_generate("a", fill_with_ret);
+  std::shared_ptr<mini_jit::Kernel> second = cache.get_or_generate("a", fill_with_ret);
+  std::shared_ptr<mini_jit::Kernel> other = cache.get_or_generate("b", fill_with_ret);
+
+  REQUIRE(first == second);
+  REQUIRE(first != other);
+  REQUIRE(first->get_kernel() != nullptr);
+
+  // patching a cached kernel would change the code of every user
+  REQUIRE(first->is_shared());
+  REQUIRE(other->is_shared());
+  REQUIRE_FALSE(mini_jit::Kernel().is_shared());
+  REQUIRE(cache.get_hits() == 1);
+  REQUIRE(cache.get_misses() == 2);
+  REQUIRE(cache.get_size() == 2);
+}
+
+TEST_CASE("Test kernel cache evicts the least recently used kernel", "[kernel_cache][correctness]")
+{
+  mini_jit::KernelCache cache(2);
+
+  std::shared_ptr<mini_jit::Kernel> a = cache.get_or_generate("a", fill_with_ret);
+  cache.get_or_generate("b", fill_with_ret);
+  cache.get_or_generate("a", fill_with_ret);  // b is now the least recently used
+  cache.get_or_generate("c", fill_with_ret);
+
+  REQUIRE(cache.get_size() == 2);
+  REQUIRE(cache.get_evictions() == 1);
+
+  uint64_t misses = cache.get_misses();
+  REQUIRE(cache.get_or_generate("a", fill_with_ret) == a);
+  REQUIRE(cache.get_misses() == misses);
+
+  cache.get_or_generate("b", fill_with_ret);
+  REQUIRE(cache.get_misses() == misses + 1);
+}
+
+TEST_CASE("Test kernel cache keeps evicted kernels alive while referenced", "[kernel_cache][correctness]")
+{
+  mini_jit::KernelCache cache(1);
+
+  std::shared_ptr<mini_jit::Kernel> a = cache.get_or_generate("a", fill_with_ret);
+  cache.get_or_generate("b", fill_with_ret);
+
+  REQUIRE(cache.get_evictions() == 1);
+  REQUIRE(a.use_count() == 1);
+  REQUIRE(a->get_kernel() != nullptr);
+}
+
+TEST_CASE("Test kernel cache with capacity zero does not cache", "[kernel_cache][correctness]")
+{
+  mini_jit::KernelCache cache(0);
+
+  std::shared_ptr<mini_jit::Kernel> first = cache.get_or_generate("a", fill_with_ret);
+  std::shared_ptr<mini_jit::Kernel> second = cache.get_or_generate("a", fill_with_ret);
+
+  REQUIRE(first != second);
+  REQUIRE(cache.get_size() == 0);
+  REQUIRE(cache.get_misses() == 2);
+
+  cache.set_capacity(1);
+  cache.get_or_generate("a", fill_with_ret);
+  cache.get_or_generate("a", fill_with_ret);
+  REQUIRE(cache.get_hits() == 1);
+
+  cache.clear();
+  REQUIRE(cache.get_size() == 0);
+  REQUIRE(cache.get_hits() == 0);
+}
+
+TEST_CASE("Test kernel cache concurrent access shares one kernel", "[kernel_cache][parallel][correctness]")
+{
+  mini_jit::KernelCache cache(8);
+
+  constexpr size_t threadCount = 8;
+  std::vector<std::shared_ptr<mini_jit::Kernel>> kernels(threadCount);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadCount; ++i)
+  {
+    threads.emplace_back([&cache, &kernels, i]() { kernels[i] = cache.get_or_generate("shared", fill_with_ret); });
+  }
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (size_t i = 1; i < threadCount; ++i)
+  {
+    REQUIRE(kernels[i] == kernels[0]);
+  }
+  REQUIRE(cache.get_size() == 1);
+  REQUIRE(cache.get_hits() + cache.get_misses() == threadCount);
+}
+
+TEST_CASE("Test brgemm and unary generation share cached kernels", "[kernel_cache][generation][correctness]")
+{
+  mini_jit::KernelCache &cache = mini_jit::KernelCache::instance();
+
+  mini_jit::Brgemm gemm1;
+  mini_jit::Brgemm gemm2;
+  REQUIRE(gemm1.generate(32, 8, 16, 4, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32) == mini_jit::Brgemm::error_t::success);
+  uint64_t hits = cache.get_hits();
+  REQUIRE(gemm2.generate(32, 8, 16, 4, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32) == mini_jit::Brgemm::error_t::success);
+  REQUIRE(cache.get_hits() == hits + 1);
+  REQUIRE(gemm1.get_kernel() == gemm2.get_kernel());
+
+  mini_jit::Brgemm gemm3;
+  REQUIRE(gemm3.generate(32, 8, 16, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32) == mini_jit::Brgemm::error_t::success);
+  REQUIRE(gemm1.get_kernel() != gemm3.get_kernel());
+
+  mini_jit::Unary relu1;
+  mini_jit::Unary relu2;
+  mini_jit::Unary relu_transpose;
+  REQUIRE(relu1.generate(17, 5, 0, mini_jit::Unary::dtype_t::fp32, mini_jit::Unary::ptype_t::relu) ==
+          mini_jit::Unary::error_t::success);
+  REQUIRE(relu2.generate(17, 5, 0, mini_jit::Unary::dtype_t::fp32, mini_jit::Unary::ptype_t::relu) ==
+          mini_jit::Unary::error_t::success);
+  REQUIRE(relu_transpose.generate(17, 5, 1, mini_jit::Unary::dtype_t::fp32, mini_jit::Unary::ptype_t::relu) ==
+          mini_jit::Unary::error_t::success);
+  REQUIRE(relu1.get_kernel() == relu2.get_kernel());
+  REQUIRE(relu1.get_kernel() != relu_transpose.get_kernel());
+}
+
+TEST_CASE("Test kernel cache loads kernels from the on-disk cache", "[kernel_cache][disk][correctness]")
+{
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / ("mlc_kernel_cache_test_" + std::to_string(getpid()));
+  std::filesystem::remove_all(directory);
+
+  std::vector<uint32_t> expected;
+  {
+    mini_jit::KernelCache cache(4, directory.string());
+    std::shared_ptr<mini_jit::Kernel> kernel =
+      cache.get_or_generate("brgemm_disk_test", [](mini_jit::Kernel &kernel) { kernel.add({mov(x0, x1), mov(x2, x3), ret()}); });
+    expected = kernel->get_buffer();
+    REQUIRE(cache.get_disk_hits() == 0);
+  }
+  REQUIRE(std::filesystem::exists(directory / "brgemm_disk_test.kernel"));
+
+  // a new cache, e.g. of a restarted process, must not generate the kernel again
+  mini_jit::KernelCache cache(4, directory.string());
+  bool generated = false;
+  std::shared_ptr<mini_jit::Kernel> kernel = cache.get_or_generate("brgemm_disk_test", [&generated](mini_jit::Kernel &kernel)
+                                                                   {
+                                                                     generated = true;
+                                                                     fill_with_ret(kernel);
+                                                                   });
+
+  REQUIRE_FALSE(generated);
+  REQUIRE(cache.get_disk_hits() == 1);
+  REQUIRE(kernel->get_kernel() != nullptr);
+  REQUIRE(kernel->get_buffer() == expected);
+  REQUIRE(std::memcmp(kernel->get_kernel(), expected.data(), expected.size() * sizeof(uint32_t)) == 0);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Test kernel cache ignores invalid on-disk kernels", "[kernel_cache][disk][correctness]")
+{
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / ("mlc_kernel_cache_test_" + std::to_string(getpid()));
+  std::filesystem::remove_all(directory);
+
+  {
+    mini_jit::KernelCache cache(4, directory.string());
+    cache.get_or_generate("brgemm_disk_test", fill_with_ret);
+  }
+
+  // corrupt the format version or the generator hash, e.g. a file of a build with changed generators
+  auto offset = GENERATE(8, 48);
+  CAPTURE(offset);
+  {
+    std::fstream file(directory / "brgemm_disk_test.kernel", std::ios::in | std::ios::out | std::ios::binary);
+    char byte = '\0';
+    file.seekg(offset);
+    file.read(&byte, 1);
+    byte ^= 1;
+    file.seekp(offset);
+    file.write(&byte, 1);
+  }
+
+  mini_jit::KernelCache cache(4, directory.string());
+  bool generated = false;
+  std::shared_ptr<mini_jit::Kernel> kernel = cache.get_or_generate("brgemm_disk_test", [&generated](mini_jit::Kernel &kernel)
+                                                                   {
+                                                                     generated = true;
+                                                                     fill_with_ret(kernel);
+                                                                   });
+
+  REQUIRE(generated);
+  REQUIRE(cache.get_disk_hits() == 0);
+  REQUIRE(kernel->get_kernel() != nullptr);
+
+  // the regenerated kernel replaced the invalid file
+  mini_jit::KernelCache cache_restarted(4, directory.string());
+  cache_restarted.get_or_generate("brgemm_disk_test", fill_with_ret);
+  REQUIRE(cache_restarted.get_disk_hits() == 1);
+
+  std::filesystem::remove_all(directory);
+}
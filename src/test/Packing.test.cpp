@@ -0,0 +1,387 @@
+#include "../main/Cpu.h"
+#include "../main/Packing.h"
+#include "../main/kernels/br_matmul_int8.h"
+#include "BaseGeneration.test.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+TEST_CASE("Test packing of A and B into the strips of the default tile", "[packing][correctness]")
+{
+  using mini_jit::Packing;
+
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto M = GENERATE(16u, 37u);
+  auto N = GENERATE(4u, 9u);
+  constexpr uint32_t K = 5;
+  constexpr uint32_t BatchSize = 2;
+
+  CAPTURE(trans_a, trans_b, M, N);
+
+  const int64_t lda = (trans_a ? K : M) + 3;
+  const int64_t ldb = (trans_b ? N : K) + 2;
+  const int64_t br_stride_a = lda * (trans_a ? M : K) + 1;
+  const int64_t br_stride_b = ldb * (trans_b ? K : N) + 1;
+
+  std::vector<float> a(br_stride_a * BatchSize);
+  std::vector<float> b(br_stride_b * BatchSize);
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = static_cast<float>(i);
+  }
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = static_cast<float>(i);
+  }
+
+  Packing packing;
+  REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, Packing::dtype_t::fp32) == Packing::error_t::success);
+
+  const Packing::tile_t tile = packing.get_tile();
+  REQUIRE(tile == mini_jit::Brgemm::default_fp32_tile);
+  REQUIRE(packing.get_size_a() == (M + tile.m - 1) / tile.m * tile.m * K);
+  REQUIRE(packing.get_size_b() == (N + tile.n - 1) / tile.n * tile.n * K);
+
+  std::vector<float> packed_a(packing.get_size_a() * BatchSize, std::numeric_limits<float>::quiet_NaN());
+  std::vector<float> packed_b(packing.get_size_b() * BatchSize, std::numeric_limits<float>::quiet_NaN());
+  packing.pack_a(a.data(), lda, br_stride_a, packed_a.data());
+  packing.pack_b(b.data(), ldb, br_stride_b, packed_b.data());
+
+  for (uint32_t iB = 0; iB < BatchSize; ++iB)
+  {
+    for (uint32_t iK = 0; iK < K; ++iK)
+    {
+      // The strips of A are column-major with a leading dimension of tile.m
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        const size_t index = iB * packing.get_size_a() + (iM / tile.m) * tile.m * K + iK * tile.m + iM % tile.m;
+        const float expected = a[iB * br_stride_a + (trans_a ? iK + iM * lda : iM + iK * lda)];
+
+        CAPTURE(iB, iK, iM);
+        REQUIRE(packed_a[index] == expected);
+      }
+
+      // The strips of B are row-major with a leading dimension of tile.n
+      for (uint32_t iN = 0; iN < N; ++iN)
+      {
+        const size_t index = iB * packing.get_size_b() + (iN / tile.n) * tile.n * K + iK * tile.n + iN % tile.n;
+        const float expected = b[iB * br_stride_b + (trans_b ? iN + iK * ldb : iK + iN * ldb)];
+
+        CAPTURE(iB, iK, iN);
+        REQUIRE(packed_b[index] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test packed brgemm (1≤M≤37, 1≤N≤13, K∈[1,7], 1≤BatchSize≤3, lda>M, ldb>K, ldc>M) on random data",
+          "[packing][generation][correctness][gemm]")
+{
+  using mini_jit::Brgemm;
+  using mini_jit::Packing;
+
+  auto M = GENERATE(1u, 8u, 17u, 37u);
+  auto N = GENERATE(1u, 6u, 13u);
+  auto K = GENERATE(1u, 7u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto dtype = GENERATE(Brgemm::dtype_t::fp32, Brgemm::dtype_t::fp64);
+
+  CAPTURE(M, N, K, BatchSize, trans_a, trans_b, static_cast<uint32_t>(dtype));
+
+  const int64_t lda = (trans_a ? K : M) + 3;
+  const int64_t ldb = (trans_b ? N : K) + 2;
+  const int64_t ldc = M + 1;
+  const int64_t br_stride_a = lda * (trans_a ? M : K);
+  const int64_t br_stride_b = ldb * (trans_b ? K : N);
+
+  std::vector<double> a(br_stride_a * BatchSize);
+  std::vector<double> b(br_stride_b * BatchSize);
+  std::vector<double> c(ldc * N);
+  for (std::vector<double> *values : {&a, &b, &c})
+  {
+    for (double &value : *values)
+    {
+      value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+    }
+  }
+
+  std::vector<double> c_verify = c;
+  for (uint32_t iN = 0; iN < N; ++iN)
+  {
+    for (uint32_t iM = 0; iM < M; ++iM)
+    {
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          c_verify[iM + iN * ldc] += a[(trans_a ? iK + iM * lda : iM + iK * lda) + iB * br_stride_a] *
+                                     b[(trans_b ? iN + iK * ldb : iK + iN * ldb) + iB * br_stride_b];
+        }
+      }
+    }
+  }
+
+  Packing packing;
+  REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, dtype) == Packing::error_t::success);
+
+  Brgemm gemm;
+  Brgemm::error_t error = gemm.generate(M, N, K, BatchSize, 0, 1, 0, dtype, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                                        Brgemm::packing_t{true, true});
+  REQUIRE(error == Brgemm::error_t::success);
+
+  // The packed strips hold the elements in the data type of the kernel
+  auto run = [&]<typename T>(T epsilon)
+  {
+    std::vector<T> a_typed(a.begin(), a.end());
+    std::vector<T> b_typed(b.begin(), b.end());
+    std::vector<T> c_typed(c.begin(), c.end());
+    std::vector<T> packed_a(packing.get_size_a() * BatchSize);
+    std::vector<T> packed_b(packing.get_size_b() * BatchSize);
+
+    packing.pack_a(a_typed.data(), lda, br_stride_a, packed_a.data());
+    packing.pack_b(b_typed.data(), ldb, br_stride_b, packed_b.data());
+
+    const Packing::tile_t tile = packing.get_tile();
+    gemm.get_kernel()(packed_a.data(), packed_b.data(), c_typed.data(), tile.m, tile.n, ldc, packing.get_size_a(), packing.get_size_b());
+
+    for (size_t i = 0; i < c_typed.size(); ++i)
+    {
+      CAPTURE(i, c_typed[i], c_verify[i]);
+      REQUIRE_THAT(c_typed[i], Catch::Matchers::WithinRel(static_cast<T>(c_verify[i]), epsilon) ||
+                                 Catch::Matchers::WithinAbs(static_cast<T>(c_verify[i]), epsilon));
+    }
+  };
+
+  if (dtype == Brgemm::dtype_t::fp64)
+  {
+    run(1e-12);
+  }
+  else
+  {
+    run(1e-5f);
+  }
+}
+
+TEST_CASE("Test packed brgemm rejects unsupported layouts", "[packing][generation]")
+{
+  using mini_jit::Brgemm;
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(16, 4, 3, 1, 1, 0, 0, Brgemm::dtype_t::fp32, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, false}) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::fp32, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{false, true}) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 1, 1, Brgemm::dtype_t::fp32, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_packing_not_supported);
+}
+
+TEST_CASE("Test packing of bf16 A and B into pairs of blocks of four k", "[packing][correctness][bf16]")
+{
+  using mini_jit::Packing;
+
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto M = GENERATE(8u, 13u);
+  auto N = GENERATE(3u, 16u);
+  constexpr uint32_t K = 6;
+  constexpr uint32_t PaddedK = 8;
+  constexpr uint32_t BatchSize = 2;
+
+  CAPTURE(trans_a, trans_b, M, N);
+
+  const int64_t lda = (trans_a ? K : M) + 3;
+  const int64_t ldb = (trans_b ? N : K) + 2;
+  const int64_t br_stride_a = lda * (trans_a ? M : K) + 1;
+  const int64_t br_stride_b = ldb * (trans_b ? K : N) + 1;
+
+  std::vector<uint16_t> a(br_stride_a * BatchSize);
+  std::vector<uint16_t> b(br_stride_b * BatchSize);
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = static_cast<uint16_t>(i + 1);
+  }
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = static_cast<uint16_t>(i + 1);
+  }
+
+  Packing packing;
+  REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, Packing::dtype_t::bf16) == Packing::error_t::success);
+
+  const Packing::tile_t tile = packing.get_tile();
+  REQUIRE(tile == mini_jit::Brgemm::default_bf16_tile);
+  REQUIRE(packing.get_size_a() == (M + tile.m - 1) / tile.m * tile.m * PaddedK);
+  REQUIRE(packing.get_size_b() == (N + tile.n - 1) / tile.n * tile.n * PaddedK);
+
+  std::vector<uint16_t> packed_a(packing.get_size_a() * BatchSize, 0xffff);
+  std::vector<uint16_t> packed_b(packing.get_size_b() * BatchSize, 0xffff);
+  packing.pack_a(a.data(), lda, br_stride_a, packed_a.data());
+  packing.pack_b(b.data(), ldb, br_stride_b, packed_b.data());
+
+  for (uint32_t iB = 0; iB < BatchSize; ++iB)
+  {
+    for (uint32_t iK = 0; iK < PaddedK; ++iK)
+    {
+      // A strip holds for each block of four k the pairs of rows, a pair holds the four k of its first row followed by its second row
+      for (uint32_t iM = 0; iM < (M + tile.m - 1) / tile.m * tile.m; ++iM)
+      {
+        const size_t index =
+          iB * packing.get_size_a() + (iM / tile.m) * tile.m * PaddedK + (iK / 4) * tile.m * 4 + (iM % tile.m) * 4 + iK % 4;
+        const uint16_t expected = iM < M && iK < K ? a[iB * br_stride_a + (trans_a ? iK + iM * lda : iM + iK * lda)] : 0;
+
+        CAPTURE(iB, iK, iM);
+        REQUIRE(packed_a[index] == expected);
+      }
+
+      for (uint32_t iN = 0; iN < (N + tile.n - 1) / tile.n * tile.n; ++iN)
+      {
+        const size_t index =
+          iB * packing.get_size_b() + (iN / tile.n) * tile.n * PaddedK + (iK / 4) * tile.n * 4 + (iN % tile.n) * 4 + iK % 4;
+        const uint16_t expected = iN < N && iK < K ? b[iB * br_stride_b + (trans_b ? iN + iK * ldb : iK + iN * ldb)] : 0;
+
+        CAPTURE(iB, iK, iN);
+        REQUIRE(packed_b[index] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test bf16 brgemm rejects unpacked operands and unsupported options", "[packing][generation][bf16]")
+{
+  using mini_jit::Brgemm;
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::bf16) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 1, 0, Brgemm::dtype_t::bf16, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::bf16, 2, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::bf16, 1, 1,
+                        Brgemm::epilogue_t{Brgemm::bias_t::none, Brgemm::activation_t::relu}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::bf16, Brgemm::tile_t{16, 4}, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_tile);
+
+  // The bfmmla is only generated for processors that implement it
+  const Brgemm::error_t expected = mini_jit::Cpu::has_bf16() ? Brgemm::error_t::success : Brgemm::error_t::err_wrong_dtype;
+  REQUIRE(gemm.generate(13, 5, 3, 2, 0, 0, 0, Brgemm::dtype_t::bf16, 1, 0, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == expected);
+}
+
+TEST_CASE("Test packing of int8 A and B into the blocks of k of the selected instruction", "[packing][correctness][int8]")
+{
+  using mini_jit::Packing;
+  using mini_jit::kernels::int8_instruction_t;
+
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+  auto M = GENERATE(8u, 13u);
+  auto N = GENERATE(3u, 16u);
+  constexpr uint32_t K = 11;
+  constexpr uint32_t BatchSize = 2;
+
+  CAPTURE(trans_a, trans_b, M, N);
+
+  // Packing interleaves the layout of the instruction that Brgemm selects on this processor
+  const uint32_t KBlock =
+    mini_jit::kernels::br_matmul_int8_k_block(mini_jit::Cpu::has_i8mm() ? int8_instruction_t::mmla : int8_instruction_t::dot);
+  const uint32_t PaddedK = (K + KBlock - 1) / KBlock * KBlock;
+
+  const int64_t lda = (trans_a ? K : M) + 3;
+  const int64_t ldb = (trans_b ? N : K) + 2;
+  const int64_t br_stride_a = lda * (trans_a ? M : K) + 1;
+  const int64_t br_stride_b = ldb * (trans_b ? K : N) + 1;
+
+  std::vector<uint8_t> a(br_stride_a * BatchSize);
+  std::vector<uint8_t> b(br_stride_b * BatchSize);
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = static_cast<uint8_t>(i % 255 + 1);
+  }
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = static_cast<uint8_t>(i % 255 + 1);
+  }
+
+  Packing packing;
+  if (!mini_jit::Cpu::has_i8mm() && !mini_jit::Cpu::has_dotprod())
+  {
+    REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, Packing::dtype_t::s8) == Packing::error_t::err_wrong_dtype);
+    SKIP("The processor does not implement the dot product instructions.");
+  }
+  REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, Packing::dtype_t::s8) == Packing::error_t::success);
+
+  const Packing::tile_t tile = packing.get_tile();
+  REQUIRE(tile == mini_jit::Brgemm::default_int8_tile);
+  REQUIRE(packing.get_size_a() == (M + tile.m - 1) / tile.m * tile.m * PaddedK);
+  REQUIRE(packing.get_size_b() == (N + tile.n - 1) / tile.n * tile.n * PaddedK);
+
+  std::vector<uint8_t> packed_a(packing.get_size_a() * BatchSize, 0xff);
+  std::vector<uint8_t> packed_b(packing.get_size_b() * BatchSize, 0xff);
+  packing.pack_a(a.data(), lda, br_stride_a, packed_a.data());
+  packing.pack_b(b.data(), ldb, br_stride_b, packed_b.data());
+
+  for (uint32_t iB = 0; iB < BatchSize; ++iB)
+  {
+    for (uint32_t iK = 0; iK < PaddedK; ++iK)
+    {
+      // A strip holds for each block of k the consecutive k of its first row, followed by those of its second row and so on
+      for (uint32_t iM = 0; iM < (M + tile.m - 1) / tile.m * tile.m; ++iM)
+      {
+        const size_t index = iB * packing.get_size_a() + (iM / tile.m) * tile.m * PaddedK + (iK / KBlock) * tile.m * KBlock +
+                             (iM % tile.m) * KBlock + iK % KBlock;
+        const uint8_t expected = iM < M && iK < K ? a[iB * br_stride_a + (trans_a ? iK + iM * lda : iM + iK * lda)] : 0;
+
+        CAPTURE(iB, iK, iM);
+        REQUIRE(packed_a[index] == expected);
+      }
+
+      for (uint32_t iN = 0; iN < (N + tile.n - 1) / tile.n * tile.n; ++iN)
+      {
+        const size_t index = iB * packing.get_size_b() + (iN / tile.n) * tile.n * PaddedK + (iK / KBlock) * tile.n * KBlock +
+                             (iN % tile.n) * KBlock + iK % KBlock;
+        const uint8_t expected = iN < N && iK < K ? b[iB * br_stride_b + (trans_b ? iN + iK * ldb : iK + iN * ldb)] : 0;
+
+        CAPTURE(iB, iK, iN);
+        REQUIRE(packed_b[index] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test int8 brgemm rejects unpacked operands and unsupported options", "[packing][generation][int8]")
+{
+  using mini_jit::Brgemm;
+
+  Brgemm::epilogue_t requantize;
+  requantize.requantize = Brgemm::requantize_t::s8;
+  requantize.scale = 0.5;
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::s8) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 1, 0, Brgemm::dtype_t::u8, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::s8, 2, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::s8, 1, 1,
+                        Brgemm::epilogue_t{Brgemm::bias_t::none, Brgemm::activation_t::relu}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::s8, 1, 1, requantize, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::fp32, 1, 0, requantize) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 4, 3, 1, 0, 0, 0, Brgemm::dtype_t::s8, Brgemm::tile_t{16, 4}, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::err_wrong_tile);
+
+  // The int8 kernels are only generated for processors that implement the int8 mmla or the dot product instructions
+  const bool has_int8 = mini_jit::Cpu::has_i8mm() || mini_jit::Cpu::has_dotprod();
+  REQUIRE(gemm.generate(13, 5, 3, 2, 0, 0, 0, Brgemm::dtype_t::s8, 1, 0, requantize, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == (has_int8 ? Brgemm::error_t::success : Brgemm::error_t::err_wrong_dtype));
+}
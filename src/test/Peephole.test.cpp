@@ -0,0 +1,109 @@
+#include "../main/Assembler.h"
+#include "../main/Kernel.h"
+#include "../main/Peephole.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test peephole removes redundant moves", "[peephole][correctness]")
+{
+  mini_jit::Kernel kernel;
+  kernel.add({mov(x0, x0), mov(x9, 4), mov(x9, x1), add(x2, x2, x9), ret()});
+
+  mini_jit::Peephole::Statistics statistics = mini_jit::Peephole::optimize(kernel);
+
+  std::vector<uint32_t> expected = {mov(x9, x1), add(x2, x2, x9), ret()};
+  REQUIRE(kernel.get_buffer() == expected);
+  REQUIRE(statistics.removed_instructions == 2);
+}
+
+TEST_CASE("Test peephole merges adjacent loads into pairs", "[peephole][correctness]")
+{
+  mini_jit::Kernel kernel;
+  kernel.add({ldrOffset(s0, x1, 4), ldrOffset(s1, x1, 8), ldrOffset(q2, x2, 16), ldrOffset(q3, x2, 0), ldr(x4, x3), ret()});
+
+  mini_jit::Peephole::Statistics statistics = mini_jit::Peephole::optimize(kernel);
+
+  std::vector<uint32_t> const &buffer = kernel.get_buffer();
+  REQUIRE(statistics.merged_loads == 2);
+  REQUIRE(buffer.size() == 4);
+  REQUIRE(std::find(buffer.begin(), buffer.end(), ldpOffset(s0, s1, x1, 4)) != buffer.end());
+  REQUIRE(std::find(buffer.begin(), buffer.end(), ldp(q3, q2, x2)) != buffer.end());
+  REQUIRE(buffer.back() == ret());
+}
+
+TEST_CASE("Test peephole keeps dependent loads apart", "[peephole][correctness]")
+{
+  mini_jit::Kernel kernel;
+  kernel.add({ldrOffset(s0, x1, 0), str(s0, x2), ldrOffset(s1, x1, 4), ret()});
+
+  mini_jit::Peephole::Statistics statistics = mini_jit::Peephole::optimize(kernel);
+
+  REQUIRE(statistics.merged_loads == 0);
+  REQUIRE(kernel.get_buffer().size() == 4);
+}
+
+TEST_CASE("Test peephole schedules loads ahead of the fmla instructions", "[peephole][correctness]")
+{
+  mini_jit::Kernel kernel;
+  mini_jit::Assembler assembler(kernel);
+
+  assembler.add(mov(x15, x3));
+  assembler.add(mov(x15, 8));
+  assembler.label("loop");
+  assembler.add({
+    ld1Post(v0, t4s, v1, t4s, v2, t4s, v3, t4s, x0, x3),
+    ldr(s4, x1),
+    add(x1, x1, x4),
+    fmla(v25, t4s, v0, t4s, v4, 0),
+    fmla(v26, t4s, v1, t4s, v4, 0),
+    fmla(v27, t4s, v2, t4s, v4, 0),
+    fmla(v28, t4s, v3, t4s, v4, 0),
+    ldr(s4, x1),
+    add(x1, x1, x4),
+    fmla(v17, t4s, v0, t4s, v4, 0),
+    fmla(v18, t4s, v1, t4s, v4, 0),
+    fmla(v19, t4s, v2, t4s, v4, 0),
+    fmla(v20, t4s, v3, t4s, v4, 0),
+    sub(x15, x15, 1),
+  });
+  assembler.add(cbnz(x15, 0), "loop", mini_jit::Assembler::relocation_t::imm19);
+  assembler.add(ret());
+  assembler.finalize();
+
+  mini_jit::Peephole::Statistics statistics = mini_jit::Peephole::optimize(kernel);
+  std::vector<uint32_t> const &buffer = kernel.get_buffer();
+
+  REQUIRE(statistics.removed_instructions == 1);
+  REQUIRE(statistics.renamed_registers == 1);
+  REQUIRE(statistics.moved_instructions > 0);
+  REQUIRE(buffer.size() == 17);
+  REQUIRE(buffer[0] == mov(x15, 8));
+
+  // the first scalar of b is renamed, hence the second load is independent of the first fmla group
+  auto second_load = std::find(buffer.begin(), buffer.end(), ldr(s4, x1));
+  auto first_fmla = std::find(buffer.begin(), buffer.end(), fmla(v25, t4s, v0, t4s, v5, 0));
+  REQUIRE(std::find(buffer.begin(), buffer.end(), ldr(s5, x1)) < first_fmla);
+  REQUIRE(second_load < first_fmla);
+  REQUIRE(first_fmla != buffer.end());
+
+  // the loop branch still targets the first instruction of the loop body
+  REQUIRE(buffer[15] == cbnz(x15, -14 * 4));
+  REQUIRE(buffer[16] == ret());
+}
+
+TEST_CASE("Test peephole keeps patch points in place", "[peephole][correctness]")
+{
+  mini_jit::Kernel kernel;
+  kernel.add(mov(x0, x0));
+  kernel.add_patch_point("loop_count");
+  kernel.add({mov(x15, 8), ret()});
+
+  mini_jit::Peephole::optimize(kernel);
+
+  REQUIRE(kernel.get_buffer()[kernel.get_patch_point("loop_count")] == mov(x15, 8));
+}
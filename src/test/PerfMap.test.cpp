@@ -0,0 +1,132 @@
+#include "../main/Kernel.h"
+#include "../main/PerfMap.h"
+#include "../main/arm_instructions/arm_all.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace mini_jit::arm_instructions;
+
+namespace
+{
+  std::filesystem::path create_test_directory()
+  {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("mlc_perf_map_test_" + std::to_string(getpid()));
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+  }
+}  // namespace
+
+TEST_CASE("Test perf map registers kernel symbols", "[perf_map][correctness]")
+{
+  std::filesystem::path directory = create_test_directory();
+
+  mini_jit::Kernel kernel;
+  kernel.set_name("br_matmul_mr_nr_k_m35_n20_k64_br16");
+  kernel.add({mov(x0, x1), ret()});
+  kernel.set_kernel();
+
+  {
+    mini_jit::PerfMap perf_map(directory.string());
+    perf_map.add(kernel.get_name(), kernel.get_kernel(), kernel.get_size());
+    REQUIRE_FALSE(perf_map.is_enabled());
+    REQUIRE_FALSE(std::filesystem::exists(perf_map.get_perf_map_path()));
+
+    perf_map.set_perf_map_enabled(true);
+    perf_map.add(kernel.get_name(), kernel.get_kernel(), kernel.get_size());
+    perf_map.add("second", kernel.get_kernel(), kernel.get_size());
+  }
+
+  std::ifstream map(directory / ("perf-" + std::to_string(getpid()) + ".map"));
+  std::string line;
+  REQUIRE(std::getline(map, line));
+
+  std::istringstream fields(line);
+  uintptr_t start = 0;
+  std::size_t size = 0;
+  std::string name;
+  fields >> std::hex >> start >> size >> name;
+  REQUIRE(start == reinterpret_cast<uintptr_t>(kernel.get_kernel()));
+  REQUIRE(size == kernel.get_size());
+  REQUIRE(name == "br_matmul_mr_nr_k_m35_n20_k64_br16");
+
+  REQUIRE(std::getline(map, line));
+  REQUIRE(line.ends_with(" second"));
+  REQUIRE_FALSE(std::getline(map, line));
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Test perf jitdump contains kernel code", "[perf_map][correctness]")
+{
+  std::filesystem::path directory = create_test_directory();
+
+  std::vector<uint32_t> code = {mov(x0, x1), mov(x2, x3), ret()};
+  std::string path;
+  {
+    mini_jit::PerfMap perf_map(directory.string());
+    perf_map.set_jitdump_enabled(true);
+    perf_map.add("unary_relu_m16_n4", code.data(), code.size() * sizeof(uint32_t));
+    path = perf_map.get_jitdump_path();
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  std::vector<char> dump((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  // header: magic, version, total size
+  uint32_t header[3];
+  REQUIRE(dump.size() >= sizeof(header));
+  std::memcpy(header, dump.data(), sizeof(header));
+  REQUIRE(header[0] == 0x4A695444);
+  REQUIRE(header[1] == 1);
+
+  // code load record: id, total size, timestamp, pid, tid, vma, code address, code size, code index, name, code
+  std::size_t offset = header[2];
+  uint32_t record[2];
+  std::memcpy(record, dump.data() + offset, sizeof(record));
+  REQUIRE(record[0] == 0);
+  REQUIRE(record[1] == 56 + std::strlen("unary_relu_m16_n4") + 1 + code.size() * sizeof(uint32_t));
+
+  uint64_t code_size = 0;
+  std::memcpy(&code_size, dump.data() + offset + 40, sizeof(code_size));
+  REQUIRE(code_size == code.size() * sizeof(uint32_t));
+  REQUIRE(std::string(dump.data() + offset + 56) == "unary_relu_m16_n4");
+  REQUIRE(std::memcmp(dump.data() + offset + 56 + std::strlen("unary_relu_m16_n4") + 1, code.data(), code_size) == 0);
+
+  // the close record terminates the jitdump
+  offset += record[1];
+  std::memcpy(record, dump.data() + offset, sizeof(record));
+  REQUIRE(record[0] == 3);
+  REQUIRE(offset + record[1] == dump.size());
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Test perf map disables the outputs it can not open", "[perf_map][correctness]")
+{
+  std::filesystem::path directory = create_test_directory() / "missing";
+
+  std::vector<uint32_t> code = {mov(x0, x1), ret()};
+  mini_jit::PerfMap perf_map(directory.string());
+  perf_map.set_perf_map_enabled(true);
+  perf_map.set_jitdump_enabled(true);
+  REQUIRE(perf_map.is_enabled());
+
+  REQUIRE_NOTHROW(perf_map.add("unary_relu_m16_n4", code.data(), code.size() * sizeof(uint32_t)));
+  REQUIRE_FALSE(perf_map.is_enabled());
+  REQUIRE_FALSE(std::filesystem::exists(perf_map.get_perf_map_path()));
+  REQUIRE_FALSE(std::filesystem::exists(perf_map.get_jitdump_path()));
+
+  // the disabled outputs are not opened again by later kernels
+  REQUIRE_NOTHROW(perf_map.add("second", code.data(), code.size() * sizeof(uint32_t)));
+
+  std::filesystem::remove_all(directory.parent_path());
+}
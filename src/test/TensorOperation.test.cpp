@@ -1,5 +1,9 @@
+#include "../main/Cpu.h"
 #include "../main/TensorOperation.h"
 #include "BaseGeneration.test.h"
+#include "kernels/bf16.test.h"
+#include "kernels/fp16.test.h"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/generators/catch_generators_range.hpp>
@@ -7,8 +11,12 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <omp.h>
 #include <span>
+#include <vector>
 
 /**
  * =================================================================================================
@@ -2027,4 +2035,1288 @@ TEST_CASE(
   }
 
   test.verify_matmul(test.matrix_c_verify.data(), test.matrix_c.data(), test.matrix_c.size());
-}
\ No newline at end of file
+}
+TEST_CASE("Test tensor operation with outer loop with first touch: zero & main kernel: brgemm & last touch: relu on fp64",
+          "[tensor_operation][brgemm][correctness]")
+{
+  using namespace mini_jit;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{3, 2, 13, 7, 5};
+  constexpr int64_t strides_in0[]{2 * 5 * 13, 5 * 13, 1, 0, 13};
+  constexpr int64_t strides_in1[]{7 * 2 * 5, 5, 0, 2 * 5, 1};
+  constexpr int64_t strides_out[]{7 * 13, 0, 1, 13, 0};
+
+  std::vector<double> a(3 * 2 * 5 * 13);
+  std::vector<double> b(3 * 7 * 2 * 5);
+  std::vector<double> c(3 * 7 * 13);
+  for (double &value : a)
+  {
+    value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+  for (double &value : b)
+  {
+    value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+  for (double &value : c)
+  {
+    value = static_cast<double>(std::rand()) / RAND_MAX;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp64, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, TensorConfig::prim_t::relu, std::span{dim_types},
+    std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < dim_sizes[0]; iC++)
+  {
+    for (int64_t iN = 0; iN < dim_sizes[3]; iN++)
+    {
+      for (int64_t iM = 0; iM < dim_sizes[2]; iM++)
+      {
+        double expected = 0;
+        for (int64_t iBr = 0; iBr < dim_sizes[1]; iBr++)
+        {
+          for (int64_t iK = 0; iK < dim_sizes[4]; iK++)
+          {
+            expected += a[iC * strides_in0[0] + iBr * strides_in0[1] + iM * strides_in0[2] + iK * strides_in0[4]] *
+                        b[iC * strides_in1[0] + iBr * strides_in1[1] + iN * strides_in1[3] + iK * strides_in1[4]];
+          }
+        }
+        expected = std::max(expected, 0.0);
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE_THAT(c[iC * strides_out[0] + iM * strides_out[2] + iN * strides_out[3]],
+                     Catch::Matchers::WithinAbs(expected, 1e-12));
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: gemm & last touch: relu on transposed operands",
+          "[tensor_operation][gemm][transpose][correctness]")
+{
+  using namespace mini_jit;
+
+  auto trans_a = GENERATE(false, true);
+  auto trans_b = GENERATE(false, true);
+  auto trans_c = GENERATE(false, true);
+  CAPTURE(trans_a, trans_b, trans_c);
+
+  constexpr int64_t M = 13;
+  constexpr int64_t N = 7;
+  constexpr int64_t K = 5;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::prim, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{M, N, K};
+  const int64_t strides_in0[]{trans_a ? K : 1, 0, trans_a ? 1 : M};
+  const int64_t strides_in1[]{0, trans_b ? 1 : K, trans_b ? N : 1};
+  const int64_t strides_out[]{trans_c ? N : 1, trans_c ? 1 : M, 0};
+
+  std::vector<float> a(M * K);
+  std::vector<float> b(K * N);
+  std::vector<float> c(M * N);
+  for (float &value : a)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+  for (float &value : b)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+  for (float &value : c)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, TensorConfig::prim_t::gemm, TensorConfig::prim_t::relu, std::span{dim_types},
+    std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iN = 0; iN < N; iN++)
+  {
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      float expected = 0;
+      for (int64_t iK = 0; iK < K; iK++)
+      {
+        expected += a[iM * strides_in0[0] + iK * strides_in0[2]] * b[iN * strides_in1[1] + iK * strides_in1[2]];
+      }
+      expected = std::max(expected, 0.0f);
+
+      CAPTURE(iN, iM);
+      REQUIRE_THAT(c[iM * strides_out[0] + iN * strides_out[1]], Catch::Matchers::WithinAbs(expected, 1e-5));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: gemm with and without an outer k loop on a NaN output",
+          "[tensor_operation][gemm][correctness]")
+{
+  using namespace mini_jit;
+
+  // Without the outer k loop the zero first touch is folded into the gemm, which must not read the output
+  auto outer_k = GENERATE(false, true);
+  CAPTURE(outer_k);
+
+  constexpr int64_t M = 13;
+  constexpr int64_t N = 7;
+  constexpr int64_t K = 5;
+  const int64_t K0 = outer_k ? 3 : 1;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim};
+  const int64_t dim_sizes[]{K0, M, N, K};
+  const int64_t strides_in0[]{M * K, 1, 0, M};
+  const int64_t strides_in1[]{K * N, 0, K, 1};
+  const int64_t strides_out[]{0, 1, M, 0};
+
+  const size_t offset = outer_k ? 0 : 1;
+  std::span<const TensorConfig::dim_t> dims = std::span{dim_types}.subspan(offset);
+  std::span<const TensorConfig::exec_t> execs = std::span{exec_types}.subspan(offset);
+
+  std::vector<float> a(K0 * M * K);
+  std::vector<float> b(K0 * K * N);
+  std::vector<float> c(M * N, std::numeric_limits<float>::quiet_NaN());
+  for (float &value : a)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+  for (float &value : b)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, TensorConfig::prim_t::gemm, TensorConfig::prim_t::none, dims, execs,
+    std::span{dim_sizes}.subspan(offset), std::span{strides_in0}.subspan(offset), std::span{strides_in1}.subspan(offset),
+    std::span{strides_out}.subspan(offset));
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iN = 0; iN < N; iN++)
+  {
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      float expected = 0;
+      for (int64_t iK0 = 0; iK0 < K0; iK0++)
+      {
+        for (int64_t iK = 0; iK < K; iK++)
+        {
+          expected += a[iK0 * strides_in0[0] + iM + iK * M] * b[iK0 * strides_in1[0] + iN * K + iK];
+        }
+      }
+
+      CAPTURE(iN, iM);
+      REQUIRE_THAT(c[iM + iN * M], Catch::Matchers::WithinAbs(expected, 1e-5));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with main kernel: gemm & last touch: relu with and without an outer k loop",
+          "[tensor_operation][gemm][correctness]")
+{
+  using namespace mini_jit;
+
+  // Without the outer k loop the relu is fused into the gemm, otherwise it has to be applied after the last k iteration
+  auto outer_k = GENERATE(false, true);
+  CAPTURE(outer_k);
+
+  constexpr int64_t M = 13;
+  constexpr int64_t N = 7;
+  constexpr int64_t K = 5;
+  const int64_t K0 = outer_k ? 3 : 1;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim};
+  const int64_t dim_sizes[]{K0, M, N, K};
+  const int64_t strides_in0[]{M * K, 1, 0, M};
+  const int64_t strides_in1[]{K * N, 0, K, 1};
+  const int64_t strides_out[]{0, 1, M, 0};
+
+  const size_t offset = outer_k ? 0 : 1;
+  std::span<const TensorConfig::dim_t> dims = std::span{dim_types}.subspan(offset);
+  std::span<const TensorConfig::exec_t> execs = std::span{exec_types}.subspan(offset);
+
+  std::vector<float> a(K0 * M * K);
+  std::vector<float> b(K0 * K * N);
+  std::vector<float> c(M * N);
+  for (std::vector<float> *values : {&a, &b, &c})
+  {
+    for (float &value : *values)
+    {
+      value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+    }
+  }
+  const std::vector<float> c_initial = c;
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, TensorConfig::prim_t::gemm, TensorConfig::prim_t::relu, dims, execs,
+    std::span{dim_sizes}.subspan(offset), std::span{strides_in0}.subspan(offset), std::span{strides_in1}.subspan(offset),
+    std::span{strides_out}.subspan(offset));
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iN = 0; iN < N; iN++)
+  {
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      float expected = c_initial[iM + iN * M];
+      for (int64_t iK0 = 0; iK0 < K0; iK0++)
+      {
+        for (int64_t iK = 0; iK < K; iK++)
+        {
+          expected += a[iK0 * strides_in0[0] + iM + iK * M] * b[iK0 * strides_in1[0] + iN * K + iK];
+        }
+      }
+      expected = std::max(expected, 0.0f);
+
+      CAPTURE(iN, iM);
+      REQUIRE_THAT(c[iM + iN * M], Catch::Matchers::WithinAbs(expected, 1e-5));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: brgemm & last touch: relu on packed inputs",
+          "[tensor_operation][brgemm][packing][correctness]")
+{
+  using namespace mini_jit;
+
+  // The leading dimension of in0 spans more memory than the packing threshold, hence both inputs are packed
+  auto trans_a = GENERATE(false, true);
+  auto trans_b = GENERATE(false, true);
+  CAPTURE(trans_a, trans_b);
+
+  constexpr int64_t M0 = 2;
+  constexpr int64_t N0 = 2;
+  constexpr int64_t B = 2;
+  constexpr int64_t M = 37;
+  constexpr int64_t N = 9;
+  constexpr int64_t K = 33;
+  constexpr int64_t LD = 8192;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k,
+                                            TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq,  TensorConfig::exec_t::seq,  TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{M0, N0, B, M, N, K};
+  const int64_t strides_in0[]{trans_a ? M * LD : M, 0, trans_a ? K : K * LD, trans_a ? LD : 1, 0, trans_a ? 1 : LD};
+  const int64_t strides_in1[]{0, trans_b ? N : N * K, trans_b ? K * N0 * N : N0 * N * K, 0, trans_b ? 1 : K, trans_b ? N0 * N : 1};
+  const int64_t strides_out[]{M, M0 * M * N, 0, 1, M0 * M, 0};
+
+  std::vector<float> a(trans_a ? M0 * M * LD : B * K * LD);
+  std::vector<float> b(B * N0 * N * K);
+  std::vector<float> c(M0 * M * N0 * N, std::numeric_limits<float>::quiet_NaN());
+  for (std::vector<float> *values : {&a, &b})
+  {
+    for (float &value : *values)
+    {
+      value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, TensorConfig::prim_t::relu,
+    std::span{dim_types}, std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+    std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iM0 = 0; iM0 < M0; iM0++)
+  {
+    for (int64_t iN0 = 0; iN0 < N0; iN0++)
+    {
+      for (int64_t iN = 0; iN < N; iN++)
+      {
+        for (int64_t iM = 0; iM < M; iM++)
+        {
+          float expected = 0;
+          for (int64_t iB = 0; iB < B; iB++)
+          {
+            for (int64_t iK = 0; iK < K; iK++)
+            {
+              expected += a[iM0 * strides_in0[0] + iB * strides_in0[2] + iM * strides_in0[3] + iK * strides_in0[5]] *
+                          b[iN0 * strides_in1[1] + iB * strides_in1[2] + iN * strides_in1[4] + iK * strides_in1[5]];
+            }
+          }
+          expected = std::max(expected, 0.0f);
+
+          CAPTURE(iM0, iN0, iN, iM);
+          REQUIRE_THAT(c[iM0 * strides_out[0] + iN0 * strides_out[1] + iM + iN * strides_out[4]],
+                       Catch::Matchers::WithinAbs(expected, 1e-4));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation on packed inputs with more threads than at setup and concurrent executions",
+          "[tensor_operation][brgemm][packing][shared][correctness]")
+{
+  using namespace mini_jit;
+
+  // The packed inputs belong to the executing thread, hence neither a larger team than at setup nor concurrent executions share them
+  constexpr int64_t M0 = 4;
+  constexpr int64_t N0 = 3;
+  constexpr int64_t B = 2;
+  constexpr int64_t M = 21;
+  constexpr int64_t N = 5;
+  constexpr int64_t K = 17;
+  constexpr int64_t LD = 8192;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k,
+                                            TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::shared, TensorConfig::exec_t::shared, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim,   TensorConfig::exec_t::prim,   TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{M0, N0, B, M, N, K};
+  constexpr int64_t strides_in0[]{M, 0, K * LD, 1, 0, LD};
+  constexpr int64_t strides_in1[]{0, N * K, N0 * N * K, 0, K, 1};
+  constexpr int64_t strides_out[]{M, M0 * M * N, 0, 1, M0 * M, 0};
+
+  std::vector<float> a(B * K * LD);
+  std::vector<float> b(B * N0 * N * K);
+  for (std::vector<float> *values : {&a, &b})
+  {
+    for (float &value : *values)
+    {
+      value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+    }
+  }
+
+  const int thread_count = omp_get_max_threads();
+  omp_set_num_threads(1);
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, TensorConfig::prim_t::relu,
+    std::span{dim_types}, std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+    std::span{strides_out});
+  omp_set_num_threads(4);
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  std::vector<float> c0(M0 * M * N0 * N, std::numeric_limits<float>::quiet_NaN());
+  std::vector<float> c1(M0 * M * N0 * N, std::numeric_limits<float>::quiet_NaN());
+  std::vector<float> c2(M0 * M * N0 * N, std::numeric_limits<float>::quiet_NaN());
+  tensor_op.execute(a.data(), b.data(), c0.data());
+
+#ifdef MLC_USE_OPENMP
+#pragma omp parallel sections num_threads(2)
+#endif
+  {
+#ifdef MLC_USE_OPENMP
+#pragma omp section
+#endif
+    tensor_op.execute(a.data(), b.data(), c1.data());
+#ifdef MLC_USE_OPENMP
+#pragma omp section
+#endif
+    tensor_op.execute(a.data(), b.data(), c2.data());
+  }
+  omp_set_num_threads(thread_count);
+
+  for (int64_t iM0 = 0; iM0 < M0; iM0++)
+  {
+    for (int64_t iN0 = 0; iN0 < N0; iN0++)
+    {
+      for (int64_t iN = 0; iN < N; iN++)
+      {
+        for (int64_t iM = 0; iM < M; iM++)
+        {
+          float expected = 0;
+          for (int64_t iB = 0; iB < B; iB++)
+          {
+            for (int64_t iK = 0; iK < K; iK++)
+            {
+              expected += a[iM0 * strides_in0[0] + iB * strides_in0[2] + iM * strides_in0[3] + iK * strides_in0[5]] *
+                          b[iN0 * strides_in1[1] + iB * strides_in1[2] + iN * strides_in1[4] + iK * strides_in1[5]];
+            }
+          }
+          expected = std::max(expected, 0.0f);
+
+          int64_t index = iM0 * strides_out[0] + iN0 * strides_out[1] + iM + iN * strides_out[4];
+          CAPTURE(iM0, iN0, iN, iM);
+          REQUIRE_THAT(c0[index], Catch::Matchers::WithinAbs(expected, 1e-4));
+          REQUIRE_THAT(c1[index], Catch::Matchers::WithinAbs(expected, 1e-4));
+          REQUIRE_THAT(c2[index], Catch::Matchers::WithinAbs(expected, 1e-4));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: brgemm & last touch: relu on bf16 inputs",
+          "[tensor_operation][brgemm][bf16][correctness]")
+{
+  using namespace mini_jit;
+
+  // The bf16 inputs are always packed, the output and the touch primitives are single precision
+  constexpr int64_t C = 2;
+  constexpr int64_t B = 3;
+  constexpr int64_t M = 19;
+  constexpr int64_t N = 11;
+  constexpr int64_t K = 6;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{C, B, M, N, K};
+  constexpr int64_t strides_in0[]{B * K * M, K * M, 1, 0, M};
+  constexpr int64_t strides_in1[]{N * B * K, K, 0, B * K, 1};
+  constexpr int64_t strides_out[]{N * M, 0, 1, M, 0};
+
+  if (!Cpu::has_bf16())
+  {
+    // The setup fails instead of the first execution trapping on the bfmmla
+    mini_jit::TensorOperation unsupported_op;
+    REQUIRE(unsupported_op.setup_no_optimization(TensorConfig::dtype_t::bf16, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm,
+                                                 TensorConfig::prim_t::relu, std::span{dim_types}, std::span{exec_types},
+                                                 std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+                                                 std::span{strides_out}) == TensorOperation::error_t::err_wrong_dtype);
+    SKIP("The processor does not implement the BFloat16 extension.");
+  }
+
+  std::vector<uint16_t> a(C * B * K * M);
+  std::vector<uint16_t> b(C * N * B * K);
+  std::vector<float> c(C * N * M, std::numeric_limits<float>::quiet_NaN());
+  for (std::vector<uint16_t> *values : {&a, &b})
+  {
+    for (uint16_t &value : *values)
+    {
+      value = to_bf16(static_cast<float>(std::rand()) / RAND_MAX - 0.5f);
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::bf16, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, TensorConfig::prim_t::relu,
+    std::span{dim_types}, std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+    std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    for (int64_t iN = 0; iN < N; iN++)
+    {
+      for (int64_t iM = 0; iM < M; iM++)
+      {
+        double expected = 0;
+        for (int64_t iB = 0; iB < B; iB++)
+        {
+          for (int64_t iK = 0; iK < K; iK++)
+          {
+            expected += static_cast<double>(from_bf16(a[iC * strides_in0[0] + iB * strides_in0[1] + iM + iK * strides_in0[4]])) *
+                        from_bf16(b[iC * strides_in1[0] + iB * strides_in1[1] + iN * strides_in1[3] + iK]);
+          }
+        }
+        expected = std::max(expected, 0.0);
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE_THAT(c[iC * strides_out[0] + iM + iN * strides_out[3]], Catch::Matchers::WithinAbs(expected, 1e-5));
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: brgemm on s8 inputs",
+          "[tensor_operation][brgemm][int8][correctness]")
+{
+  using namespace mini_jit;
+
+  // The s8 inputs are always packed, the output is int32 and only touched by zero and copy
+  constexpr int64_t C = 2;
+  constexpr int64_t B = 3;
+  constexpr int64_t M = 19;
+  constexpr int64_t N = 11;
+  constexpr int64_t K = 6;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{C, B, M, N, K};
+  constexpr int64_t strides_in0[]{B * K * M, K * M, 1, 0, M};
+  constexpr int64_t strides_in1[]{N * B * K, K, 0, B * K, 1};
+  constexpr int64_t strides_out[]{N * M, 0, 1, M, 0};
+
+  mini_jit::TensorOperation relu_op;
+  REQUIRE(relu_op.setup_no_optimization(TensorConfig::dtype_t::s8, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm,
+                                        TensorConfig::prim_t::relu, std::span{dim_types}, std::span{exec_types}, std::span{dim_sizes},
+                                        std::span{strides_in0}, std::span{strides_in1},
+                                        std::span{strides_out}) == TensorOperation::error_t::err_wrong_dtype);
+
+  if (!Cpu::has_dotprod())
+  {
+    // The setup fails instead of the first execution trapping on the sdot
+    mini_jit::TensorOperation unsupported_op;
+    REQUIRE(unsupported_op.setup_no_optimization(TensorConfig::dtype_t::s8, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm,
+                                                 TensorConfig::prim_t::none, std::span{dim_types}, std::span{exec_types},
+                                                 std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+                                                 std::span{strides_out}) == (Cpu::has_i8mm() ? TensorOperation::error_t::success
+                                                                                             : TensorOperation::error_t::err_wrong_dtype));
+    SKIP("The processor does not implement the dot product instructions.");
+  }
+
+  std::vector<int8_t> a(C * B * K * M);
+  std::vector<int8_t> b(C * N * B * K);
+  std::vector<int32_t> c(C * N * M, -1);
+  for (std::vector<int8_t> *values : {&a, &b})
+  {
+    for (int8_t &value : *values)
+    {
+      value = static_cast<int8_t>(std::rand());
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::s8, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, TensorConfig::prim_t::none,
+    std::span{dim_types}, std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1},
+    std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    for (int64_t iN = 0; iN < N; iN++)
+    {
+      for (int64_t iM = 0; iM < M; iM++)
+      {
+        int32_t expected = 0;
+        for (int64_t iB = 0; iB < B; iB++)
+        {
+          for (int64_t iK = 0; iK < K; iK++)
+          {
+            expected += a[iC * strides_in0[0] + iB * strides_in0[1] + iM + iK * strides_in0[4]] *
+                        b[iC * strides_in1[0] + iB * strides_in1[1] + iN * strides_in1[3] + iK];
+          }
+        }
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE(c[iC * strides_out[0] + iM + iN * strides_out[3]] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: brgemm & last touch: relu on fp16 inputs",
+          "[tensor_operation][brgemm][fp16][correctness]")
+{
+  using namespace mini_jit;
+
+  // The fp16 relu of the last touch compares half-precision floats, the brgemm itself runs on every processor
+  auto last_touch = GENERATE(TensorConfig::prim_t::none, TensorConfig::prim_t::relu);
+  if (last_touch == TensorConfig::prim_t::relu && !Cpu::has_fp16())
+  {
+    SKIP("The processor does not implement the half-precision arithmetic.");
+  }
+
+  CAPTURE(last_touch);
+
+  // The sequential k dimension accumulates onto the half-precision output of the previous call
+  constexpr int64_t C = 2;
+  constexpr int64_t S = 2;
+  constexpr int64_t B = 3;
+  constexpr int64_t M = 19;
+  constexpr int64_t N = 11;
+  constexpr int64_t K = 6;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::k, TensorConfig::dim_t::k, TensorConfig::dim_t::m,
+                                            TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq,  TensorConfig::exec_t::seq,  TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{C, S, B, M, N, K};
+  constexpr int64_t strides_in0[]{S * B * K * M, B * K * M, K * M, 1, 0, M};
+  constexpr int64_t strides_in1[]{N * S * B * K, B * K, K, 0, S * B * K, 1};
+  constexpr int64_t strides_out[]{N * M, 0, 0, 1, M, 0};
+
+  // Small integers keep all partial sums exact in half precision
+  std::vector<uint16_t> a(C * S * B * K * M);
+  std::vector<uint16_t> b(C * N * S * B * K);
+  std::vector<uint16_t> c(C * N * M, to_fp16(std::numeric_limits<float>::quiet_NaN()));
+  for (std::vector<uint16_t> *values : {&a, &b})
+  {
+    for (uint16_t &value : *values)
+    {
+      value = to_fp16(static_cast<float>(std::rand() % 5 - 2));
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp16, TensorConfig::prim_t::zero, TensorConfig::prim_t::brgemm, last_touch, std::span{dim_types},
+    std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    for (int64_t iN = 0; iN < N; iN++)
+    {
+      for (int64_t iM = 0; iM < M; iM++)
+      {
+        float expected = 0;
+        for (int64_t iS = 0; iS < S; iS++)
+        {
+          for (int64_t iB = 0; iB < B; iB++)
+          {
+            for (int64_t iK = 0; iK < K; iK++)
+            {
+              expected += from_fp16(a[iC * strides_in0[0] + iS * strides_in0[1] + iB * strides_in0[2] + iM + iK * strides_in0[5]]) *
+                          from_fp16(b[iC * strides_in1[0] + iS * strides_in1[1] + iB * strides_in1[2] + iN * strides_in1[4] + iK]);
+            }
+          }
+        }
+        if (last_touch == TensorConfig::prim_t::relu)
+        {
+          expected = std::max(expected, 0.0f);
+        }
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE(from_fp16(c[iC * strides_out[0] + iM + iN * strides_out[4]]) == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with first touch: zero & main kernel: gemm & last touch: activation with and without an outer k loop",
+          "[tensor_operation][gemm][unary][correctness]")
+{
+  using namespace mini_jit;
+
+  auto last_touch = GENERATE(TensorConfig::prim_t::exp, TensorConfig::prim_t::sigmoid, TensorConfig::prim_t::tanh,
+                             TensorConfig::prim_t::gelu_erf, TensorConfig::prim_t::gelu_tanh, TensorConfig::prim_t::silu);
+  auto outer_k = GENERATE(false, true);
+  CAPTURE(last_touch, outer_k);
+
+  constexpr int64_t M = 13;
+  constexpr int64_t N = 7;
+  constexpr int64_t K = 5;
+  const int64_t K0 = outer_k ? 3 : 1;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n,
+                                            TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim,
+                                              TensorConfig::exec_t::prim};
+  const int64_t dim_sizes[]{K0, M, N, K};
+  const int64_t strides_in0[]{M * K, 1, 0, M};
+  const int64_t strides_in1[]{K * N, 0, K, 1};
+  const int64_t strides_out[]{0, 1, M, 0};
+
+  const size_t offset = outer_k ? 0 : 1;
+  std::span<const TensorConfig::dim_t> dims = std::span{dim_types}.subspan(offset);
+  std::span<const TensorConfig::exec_t> execs = std::span{exec_types}.subspan(offset);
+
+  std::vector<float> a(K0 * M * K);
+  std::vector<float> b(K0 * K * N);
+  std::vector<float> c(M * N, std::numeric_limits<float>::quiet_NaN());
+  for (std::vector<float> *values : {&a, &b})
+  {
+    for (float &value : *values)
+    {
+      value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, TensorConfig::prim_t::gemm, last_touch, dims, execs,
+    std::span{dim_sizes}.subspan(offset), std::span{strides_in0}.subspan(offset), std::span{strides_in1}.subspan(offset),
+    std::span{strides_out}.subspan(offset));
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iN = 0; iN < N; iN++)
+  {
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      double x = 0;
+      for (int64_t iK0 = 0; iK0 < K0; iK0++)
+      {
+        for (int64_t iK = 0; iK < K; iK++)
+        {
+          x += a[iK0 * strides_in0[0] + iM + iK * M] * b[iK0 * strides_in1[0] + iN * K + iK];
+        }
+      }
+
+      double expected = 0;
+      switch (last_touch)
+      {
+      case TensorConfig::prim_t::exp:
+        expected = std::exp(x);
+        break;
+      case TensorConfig::prim_t::sigmoid:
+        expected = 1 / (1 + std::exp(-x));
+        break;
+      case TensorConfig::prim_t::tanh:
+        expected = std::tanh(x);
+        break;
+      case TensorConfig::prim_t::gelu_erf:
+        expected = 0.5 * x * std::erfc(-x / std::sqrt(2.0));
+        break;
+      case TensorConfig::prim_t::gelu_tanh:
+        expected = 0.5 * x * (1 + std::tanh(std::sqrt(2 / M_PI) * (x + 0.044715 * x * x * x)));
+        break;
+      default:
+        expected = x / (1 + std::exp(-x));
+        break;
+      }
+
+      CAPTURE(iN, iM, x);
+      REQUIRE_THAT(c[iM + iN * M], Catch::Matchers::WithinAbs(expected, 1e-5));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation rejects the activations on other data types than fp32", "[tensor_operation][unary]")
+{
+  using namespace mini_jit;
+
+  auto dtype = GENERATE(TensorConfig::dtype_t::fp64, TensorConfig::dtype_t::fp16);
+  CAPTURE(dtype);
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{16, 4};
+  constexpr int64_t strides_in0[]{1, 16};
+  constexpr int64_t strides_in1[]{0, 0};
+  constexpr int64_t strides_out[]{1, 16};
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    dtype, TensorConfig::prim_t::none, TensorConfig::prim_t::silu, TensorConfig::prim_t::none, std::span{dim_types},
+    std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::err_invalid_main_configuration);
+}
+
+TEST_CASE("Test tensor operation with main kernel: binary (add, sub, mul, max, min) broadcasting the inputs",
+          "[tensor_operation][binary][correctness]")
+{
+  using namespace mini_jit;
+
+  auto prim = GENERATE(TensorConfig::prim_t::add, TensorConfig::prim_t::sub, TensorConfig::prim_t::mul, TensorConfig::prim_t::max,
+                       TensorConfig::prim_t::min);
+
+  constexpr int64_t C = 3;
+  constexpr int64_t M = 13;
+  constexpr int64_t N = 7;
+
+  // A bias of the rows, a scale of the columns and both, the outer dimension is broadcast by all of them
+  auto [strides_in0, strides_in1] = GENERATE(table<std::vector<int64_t>, std::vector<int64_t>>({
+    {{M * N, 1, M}, {0, 1, 0}},
+    {{N, 0, 1}, {M * N, 1, M}},
+    {{0, 1, 0}, {N, 0, 1}},
+  }));
+  CAPTURE(prim, strides_in0, strides_in1);
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::m, TensorConfig::dim_t::n};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{C, M, N};
+  constexpr int64_t strides_out[]{M * N, 1, M};
+
+  std::vector<float> a(C * M * N);
+  std::vector<float> b(C * M * N);
+  std::vector<float> c(C * M * N, std::numeric_limits<float>::quiet_NaN());
+  for (std::vector<float> *values : {&a, &b})
+  {
+    for (float &value : *values)
+    {
+      value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, prim, TensorConfig::prim_t::none, std::span{dim_types},
+    std::span{exec_types}, std::span{dim_sizes}, std::span{strides_in0}, std::span{strides_in1}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    for (int64_t iN = 0; iN < N; iN++)
+    {
+      for (int64_t iM = 0; iM < M; iM++)
+      {
+        const float x = a[iC * strides_in0[0] + iM * strides_in0[1] + iN * strides_in0[2]];
+        const float y = b[iC * strides_in1[0] + iM * strides_in1[1] + iN * strides_in1[2]];
+
+        float expected = 0;
+        switch (prim)
+        {
+        case TensorConfig::prim_t::add:
+          expected = x + y;
+          break;
+        case TensorConfig::prim_t::sub:
+          expected = x - y;
+          break;
+        case TensorConfig::prim_t::mul:
+          expected = x * y;
+          break;
+        case TensorConfig::prim_t::max:
+          expected = std::max(x, y);
+          break;
+        default:
+          expected = std::min(x, y);
+          break;
+        }
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE(c[iC * strides_out[0] + iM + iN * strides_out[2]] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with optimization with main kernel: binary add & last touch: relu on fp64 tensors",
+          "[tensor_operation][binary][correctness]")
+{
+  using namespace mini_jit;
+
+  constexpr int64_t C = 5;
+  constexpr int64_t N = 7;
+  constexpr int64_t M = 13;
+
+  // The residual is added to the input, the bias of the rows is broadcast over the two outer dimensions
+  auto strides_in1 = GENERATE(std::vector<int64_t>{N * M, M, 1}, std::vector<int64_t>{0, 0, 1});
+  CAPTURE(strides_in1);
+
+  TensorConfig config{
+    TensorConfig::prim_t::none,                                                         // first_touch
+    TensorConfig::prim_t::add,                                                          // main
+    TensorConfig::prim_t::relu,                                                         // last touch
+    {TensorConfig::dim_t::c, TensorConfig::dim_t::c, TensorConfig::dim_t::c},           // dim_types
+    {TensorConfig::exec_t::seq, TensorConfig::exec_t::seq, TensorConfig::exec_t::seq},  // exec_types
+    {C, N, M},                                                                          // dim_sizes
+    {N * M, M, 1},                                                                      // strides_in0
+    strides_in1,                                                                        // strides_in1
+    {N * M, M, 1},                                                                      // strides_out
+    TensorConfig::dtype_t::fp64,                                                        // dtype_t
+  };
+
+  std::vector<double> a(C * N * M);
+  std::vector<double> b(C * N * M);
+  std::vector<double> c(C * N * M, std::numeric_limits<double>::quiet_NaN());
+  for (std::vector<double> *values : {&a, &b})
+  {
+    for (double &value : *values)
+    {
+      value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+    }
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup(config);
+
+  INFO(tensor_op.get_config().to_string());
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), b.data(), c.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    for (int64_t iN = 0; iN < N; iN++)
+    {
+      for (int64_t iM = 0; iM < M; iM++)
+      {
+        const double expected =
+          std::max(a[iC * N * M + iN * M + iM] + b[iC * strides_in1[0] + iN * strides_in1[1] + iM * strides_in1[2]], 0.0);
+
+        CAPTURE(iC, iN, iM);
+        REQUIRE(c[iC * N * M + iN * M + iM] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation rejects the invalid configurations of a binary", "[tensor_operation][binary]")
+{
+  using namespace mini_jit;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, TensorConfig::dim_t::m, TensorConfig::dim_t::n};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{2, 16, 4};
+  constexpr int64_t strides_in[]{64, 1, 16};
+  constexpr int64_t strides_in1_padded[]{128, 2, 32};
+  constexpr int64_t strides_out[]{64, 1, 16};
+  constexpr int64_t strides_out_k[]{0, 1, 16};
+
+  auto setup = [&](TensorConfig::dtype_t dtype, TensorConfig::prim_t first_touch, size_t offset, std::span<const int64_t> strides_in1,
+                   std::span<const int64_t> strides_out)
+  {
+    mini_jit::TensorOperation tensor_op;
+    return tensor_op.setup_no_optimization(dtype, first_touch, TensorConfig::prim_t::add, TensorConfig::prim_t::none,
+                                           std::span{dim_types}.subspan(offset), std::span{exec_types}.subspan(offset),
+                                           std::span{dim_sizes}.subspan(offset), std::span{strides_in}.subspan(offset),
+                                           strides_in1.empty() ? strides_in1 : strides_in1.subspan(offset), strides_out.subspan(offset));
+  };
+
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, 1, strides_in, strides_out) == TensorOperation::error_t::success);
+  REQUIRE(setup(TensorConfig::dtype_t::fp16, TensorConfig::prim_t::none, 1, strides_in, strides_out) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, 1, strides_in, strides_out) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, 1, {}, strides_out) ==
+          TensorOperation::error_t::err_wrong_dimension);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, 1, strides_in1_padded, strides_out) ==
+          TensorOperation::error_t::err_invalid_strides);
+
+  // The output of a k dimension would be overwritten instead of reduced
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, 0, strides_in, strides_out_k) ==
+          TensorOperation::error_t::err_invalid_strides);
+}
+
+TEST_CASE("Test tensor operation with main kernel: reduce (sum, max, mean) over an outer and a primitive k dimension",
+          "[tensor_operation][reduce][correctness]")
+{
+  using namespace mini_jit;
+
+  auto prim = GENERATE(TensorConfig::prim_t::reduce_sum, TensorConfig::prim_t::reduce_max, TensorConfig::prim_t::reduce_mean);
+
+  constexpr int64_t K0 = 3;
+  constexpr int64_t K1 = 11;
+  constexpr int64_t C = 9;
+
+  // The unit stride k is reduced inside the columns of n, otherwise the columns are reduced into m
+  auto unit_k = GENERATE(true, false);
+  CAPTURE(prim, unit_k);
+
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{K0, C, K1};
+  const TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, unit_k ? TensorConfig::dim_t::n : TensorConfig::dim_t::m,
+                                        TensorConfig::dim_t::k};
+  const std::vector<int64_t> strides_in0 = unit_k ? std::vector<int64_t>{C * K1, K1, 1} : std::vector<int64_t>{C * K1, 1, C};
+  constexpr int64_t strides_out[]{0, 1, 0};
+
+  std::vector<float> a(K0 * C * K1);
+  std::vector<float> b(C, std::numeric_limits<float>::quiet_NaN());
+  for (float &value : a)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, prim, TensorConfig::prim_t::none, std::span{dim_types}, std::span{exec_types},
+    std::span{dim_sizes}, std::span{strides_in0}, std::span<const int64_t>{}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), nullptr, b.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    float expected = prim == TensorConfig::prim_t::reduce_max ? -std::numeric_limits<float>::infinity() : 0;
+    for (int64_t iK0 = 0; iK0 < K0; iK0++)
+    {
+      for (int64_t iK1 = 0; iK1 < K1; iK1++)
+      {
+        const float value = a[iK0 * strides_in0[0] + iC * strides_in0[1] + iK1 * strides_in0[2]];
+        expected = prim == TensorConfig::prim_t::reduce_max ? std::max(expected, value) : expected + value;
+      }
+    }
+    if (prim == TensorConfig::prim_t::reduce_mean)
+    {
+      expected /= K0 * K1;
+    }
+
+    CAPTURE(iC);
+    REQUIRE_THAT(b[iC], Catch::Matchers::WithinAbs(expected, 1e-5));
+  }
+}
+
+TEST_CASE("Test tensor operation with optimization with main kernel: reduce sum of the middle dimension on fp64 tensors",
+          "[tensor_operation][reduce][correctness]")
+{
+  using namespace mini_jit;
+
+  constexpr int64_t C0 = 5;
+  constexpr int64_t K = 300;
+  constexpr int64_t C1 = 7;
+
+  TensorConfig config{
+    TensorConfig::prim_t::none,                                                         // first_touch
+    TensorConfig::prim_t::reduce_sum,                                                   // main
+    TensorConfig::prim_t::none,                                                         // last touch
+    {TensorConfig::dim_t::c, TensorConfig::dim_t::k, TensorConfig::dim_t::c},           // dim_types
+    {TensorConfig::exec_t::seq, TensorConfig::exec_t::seq, TensorConfig::exec_t::seq},  // exec_types
+    {C0, K, C1},                                                                        // dim_sizes
+    {K * C1, C1, 1},                                                                    // strides_in0
+    {0, 0, 0},                                                                          // strides_in1
+    {C1, 0, 1},                                                                         // strides_out
+    TensorConfig::dtype_t::fp64,                                                        // dtype_t
+  };
+
+  std::vector<double> a(C0 * K * C1);
+  std::vector<double> b(C0 * C1, std::numeric_limits<double>::quiet_NaN());
+  for (double &value : a)
+  {
+    value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup(config);
+
+  INFO(tensor_op.get_config().to_string());
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), nullptr, b.data());
+
+  for (int64_t iC0 = 0; iC0 < C0; iC0++)
+  {
+    for (int64_t iC1 = 0; iC1 < C1; iC1++)
+    {
+      double expected = 0;
+      for (int64_t iK = 0; iK < K; iK++)
+      {
+        expected += a[iC0 * K * C1 + iK * C1 + iC1];
+      }
+
+      CAPTURE(iC0, iC1);
+      REQUIRE_THAT(b[iC0 * C1 + iC1], Catch::Matchers::WithinAbs(expected, 1e-10));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation rejects the invalid configurations of a reduce", "[tensor_operation][reduce]")
+{
+  using namespace mini_jit;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::k, TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::dim_t dim_types_mn[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::k};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr TensorConfig::exec_t exec_types_mn[]{TensorConfig::exec_t::prim, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{2, 16, 4};
+  constexpr int64_t strides_in[]{64, 4, 1};
+  constexpr int64_t strides_in_padded[]{128, 8, 2};
+  constexpr int64_t strides_out[]{0, 1, 0};
+  constexpr int64_t strides_out_k[]{0, 1, 1};
+
+  auto setup = [&](TensorConfig::dtype_t dtype, TensorConfig::prim_t first_touch, std::span<const TensorConfig::dim_t> dim_types,
+                   std::span<const TensorConfig::exec_t> exec_types, std::span<const int64_t> strides_in,
+                   std::span<const int64_t> strides_out)
+  {
+    mini_jit::TensorOperation tensor_op;
+    return tensor_op.setup_no_optimization(dtype, first_touch, TensorConfig::prim_t::reduce_sum, TensorConfig::prim_t::none, dim_types,
+                                           exec_types, std::span{dim_sizes}, strides_in, std::span<const int64_t>{}, strides_out);
+  };
+
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types, exec_types, strides_in, strides_out) ==
+          TensorOperation::error_t::success);
+  REQUIRE(setup(TensorConfig::dtype_t::fp16, TensorConfig::prim_t::none, dim_types, exec_types, strides_in, strides_out) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, dim_types, exec_types, strides_in, strides_out) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types_mn, exec_types_mn, strides_in, strides_out) ==
+          TensorOperation::error_t::err_invalid_primitive_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types, exec_types, strides_in_padded, strides_out) ==
+          TensorOperation::error_t::err_invalid_strides);
+
+  // The output of a k dimension would be overwritten instead of reduced
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types, exec_types, strides_in, strides_out_k) ==
+          TensorOperation::error_t::err_invalid_strides);
+}
+
+TEST_CASE("Test tensor operation with main kernel: normalization (softmax, layer_norm, rms_norm) over a primitive m dimension",
+          "[tensor_operation][normalization][correctness]")
+{
+  using namespace mini_jit;
+
+  auto prim = GENERATE(TensorConfig::prim_t::softmax, TensorConfig::prim_t::layer_norm, TensorConfig::prim_t::rms_norm);
+  auto M = GENERATE(7, 64, 301);
+  CAPTURE(prim, M);
+
+  constexpr int64_t C = 3;
+  constexpr int64_t N = 5;
+
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::n, TensorConfig::dim_t::m};
+  const int64_t dim_sizes[]{C, N, M};
+  const int64_t strides_in0[]{N * (M + 3), M + 3, 1};
+  const int64_t strides_out[]{N * M, M, 1};
+
+  std::vector<float> a(C * N * (M + 3));
+  std::vector<float> b(C * N * M, std::numeric_limits<float>::quiet_NaN());
+  for (float &value : a)
+  {
+    value = (static_cast<float>(std::rand()) / RAND_MAX - 0.5f) * 8;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup_no_optimization(
+    TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, prim, TensorConfig::prim_t::none, std::span{dim_types}, std::span{exec_types},
+    std::span{dim_sizes}, std::span{strides_in0}, std::span<const int64_t>{}, std::span{strides_out});
+
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), nullptr, b.data());
+
+  for (int64_t iColumn = 0; iColumn < C * N; iColumn++)
+  {
+    const float *column = a.data() + iColumn * (M + 3);
+
+    double max = -std::numeric_limits<double>::infinity();
+    double sum = 0;
+    double square_sum = 0;
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      max = std::max(max, static_cast<double>(column[iM]));
+      sum += column[iM];
+      square_sum += static_cast<double>(column[iM]) * column[iM];
+    }
+
+    double exp_sum = 0;
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      exp_sum += std::exp(column[iM] - max);
+    }
+    const double mean = sum / M;
+    const double variance = square_sum / M - mean * mean;
+
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      double expected = column[iM] / std::sqrt(square_sum / M + 1e-5);
+      if (prim == TensorConfig::prim_t::softmax)
+      {
+        expected = std::exp(column[iM] - max) / exp_sum;
+      }
+      else if (prim == TensorConfig::prim_t::layer_norm)
+      {
+        expected = (column[iM] - mean) / std::sqrt(variance + 1e-5);
+      }
+
+      CAPTURE(iColumn, iM);
+      REQUIRE_THAT(b[iColumn * M + iM], Catch::Matchers::WithinAbs(expected, 1e-4));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation with optimization with main kernel: softmax over a long m dimension",
+          "[tensor_operation][normalization][correctness]")
+{
+  using namespace mini_jit;
+
+  constexpr int64_t C = 6;
+  constexpr int64_t M = 4096;
+
+  // The optimization must not split the normalized dimension
+  TensorConfig config{
+    TensorConfig::prim_t::none,                              // first_touch
+    TensorConfig::prim_t::softmax,                           // main
+    TensorConfig::prim_t::none,                              // last touch
+    {TensorConfig::dim_t::c, TensorConfig::dim_t::m},        // dim_types
+    {TensorConfig::exec_t::seq, TensorConfig::exec_t::seq},  // exec_types
+    {C, M},                                                  // dim_sizes
+    {M, 1},                                                  // strides_in0
+    {0, 0},                                                  // strides_in1
+    {M, 1},                                                  // strides_out
+    TensorConfig::dtype_t::fp32,                             // dtype_t
+  };
+
+  std::vector<float> a(C * M);
+  std::vector<float> b(C * M, std::numeric_limits<float>::quiet_NaN());
+  for (float &value : a)
+  {
+    value = (static_cast<float>(std::rand()) / RAND_MAX - 0.5f) * 20;
+  }
+
+  mini_jit::TensorOperation tensor_op;
+  TensorOperation::error_t err = tensor_op.setup(config);
+
+  INFO(tensor_op.get_config().to_string());
+  REQUIRE(err == TensorOperation::error_t::success);
+
+  tensor_op.execute(a.data(), nullptr, b.data());
+
+  for (int64_t iC = 0; iC < C; iC++)
+  {
+    double max = -std::numeric_limits<double>::infinity();
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      max = std::max(max, static_cast<double>(a[iC * M + iM]));
+    }
+    double sum = 0;
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      sum += std::exp(a[iC * M + iM] - max);
+    }
+
+    for (int64_t iM = 0; iM < M; iM++)
+    {
+      CAPTURE(iC, iM);
+      REQUIRE_THAT(b[iC * M + iM], Catch::Matchers::WithinRel(std::exp(a[iC * M + iM] - max) / sum, 1e-5));
+    }
+  }
+}
+
+TEST_CASE("Test tensor operation rejects the invalid configurations of a normalization", "[tensor_operation][normalization]")
+{
+  using namespace mini_jit;
+
+  constexpr TensorConfig::dim_t dim_types[]{TensorConfig::dim_t::c, TensorConfig::dim_t::n, TensorConfig::dim_t::m};
+  constexpr TensorConfig::dim_t dim_types_mm[]{TensorConfig::dim_t::m, TensorConfig::dim_t::n, TensorConfig::dim_t::m};
+  constexpr TensorConfig::exec_t exec_types[]{TensorConfig::exec_t::seq, TensorConfig::exec_t::prim, TensorConfig::exec_t::prim};
+  constexpr int64_t dim_sizes[]{2, 16, 40};
+  constexpr int64_t strides[]{640, 40, 1};
+  constexpr int64_t strides_padded[]{1280, 80, 2};
+
+  auto setup = [&](TensorConfig::dtype_t dtype, TensorConfig::prim_t first_touch, std::span<const TensorConfig::dim_t> dim_types,
+                   std::span<const int64_t> strides_in, std::span<const int64_t> strides_out)
+  {
+    mini_jit::TensorOperation tensor_op;
+    return tensor_op.setup_no_optimization(dtype, first_touch, TensorConfig::prim_t::softmax, TensorConfig::prim_t::none, dim_types,
+                                           std::span{exec_types}, std::span{dim_sizes}, strides_in, std::span<const int64_t>{},
+                                           strides_out);
+  };
+
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types, strides, strides) ==
+          TensorOperation::error_t::success);
+  REQUIRE(setup(TensorConfig::dtype_t::fp64, TensorConfig::prim_t::none, dim_types, strides, strides) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::zero, dim_types, strides, strides) ==
+          TensorOperation::error_t::err_invalid_main_configuration);
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types, strides_padded, strides) ==
+          TensorOperation::error_t::err_invalid_strides);
+
+  // A second m dimension would split the normalized elements across calls of the kernel
+  REQUIRE(setup(TensorConfig::dtype_t::fp32, TensorConfig::prim_t::none, dim_types_mm, strides, strides) ==
+          TensorOperation::error_t::err_invalid_primitive_configuration);
+}
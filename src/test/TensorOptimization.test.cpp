@@ -48,6 +48,41 @@ TEST_CASE("Test tensor optimization primitive identification gemm", "[tensor_opt
   REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
 }
 
+TEST_CASE("Test tensor optimization primitive identification gemm row-major inputs", "[tensor_optimization][gemm][correctness]")
+{
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                                                                             // first_touch
+    mini_jit::TensorConfig::prim_t::gemm,                                                                             // main
+    mini_jit::TensorConfig::prim_t::none,                                                                             // last touch
+    {mini_jit::TensorConfig::dim_t::m, mini_jit::TensorConfig::dim_t::n, mini_jit::TensorConfig::dim_t::k},           // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {32, 16, 8},                                                                                                      // dim_sizes
+    {8, 0, 1},                                                                                                        // strides_in0
+    {0, 1, 16},                                                                                                       // strides_in1
+    {1, 32, 0},                                                                                                       // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                            // dtype_t
+  };
+
+  mini_jit::TensorConfig expected{
+    mini_jit::TensorConfig::prim_t::none,                                                                                // first_touch
+    mini_jit::TensorConfig::prim_t::gemm,                                                                                // main
+    mini_jit::TensorConfig::prim_t::none,                                                                                // last touch
+    {mini_jit::TensorConfig::dim_t::m, mini_jit::TensorConfig::dim_t::n, mini_jit::TensorConfig::dim_t::k},              // dim_types
+    {mini_jit::TensorConfig::exec_t::prim, mini_jit::TensorConfig::exec_t::prim, mini_jit::TensorConfig::exec_t::prim},  // exec_types
+    {32, 16, 8},                                                                                                         // dim_sizes
+    {8, 0, 1},                                                                                                           // strides_in0
+    {0, 1, 16},                                                                                                          // strides_in1
+    {1, 32, 0},                                                                                                          // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                               // dtype_t
+  };
+
+  mini_jit::TensorOptimization optimization;
+  mini_jit::TensorConfig new_config = optimization.optimize_primitive_identification(config);
+
+  REQUIRE_FALSE(mini_jit::TensorConfig::equals(config, new_config));
+  REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
+}
+
 TEST_CASE("Test tensor optimization primitive identification brgemm", "[tensor_optimization][brgemm][correctness]")
 {
   mini_jit::TensorConfig config{
@@ -219,6 +254,136 @@ TEST_CASE("Test tensor optimization primitive identification unary transpose all
   REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
 }
 
+TEST_CASE("Test tensor optimization primitive identification binary all c dimensions", "[tensor_optimization][binary][correctness]")
+{
+  auto type = GENERATE(mini_jit::TensorConfig::prim_t::add, mini_jit::TensorConfig::prim_t::mul, mini_jit::TensorConfig::prim_t::max);
+
+  CAPTURE(type);
+
+  // in0 broadcasts the unit stride dimension of the output, hence m is identified by the output
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                                                                             // first_touch
+    type,                                                                                                             // main
+    mini_jit::TensorConfig::prim_t::none,                                                                             // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::c},           // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {4, 16, 32},                                                                                                      // dim_sizes
+    {32, 0, 1},                                                                                                       // strides_in0
+    {16 * 32, 1, 16},                                                                                                 // strides_in1
+    {16 * 32, 1, 16},                                                                                                 // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                            // dtype_t
+  };
+
+  mini_jit::TensorConfig expected{
+    mini_jit::TensorConfig::prim_t::none,                                                                               // first_touch
+    type,                                                                                                               // main
+    mini_jit::TensorConfig::prim_t::none,                                                                               // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::m, mini_jit::TensorConfig::dim_t::n},             // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::prim, mini_jit::TensorConfig::exec_t::prim},  // exec_types
+    {4, 16, 32},                                                                                                        // dim_sizes
+    {32, 0, 1},                                                                                                         // strides_in0
+    {16 * 32, 1, 16},                                                                                                   // strides_in1
+    {16 * 32, 1, 16},                                                                                                   // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                              // dtype_t
+  };
+
+  mini_jit::TensorOptimization optimization;
+  mini_jit::TensorConfig new_config = optimization.optimize_primitive_identification(config);
+
+  INFO(new_config.to_string());
+  REQUIRE_FALSE(mini_jit::TensorConfig::equals(config, new_config));
+  REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
+}
+
+TEST_CASE("Test tensor optimization primitive identification reduce", "[tensor_optimization][reduce][correctness]")
+{
+  auto type = GENERATE(mini_jit::TensorConfig::prim_t::reduce_sum, mini_jit::TensorConfig::prim_t::reduce_max,
+                       mini_jit::TensorConfig::prim_t::reduce_mean);
+
+  // The unit stride k is reduced within the columns of the n dimension, otherwise the unit stride c dimension is m
+  auto [strides_in0, strides_out, expected_c] = GENERATE(table<std::vector<int64_t>, std::vector<int64_t>, mini_jit::TensorConfig::dim_t>({
+    {{16 * 32, 32, 1}, {16, 1, 0}, mini_jit::TensorConfig::dim_t::n},
+    {{16 * 32, 1, 16}, {16, 1, 0}, mini_jit::TensorConfig::dim_t::m},
+  }));
+
+  CAPTURE(type, strides_in0, expected_c);
+
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                                                                             // first_touch
+    type,                                                                                                             // main
+    mini_jit::TensorConfig::prim_t::none,                                                                             // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::k},           // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {4, 16, 32},                                                                                                      // dim_sizes
+    strides_in0,                                                                                                      // strides_in0
+    {0, 0, 0},                                                                                                        // strides_in1
+    strides_out,                                                                                                      // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                            // dtype_t
+  };
+
+  mini_jit::TensorConfig expected{
+    mini_jit::TensorConfig::prim_t::none,                                                                               // first_touch
+    type,                                                                                                               // main
+    mini_jit::TensorConfig::prim_t::none,                                                                               // last touch
+    {mini_jit::TensorConfig::dim_t::c, expected_c, mini_jit::TensorConfig::dim_t::k},                                   // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::prim, mini_jit::TensorConfig::exec_t::prim},  // exec_types
+    {4, 16, 32},                                                                                                        // dim_sizes
+    strides_in0,                                                                                                        // strides_in0
+    {0, 0, 0},                                                                                                          // strides_in1
+    strides_out,                                                                                                        // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                              // dtype_t
+  };
+
+  mini_jit::TensorOptimization optimization;
+  mini_jit::TensorConfig new_config = optimization.optimize_primitive_identification(config);
+
+  INFO(new_config.to_string());
+  REQUIRE_FALSE(mini_jit::TensorConfig::equals(config, new_config));
+  REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
+}
+
+TEST_CASE("Test tensor optimization primitive identification normalization", "[tensor_optimization][normalization][correctness]")
+{
+  auto type = GENERATE(mini_jit::TensorConfig::prim_t::softmax, mini_jit::TensorConfig::prim_t::layer_norm,
+                       mini_jit::TensorConfig::prim_t::rms_norm);
+
+  CAPTURE(type);
+
+  // The m dimension stays the normalized dimension, the c dimension with the smallest stride of out holds the columns
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                                                                             // first_touch
+    type,                                                                                                             // main
+    mini_jit::TensorConfig::prim_t::none,                                                                             // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::m},           // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {4, 16, 512},                                                                                                     // dim_sizes
+    {16 * 512, 512, 1},                                                                                               // strides_in0
+    {0, 0, 0},                                                                                                        // strides_in1
+    {16 * 512, 512, 1},                                                                                               // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                            // dtype_t
+  };
+
+  mini_jit::TensorConfig expected{
+    mini_jit::TensorConfig::prim_t::none,                                                                               // first_touch
+    type,                                                                                                               // main
+    mini_jit::TensorConfig::prim_t::none,                                                                               // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::n, mini_jit::TensorConfig::dim_t::m},             // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::prim, mini_jit::TensorConfig::exec_t::prim},  // exec_types
+    {4, 16, 512},                                                                                                       // dim_sizes
+    {16 * 512, 512, 1},                                                                                                 // strides_in0
+    {0, 0, 0},                                                                                                          // strides_in1
+    {16 * 512, 512, 1},                                                                                                 // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                              // dtype_t
+  };
+
+  mini_jit::TensorOptimization optimization;
+  mini_jit::TensorConfig new_config = optimization.optimize_primitive_identification(config);
+
+  INFO(new_config.to_string());
+  REQUIRE_FALSE(mini_jit::TensorConfig::equals(config, new_config));
+  REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
+}
+
 // ==================================================================
 // Shared Identification
 // ==================================================================
@@ -564,6 +729,42 @@ TEST_CASE("Test tensor optimization dimension splitting", "[tensor_optimization]
   REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
 }
 
+TEST_CASE("Test tensor optimization dimension splitting keeps the m dimension of a normalization",
+          "[tensor_optimization][normalization][correctness]")
+{
+  mini_jit::TensorConfig config{
+    mini_jit::TensorConfig::prim_t::none,                                        // first_touch
+    mini_jit::TensorConfig::prim_t::softmax,                                     // main
+    mini_jit::TensorConfig::prim_t::none,                                        // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::m},        // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {500, 4096},                                                                 // dim_sizes
+    {4096, 1},                                                                   // strides_in0
+    {0, 0},                                                                      // strides_in1
+    {4096, 1},                                                                   // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                       // dtype_t
+  };
+
+  mini_jit::TensorConfig expected{
+    mini_jit::TensorConfig::prim_t::none,                                                                             // first_touch
+    mini_jit::TensorConfig::prim_t::softmax,                                                                          // main
+    mini_jit::TensorConfig::prim_t::none,                                                                             // last touch
+    {mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::c, mini_jit::TensorConfig::dim_t::m},           // dim_types
+    {mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq, mini_jit::TensorConfig::exec_t::seq},  // exec_types
+    {20, 25, 4096},                                                                                                   // dim_sizes
+    {4096 * 25, 4096, 1},                                                                                             // strides_in0
+    {0, 0, 0},                                                                                                        // strides_in1
+    {4096 * 25, 4096, 1},                                                                                             // strides_out
+    mini_jit::TensorConfig::dtype_t::fp32,                                                                            // dtype_t
+  };
+
+  mini_jit::TensorOptimization optimization;
+  mini_jit::TensorConfig new_config = optimization.optimize_dimension_splitting(config);
+
+  INFO(new_config.to_string());
+  REQUIRE(mini_jit::TensorConfig::equals(expected, new_config));
+}
+
 // ==================================================================
 // Dimension Fusing
 // ==================================================================
@@ -0,0 +1,45 @@
+#include "../../../main/arm_instructions/base/b.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test b instruction with positive offset", "[codegen][64bit]")
+{
+  uint32_t value = b(20*4);
+  uint32_t expected = 0b000101'00000000000000000000010100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test b instruction with negative offset", "[codegen][64bit]")
+{
+  uint32_t value = b(-36*4);
+  uint32_t expected = 0b000101'11111111111111111111011100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test b.cond instruction with positive offset", "[codegen][64bit]")
+{
+  uint32_t value = b(Condition::ne, 20 * 4);
+  uint32_t expected = 0b01010100'0000000000000010100'0'0001;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test b.cond instruction with SVE condition and negative offset", "[codegen][64bit]")
+{
+  uint32_t value = b(Condition::first, -36 * 4);
+  uint32_t expected = 0b01010100'1111111111111011100'0'0100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
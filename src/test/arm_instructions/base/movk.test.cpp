@@ -0,0 +1,56 @@
+
+#include "../../../main/arm_instructions/base/movk.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test movk 32bit instruction", "[codegen][32bit]")
+{
+  uint32_t value = movk(w12, 1033);
+  uint32_t expected = 0b0'11100101'00'0000010000001001'01100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test movk 64bit instruction", "[codegen][64bit]")
+{
+  uint32_t value = movk(x12, 1033);
+  uint32_t expected = 0b1'11100101'00'0000010000001001'01100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test movk shift 32bit instruction", "[codegen][32bit]")
+{
+  uint32_t value = movk(w12, 1033, 16);
+  uint32_t expected = 0b0'11100101'01'0000010000001001'01100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test movk shift 64bit instruction", "[codegen][64bit]")
+{
+  uint32_t value = movk(x12, 1033, 32);
+  uint32_t expected = 0b1'11100101'10'0000010000001001'01100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test movk immediate internal instruction", "[codegen][internal]")
+{
+  uint32_t value = internal::movk(12, 1033, 32, true);
+  uint32_t expected = 0b1'11100101'10'0000010000001001'01100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
\ No newline at end of file
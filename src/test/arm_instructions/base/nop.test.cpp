@@ -0,0 +1,15 @@
+#include "../../../main/arm_instructions/base/nop.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test nop instruction", "[codegen]")
+{
+  uint32_t value = nop();
+  uint32_t expected = 0xd503201f;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,45 @@
+#include "../../../main/arm_instructions/base/prfm.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test prfm instruction", "[codegen][64bit]")
+{
+  uint32_t value = prfm(PrefetchOp::PLDL1KEEP, x13);
+  uint32_t expected = 0b1111100110'000000000000'01101'00000;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test prfm offset instruction", "[codegen][64bit]")
+{
+  uint32_t value = prfmOffset(PrefetchOp::PSTL2STRM, x25, 4088);
+  uint32_t expected = 0b1111100110'000111111111'11001'10011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test prfm offset sp instruction", "[codegen][64bit]")
+{
+  uint32_t value = prfmOffset(PrefetchOp::PLDL1STRM, sp, 8);
+  uint32_t expected = 0b1111100110'000000000001'11111'00001;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test prfm register instruction", "[codegen][64bit]")
+{
+  uint32_t value = prfm(PrefetchOp::PLDL2KEEP, x13, x23);
+  uint32_t expected = 0b11111000101'10111'011'0'10'01101'00010;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
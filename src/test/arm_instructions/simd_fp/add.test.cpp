@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/simd_fp/add.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test add t2s vector instruction", "[codegen][t2s]")
+{
+  uint32_t value = add(v23, t2s, v19, t2s, v17, t2s);
+  uint32_t expected = 0b0'0'0'01110'10'1'10001'100001'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test add t4s vector instruction", "[codegen][t4s]")
+{
+  uint32_t value = add(v23, t4s, v19, t4s, v17, t4s);
+  uint32_t expected = 0b0'1'0'01110'10'1'10001'100001'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test add t2d vector instruction", "[codegen][t2d]")
+{
+  uint32_t value = add(v23, t2d, v19, t2d, v17, t2d);
+  uint32_t expected = 0b0'1'0'01110'11'1'10001'100001'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,52 @@
+#include "../../../main/arm_instructions/simd_fp/bfdot.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test bfdot t2s t4h instruction", "[codegen][t2s]")
+{
+  uint32_t value = bfdot(v23, t2s, v19, t4h, v17, t4h);
+  uint32_t expected = 0b0'0'1'01110'010'10001'111111'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test bfdot t4s t8h instruction", "[codegen][t4s]")
+{
+  uint32_t value = bfdot(v23, t4s, v19, t8h, v17, t8h);
+  uint32_t expected = 0b0'1'1'01110'010'10001'111111'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test bfdot t2s t4h by element instruction", "[codegen][t2s]")
+{
+  uint32_t value = bfdot(v23, t2s, v19, t4h, v17, 1);
+  uint32_t expected = 0b0'0'0'01111'01'1'10001'1111'0'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test bfdot t4s t8h by element instruction", "[codegen][t4s]")
+{
+  uint32_t value = bfdot(v23, t4s, v19, t8h, v17, 2);
+  uint32_t expected = 0b0'1'0'01111'01'0'10001'1111'1'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+
+  value = bfdot(v23, t4s, v19, t8h, v31, 3);
+  expected = 0b0'1'0'01111'01'1'11111'1111'1'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
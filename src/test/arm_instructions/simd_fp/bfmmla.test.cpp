@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/simd_fp/bfmmla.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test bfmmla t4s t8h instruction", "[codegen][t4s]")
+{
+  uint32_t value = bfmmla(v23, t4s, v19, t8h, v17, t8h);
+  uint32_t expected = 0b0'1'1'01110'010'10001'111011'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test bfmmla instruction with the highest registers", "[codegen][t4s]")
+{
+  uint32_t value = bfmmla(v31, t4s, v31, t8h, v31, t8h);
+  uint32_t expected = 0b0'1'1'01110'010'11111'111011'11111'11111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
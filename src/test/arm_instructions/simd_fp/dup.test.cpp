@@ -0,0 +1,45 @@
+#include "../../../main/arm_instructions/simd_fp/dup.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test dup (element) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = dup(v3, t2s, v5, 3);
+  uint32_t expected = 0b0'0'0'01110000'11100'0'0000'1'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test dup (element) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = dup(v3, t4s, v5, 0);
+  uint32_t expected = 0b0'1'0'01110000'00100'0'0000'1'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test dup (element) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = dup(v3, t2d, v5, 1);
+  uint32_t expected = 0b0'1'0'01110000'11000'0'0000'1'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test dup (element) internal instruction", "[codegen][internal]")
+{
+  uint32_t value = internal::dupElement(3, 5, 1, true, internal::dupQType::q1);
+  uint32_t expected = 0b0'1'0'01110000'11000'0'0000'1'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,55 @@
+#include "../../../main/arm_instructions/simd_fp/faddp.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test faddp (vector) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = faddp(v23, t2s, v19, t2s, v17, t2s);
+  uint32_t expected = 0b00'1011100'0'1'10001'110101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test faddp (vector) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = faddp(v23, t4s, v19, t4s, v17, t4s);
+  uint32_t expected = 0b01'1011100'0'1'10001'110101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test faddp (vector) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = faddp(v23, t2d, v19, t2d, v17, t2d);
+  uint32_t expected = 0b01'1011100'1'1'10001'110101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test faddp (scalar) single-precision instruction", "[codegen][32bit]")
+{
+  uint32_t value = faddp(s23, v19, t2s);
+  uint32_t expected = 0b011111100'0'11000'01101'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test faddp (scalar) double-precision instruction", "[codegen][64bit]")
+{
+  uint32_t value = faddp(d23, v19, t2d);
+  uint32_t expected = 0b011111100'1'11000'01101'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
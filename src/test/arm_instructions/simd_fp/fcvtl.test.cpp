@@ -0,0 +1,45 @@
+#include "../../../main/arm_instructions/simd_fp/fcvtl.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fcvtl t4s t4h instruction", "[codegen][4s]")
+{
+  uint32_t value = fcvtl(v23, t4s, v19, t4h);
+  uint32_t expected = 0b0'0'0'01110'0'0'10000'10111'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtl t2d t2s instruction", "[codegen][2d]")
+{
+  uint32_t value = fcvtl(v23, t2d, v19, t2s);
+  uint32_t expected = 0b0'0'0'01110'0'1'10000'10111'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtl2 t4s t8h instruction", "[codegen][8h]")
+{
+  uint32_t value = fcvtl2(v23, t4s, v19, t8h);
+  uint32_t expected = 0b0'1'0'01110'0'0'10000'10111'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtl2 t2d t4s instruction", "[codegen][4s]")
+{
+  uint32_t value = fcvtl2(v23, t2d, v19, t4s);
+  uint32_t expected = 0b0'1'0'01110'0'1'10000'10111'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,45 @@
+#include "../../../main/arm_instructions/simd_fp/fcvtn.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fcvtn t4h t4s instruction", "[codegen][4h]")
+{
+  uint32_t value = fcvtn(v23, t4h, v19, t4s);
+  uint32_t expected = 0b0'0'0'01110'0'0'10000'10110'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtn t2s t2d instruction", "[codegen][2s]")
+{
+  uint32_t value = fcvtn(v23, t2s, v19, t2d);
+  uint32_t expected = 0b0'0'0'01110'0'1'10000'10110'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtn2 t8h t4s instruction", "[codegen][8h]")
+{
+  uint32_t value = fcvtn2(v23, t8h, v19, t4s);
+  uint32_t expected = 0b0'1'0'01110'0'0'10000'10110'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fcvtn2 t4s t2d instruction", "[codegen][4s]")
+{
+  uint32_t value = fcvtn2(v23, t4s, v19, t2d);
+  uint32_t expected = 0b0'1'0'01110'0'1'10000'10110'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -4,6 +4,26 @@
 
 using namespace mini_jit::arm_instructions;
 
+TEST_CASE("Test fmax (vector) four half-precision instruction", "[codegen][4h]")
+{
+  uint32_t value = fmax(v23, t4h, v19, t4h, v17, t4h);
+  uint32_t expected = 0b00'0011100'1'0'10001'001101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmax (vector) eight half-precision instruction", "[codegen][8h]")
+{
+  uint32_t value = fmax(v23, t8h, v19, t8h, v17, t8h);
+  uint32_t expected = 0b01'0011100'1'0'10001'001101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
 TEST_CASE("Test fmax (vector) two single-precision instruction", "[codegen][2s]")
 {
   uint32_t value = fmax(v23, t2s, v19, t2s, v17, t2s);
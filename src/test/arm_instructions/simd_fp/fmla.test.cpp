@@ -102,4 +102,33 @@ TEST_CASE("Test fmla vector singel/double precision internal instruction", "[cod
   INFO("value:    " << std::bitset<32>(value));
   INFO("expected: " << std::bitset<32>(expected));
   REQUIRE(value == expected);
-}
\ No newline at end of file
+}
+TEST_CASE("Test fmla (vector) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = fmla(v23, t2s, v19, t2s, v17, t2s);
+  uint32_t expected = 0b0'0'0011100'0'1'10001'110011'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmla (vector) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = fmla(v23, t4s, v19, t4s, v17, t4s);
+  uint32_t expected = 0b0'1'0011100'0'1'10001'110011'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmla (vector) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = fmla(v23, t2d, v19, t2d, v17, t2d);
+  uint32_t expected = 0b0'1'0011100'1'1'10001'110011'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,55 @@
+#include "../../../main/arm_instructions/simd_fp/fmov.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fmov (general) 32bit to single-precision instruction", "[codegen][32bit]")
+{
+  uint32_t value = fmov(s3, w14);
+  uint32_t expected = 0b0'0'0'11110'00'1'00'111'000000'01110'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmov (general) 64bit to double-precision instruction", "[codegen][64bit]")
+{
+  uint32_t value = fmov(d3, x14);
+  uint32_t expected = 0b1'0'0'11110'01'1'00'111'000000'01110'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmov (general) single-precision to 32bit instruction", "[codegen][32bit]")
+{
+  uint32_t value = fmov(w14, s3);
+  uint32_t expected = 0b0'0'0'11110'00'1'00'110'000000'00011'01110;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmov (general) double-precision to 64bit instruction", "[codegen][64bit]")
+{
+  uint32_t value = fmov(x14, d3);
+  uint32_t expected = 0b1'0'0'11110'01'1'00'110'000000'00011'01110;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmov (general) internal instruction", "[codegen][internal]")
+{
+  uint32_t value = internal::fmovGeneral(3, 14, internal::fmovFType::ftype01, true, false);
+  uint32_t expected = 0b1'0'0'11110'01'1'00'111'000000'01110'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,75 @@
+#include "../../../main/arm_instructions/simd_fp/fmul.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fmul (vector) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = fmul(v3, t2s, v5, t2s, v7, t2s);
+  uint32_t expected = 0b0'0'1'01110'0'0'1'00111'110111'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (vector) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = fmul(v3, t4s, v5, t4s, v7, t4s);
+  uint32_t expected = 0b0'1'1'01110'0'0'1'00111'110111'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (vector) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = fmul(v3, t2d, v5, t2d, v7, t2d);
+  uint32_t expected = 0b0'1'1'01110'0'1'1'00111'110111'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (by element) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = fmul(v3, t2s, v5, t2s, v7, 1);
+  uint32_t expected = 0b0'0'0'01111'1'0'1'00111'1001'0'0'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (by element) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = fmul(v3, t4s, v5, t4s, v7, 3);
+  uint32_t expected = 0b0'1'0'01111'1'0'1'00111'1001'1'0'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (by element) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = fmul(v3, t2d, v5, t2d, v17, 1);
+  uint32_t expected = 0b0'1'0'01111'1'1'0'10001'1001'1'0'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmul (by element) internal instruction", "[codegen][internal]")
+{
+  uint32_t value = internal::fmulByElement(3, 5, 7, 3, internal::fmulSzType::sz0, internal::fmulQType::q1);
+  uint32_t expected = 0b0'1'0'01111'1'0'1'00111'1001'1'0'00101'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
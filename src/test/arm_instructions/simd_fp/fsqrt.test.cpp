@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/simd_fp/fsqrt.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fsqrt (vector) two single-precision instruction", "[codegen][2s]")
+{
+  uint32_t value = fsqrt(v23, t2s, v19, t2s);
+  uint32_t expected = 0b00'1011101'0'100001111110'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fsqrt (vector) four single-precision instruction", "[codegen][4s]")
+{
+  uint32_t value = fsqrt(v23, t4s, v19, t4s);
+  uint32_t expected = 0b01'1011101'0'100001111110'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fsqrt (vector) two double-precision instruction", "[codegen][2d]")
+{
+  uint32_t value = fsqrt(v23, t2d, v19, t2d);
+  uint32_t expected = 0b01'1011101'1'100001111110'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
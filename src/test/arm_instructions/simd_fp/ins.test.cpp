@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/simd_fp/ins.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test ins (general) first word instruction", "[codegen][4s]")
+{
+  uint32_t value = ins(v23, t4s, 0, w19);
+  uint32_t expected = 0b01001110000'00100'000111'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ins (general) last word instruction", "[codegen][4s]")
+{
+  uint32_t value = ins(v23, t4s, 3, w19);
+  uint32_t expected = 0b01001110000'11100'000111'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ins (general) second doubleword instruction", "[codegen][2d]")
+{
+  uint32_t value = ins(v23, t2d, 1, x19);
+  uint32_t expected = 0b01001110000'11000'000111'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
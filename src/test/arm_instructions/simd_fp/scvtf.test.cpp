@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/simd_fp/scvtf.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test scvtf t2s instruction", "[codegen][t2s]")
+{
+  uint32_t value = scvtf(v23, t2s, v19, t2s);
+  uint32_t expected = 0b0'0'0'01110'0'0'10000'11101'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test scvtf t4s instruction", "[codegen][t4s]")
+{
+  uint32_t value = scvtf(v23, t4s, v19, t4s);
+  uint32_t expected = 0b0'1'0'01110'0'0'10000'11101'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test scvtf t2d instruction", "[codegen][t2d]")
+{
+  uint32_t value = scvtf(v23, t2d, v19, t2d);
+  uint32_t expected = 0b0'1'0'01110'0'1'10000'11101'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
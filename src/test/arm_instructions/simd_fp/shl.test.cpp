@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/simd_fp/shl.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test shl (vector) two words instruction", "[codegen][2s]")
+{
+  uint32_t value = shl(v23, t2s, v19, t2s, 23);
+  uint32_t expected = 0b00'0011110'0110111'010101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test shl (vector) four words instruction", "[codegen][4s]")
+{
+  uint32_t value = shl(v23, t4s, v19, t4s, 23);
+  uint32_t expected = 0b01'0011110'0110111'010101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test shl (vector) two doublewords instruction", "[codegen][2d]")
+{
+  uint32_t value = shl(v23, t2d, v19, t2d, 52);
+  uint32_t expected = 0b01'0011110'1110100'010101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/simd_fp/smmla.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test smmla t4s t16b instruction", "[codegen][t4s]")
+{
+  uint32_t value = smmla(v23, t4s, v19, t16b, v17, t16b);
+  uint32_t expected = 0b0'1'0'01110'100'10001'101001'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test smmla instruction with the highest registers", "[codegen][t4s]")
+{
+  uint32_t value = smmla(v31, t4s, v31, t16b, v31, t16b);
+  uint32_t expected = 0b0'1'0'01110'100'11111'101001'11111'11111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
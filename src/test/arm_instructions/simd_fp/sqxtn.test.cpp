@@ -0,0 +1,65 @@
+#include "../../../main/arm_instructions/simd_fp/sqxtn.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test sqxtn t8b t8h instruction", "[codegen][t8b]")
+{
+  uint32_t value = sqxtn(v23, t8b, v19, t8h);
+  uint32_t expected = 0b0'0'0'01110'00'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test sqxtn t4h t4s instruction", "[codegen][t4h]")
+{
+  uint32_t value = sqxtn(v23, t4h, v19, t4s);
+  uint32_t expected = 0b0'0'0'01110'01'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test sqxtn t2s t2d instruction", "[codegen][t2s]")
+{
+  uint32_t value = sqxtn(v23, t2s, v19, t2d);
+  uint32_t expected = 0b0'0'0'01110'10'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test sqxtn2 t16b t8h instruction", "[codegen][t16b]")
+{
+  uint32_t value = sqxtn2(v23, t16b, v19, t8h);
+  uint32_t expected = 0b0'1'0'01110'00'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test sqxtn2 t8h t4s instruction", "[codegen][t8h]")
+{
+  uint32_t value = sqxtn2(v23, t8h, v19, t4s);
+  uint32_t expected = 0b0'1'0'01110'01'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test sqxtn2 t4s t2d instruction", "[codegen][t4s]")
+{
+  uint32_t value = sqxtn2(v23, t4s, v19, t2d);
+  uint32_t expected = 0b0'1'0'01110'10'10000'10100'10'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,52 @@
+#include "../../../main/arm_instructions/simd_fp/udot.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test udot t2s t8b instruction", "[codegen][t2s]")
+{
+  uint32_t value = udot(v23, t2s, v19, t8b, v17, t8b);
+  uint32_t expected = 0b0'0'1'01110'100'10001'100101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test udot t4s t16b instruction", "[codegen][t4s]")
+{
+  uint32_t value = udot(v23, t4s, v19, t16b, v17, t16b);
+  uint32_t expected = 0b0'1'1'01110'100'10001'100101'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test udot t2s t8b by element instruction", "[codegen][t2s]")
+{
+  uint32_t value = udot(v23, t2s, v19, t8b, v17, 1);
+  uint32_t expected = 0b0'0'1'01111'10'1'10001'1110'0'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test udot t4s t16b by element instruction", "[codegen][t4s]")
+{
+  uint32_t value = udot(v23, t4s, v19, t16b, v17, 2);
+  uint32_t expected = 0b0'1'1'01111'10'0'10001'1110'1'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+
+  value = udot(v23, t4s, v19, t16b, v31, 3);
+  expected = 0b0'1'1'01111'10'1'11111'1110'1'0'10011'10111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/addvl.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test addvl x8, x8, #3 instruction", "[codegen][64Bit]")
+{
+  uint32_t value = addvl(x8, x8, 3);
+  uint32_t expected = 0b000001000'01'01000'01010'000011'01000;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test addvl x2, x5, #-4 instruction", "[codegen][64Bit]")
+{
+  uint32_t value = addvl(x2, x5, -4);
+  uint32_t expected = 0b000001000'01'00101'01010'111100'00010;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
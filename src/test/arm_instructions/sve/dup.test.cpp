@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/dup.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test dup z9.s, #0 instruction", "[codegen][32Bit]")
+{
+  uint32_t value = dup(z9, ts, 0);
+  uint32_t expected = 0b00100101'10'111'00'011'0'00000000'01001;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test dup z9.d, #-3 instruction", "[codegen][64Bit]")
+{
+  uint32_t value = dup(z9, td, -3);
+  uint32_t expected = 0b00100101'11'111'00'011'0'11111101'01001;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/fmax.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fmax z4.s, p2/m, z4.s, #0.0 instruction", "[codegen][32Bit]")
+{
+  uint32_t value = fmax(z4, ts, p2, 0.0);
+  uint32_t expected = 0b01100101'10'011'110'100'010'0000'0'00100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmax z4.d, p2/m, z4.d, #1.0 instruction", "[codegen][64Bit]")
+{
+  uint32_t value = fmax(z4, td, p2, 1.0);
+  uint32_t expected = 0b01100101'11'011'110'100'010'0000'1'00100;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/fmla.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test fmla z3.s, p1/m, z24.s, z17.s instruction", "[codegen][32Bit]")
+{
+  uint32_t value = fmla(z3, ts, p1, z24, z17);
+  uint32_t expected = 0b01100101'10'1'10001'000'001'11000'00011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test fmla z31.d, p7/m, z0.d, z9.d instruction", "[codegen][64Bit]")
+{
+  uint32_t value = fmla(z31, td, p7, z0, z9);
+  uint32_t expected = 0b01100101'11'1'01001'000'111'00000'11111;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/inc.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test incw x16, all, mul #3 instruction", "[codegen][32Bit]")
+{
+  uint32_t value = incw(x16, 3);
+  uint32_t expected = 0b00000100'10'11'0010'11100'0'11111'10000;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test incd x14, all instruction", "[codegen][64Bit]")
+{
+  uint32_t value = incd(x14);
+  uint32_t expected = 0b00000100'11'11'0000'11100'0'11111'01110;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
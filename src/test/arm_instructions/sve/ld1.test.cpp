@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/sve/ld1.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test ld1w {z5.s}, p2/z, [x8, #3, mul vl] instruction", "[codegen][32Bit]")
+{
+  uint32_t value = ld1w(z5, ts, p2, x8, 3);
+  uint32_t expected = 0b1010010'1010'0'0011'101'010'01000'00101;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ld1w {z5.s}, p2/z, [x8, #-2, mul vl] instruction", "[codegen][32Bit]")
+{
+  uint32_t value = ld1w(z5, ts, p2, x8, -2);
+  uint32_t expected = 0b1010010'1010'0'1110'101'010'01000'00101;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ld1d {z30.d}, p6/z, [x1, #7, mul vl] instruction", "[codegen][64Bit]")
+{
+  uint32_t value = ld1d(z30, td, p6, x1, 7);
+  uint32_t expected = 0b1010010'1111'0'0111'101'110'00001'11110;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/ld1r.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test ld1rw {z24.s}, p7/z, [x14, #12] instruction", "[codegen][32Bit]")
+{
+  uint32_t value = ld1rw(z24, ts, p7, x14, 12);
+  uint32_t expected = 0b1000010'10'1'000011'1'10'111'01110'11000;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ld1rd {z24.d}, p7/z, [x14, #504] instruction", "[codegen][64Bit]")
+{
+  uint32_t value = ld1rd(z24, td, p7, x14, 504);
+  uint32_t expected = 0b1000010'11'1'111111'1'11'111'01110'11000;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
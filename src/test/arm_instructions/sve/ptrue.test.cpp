@@ -0,0 +1,35 @@
+#include "../../../main/arm_instructions/sve/ptrue.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test ptrue p3.s instruction", "[codegen][32Bit]")
+{
+  uint32_t value = ptrue(p3, ts);
+  uint32_t expected = 0b00100101'10'011000'111000'11111'0'0011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ptrue p5.d instruction", "[codegen][64Bit]")
+{
+  uint32_t value = ptrue(p5, td);
+  uint32_t expected = 0b00100101'11'011000'111000'11111'0'0101;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test ptrue internal instruction", "[codegen][internal]")
+{
+  uint32_t value = internal::ptrue(3, internal::ptrueSizeType::size32);
+  uint32_t expected = 0b00100101'10'011000'111000'11111'0'0011;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
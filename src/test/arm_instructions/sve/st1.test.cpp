@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/st1.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test st1w {z5.s}, p2, [x8, #3, mul vl] instruction", "[codegen][32Bit]")
+{
+  uint32_t value = st1w(z5, ts, p2, x8, 3);
+  uint32_t expected = 0b1110010'1010'0'0011'111'010'01000'00101;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test st1d {z30.d}, p6, [x1, #-8, mul vl] instruction", "[codegen][64Bit]")
+{
+  uint32_t value = st1d(z30, td, p6, x1, -8);
+  uint32_t expected = 0b1110010'1111'0'1000'111'110'00001'11110;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
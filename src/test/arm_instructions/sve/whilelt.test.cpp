@@ -0,0 +1,25 @@
+#include "../../../main/arm_instructions/sve/whilelt.h"
+#include <bitset>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace mini_jit::arm_instructions;
+
+TEST_CASE("Test whilelt p2.s, x16, x20 instruction", "[codegen][32Bit]")
+{
+  uint32_t value = whilelt(p2, ts, x16, x20);
+  uint32_t expected = 0b00100101'10'1'10100'000'1'0'1'10000'0'0010;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
+
+TEST_CASE("Test whilelt p1.d, x3, x7 instruction", "[codegen][64Bit]")
+{
+  uint32_t value = whilelt(p1, td, x3, x7);
+  uint32_t expected = 0b00100101'11'1'00111'000'1'0'1'00011'0'0001;
+
+  INFO("value:    " << std::bitset<32>(value));
+  INFO("expected: " << std::bitset<32>(expected));
+  REQUIRE(value == expected);
+}
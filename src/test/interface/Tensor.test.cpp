@@ -1,9 +1,12 @@
 #include "../../../include/MachineLearningCompiler/Tensor.h"
 #include "../../interface/TensorUtils.h"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/generators/catch_generators_range.hpp>
 #include <cmath>
+#include <functional>
+#include <numeric>
 #include <vector>
 
 TEST_CASE("Test interface tensor fill_random", "[tensor][correctness]")
@@ -486,6 +489,335 @@ TEST_CASE("Test interface tensor unary identity", "[tensor][correctness]")
   delete[] data2;
 }
 
+TEST_CASE("Test interface tensor unary activations", "[tensor][correctness]")
+{
+  auto [type, reference] = GENERATE(table<mlc::UnaryType, double (*)(double)>({
+    {mlc::UnaryType::Exp, [](double x) { return std::exp(x); }},
+    {mlc::UnaryType::Sigmoid, [](double x) { return 1 / (1 + std::exp(-x)); }},
+    {mlc::UnaryType::Tanh, [](double x) { return std::tanh(x); }},
+    {mlc::UnaryType::GeluErf, [](double x) { return 0.5 * x * std::erfc(-x / std::sqrt(2.0)); }},
+    {mlc::UnaryType::GeluTanh, [](double x) { return 0.5 * x * (1 + std::tanh(std::sqrt(2 / M_PI) * (x + 0.044715 * x * x * x))); }},
+    {mlc::UnaryType::SiLU, [](double x) { return x / (1 + std::exp(-x)); }},
+  }));
+
+  CAPTURE(type);
+
+  std::vector<uint64_t> shape = {3, 4, 5};
+  std::vector<float> data1(3 * 4 * 5);
+  std::vector<float> data2(data1.size(), 0);
+  for (size_t i = 0; i < data1.size(); ++i)
+  {
+    data1[i] = static_cast<float>(i) / 10 - 3;
+  }
+
+  mlc::Tensor tensor1(data1.data(), shape);
+  mlc::Tensor tensor2(data2.data(), shape);
+
+  mlc::Error err = mlc::unary(tensor1, tensor2, type);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t i = 0; i < data1.size(); i++)
+  {
+    CAPTURE(i, data1[i]);
+    REQUIRE(std::abs(data2[i] - reference(data1[i])) <= 1e-6 * std::max(1.0, std::abs(reference(data1[i]))));
+  }
+
+  err = mlc::unary(tensor1, tensor2, mlc::UnaryType::None);
+  REQUIRE(err.type == mlc::ErrorType::ExecuteWrongMainPrimitive);
+}
+
+TEST_CASE("Test interface tensor binary broadcasting", "[tensor][correctness]")
+{
+  auto [shape0, shape1, shape_out] = GENERATE(table<std::vector<uint64_t>, std::vector<uint64_t>, std::vector<uint64_t>>({
+    {{3, 4, 5}, {3, 4, 5}, {3, 4, 5}},
+    {{3, 4, 5}, {5}, {3, 4, 5}},
+    {{3, 4, 1}, {3, 4, 5}, {3, 4, 5}},
+    {{4, 1}, {3, 1, 5}, {3, 4, 5}},
+    {{1}, {3, 4, 5}, {3, 4, 5}},
+    {{7}, {1}, {7}},
+  }));
+  auto [type, reference] = GENERATE(table<mlc::BinaryType, float (*)(float, float)>({
+    {mlc::BinaryType::Add, [](float x, float y) { return x + y; }},
+    {mlc::BinaryType::Sub, [](float x, float y) { return x - y; }},
+    {mlc::BinaryType::Mul, [](float x, float y) { return x * y; }},
+    {mlc::BinaryType::Maximum, [](float x, float y) { return std::max(x, y); }},
+    {mlc::BinaryType::Minimum, [](float x, float y) { return std::min(x, y); }},
+  }));
+
+  CAPTURE(shape0, shape1, shape_out, type);
+
+  auto size = [](const std::vector<uint64_t> &shape)
+  {
+    uint64_t size = 1;
+    for (uint64_t dim : shape)
+    {
+      size *= dim;
+    }
+    return size;
+  };
+
+  std::vector<float> data0(size(shape0));
+  std::vector<float> data1(size(shape1));
+  std::vector<float> data_out(size(shape_out), 0);
+  for (size_t i = 0; i < data0.size(); ++i)
+  {
+    data0[i] = static_cast<float>(i) / 4 - 2;
+  }
+  for (size_t i = 0; i < data1.size(); ++i)
+  {
+    data1[i] = static_cast<float>(i % 7) - 3;
+  }
+
+  mlc::Tensor tensor0(data0.data(), shape0);
+  mlc::Tensor tensor1(data1.data(), shape1);
+  mlc::Tensor tensor_out(data_out.data(), shape_out);
+
+  mlc::Error err = mlc::binary(tensor0, tensor1, tensor_out, type);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  // The offset of an output element in an input aligned to the last dimension, a dimension of size one is repeated
+  auto offset = [&shape_out](const mlc::Tensor &tensor, size_t index)
+  {
+    size_t result = 0;
+    for (size_t i = 0; i < tensor.dim_sizes.size(); ++i)
+    {
+      size_t dim = shape_out.size() - 1 - i;
+      size_t stride = 1;
+      for (size_t j = dim + 1; j < shape_out.size(); ++j)
+      {
+        stride *= shape_out[j];
+      }
+      size_t position = tensor.dim_sizes[tensor.dim_sizes.size() - 1 - i] == 1 ? 0 : index / stride % shape_out[dim];
+      result += position * tensor.strides[tensor.dim_sizes.size() - 1 - i];
+    }
+    return result;
+  };
+
+  for (size_t i = 0; i < data_out.size(); i++)
+  {
+    CAPTURE(i);
+    REQUIRE(data_out[i] == reference(data0[offset(tensor0, i)], data1[offset(tensor1, i)]));
+  }
+}
+
+TEST_CASE("Test interface tensor binary add & relu and failures", "[tensor][correctness]")
+{
+  std::vector<double> data0(3 * 4, -1);
+  std::vector<double> data1{0, 1, 2, 3};
+  std::vector<double> data_out(data0.size(), 0);
+
+  mlc::Tensor tensor0(data0.data(), {3, 4});
+  mlc::Tensor tensor1(data1.data(), {4});
+  mlc::Tensor tensor_out(data_out.data(), {3, 4});
+
+  mlc::Error err = mlc::binary(tensor0, tensor1, tensor_out, mlc::BinaryType::Add, mlc::UnaryType::ReLU);
+  REQUIRE(err.type == mlc::ErrorType::None);
+  for (size_t i = 0; i < data_out.size(); i++)
+  {
+    CAPTURE(i);
+    REQUIRE(data_out[i] == std::max(data1[i % 4] - 1, 0.0));
+  }
+
+  REQUIRE(mlc::add(tensor0, tensor1, tensor_out).type == mlc::ErrorType::None);
+  REQUIRE(data_out[5] == 0);
+  REQUIRE(mlc::mul(tensor0, tensor1, tensor_out).type == mlc::ErrorType::None);
+  REQUIRE(data_out[5] == -1);
+
+  REQUIRE(mlc::binary(tensor0, tensor1, tensor_out, mlc::BinaryType::None).type == mlc::ErrorType::ExecuteWrongMainPrimitive);
+
+  // The dimensions must match or be of size one, the output is not broadcast
+  mlc::Tensor tensor_wrong(data1.data(), {3});
+  REQUIRE(mlc::sub(tensor0, tensor_wrong, tensor_out).type == mlc::ErrorType::ExecuteWrongDimension);
+  mlc::Tensor tensor_single(data1.data(), {1, 4});
+  std::vector<double> data_larger(2 * 3 * 4);
+  mlc::Tensor tensor_larger(data_larger.data(), {2, 3, 4});
+  REQUIRE(mlc::maximum(tensor_single, tensor1, tensor_larger).type == mlc::ErrorType::ExecuteWrongDimension);
+  REQUIRE(mlc::minimum(tensor_larger, tensor1, tensor_out).type == mlc::ErrorType::ExecuteWrongDimension);
+
+  std::vector<float> data_fp32(4);
+  mlc::Tensor tensor_fp32(data_fp32.data(), {4});
+  REQUIRE(mlc::add(tensor0, tensor_fp32, tensor_out).type == mlc::ErrorType::ExecuteWrongDType);
+}
+
+TEST_CASE("Test interface tensor reduce sum, max and mean", "[tensor][correctness]")
+{
+  const std::vector<uint64_t> shape{3, 5, 4, 6};
+  auto [dims, shape_out] = GENERATE(table<std::vector<int64_t>, std::vector<uint64_t>>({
+    {{3}, {3, 5, 4}},
+    {{1}, {3, 4, 6}},
+    {{0, 2}, {1, 5, 1, 6}},
+    {{1, 3}, {3, 4}},
+    {{0, 1, 2, 3}, {}},
+  }));
+  auto type = GENERATE(mlc::ReduceType::Sum, mlc::ReduceType::Max, mlc::ReduceType::Mean);
+
+  CAPTURE(dims, shape_out, type);
+
+  std::vector<float> data(3 * 5 * 4 * 6);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<float>(i * 7 % 13) - 6;
+  }
+
+  // The reference visits the input and computes the index of the element in the output that keeps the not reduced dimensions
+  uint64_t count = 1;
+  for (int64_t dim : dims)
+  {
+    count *= shape[dim];
+  }
+  std::vector<float> expected(data.size() / count, 0);
+  std::vector<bool> visited(expected.size(), false);
+
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    size_t index = 0;
+    size_t remainder = i;
+    size_t stride_in = data.size();
+    for (size_t dim = 0; dim < shape.size(); ++dim)
+    {
+      stride_in /= shape[dim];
+      const size_t position = remainder / stride_in;
+      remainder %= stride_in;
+      if (std::find(dims.begin(), dims.end(), static_cast<int64_t>(dim)) == dims.end())
+      {
+        index = index * shape[dim] + position;
+      }
+    }
+
+    if (!visited[index])
+    {
+      expected[index] = data[i];
+    }
+    else
+    {
+      expected[index] = type == mlc::ReduceType::Max ? std::max(expected[index], data[i]) : expected[index] + data[i];
+    }
+    visited[index] = true;
+  }
+
+  std::vector<float> data_out(expected.size(), std::nanf("1"));
+  mlc::Tensor tensor(data.data(), shape);
+  mlc::Tensor tensor_out(data_out.data(), shape_out);
+
+  mlc::Error err = mlc::reduce(tensor, tensor_out, dims, type);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t i = 0; i < data_out.size(); i++)
+  {
+    const float reference = type == mlc::ReduceType::Mean ? expected[i] / count : expected[i];
+    CAPTURE(i);
+    REQUIRE(std::abs(data_out[i] - reference) <= 1e-4f);
+  }
+}
+
+TEST_CASE("Test interface tensor reduce failures", "[tensor][correctness]")
+{
+  std::vector<double> data{1, 2, 3, 4, 5, 6};
+  std::vector<double> data_out(3, 0);
+
+  mlc::Tensor tensor(data.data(), {2, 3});
+  mlc::Tensor tensor_out(data_out.data(), {3});
+
+  REQUIRE(mlc::reduce_sum(tensor, tensor_out, {0}).type == mlc::ErrorType::None);
+  REQUIRE(data_out == std::vector<double>{5, 7, 9});
+  REQUIRE(mlc::reduce_max(tensor, tensor_out, {0}).type == mlc::ErrorType::None);
+  REQUIRE(data_out == std::vector<double>{4, 5, 6});
+  REQUIRE(mlc::reduce_mean(tensor, tensor_out, {0}).type == mlc::ErrorType::None);
+  REQUIRE(data_out == std::vector<double>{2.5, 3.5, 4.5});
+
+  REQUIRE(mlc::reduce(tensor, tensor_out, {0}, mlc::ReduceType::None).type == mlc::ErrorType::ExecuteWrongMainPrimitive);
+
+  // The reduced dimensions must exist once and the output must hold the remaining dimensions
+  REQUIRE(mlc::reduce_sum(tensor, tensor_out, {}).type == mlc::ErrorType::ExecuteWrongDimension);
+  REQUIRE(mlc::reduce_sum(tensor, tensor_out, {2}).type == mlc::ErrorType::ExecuteWrongDimension);
+  REQUIRE(mlc::reduce_sum(tensor, tensor_out, {0, 0}).type == mlc::ErrorType::ExecuteWrongDimension);
+  REQUIRE(mlc::reduce_sum(tensor, tensor_out, {1}).type == mlc::ErrorType::ExecuteWrongDimension);
+
+  std::vector<float> data_fp32(3);
+  mlc::Tensor tensor_fp32(data_fp32.data(), {3});
+  REQUIRE(mlc::reduce_sum(tensor, tensor_fp32, {0}).type == mlc::ErrorType::ExecuteWrongDType);
+}
+
+TEST_CASE("Test interface tensor softmax, layer norm and rms norm", "[tensor][correctness]")
+{
+  auto shape = GENERATE(std::vector<uint64_t>{37}, std::vector<uint64_t>{3, 5, 300});
+  auto type = GENERATE(mlc::NormalizationType::Softmax, mlc::NormalizationType::LayerNorm, mlc::NormalizationType::RmsNorm);
+
+  CAPTURE(shape, type);
+
+  const uint64_t size = shape.back();
+  std::vector<float> data(std::accumulate(shape.begin(), shape.end(), uint64_t{1}, std::multiplies<uint64_t>()));
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<float>(i * 7 % 13) - 6;
+  }
+
+  std::vector<float> data_out(data.size(), std::nanf("1"));
+  mlc::Tensor tensor(data.data(), shape);
+  mlc::Tensor tensor_out(data_out.data(), shape);
+
+  mlc::Error err = mlc::normalize(tensor, tensor_out, type);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t row = 0; row < data.size() / size; row++)
+  {
+    const float *x = data.data() + row * size;
+    const double max = *std::max_element(x, x + size);
+    double sum = 0;
+    double square_sum = 0;
+    double exp_sum = 0;
+    for (uint64_t i = 0; i < size; i++)
+    {
+      sum += x[i];
+      square_sum += static_cast<double>(x[i]) * x[i];
+      exp_sum += std::exp(x[i] - max);
+    }
+    const double mean = sum / size;
+
+    for (uint64_t i = 0; i < size; i++)
+    {
+      double reference = x[i] / std::sqrt(square_sum / size + 1e-5);
+      if (type == mlc::NormalizationType::Softmax)
+      {
+        reference = std::exp(x[i] - max) / exp_sum;
+      }
+      else if (type == mlc::NormalizationType::LayerNorm)
+      {
+        reference = (x[i] - mean) / std::sqrt(square_sum / size - mean * mean + 1e-5);
+      }
+
+      CAPTURE(row, i);
+      REQUIRE(std::abs(data_out[row * size + i] - reference) <= 1e-4);
+    }
+  }
+}
+
+TEST_CASE("Test interface tensor normalization failures", "[tensor][correctness]")
+{
+  std::vector<float> data{1, 2, 3, 4, 5, 6};
+  std::vector<float> data_out(6, 0);
+
+  mlc::Tensor tensor(data.data(), {2, 3});
+  mlc::Tensor tensor_out(data_out.data(), {2, 3});
+
+  REQUIRE(mlc::softmax(tensor, tensor_out).type == mlc::ErrorType::None);
+  REQUIRE(std::abs(data_out[0] + data_out[1] + data_out[2] - 1) <= 1e-6f);
+  REQUIRE(mlc::layer_norm(tensor, tensor_out).type == mlc::ErrorType::None);
+  REQUIRE(std::abs(data_out[3] + data_out[5]) <= 1e-6f);
+  REQUIRE(mlc::rms_norm(tensor, tensor_out).type == mlc::ErrorType::None);
+
+  REQUIRE(mlc::normalize(tensor, tensor_out, mlc::NormalizationType::None).type == mlc::ErrorType::ExecuteWrongMainPrimitive);
+
+  // The output must have the dimensions of the input
+  mlc::Tensor tensor_transposed(data_out.data(), {3, 2});
+  REQUIRE(mlc::softmax(tensor, tensor_transposed).type == mlc::ErrorType::ExecuteWrongDimension);
+
+  std::vector<double> data_fp64(6);
+  mlc::Tensor tensor_fp64(data_fp64.data(), {2, 3});
+  REQUIRE(mlc::softmax(tensor_fp64, tensor_fp64).type == mlc::ErrorType::ExecuteWrongDType);
+  REQUIRE(mlc::softmax(tensor, tensor_fp64).type == mlc::ErrorType::ExecuteWrongDType);
+}
+
 TEST_CASE("Test interface tensor contraction first+last", "[tensor][correctness]")
 {
   std::vector<uint64_t> shape1 = {3, 4};
@@ -559,4 +891,131 @@ TEST_CASE("Test interface tensor einsum operation", "[setup][correctness]")
   INFO(error.message);
   REQUIRE(error.type == mlc::ErrorType::None);
   delete setup;
-}
\ No newline at end of file
+}
+TEST_CASE("Test interface tensor gemm fp64", "[tensor][correctness]")
+{
+  std::vector<uint64_t> shape1 = {4, 3};  // k, m
+  std::vector<uint64_t> shape2 = {5, 4};  // n, k
+  std::vector<uint64_t> shape3 = {5, 3};  // n, m
+
+  mlc::Tensor tensor1(shape1, mlc::DataType::FP64);
+  mlc::Tensor tensor2(shape2, mlc::DataType::FP64);
+  mlc::Tensor tensor3(shape3, mlc::DataType::FP64);
+  REQUIRE(tensor1.data == nullptr);
+  REQUIRE(tensor1.data_fp64 != nullptr);
+
+  mlc::fill_counting_up(tensor1, 0, 0.5);
+  mlc::fill_counting_down(tensor2, 1, 0.25);
+  mlc::fill_number(tensor3, 1);
+
+  mlc::Error err = mlc::gemm(tensor1, tensor2, tensor3);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t n = 0; n < shape3[0]; n++)
+  {
+    for (size_t m = 0; m < shape3[1]; m++)
+    {
+      double expected = 1;
+      for (size_t k = 0; k < shape1[0]; k++)
+      {
+        expected += tensor1.data_fp64[k * 3 + m] * tensor2.data_fp64[n * 4 + k];
+      }
+      CAPTURE(n, m);
+      REQUIRE(tensor3.data_fp64[n * 3 + m] == expected);
+    }
+  }
+}
+
+TEST_CASE("Test interface tensor einsum fp64", "[tensor][correctness]")
+{
+  mlc::Tensor tensor1({3, 4}, mlc::DataType::FP64);
+  mlc::Tensor tensor2({4, 5}, mlc::DataType::FP64);
+  mlc::Tensor tensor3({3, 5}, mlc::DataType::FP64);
+
+  mlc::fill_random(tensor1);
+  mlc::fill_random(tensor2);
+
+  mlc::Error err = mlc::einsum({tensor1, tensor2}, tensor3, "[0,1],[1,2]->[0,2]");
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t i = 0; i < 3; i++)
+  {
+    for (size_t j = 0; j < 5; j++)
+    {
+      double expected = 0;
+      for (size_t k = 0; k < 4; k++)
+      {
+        expected += tensor1.data_fp64[i * 4 + k] * tensor2.data_fp64[k * 5 + j];
+      }
+      CAPTURE(i, j);
+      REQUIRE(std::abs(tensor3.data_fp64[i * 5 + j] - expected) <= 1e-12 * std::max(1.0, std::abs(expected)));
+    }
+  }
+}
+
+TEST_CASE("Test interface tensor gemm fp16", "[tensor][correctness]")
+{
+  std::vector<uint64_t> shape1 = {4, 3};  // k, m
+  std::vector<uint64_t> shape2 = {5, 4};  // n, k
+  std::vector<uint64_t> shape3 = {5, 3};  // n, m
+
+  mlc::Tensor tensor1(shape1, mlc::DataType::FP16);
+  mlc::Tensor tensor2(shape2, mlc::DataType::FP16);
+  mlc::Tensor tensor3(shape3, mlc::DataType::FP16);
+  REQUIRE(tensor1.data == nullptr);
+  REQUIRE(tensor1.data_fp16 != nullptr);
+
+  // The values and sums are multiples of 1/8 below 2^8, i.e. exact in half precision
+  mlc::fill_counting_up(tensor1, 0, 0.5);
+  mlc::fill_counting_down(tensor2, 1, 0.25);
+  mlc::fill_number(tensor3, 1);
+  REQUIRE(mlc::internal::fromHalf(tensor1.data_fp16[3]) == 1.5f);
+
+  mlc::Error err = mlc::gemm(tensor1, tensor2, tensor3);
+  REQUIRE(err.type == mlc::ErrorType::None);
+
+  for (size_t n = 0; n < shape3[0]; n++)
+  {
+    for (size_t m = 0; m < shape3[1]; m++)
+    {
+      float expected = 1;
+      for (size_t k = 0; k < shape1[0]; k++)
+      {
+        expected += mlc::internal::fromHalf(tensor1.data_fp16[k * 3 + m]) * mlc::internal::fromHalf(tensor2.data_fp16[n * 4 + k]);
+      }
+      CAPTURE(n, m);
+      REQUIRE(mlc::internal::fromHalf(tensor3.data_fp16[n * 3 + m]) == expected);
+    }
+  }
+}
+
+TEST_CASE("Test interface tensor fp16 rounds to nearest even", "[tensor][correctness]")
+{
+  // 2049 lies halfway between the half-precision floats 2048 and 2050, 1 + 2^-11 + 2^-30 is closer to 1 + 2^-10 than to 1
+  REQUIRE(mlc::internal::toHalf(2049) == mlc::internal::toHalf(2048));
+  REQUIRE(mlc::internal::toHalf(2051) == mlc::internal::toHalf(2052));
+  REQUIRE(mlc::internal::fromHalf(mlc::internal::toHalf(1 + std::ldexp(1.0, -11) + std::ldexp(1.0, -30))) == 1 + std::ldexp(1.0f, -10));
+  REQUIRE(mlc::internal::fromHalf(mlc::internal::toHalf(std::ldexp(1.0, -24))) == std::ldexp(1.0f, -24));
+  REQUIRE(mlc::internal::toHalf(65520) == 0x7c00);
+  REQUIRE(mlc::internal::toHalf(-65504) == 0xfbff);
+}
+
+TEST_CASE("Test interface tensor mixed data types failure", "[tensor][correctness]")
+{
+  mlc::Tensor tensor1({4, 3}, mlc::DataType::FP64);
+  mlc::Tensor tensor2({5, 4});
+  mlc::Tensor tensor3({5, 3}, mlc::DataType::FP64);
+
+  mlc::Error err = mlc::gemm(tensor1, tensor2, tensor3);
+  REQUIRE(err.type == mlc::ErrorType::ExecuteWrongDType);
+
+  err = mlc::einsum({tensor1, tensor2}, tensor3, "[1,0],[2,1]->[2,0]");
+  REQUIRE(err.type == mlc::ErrorType::ExecuteWrongDType);
+
+  err = mlc::unary_identity(tensor2, tensor3);
+  REQUIRE(err.type == mlc::ErrorType::ExecuteWrongDimension);
+
+  mlc::Tensor tensor4({5, 3});
+  err = mlc::unary_relu(tensor4, tensor3);
+  REQUIRE(err.type == mlc::ErrorType::ExecuteWrongDType);
+}
@@ -0,0 +1,30 @@
+#ifndef MINIJIT_KERNELS_BF16_TEST_H
+#define MINIJIT_KERNELS_BF16_TEST_H
+
+#include <bit>
+#include <cstdint>
+
+/**
+ * @brief Converts a float to the nearest bfloat16, ties are rounded to even.
+ *
+ * @param value The finite float to convert.
+ * @return The upper 16 bits of the rounded float.
+ */
+inline uint16_t to_bf16(float value)
+{
+  const uint32_t bits = std::bit_cast<uint32_t>(value);
+  return static_cast<uint16_t>((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+/**
+ * @brief Converts a bfloat16 to the float of the same value.
+ *
+ * @param value The bfloat16 to convert.
+ * @return The float whose upper 16 bits are the bfloat16.
+ */
+inline float from_bf16(uint16_t value)
+{
+  return std::bit_cast<float>(static_cast<uint32_t>(value) << 16);
+}
+
+#endif  // MINIJIT_KERNELS_BF16_TEST_H
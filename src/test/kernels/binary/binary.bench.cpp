@@ -0,0 +1,107 @@
+#include "../../../main/Binary.h"
+#include "../../../main/kernels/binary/binary.h"
+#include "../unary/unary.bench.h"
+#include <benchmark/benchmark.h>
+
+class BinaryFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b, matrix_c;
+  double bytes;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    bytes = 0;
+
+    int M = state.range(0);
+    int N = state.range(1);
+
+    matrix_a.resize(M * N);
+    matrix_b.resize(M * N);
+    matrix_c.resize(M * N);
+
+    fill_random_matrix_args(matrix_a.data(), M * N);
+    fill_random_matrix_args(matrix_b.data(), M * N);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["Bytes"] = benchmark::Counter(bytes, benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @brief Runs the binary kernel of the benchmark arguments.
+   *
+   * @param state The state of the benchmark.
+   * @param op The elementwise operation of the kernel.
+   * @param broadcast_b True if B is broadcast along the rows.
+   */
+  void run(benchmark::State &state, mini_jit::kernels::binary_op_t op, bool broadcast_b)
+  {
+    int M = state.range(0);
+    int N = state.range(1);
+
+    mini_jit::Kernel native_kernel;
+    mini_jit::kernels::binary(native_kernel, M, N, op, mini_jit::kernels::dtype_t::fp32, false, broadcast_b);
+    native_kernel.set_kernel();
+    mini_jit::Binary::kernel_t kernel = reinterpret_cast<mini_jit::Binary::kernel_t>(const_cast<void *>(native_kernel.get_kernel()));
+
+    for (auto _ : state)
+    {
+      kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, M, M);
+    }
+
+    // M * N * 4 bytes (fp32) * 3 (load A/load B/store C), a broadcast B only loads a single row
+    bytes = (M * N * 4 * 2 + (broadcast_b ? N : M * N) * 4) * state.iterations();
+  }
+};
+
+BENCHMARK_DEFINE_F(BinaryFixture, BM_binary_add)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::binary_op_t::add, false);
+}
+
+BENCHMARK_DEFINE_F(BinaryFixture, BM_binary_mul)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::binary_op_t::mul, false);
+}
+
+BENCHMARK_DEFINE_F(BinaryFixture, BM_binary_max)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::binary_op_t::max, false);
+}
+
+BENCHMARK_DEFINE_F(BinaryFixture, BM_binary_add_broadcast_b)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::binary_op_t::add, true);
+}
+
+static void CustomArguments(benchmark::internal::Benchmark *b)
+{
+  for (int S : {50, 64, 512, 2048})
+    b->Args({S, S});
+}
+
+BENCHMARK_REGISTER_F(BinaryFixture, BM_binary_add)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(BinaryFixture, BM_binary_mul)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(BinaryFixture, BM_binary_max)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(BinaryFixture, BM_binary_add_broadcast_b)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
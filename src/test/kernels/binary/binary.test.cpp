@@ -0,0 +1,181 @@
+#include "../../../main/Binary.h"
+#include "../../../main/kernels/binary/binary.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  using mini_jit::kernels::activation_t;
+  using mini_jit::kernels::binary_op_t;
+
+  /**
+   * @brief Computes the operation on two elements.
+   *
+   * @param op The elementwise operation.
+   * @param x The element of A.
+   * @param y The element of B.
+   * @return The reference result.
+   */
+  template <typename T> T reference(binary_op_t op, T x, T y)
+  {
+    switch (op)
+    {
+    case binary_op_t::add:
+      return x + y;
+    case binary_op_t::sub:
+      return x - y;
+    case binary_op_t::mul:
+      return x * y;
+    case binary_op_t::max:
+      return std::isnan(x) || std::isnan(y) ? std::numeric_limits<T>::quiet_NaN() : std::max(x, y);
+    case binary_op_t::min:
+      return std::isnan(x) || std::isnan(y) ? std::numeric_limits<T>::quiet_NaN() : std::min(x, y);
+    }
+    return std::numeric_limits<T>::quiet_NaN();
+  }
+
+  /**
+   * @brief Executes the generated kernel on random values with padded leading dimensions.
+   *
+   * @param M The rows of C.
+   * @param N The columns of C.
+   * @param op The elementwise operation.
+   * @param broadcast_a True if A holds a single row.
+   * @param broadcast_b True if B holds a single row.
+   * @param column_a True if A holds a single column, i.e. the leading dimension of A is zero.
+   * @param column_b True if B holds a single column, i.e. the leading dimension of B is zero.
+   * @param activation The activation applied to C.
+   */
+  template <typename T>
+  void run_binary(const uint32_t M, const uint32_t N, binary_op_t op, bool broadcast_a, bool broadcast_b, bool column_a, bool column_b,
+                  activation_t activation = activation_t::none)
+  {
+    const uint32_t rows_a = broadcast_a ? 1 : M;
+    const uint32_t rows_b = broadcast_b ? 1 : M;
+    const uint32_t lda = column_a ? 0 : rows_a + 3;
+    const uint32_t ldb = column_b ? 0 : rows_b + 2;
+    const uint32_t ldc = M + 1;
+
+    std::vector<T> a(std::max(lda, rows_a) * N);
+    std::vector<T> b(std::max(ldb, rows_b) * N);
+    std::vector<T> c(ldc * N, -1);
+    for (std::vector<T> *values : {&a, &b})
+    {
+      for (T &value : *values)
+      {
+        value = static_cast<T>(std::rand()) / RAND_MAX * 10 - 5;
+      }
+    }
+
+    const mini_jit::kernels::dtype_t dtype = sizeof(T) == 8 ? mini_jit::kernels::dtype_t::fp64 : mini_jit::kernels::dtype_t::fp32;
+    mini_jit::Kernel kernel;
+    mini_jit::kernels::binary(kernel, M, N, op, dtype, broadcast_a, broadcast_b, activation);
+    kernel.set_kernel();
+    mini_jit::Binary::kernel_t binary = reinterpret_cast<mini_jit::Binary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    binary(a.data(), b.data(), c.data(), lda, ldb, ldc);
+
+    // The padding rows of C must not be written
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < ldc; ++iM)
+      {
+        const T result = c[ldc * iN + iM];
+        if (iM >= M)
+        {
+          REQUIRE(result == -1);
+          continue;
+        }
+
+        const T x = a[lda * iN + (broadcast_a ? 0 : iM)];
+        const T y = b[ldb * iN + (broadcast_b ? 0 : iM)];
+        const T expected = activation == activation_t::relu ? std::max(reference(op, x, y), T{0}) : reference(op, x, y);
+        CAPTURE(iM, iN, x, y, result);
+        REQUIRE(result == expected);
+      }
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test binary jited correctness on random data", "[jit][correctness][binary]")
+{
+  auto op = GENERATE(binary_op_t::add, binary_op_t::sub, binary_op_t::mul, binary_op_t::max, binary_op_t::min);
+  auto broadcast_a = GENERATE(false, true);
+  auto broadcast_b = GENERATE(false, true);
+  auto M = GENERATE(range(1u, 37u + 1u, 1u));
+  auto N = GENERATE(1u, 3u);
+
+  CAPTURE(op, broadcast_a, broadcast_b, M, N);
+  run_binary<float>(M, N, op, broadcast_a, broadcast_b, false, false);
+  run_binary<double>(M, N, op, broadcast_a, broadcast_b, false, false);
+}
+
+TEST_CASE("Test binary jited correctness with broadcast columns", "[jit][correctness][binary]")
+{
+  auto op = GENERATE(binary_op_t::add, binary_op_t::sub, binary_op_t::mul);
+  auto [column_a, column_b] = GENERATE(table<bool, bool>({{true, false}, {false, true}, {true, true}}));
+  auto broadcast_b = GENERATE(false, true);
+  auto M = GENERATE(1u, 4u, 17u, 64u, 67u);
+
+  CAPTURE(op, column_a, column_b, broadcast_b, M);
+  run_binary<float>(M, 5, op, false, broadcast_b, column_a, column_b);
+  run_binary<double>(M, 5, op, false, broadcast_b, column_a, column_b);
+}
+
+TEST_CASE("Test binary jited correctness with a relu activation", "[jit][correctness][binary]")
+{
+  auto op = GENERATE(binary_op_t::add, binary_op_t::sub, binary_op_t::mul, binary_op_t::max, binary_op_t::min);
+  auto broadcast_b = GENERATE(false, true);
+  auto M = GENERATE(1u, 3u, 4u, 15u, 16u, 17u, 64u, 67u);
+
+  CAPTURE(op, broadcast_b, M);
+  run_binary<float>(M, 3, op, false, broadcast_b, false, false, activation_t::relu);
+  run_binary<double>(M, 3, op, false, broadcast_b, false, false, activation_t::relu);
+}
+
+TEST_CASE("Test binary jited max and min propagate NaN", "[jit][correctness][binary]")
+{
+  auto op = GENERATE(binary_op_t::max, binary_op_t::min);
+  CAPTURE(op);
+
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  const std::vector<float> a{nan, 1.0f, nan, -0.0f, 2.0f};
+  const std::vector<float> b{1.0f, nan, nan, 0.0f, -3.0f};
+  std::vector<float> c(a.size());
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::binary(kernel, a.size(), 1, op, mini_jit::kernels::dtype_t::fp32, false, false);
+  kernel.set_kernel();
+  mini_jit::Binary::kernel_t binary = reinterpret_cast<mini_jit::Binary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  binary(a.data(), b.data(), c.data(), a.size(), b.size(), c.size());
+
+  REQUIRE(std::isnan(c[0]));
+  REQUIRE(std::isnan(c[1]));
+  REQUIRE(std::isnan(c[2]));
+  REQUIRE(std::signbit(c[3]) == (op == binary_op_t::min));
+  REQUIRE(c[4] == (op == binary_op_t::max ? 2.0f : -3.0f));
+}
+
+TEST_CASE("Test Binary generate", "[generation][binary]")
+{
+  using mini_jit::Binary;
+
+  auto ptype = GENERATE(Binary::ptype_t::add, Binary::ptype_t::sub, Binary::ptype_t::mul, Binary::ptype_t::max, Binary::ptype_t::min);
+  auto dtype = GENERATE(Binary::dtype_t::fp32, Binary::dtype_t::fp64);
+  CAPTURE(ptype, dtype);
+
+  Binary binary;
+  REQUIRE(binary.generate(11, 3, false, true, dtype, ptype) == Binary::error_t::success);
+  REQUIRE(binary.get_kernel() != nullptr);
+  REQUIRE(binary.generate(0, 3, false, false, dtype, ptype) == Binary::error_t::err_wrong_dimension);
+  REQUIRE(binary.generate(11, 0, false, false, dtype, ptype) == Binary::error_t::err_wrong_dimension);
+  REQUIRE(binary.generate(11, 3, false, false, static_cast<Binary::dtype_t>(2), ptype) == Binary::error_t::err_wrong_dtype);
+  REQUIRE(binary.generate(11, 3, true, false, dtype, ptype, Binary::activation_t::relu) == Binary::error_t::success);
+  REQUIRE(binary.generate(11, 3, false, false, dtype, ptype, Binary::activation_t::clamp) == Binary::error_t::err_wrong_activation);
+}
@@ -0,0 +1,127 @@
+#include "../../main/Brgemm.h"
+#include "../../main/Cpu.h"
+#include "../../main/Kernel.h"
+#include "../../main/Packing.h"
+#include "../../main/kernels/br_matmul_bf16.h"
+#include "bf16.test.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+TEST_CASE("Test br_matmul_bf16 (1≤M≤37, 1≤N≤17, K∈{1,4,9}, BatchSize∈{1,3}) on packed random data",
+          "[jit][correctness][gemm][bf16]")
+{
+  using mini_jit::Packing;
+
+  if (!mini_jit::Cpu::has_bf16())
+  {
+    SKIP("The processor does not implement the BFloat16 extension.");
+  }
+
+  auto M = GENERATE(1u, 2u, 3u, 7u, 8u, 9u, 37u);
+  auto N = GENERATE(1u, 2u, 5u, 8u, 17u);
+  auto K = GENERATE(1u, 4u, 9u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto beta = GENERATE(0.0, 1.0);
+  auto trans_a = GENERATE(0u, 1u);
+  auto trans_b = GENERATE(0u, 1u);
+
+  CAPTURE(M, N, K, BatchSize, beta, trans_a, trans_b);
+
+  const int64_t lda = (trans_a ? K : M) + 3;
+  const int64_t ldb = (trans_b ? N : K) + 2;
+  const int64_t ldc = M + 1;
+  const int64_t br_stride_a = lda * (trans_a ? M : K);
+  const int64_t br_stride_b = ldb * (trans_b ? K : N);
+
+  std::vector<uint16_t> a(br_stride_a * BatchSize);
+  std::vector<uint16_t> b(br_stride_b * BatchSize);
+  std::vector<float> c(ldc * N);
+  for (std::vector<uint16_t> *values : {&a, &b})
+  {
+    for (uint16_t &value : *values)
+    {
+      value = to_bf16(static_cast<float>(std::rand()) / RAND_MAX - 0.5f);
+    }
+  }
+  for (float &value : c)
+  {
+    value = static_cast<float>(std::rand()) / RAND_MAX - 0.5f;
+  }
+
+  // The products of two bfloat16 are exact in single precision, the padding rows of C must not be written
+  std::vector<float> c_verify = c;
+  for (uint32_t iN = 0; iN < N; ++iN)
+  {
+    for (uint32_t iM = 0; iM < M; ++iM)
+    {
+      double sum = beta == 0 ? 0 : c[iM + iN * ldc];
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          sum += static_cast<double>(from_bf16(a[(trans_a ? iK + iM * lda : iM + iK * lda) + iB * br_stride_a])) *
+                 from_bf16(b[(trans_b ? iN + iK * ldb : iK + iN * ldb) + iB * br_stride_b]);
+        }
+      }
+      c_verify[iM + iN * ldc] = static_cast<float>(sum);
+    }
+  }
+
+  Packing packing;
+  REQUIRE(packing.generate(M, N, K, BatchSize, trans_a, trans_b, Packing::dtype_t::bf16) == Packing::error_t::success);
+
+  std::vector<uint16_t> packed_a(packing.get_size_a() * BatchSize);
+  std::vector<uint16_t> packed_b(packing.get_size_b() * BatchSize);
+  packing.pack_a(a.data(), lda, br_stride_a, packed_a.data());
+  packing.pack_b(b.data(), ldb, br_stride_b, packed_b.data());
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_bf16(kernel, M, N, K, BatchSize, beta);
+  kernel.set_kernel();
+
+  mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  matmul(packed_a.data(), packed_b.data(), c.data(), 0, 0, ldc, packing.get_size_a(), packing.get_size_b());
+
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    CAPTURE(i, c[i], c_verify[i]);
+    REQUIRE_THAT(c[i], Catch::Matchers::WithinRel(c_verify[i], 1e-5f) || Catch::Matchers::WithinAbs(c_verify[i], 1e-5f));
+  }
+}
+
+TEST_CASE("Test Brgemm with bf16 inputs", "[generation][correctness][gemm][bf16]")
+{
+  using mini_jit::Brgemm;
+  using mini_jit::Packing;
+
+  if (!mini_jit::Cpu::has_bf16())
+  {
+    SKIP("The processor does not implement the BFloat16 extension.");
+  }
+
+  Packing packing;
+  REQUIRE(packing.generate(19, 10, 6, 2, 0, 0, Packing::dtype_t::bf16) == Packing::error_t::success);
+  REQUIRE(packing.get_tile() == Brgemm::default_bf16_tile);
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(19, 10, 6, 2, 0, 0, 0, Brgemm::dtype_t::bf16, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride,
+                        Brgemm::packing_t{true, true}) == Brgemm::error_t::success);
+
+  std::vector<uint16_t> a(19 * 6 * 2, to_bf16(0.5f));
+  std::vector<uint16_t> b(6 * 10 * 2, to_bf16(3.0f));
+  std::vector<uint16_t> packed_a(packing.get_size_a() * 2);
+  std::vector<uint16_t> packed_b(packing.get_size_b() * 2);
+  std::vector<float> c(19 * 10, 1);
+  packing.pack_a(a.data(), 19, 19 * 6, packed_a.data());
+  packing.pack_b(b.data(), 6, 6 * 10, packed_b.data());
+
+  gemm.get_kernel()(packed_a.data(), packed_b.data(), c.data(), 0, 0, 19, packing.get_size_a(), packing.get_size_b());
+  for (float value : c)
+  {
+    REQUIRE(value == 1 + 2 * 6 * 0.5f * 3.0f);
+  }
+}
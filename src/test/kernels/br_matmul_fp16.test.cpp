@@ -0,0 +1,167 @@
+#include "../../main/Brgemm.h"
+#include "../../main/Cpu.h"
+#include "../../main/Kernel.h"
+#include "../../main/Unary.h"
+#include "../../main/kernels/br_matmul_fp16.h"
+#include "fp16.test.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+TEST_CASE("Test br_matmul_fp16 (1≤M≤37, 1≤N≤17, 1≤K≤19, BatchSize∈{1,3}) on random integers",
+          "[jit][correctness][gemm][fp16]")
+{
+  using mini_jit::kernels::fp16_accumulation_t;
+
+  auto accumulation = GENERATE(fp16_accumulation_t::fp16, fp16_accumulation_t::fp32);
+  if (accumulation == fp16_accumulation_t::fp16 && !mini_jit::Cpu::has_fp16())
+  {
+    SKIP("The processor does not implement the half-precision arithmetic.");
+  }
+
+  auto M = GENERATE(1u, 3u, 7u, 8u, 9u, 16u, 37u);
+  auto N = GENERATE(1u, 3u, 4u, 8u, 17u);
+  auto K = GENERATE(1u, 7u, 8u, 19u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto beta = GENERATE(0.0, 1.0);
+
+  CAPTURE(accumulation, M, N, K, BatchSize, beta);
+
+  const int64_t lda = M + 3;
+  const int64_t ldb = K + 2;
+  const int64_t ldc = M + 1;
+  const int64_t br_stride_a = lda * K;
+  const int64_t br_stride_b = ldb * N;
+
+  // Small integers keep all partial sums exact in half precision, hence both accumulations match the reference exactly
+  std::vector<uint16_t> a(br_stride_a * BatchSize);
+  std::vector<uint16_t> b(br_stride_b * BatchSize);
+  std::vector<uint16_t> c(ldc * N);
+  for (std::vector<uint16_t> *values : {&a, &b, &c})
+  {
+    for (uint16_t &value : *values)
+    {
+      value = to_fp16(static_cast<float>(std::rand() % 5 - 2));
+    }
+  }
+
+  // The padding rows of C must not be written
+  std::vector<uint16_t> c_verify = c;
+  for (uint32_t iN = 0; iN < N; ++iN)
+  {
+    for (uint32_t iM = 0; iM < M; ++iM)
+    {
+      float sum = beta == 0 ? 0 : from_fp16(c[iM + iN * ldc]);
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          sum += from_fp16(a[iM + iK * lda + iB * br_stride_a]) * from_fp16(b[iK + iN * ldb + iB * br_stride_b]);
+        }
+      }
+      c_verify[iM + iN * ldc] = to_fp16(sum);
+    }
+  }
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_fp16(kernel, M, N, K, BatchSize, accumulation, beta);
+  kernel.set_kernel();
+
+  mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  matmul(a.data(), b.data(), c.data(), lda, ldb, ldc, br_stride_a, br_stride_b);
+
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    CAPTURE(i, from_fp16(c[i]), from_fp16(c_verify[i]));
+    REQUIRE(c[i] == c_verify[i]);
+  }
+}
+
+TEST_CASE("Test br_matmul_fp16 with single-precision accumulators rounds C once", "[jit][correctness][gemm][fp16]")
+{
+  // 1 + 4096 * 2^-11 is 3, but every partial sum 1 + i * 2^-11 rounds back to 1 in half precision
+  constexpr uint32_t K = 4096;
+  std::vector<uint16_t> a(K, to_fp16(1.0f / 2048));
+  std::vector<uint16_t> b(K, to_fp16(1.0f));
+  std::vector<uint16_t> c(1, to_fp16(1.0f));
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_fp16(kernel, 1, 1, K, 1, mini_jit::kernels::fp16_accumulation_t::fp32, 1);
+  kernel.set_kernel();
+
+  mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  matmul(a.data(), b.data(), c.data(), 1, K, 1, 0, 0);
+
+  REQUIRE(from_fp16(c[0]) == 3.0f);
+}
+
+TEST_CASE("Test Brgemm with fp16 inputs", "[generation][correctness][gemm][fp16]")
+{
+  using mini_jit::Brgemm;
+
+  auto dtype = GENERATE(Brgemm::dtype_t::fp16, Brgemm::dtype_t::fp16_fp32);
+  if (dtype == Brgemm::dtype_t::fp16 && !mini_jit::Cpu::has_fp16())
+  {
+    SKIP("The processor does not implement the half-precision arithmetic.");
+  }
+
+  CAPTURE(dtype);
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(19, 10, 6, 2, 0, 0, 0, dtype) == Brgemm::error_t::success);
+
+  std::vector<uint16_t> a(19 * 6 * 2, to_fp16(0.5f));
+  std::vector<uint16_t> b(6 * 10 * 2, to_fp16(3.0f));
+  std::vector<uint16_t> c(19 * 10, to_fp16(1.0f));
+
+  gemm.get_kernel()(a.data(), b.data(), c.data(), 19, 6, 19, 19 * 6, 6 * 10);
+  for (uint16_t value : c)
+  {
+    REQUIRE(from_fp16(value) == 1 + 2 * 6 * 0.5f * 3.0f);
+  }
+}
+
+TEST_CASE("Test Brgemm rejects the unsupported options of fp16", "[generation][gemm][fp16]")
+{
+  using mini_jit::Brgemm;
+
+  auto dtype = GENERATE(Brgemm::dtype_t::fp16, Brgemm::dtype_t::fp16_fp32);
+  CAPTURE(dtype);
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(16, 8, 4, 1, 1, 0, 0, dtype) == Brgemm::error_t::err_row_major_order_not_supported);
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, dtype, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride, Brgemm::packing_t{true, false}) ==
+          Brgemm::error_t::err_packing_not_supported);
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, dtype, 2, 1) == Brgemm::error_t::err_wrong_dtype);
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, dtype, 1, 0.5) == Brgemm::error_t::err_wrong_dtype);
+
+  mini_jit::kernels::epilogue_t relu;
+  relu.activation = mini_jit::kernels::activation_t::relu;
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, dtype, 1, 1, relu) == Brgemm::error_t::err_wrong_dtype);
+
+  const Brgemm::tile_t other_tile = dtype == Brgemm::dtype_t::fp16 ? Brgemm::default_fp16_fp32_tile : Brgemm::default_fp16_tile;
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, dtype, other_tile) == Brgemm::error_t::err_wrong_tile);
+  REQUIRE(Brgemm::is_valid_tile(37, 5, dtype == Brgemm::dtype_t::fp16 ? Brgemm::default_fp16_tile : Brgemm::default_fp16_fp32_tile,
+                                dtype));
+}
+
+TEST_CASE("Test Brgemm and Unary generate the half-precision arithmetic only on processors that implement it", "[generation][gemm][fp16]")
+{
+  using mini_jit::Brgemm;
+  using mini_jit::Unary;
+
+  // The half-precision accumulation and the fp16 relu use FEAT_FP16, the single-precision accumulation only converts
+  const bool has_fp16 = mini_jit::Cpu::has_fp16();
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, Brgemm::dtype_t::fp16) ==
+          (has_fp16 ? Brgemm::error_t::success : Brgemm::error_t::err_wrong_dtype));
+  REQUIRE(gemm.generate(16, 8, 4, 1, 0, 0, 0, Brgemm::dtype_t::fp16_fp32) == Brgemm::error_t::success);
+
+  Unary unary;
+  REQUIRE(unary.generate(16, 8, 0, Unary::dtype_t::fp16, Unary::ptype_t::relu) ==
+          (has_fp16 ? Unary::error_t::success : Unary::error_t::err_wrong_dtype));
+  REQUIRE(unary.generate(16, 8, 0, Unary::dtype_t::fp16, Unary::ptype_t::identity) == Unary::error_t::success);
+}
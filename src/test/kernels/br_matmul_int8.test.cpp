@@ -0,0 +1,256 @@
+#include "../../main/Brgemm.h"
+#include "../../main/Cpu.h"
+#include "../../main/Kernel.h"
+#include "../../main/Packing.h"
+#include "../../main/kernels/br_matmul_int8.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  using mini_jit::kernels::int8_instruction_t;
+
+  /**
+   * Interleaves the br_size matrices of a column-major operand into the strips of br_matmul_int8, i.e. the reference of Packing for
+   * either instruction.
+   *
+   * @param src The column-major A or the column-major transposed B, i.e. rows x k with the leading dimension rows.
+   * @param rows The rows of A or the columns of B.
+   * @param k The columns of A or the rows of B.
+   * @param br_size number of batch dimensions.
+   * @param instruction The instruction whose blocks of k are interleaved.
+   * @return The packed matrices, which are one after the other.
+   */
+  std::vector<uint8_t> pack_int8(std::vector<uint8_t> const &src, uint32_t rows, uint32_t k, uint32_t br_size,
+                                 int8_instruction_t instruction)
+  {
+    constexpr uint32_t strip_size = mini_jit::kernels::br_matmul_int8_mr;
+    const uint32_t k_block = mini_jit::kernels::br_matmul_int8_k_block(instruction);
+    const uint32_t padded_k = mini_jit::kernels::br_matmul_int8_padded_k(k, instruction);
+
+    std::vector<uint8_t> packed;
+    for (uint32_t iB = 0; iB < br_size; ++iB)
+    {
+      for (uint32_t iStrip = 0; iStrip < rows; iStrip += strip_size)
+      {
+        for (uint32_t iK = 0; iK < padded_k; iK += k_block)
+        {
+          for (uint32_t iRow = iStrip; iRow < iStrip + strip_size; ++iRow)
+          {
+            for (uint32_t iBlock = iK; iBlock < iK + k_block; ++iBlock)
+            {
+              packed.push_back(iRow < rows && iBlock < k ? src[iRow + iBlock * rows + iB * rows * k] : 0);
+            }
+          }
+        }
+      }
+    }
+    return packed;
+  }
+
+  /**
+   * Gets the signed or unsigned value of a byte.
+   */
+  int32_t to_int(uint8_t value, bool is_signed)
+  {
+    return is_signed ? static_cast<int8_t>(value) : value;
+  }
+}  // namespace
+
+TEST_CASE("Test br_matmul_int8 (1≤M≤37, 1≤N≤17, K∈{1,4,9,17}, BatchSize∈{1,3}) on packed random data",
+          "[jit][correctness][gemm][int8]")
+{
+  if (!mini_jit::Cpu::has_dotprod())
+  {
+    SKIP("The processor does not implement the dot product instructions.");
+  }
+
+  auto instruction = GENERATE(int8_instruction_t::dot, int8_instruction_t::mmla);
+  if (instruction == int8_instruction_t::mmla && !mini_jit::Cpu::has_i8mm())
+  {
+    SKIP("The processor does not implement the Int8 matrix multiplication extension.");
+  }
+
+  auto M = GENERATE(1u, 2u, 3u, 7u, 8u, 9u, 37u);
+  auto N = GENERATE(1u, 2u, 5u, 8u, 17u);
+  auto K = GENERATE(1u, 4u, 9u, 17u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto is_signed = GENERATE(true, false);
+  auto beta = GENERATE(0.0, 1.0);
+
+  CAPTURE(instruction, M, N, K, BatchSize, is_signed, beta);
+
+  const int64_t ldc = M + 1;
+
+  // B is stored transposed, which makes the columns of B the rows of the packed operand
+  std::vector<uint8_t> a(M * K * BatchSize);
+  std::vector<uint8_t> b_transposed(N * K * BatchSize);
+  std::vector<int32_t> c(ldc * N);
+  for (std::vector<uint8_t> *values : {&a, &b_transposed})
+  {
+    for (uint8_t &value : *values)
+    {
+      value = static_cast<uint8_t>(std::rand());
+    }
+  }
+  for (int32_t &value : c)
+  {
+    value = std::rand() % 2001 - 1000;
+  }
+
+  // The padding rows of C must not be written
+  std::vector<int32_t> c_verify = c;
+  for (uint32_t iN = 0; iN < N; ++iN)
+  {
+    for (uint32_t iM = 0; iM < M; ++iM)
+    {
+      int32_t sum = beta == 0 ? 0 : c[iM + iN * ldc];
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          sum += to_int(a[iM + iK * M + iB * M * K], is_signed) * to_int(b_transposed[iN + iK * N + iB * N * K], is_signed);
+        }
+      }
+      c_verify[iM + iN * ldc] = sum;
+    }
+  }
+
+  std::vector<uint8_t> packed_a = pack_int8(a, M, K, BatchSize, instruction);
+  std::vector<uint8_t> packed_b = pack_int8(b_transposed, N, K, BatchSize, instruction);
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_int8(kernel, M, N, K, BatchSize, is_signed, instruction, beta);
+  kernel.set_kernel();
+
+  mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  matmul(packed_a.data(), packed_b.data(), c.data(), 0, 0, ldc, packed_a.size() / BatchSize, packed_b.size() / BatchSize);
+
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    CAPTURE(i, c[i], c_verify[i]);
+    REQUIRE(c[i] == c_verify[i]);
+  }
+}
+
+TEST_CASE("Test br_matmul_int8 with a requantization to int8 (1≤M≤37, 1≤N≤17, K∈{3,19}) on packed random data",
+          "[jit][correctness][gemm][int8][epilogue]")
+{
+  if (!mini_jit::Cpu::has_dotprod())
+  {
+    SKIP("The processor does not implement the dot product instructions.");
+  }
+
+  auto instruction = GENERATE(int8_instruction_t::dot, int8_instruction_t::mmla);
+  if (instruction == int8_instruction_t::mmla && !mini_jit::Cpu::has_i8mm())
+  {
+    SKIP("The processor does not implement the Int8 matrix multiplication extension.");
+  }
+
+  auto M = GENERATE(1u, 2u, 3u, 4u, 5u, 8u, 13u, 37u);
+  auto N = GENERATE(1u, 3u, 8u, 17u);
+  auto K = GENERATE(3u, 19u);
+  auto is_signed = GENERATE(true, false);
+
+  // The scales are powers of two, hence the reference is exact whether or not the compiler contracts the multiply and add
+  auto scale = GENERATE(1.0 / 64, 1.0 / 1024);
+  auto zero_point = GENERATE(-7, 0, 12);
+
+  CAPTURE(instruction, M, N, K, is_signed, scale, zero_point);
+
+  constexpr uint32_t BatchSize = 2;
+  const int64_t ldc = M + 2;
+
+  std::vector<uint8_t> a(M * K * BatchSize);
+  std::vector<uint8_t> b_transposed(N * K * BatchSize);
+  std::vector<int8_t> c(ldc * N, 99);
+  for (std::vector<uint8_t> *values : {&a, &b_transposed})
+  {
+    for (uint8_t &value : *values)
+    {
+      value = static_cast<uint8_t>(std::rand());
+    }
+  }
+
+  // The accumulators are scaled and shifted in single precision, rounded to the nearest even integer and saturated
+  std::vector<int8_t> c_verify = c;
+  for (uint32_t iN = 0; iN < N; ++iN)
+  {
+    for (uint32_t iM = 0; iM < M; ++iM)
+    {
+      int32_t sum = 0;
+      for (uint32_t iB = 0; iB < BatchSize; ++iB)
+      {
+        for (uint32_t iK = 0; iK < K; ++iK)
+        {
+          sum += to_int(a[iM + iK * M + iB * M * K], is_signed) * to_int(b_transposed[iN + iK * N + iB * N * K], is_signed);
+        }
+      }
+      const float value = static_cast<float>(sum) * static_cast<float>(scale) + static_cast<float>(zero_point);
+      c_verify[iM + iN * ldc] = static_cast<int8_t>(std::clamp(std::nearbyint(value), -128.0f, 127.0f));
+    }
+  }
+
+  std::vector<uint8_t> packed_a = pack_int8(a, M, K, BatchSize, instruction);
+  std::vector<uint8_t> packed_b = pack_int8(b_transposed, N, K, BatchSize, instruction);
+
+  mini_jit::kernels::epilogue_t epilogue;
+  epilogue.requantize = mini_jit::kernels::requantize_t::s8;
+  epilogue.scale = scale;
+  epilogue.zero_point = zero_point;
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_int8(kernel, M, N, K, BatchSize, is_signed, instruction, 0, epilogue);
+  kernel.set_kernel();
+
+  mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  matmul(packed_a.data(), packed_b.data(), c.data(), 0, 0, ldc, packed_a.size() / BatchSize, packed_b.size() / BatchSize);
+
+  for (size_t i = 0; i < c.size(); ++i)
+  {
+    CAPTURE(i, c[i], c_verify[i]);
+    REQUIRE(c[i] == c_verify[i]);
+  }
+}
+
+TEST_CASE("Test Brgemm with s8 and u8 inputs", "[generation][correctness][gemm][int8]")
+{
+  using mini_jit::Brgemm;
+  using mini_jit::Packing;
+
+  if (!mini_jit::Cpu::has_dotprod())
+  {
+    SKIP("The processor does not implement the dot product instructions.");
+  }
+
+  auto dtype = GENERATE(Brgemm::dtype_t::s8, Brgemm::dtype_t::u8);
+  CAPTURE(dtype);
+
+  Packing packing;
+  REQUIRE(packing.generate(19, 10, 6, 2, 0, 0, dtype) == Packing::error_t::success);
+  REQUIRE(packing.get_tile() == Brgemm::default_int8_tile);
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(19, 10, 6, 2, 0, 0, 0, dtype, 1, 1, {}, {}, Brgemm::batch_reduce_t::stride, Brgemm::packing_t{true, true}) ==
+          Brgemm::error_t::success);
+
+  const uint8_t value_a = dtype == Brgemm::dtype_t::s8 ? static_cast<uint8_t>(-3) : 200;
+  std::vector<uint8_t> a(19 * 6 * 2, value_a);
+  std::vector<uint8_t> b(6 * 10 * 2, 5);
+  std::vector<uint8_t> packed_a(packing.get_size_a() * 2);
+  std::vector<uint8_t> packed_b(packing.get_size_b() * 2);
+  std::vector<int32_t> c(19 * 10, 1);
+  packing.pack_a(a.data(), 19, 19 * 6, packed_a.data());
+  packing.pack_b(b.data(), 6, 6 * 10, packed_b.data());
+
+  gemm.get_kernel()(packed_a.data(), packed_b.data(), c.data(), 0, 0, 19, packing.get_size_a(), packing.get_size_b());
+  for (int32_t value : c)
+  {
+    REQUIRE(value == 1 + 2 * 6 * to_int(value_a, dtype == Brgemm::dtype_t::s8) * 5);
+  }
+}
@@ -0,0 +1,77 @@
+#include "../../main/Brgemm.h"
+#include "../../main/Peephole.h"
+#include "../../main/kernels/br_matmul_mr_nr_k.h"
+#include "matmul.bench.h"
+#include <benchmark/benchmark.h>
+
+template <uint32_t TMdim, uint32_t TNdim, uint32_t TKdim> class GemmMrNrMxNxKFixture : public benchmark::Fixture
+{
+public:
+  float matrix_a[TMdim * TKdim];
+  float matrix_b[TKdim * TNdim];
+  float matrix_c[TMdim * TNdim];
+  double flops;
+
+  void SetUp(::benchmark::State &) override
+  {
+    flops = 0;
+
+    fill_random_matrix(matrix_a);
+    fill_random_matrix(matrix_b);
+    fill_random_matrix(matrix_c);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["FLOPS"] = benchmark::Counter(flops, benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @brief Runs the br_matmul_mr_nr_k kernel with the default 16x4 register block for the dimensions of the fixture.
+   *
+   * @param state The benchmark state.
+   * @param use_peephole True if the kernel is rewritten by the peephole pass before it is set.
+   */
+  void run(benchmark::State &state, bool use_peephole)
+  {
+    // Generate kernel
+    mini_jit::Kernel native_kernel;
+    mini_jit::kernels::br_matmul_mr_nr_k(native_kernel, 16, 4, TMdim, TNdim, TKdim, 1);
+    if (use_peephole)
+    {
+      mini_jit::Peephole::optimize(native_kernel);
+    }
+    native_kernel.set_kernel();
+    mini_jit::Brgemm::kernel_t kernel = reinterpret_cast<mini_jit::Brgemm::kernel_t>(
+      const_cast<void *>(native_kernel.get_kernel()));  // Properly cast from const void* to kernel_t
+
+    for (auto _ : state)
+    {
+      // Run kernel
+      kernel(matrix_a, matrix_b, matrix_c, TMdim, TKdim, TMdim, 1, 1);
+    }
+
+    flops = (TMdim * TNdim * TKdim) * 2;  // M * N * K * 2 instructions (add & mul)
+    flops *= state.iterations();
+  }
+};
+
+BENCHMARK_TEMPLATE_DEFINE_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k, 64, 48, 64)(benchmark::State &state)
+{
+  run(state, false);
+};
+
+BENCHMARK_TEMPLATE_DEFINE_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k_peephole, 64, 48, 64)(benchmark::State &state)
+{
+  run(state, true);
+};
+
+// The remaining 15 rows and 3 columns are processed by smaller blocks of the same kernel
+BENCHMARK_TEMPLATE_DEFINE_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k_remainder, 63, 47, 64)(benchmark::State &state)
+{
+  run(state, false);
+};
+
+BENCHMARK_REGISTER_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k)->MinWarmUpTime(1.0);            // WarmUp in seconds
+BENCHMARK_REGISTER_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k_peephole)->MinWarmUpTime(1.0);   // WarmUp in seconds
+BENCHMARK_REGISTER_F(GemmMrNrMxNxKFixture, BM_br_matmul_mr_nr_k_remainder)->MinWarmUpTime(1.0);  // WarmUp in seconds
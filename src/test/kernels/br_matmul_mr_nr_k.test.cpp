@@ -0,0 +1,216 @@
+#include "../../main/kernels/br_matmul_mr_nr_k.h"
+#include "matmul.test.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstdint>
+#include <cstring>
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=8, NR=12, M=8*1, N=12*1, K=1, B=1) jited br gemm correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 8;
+  const uint32_t NR = 12;
+  const uint32_t M = MR * 1;
+  const uint32_t N = NR * 1;
+  const uint32_t K = 1;
+  const uint32_t B = 1;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=8, NR=12, M=8*2, N=12*3, K=18, B=1) jited br gemm correctness counting data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 8;
+  const uint32_t NR = 12;
+  const uint32_t M = MR * 2;
+  const uint32_t N = NR * 3;
+  const uint32_t K = 18;
+  const uint32_t B = 1;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Counting);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=12, NR=8, M=12*3, N=8*2, K=7, B=3) jited br gemm correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 12;
+  const uint32_t NR = 8;
+  const uint32_t M = MR * 3;
+  const uint32_t N = NR * 2;
+  const uint32_t K = 7;
+  const uint32_t B = 3;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=16, NR=6, M=16*2, N=6*2, K=18, B=5) jited br gemm correctness counting data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 16;
+  const uint32_t NR = 6;
+  const uint32_t M = MR * 2;
+  const uint32_t N = NR * 2;
+  const uint32_t K = 18;
+  const uint32_t B = 5;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Counting);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=24, NR=4, M=24*2, N=4*3, K=9, B=2) jited br gemm correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 24;
+  const uint32_t NR = 4;
+  const uint32_t M = MR * 2;
+  const uint32_t N = NR * 3;
+  const uint32_t K = 9;
+  const uint32_t B = 2;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=4, NR=30, M=4*3, N=30*1, K=5, B=2) jited br gemm correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 4;
+  const uint32_t NR = 30;
+  const uint32_t M = MR * 3;
+  const uint32_t N = NR * 1;
+  const uint32_t K = 5;
+  const uint32_t B = 2;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=20, NR=5, M=20*1, N=5*3, K=11, B=4) jited br gemm correctness counting data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 20;
+  const uint32_t NR = 5;
+  const uint32_t M = MR * 1;
+  const uint32_t N = NR * 3;
+  const uint32_t K = 11;
+  const uint32_t B = 4;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Counting);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=8, NR=12, M=8*2+7, N=12*2+5, K=6, B=2) jited br gemm correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 8;
+  const uint32_t NR = 12;
+  const uint32_t M = MR * 2 + 7;
+  const uint32_t N = NR * 2 + 5;
+  const uint32_t K = 6;
+  const uint32_t B = 2;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=16, NR=6, M=15, N=4, K=3, B=1) jited br gemm correctness counting data", "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 16;
+  const uint32_t NR = 6;
+  const uint32_t M = 15;
+  const uint32_t N = 4;
+  const uint32_t K = 3;
+  const uint32_t B = 1;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Counting);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=16, NR=4, M=16*{0,1,3}+[1-16], N=4*{0,1,50}+[1-4], K={1,18}, B={1,5}) jited br gemm correctness "
+          "random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 16;
+  const uint32_t NR = 4;
+  auto MBlocks = GENERATE(0u, 1u, 3u);
+  auto MRest = GENERATE(range(1u, 16u + 1u, 1u));
+  auto NBlocks = GENERATE(0u, 1u, 50u);
+  auto NRest = GENERATE(range(1u, 4u + 1u, 1u));
+  auto K = GENERATE(1u, 18u);
+  auto B = GENERATE(1u, 5u);
+  const uint32_t M = MR * MBlocks + MRest;
+  const uint32_t N = NR * NBlocks + NRest;
+  CAPTURE(M, N, K, B);
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=16, NR=4, M=16+[1-15], N=4+[1-3], K=18, B=5) jited br gemm correctness counting data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 16;
+  const uint32_t NR = 4;
+  auto MRest = GENERATE(range(1u, 15u + 1u, 1u));
+  auto NRest = GENERATE(range(1u, 3u + 1u, 1u));
+  const uint32_t M = MR + MRest;
+  const uint32_t N = NR + NRest;
+  const uint32_t K = 18;
+  const uint32_t B = 5;
+
+  CAPTURE(M, N);
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Counting);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, M, N, K, B);
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k (MR=16, NR=4, M=16*3+5, N=4*2+1, K=18, B=5) patched loop counts correctness random data",
+          "[jit][correctness][gemm]")
+{
+  const uint32_t MR = 16;
+  const uint32_t NR = 4;
+  const uint32_t M = MR * 3 + 5;
+  const uint32_t N = NR * 2 + 1;
+  const uint32_t K = 18;
+  const uint32_t B = 5;
+  GemmMxNxKxBatchTestFixture gemmTest(M, N, K, B);
+  gemmTest.SetUp(TestInfill::Random);
+  mini_jit::kernels::br_matmul_mr_nr_k(gemmTest.native_kernel, MR, NR, MR + 5, NR + 1, 1, 1);
+  gemmTest.native_kernel.set_kernel();
+  mini_jit::kernels::br_matmul_mr_nr_k_patch_loops(gemmTest.native_kernel, M / MR, N / NR, K, B);
+
+  mini_jit::Kernel expected;
+  mini_jit::kernels::br_matmul_mr_nr_k(expected, MR, NR, M, N, K, B);
+  REQUIRE(gemmTest.native_kernel.get_buffer() == expected.get_buffer());
+  REQUIRE(std::memcmp(gemmTest.native_kernel.get_kernel(), expected.get_buffer().data(), expected.get_size()) == 0);
+
+  gemmTest.RunTest(M, K, M, M * K, K * N);
+}
+
+TEST_CASE("Test br_matmul_mr_nr_k register block limits", "[jit][correctness][gemm]")
+{
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(4) == 30);
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(8) == 14);
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(12) == 9);
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(16) == 6);
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(24) == 4);
+
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(2, mini_jit::kernels::dtype_t::fp64) == 30);
+  REQUIRE(mini_jit::kernels::br_matmul_mr_nr_k_max_nr(8, mini_jit::kernels::dtype_t::fp64) == 6);
+}
@@ -0,0 +1,145 @@
+#include "../../main/Brgemm.h"
+#include "../../main/Cpu.h"
+#include "../../main/Kernel.h"
+#include "../../main/kernels/br_matmul_sve.h"
+#include "sve.test.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Executes a generated SVE kernel on random data with padded leading dimensions and compares it against a naive brgemm.
+   *
+   * @param kernel The kernel that contains the generated instructions.
+   * @param M The rows of A and C.
+   * @param N The columns of B and C.
+   * @param K The columns of A and rows of B.
+   * @param BatchSize The number of A and B blocks.
+   * @param beta The scaling of C, zero or one.
+   * @param epsilon The relative and absolute tolerance.
+   */
+  template <typename T>
+  void run_br_matmul_sve(mini_jit::Kernel &kernel, uint32_t M, uint32_t N, uint32_t K, uint32_t BatchSize, double beta, T epsilon)
+  {
+    const int64_t lda = M + 3;
+    const int64_t ldb = K + 2;
+    const int64_t ldc = M + 1;
+    const int64_t br_stride_a = lda * K + 5;
+    const int64_t br_stride_b = ldb * N + 7;
+
+    std::vector<T> a(br_stride_a * BatchSize);
+    std::vector<T> b(br_stride_b * BatchSize);
+    std::vector<T> c(ldc * N);
+    for (std::vector<T> *values : {&a, &b, &c})
+    {
+      for (T &value : *values)
+      {
+        value = static_cast<T>(std::rand()) / RAND_MAX - static_cast<T>(0.5);
+      }
+    }
+
+    // The padding rows of C must not be written
+    std::vector<T> c_verify = c;
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        T sum = beta == 0 ? 0 : c[iM + iN * ldc];
+        for (uint32_t iB = 0; iB < BatchSize; ++iB)
+        {
+          for (uint32_t iK = 0; iK < K; ++iK)
+          {
+            sum += a[iM + iK * lda + iB * br_stride_a] * b[iK + iN * ldb + iB * br_stride_b];
+          }
+        }
+        c_verify[iM + iN * ldc] = sum;
+      }
+    }
+
+    mini_jit::Brgemm::kernel_t matmul = reinterpret_cast<mini_jit::Brgemm::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    matmul(a.data(), b.data(), c.data(), lda, ldb, ldc, br_stride_a, br_stride_b);
+
+    for (size_t i = 0; i < c.size(); ++i)
+    {
+      CAPTURE(i, c[i], c_verify[i]);
+      REQUIRE_THAT(c[i], Catch::Matchers::WithinRel(c_verify[i], epsilon) || Catch::Matchers::WithinAbs(c_verify[i], epsilon));
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test br_matmul_sve (1≤M≤70, 1≤N≤19, K∈{1,9}, BatchSize∈{1,3}) at each vector length on random data",
+          "[jit][correctness][gemm][sve]")
+{
+  auto M = GENERATE(1u, 3u, 4u, 8u, 17u, 48u, 70u);
+  auto N = GENERATE(1u, 7u, 8u, 19u);
+  auto K = GENERATE(1u, 9u);
+  auto BatchSize = GENERATE(1u, 3u);
+  auto beta = GENERATE(0.0, 1.0);
+  auto dtype = GENERATE(mini_jit::kernels::dtype_t::fp32, mini_jit::kernels::dtype_t::fp64);
+
+  CAPTURE(M, N, K, BatchSize, beta, static_cast<uint32_t>(dtype));
+
+  // The same kernel runs at all vector lengths
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_sve(kernel, mini_jit::kernels::br_matmul_sve_default_m_vectors, mini_jit::kernels::br_matmul_sve_default_nr,
+                                   M, N, K, BatchSize, dtype, beta);
+  kernel.set_kernel();
+
+  for_each_sve_vector_length(
+    [&]()
+    {
+      if (dtype == mini_jit::kernels::dtype_t::fp64)
+      {
+        run_br_matmul_sve(kernel, M, N, K, BatchSize, beta, 1e-12);
+      }
+      else
+      {
+        run_br_matmul_sve(kernel, M, N, K, BatchSize, beta, 1e-5f);
+      }
+    });
+}
+
+TEST_CASE("Test br_matmul_sve with a register block of a single vector and the widest block", "[jit][correctness][gemm][sve]")
+{
+  auto m_vectors = GENERATE(1u, 2u, 5u);
+  const uint32_t nr = mini_jit::kernels::br_matmul_sve_max_nr(m_vectors);
+
+  CAPTURE(m_vectors, nr);
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::br_matmul_sve(kernel, m_vectors, nr, 37, 2 * nr + 1, 4, 2);
+  kernel.set_kernel();
+
+  for_each_sve_vector_length([&]() { run_br_matmul_sve(kernel, 37, 2 * nr + 1, 4, 2, 1, 1e-5f); });
+}
+
+TEST_CASE("Test Brgemm with the SVE backend at each vector length", "[generation][correctness][gemm][sve]")
+{
+  using mini_jit::Brgemm;
+
+  if (!mini_jit::Cpu::is_sve_enabled())
+  {
+    SKIP("The SVE backend is not enabled.");
+  }
+
+  Brgemm gemm;
+  REQUIRE(gemm.generate(35, 20, 9, 2, 0, 0, 0, Brgemm::dtype_t::fp32) == Brgemm::error_t::success);
+
+  for_each_sve_vector_length(
+    [&]()
+    {
+      std::vector<float> a(35 * 9 * 2, 1);
+      std::vector<float> b(9 * 20 * 2, 2);
+      std::vector<float> c(35 * 20, 1);
+      gemm.get_kernel()(a.data(), b.data(), c.data(), 35, 9, 35, 35 * 9, 9 * 20);
+      for (float value : c)
+      {
+        REQUIRE(value == 1 + 2 * 9 * 2);
+      }
+    });
+}
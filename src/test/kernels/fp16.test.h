@@ -0,0 +1,59 @@
+#ifndef MINIJIT_KERNELS_FP16_TEST_H
+#define MINIJIT_KERNELS_FP16_TEST_H
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Converts a float to the nearest half-precision float, ties are rounded to even.
+ *
+ * @param value The float to convert, values beyond the range of half precision become infinity.
+ * @return The bits of the half-precision float.
+ */
+inline uint16_t to_fp16(float value)
+{
+  const uint32_t bits = std::bit_cast<uint32_t>(value);
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t magnitude = bits & 0x7fffffff;
+  if (magnitude > 0x7f800000)
+  {
+    return sign | 0x7e00;  // quiet NaN
+  }
+  if (magnitude >= 0x477ff000)
+  {
+    return sign | 0x7c00;  // rounds to at least 2^16, i.e. infinity
+  }
+  if (magnitude < 0x38800000)
+  {
+    // Subnormal, the scaling by 2^24 is exact and the smallest normal 0x0400 is reached by rounding up
+    return sign | static_cast<uint16_t>(std::nearbyint(std::bit_cast<float>(magnitude) * 16777216.0f));
+  }
+  const uint32_t rounded = magnitude + 0xfff + ((magnitude >> 13) & 1);
+  return sign | static_cast<uint16_t>((rounded - 0x38000000) >> 13);
+}
+
+/**
+ * @brief Converts a half-precision float to the float of the same value.
+ *
+ * @param value The bits of the half-precision float.
+ * @return The float of the same value.
+ */
+inline float from_fp16(uint16_t value)
+{
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1f;
+  const uint32_t mantissa = value & 0x3ff;
+  if (exponent == 0)
+  {
+    const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+    return sign != 0 ? -magnitude : magnitude;
+  }
+  if (exponent == 0x1f)
+  {
+    return std::bit_cast<float>(sign | 0x7f800000 | (mantissa << 13));
+  }
+  return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+#endif  // MINIJIT_KERNELS_FP16_TEST_H
@@ -1,5 +1,7 @@
 #include "matmul.bench.h"
 #include "../../main/Brgemm.h"
+#include "../../main/Packing.h"
+#include "../../main/Unary.h"
 #include <benchmark/benchmark.h>
 
 class GemmFixture : public benchmark::Fixture
@@ -125,4 +127,344 @@ BENCHMARK_REGISTER_F(BrGemmFixture, BM_brMatmul)
   ->ArgNames({"M", "N", "K", "Batch"})
   ->DisplayAggregatesOnly(true)
   ->Apply(CustomArgumentsBatch)
-  ->MinWarmUpTime(0.3);  // WarmUp in seconds
\ No newline at end of file
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_DEFINE_F(BrGemmFixture, BM_brMatmul_prefetch)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+  int Batch = state.range(3);
+
+  mini_jit::Brgemm::prefetch_t prefetch;
+  prefetch.a = state.range(4);
+  prefetch.b = state.range(5);
+  prefetch.c = state.range(6) != 0;
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, Batch, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, mini_jit::Brgemm::default_fp32_tile, 1, 1, {}, prefetch);
+  auto kernel = brgemm.get_kernel();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, K, M, M * K, K * N);
+  }
+
+  flops = M * N * K * Batch * 2 * state.iterations();
+}
+
+// Sweep of the prefetch distances in k iterations on the register block of default_fp32_tile, the distance zero is the baseline
+static void CustomArgumentsPrefetch(benchmark::internal::Benchmark *b)
+{
+  for (int Batch : {1, 16})
+    for (int K : {128, 512})
+      for (int distance_a : {0, 4, 8, 16, 32})
+        for (int distance_b : {0, 4, 8, 16, 32})
+          for (int prefetch_c : {0, 1})
+            b->Args({64, 64, K, Batch, distance_a, distance_b, prefetch_c});
+}
+
+BENCHMARK_REGISTER_F(BrGemmFixture, BM_brMatmul_prefetch)
+  ->ArgNames({"M", "N", "K", "Batch", "PrefetchA", "PrefetchB", "PrefetchC"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsPrefetch)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_DEFINE_F(BrGemmFixture, BM_brMatmul_address)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+  int Batch = state.range(3);
+
+  // The blocks are listed in reverse order, the strided kernel of the same tile is the baseline
+  std::vector<void const *> pointers_a(Batch);
+  std::vector<void const *> pointers_b(Batch);
+  for (int i = 0; i < Batch; ++i)
+  {
+    pointers_a[i] = matrix_a.data() + (Batch - 1 - i) * M * K;
+    pointers_b[i] = matrix_b.data() + (Batch - 1 - i) * K * N;
+  }
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, Batch, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, mini_jit::Brgemm::default_fp32_tile, 1, 1, {}, {},
+                  mini_jit::Brgemm::batch_reduce_t::address);
+  auto kernel = brgemm.get_kernel_address();
+
+  for (auto _ : state)
+  {
+    kernel(pointers_a.data(), pointers_b.data(), matrix_c.data(), M, K, M);
+  }
+
+  flops = M * N * K * Batch * 2 * state.iterations();
+}
+
+BENCHMARK_DEFINE_F(BrGemmFixture, BM_brMatmul_offset)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+  int Batch = state.range(3);
+
+  std::vector<int64_t> offsets_a(Batch);
+  std::vector<int64_t> offsets_b(Batch);
+  for (int i = 0; i < Batch; ++i)
+  {
+    offsets_a[i] = (Batch - 1 - i) * M * K;
+    offsets_b[i] = (Batch - 1 - i) * K * N;
+  }
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, Batch, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, mini_jit::Brgemm::default_fp32_tile, 1, 1, {}, {},
+                  mini_jit::Brgemm::batch_reduce_t::offset);
+  auto kernel = brgemm.get_kernel_offset();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, K, M, offsets_a.data(), offsets_b.data());
+  }
+
+  flops = M * N * K * Batch * 2 * state.iterations();
+}
+
+static void CustomArgumentsBatchReduce(benchmark::internal::Benchmark *b)
+{
+  for (int Batch : {1, 4, 16})
+    for (int K : {16, 64, 256})
+      b->Args({64, 64, K, Batch});
+}
+
+BENCHMARK_REGISTER_F(BrGemmFixture, BM_brMatmul_address)
+  ->ArgNames({"M", "N", "K", "Batch"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsBatchReduce)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(BrGemmFixture, BM_brMatmul_offset)
+  ->ArgNames({"M", "N", "K", "Batch"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsBatchReduce)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+class EpilogueFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b, matrix_c, bias;
+  double flops;
+  double bytes;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    flops = 0;
+    bytes = 0;
+
+    int M = state.range(0);
+    int N = state.range(1);
+    int K = state.range(2);
+
+    matrix_a.resize(M * K);
+    matrix_b.resize(K * N);
+    matrix_c.resize(M * N);
+    bias.resize(M);
+
+    fill_random_matrix_args(matrix_a.data(), M * K);
+    fill_random_matrix_args(matrix_b.data(), K * N);
+    fill_random_matrix_args(matrix_c.data(), M * N);
+    fill_random_matrix_args(bias.data(), M);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["FLOPS"] = benchmark::Counter(flops, benchmark::Counter::kIsRate);
+    state.counters["Bytes"] = benchmark::Counter(bytes, benchmark::Counter::kIsRate, benchmark::Counter::kIs1024);
+  }
+};
+
+BENCHMARK_DEFINE_F(EpilogueFixture, BM_matmul_relu_unary)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, 1, 0);
+  auto kernel = brgemm.get_kernel();
+
+  mini_jit::Unary unary;
+  unary.generate(M, N, 0, mini_jit::Unary::dtype_t::fp32, mini_jit::Unary::ptype_t::relu);
+  auto relu = unary.get_kernel();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, K, M, 1, 1);
+    relu(matrix_c.data(), matrix_c.data(), M, M);
+  }
+
+  // The relu reads and writes C a second time
+  flops = M * N * K * 2 * state.iterations();
+  bytes = (M * K + K * N + 3 * M * N) * sizeof(float) * state.iterations();
+}
+
+BENCHMARK_DEFINE_F(EpilogueFixture, BM_matmul_relu_fused)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, 1, 0,
+                  mini_jit::Brgemm::epilogue_t{mini_jit::Brgemm::bias_t::none, mini_jit::Brgemm::activation_t::relu});
+  auto kernel = brgemm.get_kernel();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, K, M, 1, 1);
+  }
+
+  flops = M * N * K * 2 * state.iterations();
+  bytes = (M * K + K * N + M * N) * sizeof(float) * state.iterations();
+}
+
+BENCHMARK_DEFINE_F(EpilogueFixture, BM_matmul_bias_relu_fused)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32, 1, 0,
+                  mini_jit::Brgemm::epilogue_t{mini_jit::Brgemm::bias_t::row, mini_jit::Brgemm::activation_t::relu});
+  auto kernel = brgemm.get_kernel_bias();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), M, K, M, 1, 1, bias.data());
+  }
+
+  flops = M * N * K * 2 * state.iterations();
+  bytes = (M * K + K * N + M * N + M) * sizeof(float) * state.iterations();
+}
+
+static void CustomArgumentsEpilogue(benchmark::internal::Benchmark *b)
+{
+  for (int MN : {16, 32, 64, 128, 256})
+    for (int K : {16, 64, 256})
+      b->Args({MN, MN, K});
+}
+
+BENCHMARK_REGISTER_F(EpilogueFixture, BM_matmul_relu_unary)
+  ->ArgNames({"M", "N", "K"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsEpilogue)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(EpilogueFixture, BM_matmul_relu_fused)
+  ->ArgNames({"M", "N", "K"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsEpilogue)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(EpilogueFixture, BM_matmul_bias_relu_fused)
+  ->ArgNames({"M", "N", "K"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsEpilogue)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+class PackingFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b, matrix_c, packed_a, packed_b;
+  double flops;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    flops = 0;
+
+    int N = state.range(1);
+    int K = state.range(2);
+    int LD = state.range(3);
+
+    // A, B and C share the leading dimension LD >= M, K
+    matrix_a.resize(static_cast<size_t>(LD) * K);
+    matrix_b.resize(static_cast<size_t>(LD) * N);
+    matrix_c.resize(static_cast<size_t>(LD) * N);
+
+    fill_random_matrix_args(matrix_a.data(), matrix_a.size());
+    fill_random_matrix_args(matrix_b.data(), matrix_b.size());
+    fill_random_matrix_args(matrix_c.data(), matrix_c.size());
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["FLOPS"] = benchmark::Counter(flops, benchmark::Counter::kIsRate);
+  }
+};
+
+BENCHMARK_DEFINE_F(PackingFixture, BM_matmul_strided)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+  int LD = state.range(3);
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, 1, 0, 0, 0, mini_jit::Brgemm::dtype_t::fp32);
+  auto kernel = brgemm.get_kernel();
+
+  for (auto _ : state)
+  {
+    kernel(matrix_a.data(), matrix_b.data(), matrix_c.data(), LD, LD, LD, 1, 1);
+  }
+
+  flops = static_cast<double>(M) * N * K * 2 * state.iterations();
+}
+
+BENCHMARK_DEFINE_F(PackingFixture, BM_matmul_packed)(benchmark::State &state)
+{
+  int M = state.range(0);
+  int N = state.range(1);
+  int K = state.range(2);
+  int LD = state.range(3);
+
+  mini_jit::Packing packing;
+  packing.generate(M, N, K, 1, 0, 0, mini_jit::Packing::dtype_t::fp32);
+  packed_a.resize(packing.get_size_a());
+  packed_b.resize(packing.get_size_b());
+  mini_jit::Packing::tile_t tile = packing.get_tile();
+
+  mini_jit::Brgemm brgemm;
+  brgemm.generate(M, N, K, 1, 0, 1, 0, mini_jit::Brgemm::dtype_t::fp32, 1, 1, {}, {}, mini_jit::Brgemm::batch_reduce_t::stride,
+                  mini_jit::Brgemm::packing_t{true, true});
+  auto kernel = brgemm.get_kernel();
+
+  // The packing is part of each iteration
+  for (auto _ : state)
+  {
+    packing.pack_a(matrix_a.data(), LD, 1, packed_a.data());
+    packing.pack_b(matrix_b.data(), LD, 1, packed_b.data());
+    kernel(packed_a.data(), packed_b.data(), matrix_c.data(), tile.m, tile.n, LD, 1, 1);
+  }
+
+  flops = static_cast<double>(M) * N * K * 2 * state.iterations();
+}
+
+// Square matrices with dense and with power of two leading dimensions that exceed the matrices
+static void CustomArgumentsPacking(benchmark::internal::Benchmark *b)
+{
+  b->Args({2048, 2048, 2048, 2048});
+  for (int size : {256, 512, 1024})
+    for (int LD : {size, 4096, 8192})
+      b->Args({size, size, size, LD});
+}
+
+BENCHMARK_REGISTER_F(PackingFixture, BM_matmul_strided)
+  ->ArgNames({"M", "N", "K", "LD"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsPacking)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(PackingFixture, BM_matmul_packed)
+  ->ArgNames({"M", "N", "K", "LD"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArgumentsPacking)
+  ->MinWarmUpTime(0.3);  // WarmUp in seconds
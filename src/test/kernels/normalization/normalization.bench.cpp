@@ -0,0 +1,95 @@
+#include "../../../main/Normalization.h"
+#include "../../../main/kernels/normalization/normalization.h"
+#include "../unary/unary.bench.h"
+#include <benchmark/benchmark.h>
+
+class NormalizationFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b;
+  double bytes;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    bytes = 0;
+
+    int M = state.range(0);
+    int N = state.range(1);
+
+    matrix_a.resize(M * N);
+    matrix_b.resize(M * N);
+
+    fill_random_matrix_args(matrix_a.data(), M * N);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["Bytes"] = benchmark::Counter(bytes, benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @brief Runs the normalization kernel of the benchmark arguments.
+   *
+   * @param state The state of the benchmark.
+   * @param normalization The normalization of each column.
+   */
+  void run(benchmark::State &state, mini_jit::kernels::normalization_t normalization)
+  {
+    int M = state.range(0);
+    int N = state.range(1);
+
+    mini_jit::Kernel native_kernel;
+    mini_jit::kernels::normalization(native_kernel, M, N, normalization, mini_jit::Normalization::default_epsilon);
+    native_kernel.set_kernel();
+    mini_jit::Normalization::kernel_t kernel =
+      reinterpret_cast<mini_jit::Normalization::kernel_t>(const_cast<void *>(native_kernel.get_kernel()));
+
+    for (auto _ : state)
+    {
+      kernel(matrix_a.data(), matrix_b.data(), M, M);
+    }
+
+    // M * N * 4 bytes (fp32) of A and B, the second read of a column is not counted
+    bytes = 2 * M * N * 4 * state.iterations();
+  }
+};
+
+BENCHMARK_DEFINE_F(NormalizationFixture, BM_softmax)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::normalization_t::softmax);
+}
+
+BENCHMARK_DEFINE_F(NormalizationFixture, BM_layer_norm)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::normalization_t::layer_norm);
+}
+
+BENCHMARK_DEFINE_F(NormalizationFixture, BM_rms_norm)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::normalization_t::rms_norm);
+}
+
+// The sequence lengths of attention rows, N rows are normalized per call
+static void CustomArguments(benchmark::internal::Benchmark *b)
+{
+  for (int S : {128, 512, 1024, 2048, 4096, 8192})
+    b->Args({S, 64});
+}
+
+BENCHMARK_REGISTER_F(NormalizationFixture, BM_softmax)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(NormalizationFixture, BM_layer_norm)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(NormalizationFixture, BM_rms_norm)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
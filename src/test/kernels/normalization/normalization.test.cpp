@@ -0,0 +1,195 @@
+#include "../../../main/Normalization.h"
+#include "../../../main/kernels/normalization/normalization.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  using mini_jit::kernels::normalization_t;
+
+  /**
+   * @brief Computes the normalization of a column in double precision.
+   *
+   * @param normalization The normalization of the column.
+   * @param column The elements of the column.
+   * @param epsilon The epsilon of a layer norm or a rms norm.
+   * @return The normalized column.
+   */
+  std::vector<double> reference(normalization_t normalization, const std::vector<double> &column, double epsilon)
+  {
+    const double size = static_cast<double>(column.size());
+    double max = column[0];
+    double sum = 0;
+    double squares = 0;
+    for (double x : column)
+    {
+      max = std::max(max, x);
+      sum += x;
+      squares += x * x;
+    }
+    const double mean = sum / size;
+
+    std::vector<double> result;
+    double variance = 0;
+    double exp_sum = 0;
+    for (double x : column)
+    {
+      variance += (x - mean) * (x - mean) / size;
+      exp_sum += std::exp(x - max);
+    }
+    for (double x : column)
+    {
+      switch (normalization)
+      {
+      case normalization_t::softmax:
+        result.push_back(std::exp(x - max) / exp_sum);
+        break;
+      case normalization_t::layer_norm:
+        result.push_back((x - mean) / std::sqrt(variance + epsilon));
+        break;
+      case normalization_t::rms_norm:
+        result.push_back(x / std::sqrt(squares / size + epsilon));
+        break;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Executes the generated kernel on random values with padded leading dimensions.
+   *
+   * @param M The rows of A and B, i.e. the normalized dimension.
+   * @param N The columns of A and B.
+   * @param normalization The normalization of each column.
+   * @param offset The value added to the random values in [-5, 5].
+   * @param range The factor of the random values.
+   */
+  void run_normalization(const uint32_t M, const uint32_t N, normalization_t normalization, float offset, float range)
+  {
+    const uint32_t lda = M + 3;
+    const uint32_t ldb = M + 1;
+    const float epsilon = 1e-5f;
+
+    std::vector<float> a(lda * N);
+    std::vector<float> b(ldb * N, -1);
+    for (float &value : a)
+    {
+      value = offset + (static_cast<float>(std::rand()) / RAND_MAX * 10 - 5) * range;
+    }
+
+    mini_jit::Kernel kernel;
+    mini_jit::kernels::normalization(kernel, M, N, normalization, epsilon);
+    kernel.set_kernel();
+    mini_jit::Normalization::kernel_t normalize =
+      reinterpret_cast<mini_jit::Normalization::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    normalize(a.data(), b.data(), lda, ldb);
+
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      const std::vector<double> column(a.begin() + lda * iN, a.begin() + lda * iN + M);
+      const std::vector<double> expected = reference(normalization, column, epsilon);
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        const float result = b[ldb * iN + iM];
+        CAPTURE(iM, iN, column[iM], expected[iM], result);
+        if (normalization == normalization_t::softmax)
+        {
+          REQUIRE_THAT(result, Catch::Matchers::WithinRel(static_cast<float>(expected[iM]), 1e-5f) ||
+                                 Catch::Matchers::WithinAbs(expected[iM], 1e-30));
+        }
+        else
+        {
+          REQUIRE_THAT(result, Catch::Matchers::WithinAbs(expected[iM], 1e-4));
+        }
+      }
+
+      // The padding row of B must not be written
+      REQUIRE(b[ldb * iN + M] == -1);
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test normalization jited correctness on random data", "[jit][correctness][normalization]")
+{
+  auto normalization = GENERATE(normalization_t::softmax, normalization_t::layer_norm, normalization_t::rms_norm);
+  auto M = GENERATE(range(1u, 70u + 1u, 1u));
+  auto N = GENERATE(1u, 3u);
+
+  CAPTURE(normalization, M, N);
+  run_normalization(M, N, normalization, 0, 1);
+}
+
+TEST_CASE("Test normalization jited correctness of long columns", "[jit][correctness][normalization]")
+{
+  auto normalization = GENERATE(normalization_t::softmax, normalization_t::layer_norm, normalization_t::rms_norm);
+  auto M = GENERATE(128u, 1000u, 4099u, 8192u);
+
+  CAPTURE(normalization, M);
+  run_normalization(M, 2, normalization, 0, 1);
+}
+
+TEST_CASE("Test normalization jited correctness on large values", "[jit][correctness][normalization]")
+{
+  // The softmax rescales the sum whenever a block raises the maximum, the layer norm shifts a large mean
+  auto [normalization, offset, range] = GENERATE(table<normalization_t, float, float>({
+    {normalization_t::softmax, 0.0f, 20.0f},
+    {normalization_t::softmax, -500.0f, 100.0f},
+    {normalization_t::layer_norm, 1000.0f, 1.0f},
+    {normalization_t::layer_norm, -20000.0f, 5.0f},
+  }));
+  auto M = GENERATE(7u, 32u, 77u, 513u);
+
+  CAPTURE(normalization, offset, range, M);
+  run_normalization(M, 3, normalization, offset, range);
+}
+
+TEST_CASE("Test normalization jited softmax of constant and increasing columns", "[jit][correctness][normalization]")
+{
+  // An increasing column raises the maximum in every block
+  const uint32_t M = 101;
+  std::vector<float> a(M * 2);
+  std::vector<float> b(M * 2);
+  for (uint32_t i = 0; i < M; ++i)
+  {
+    a[i] = 3.0f;
+    a[M + i] = 0.5f * static_cast<float>(i);
+  }
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::normalization(kernel, M, 2, normalization_t::softmax, 0);
+  kernel.set_kernel();
+  mini_jit::Normalization::kernel_t normalize =
+    reinterpret_cast<mini_jit::Normalization::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  normalize(a.data(), b.data(), M, M);
+
+  const std::vector<double> expected = reference(normalization_t::softmax, std::vector<double>(a.begin() + M, a.end()), 0);
+  for (uint32_t i = 0; i < M; ++i)
+  {
+    CAPTURE(i);
+    REQUIRE_THAT(b[i], Catch::Matchers::WithinRel(1.0f / M, 1e-5f));
+    REQUIRE_THAT(b[M + i], Catch::Matchers::WithinRel(static_cast<float>(expected[i]), 1e-5f) ||
+                             Catch::Matchers::WithinAbs(expected[i], 1e-30));
+  }
+}
+
+TEST_CASE("Test Normalization generate", "[generation][normalization]")
+{
+  using mini_jit::Normalization;
+
+  auto ptype = GENERATE(Normalization::ptype_t::softmax, Normalization::ptype_t::layer_norm, Normalization::ptype_t::rms_norm);
+  auto M = GENERATE(1u, 31u, 32u, 33u, 4096u);
+  CAPTURE(ptype, M);
+
+  Normalization normalization;
+  REQUIRE(normalization.generate(M, 3, Normalization::dtype_t::fp32, ptype) == Normalization::error_t::success);
+  REQUIRE(normalization.get_kernel() != nullptr);
+  REQUIRE(normalization.generate(0, 3, Normalization::dtype_t::fp32, ptype) == Normalization::error_t::err_wrong_dimension);
+  REQUIRE(normalization.generate(M, 0, Normalization::dtype_t::fp32, ptype) == Normalization::error_t::err_wrong_dimension);
+  REQUIRE(normalization.generate(M, 3, static_cast<Normalization::dtype_t>(1), ptype) == Normalization::error_t::err_wrong_dtype);
+}
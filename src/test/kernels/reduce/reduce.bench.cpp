@@ -0,0 +1,106 @@
+#include "../../../main/Reduce.h"
+#include "../../../main/kernels/reduce/reduce.h"
+#include "../unary/unary.bench.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+
+class ReduceFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b;
+  double bytes;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    bytes = 0;
+
+    int M = state.range(0);
+    int N = state.range(1);
+
+    matrix_a.resize(M * N);
+    matrix_b.resize(std::max(M, N));
+
+    fill_random_matrix_args(matrix_a.data(), M * N);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["Bytes"] = benchmark::Counter(bytes, benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @brief Runs the reduce kernel of the benchmark arguments.
+   *
+   * @param state The state of the benchmark.
+   * @param op The reduce operation of the kernel.
+   * @param axis The reduced dimension of A.
+   */
+  void run(benchmark::State &state, mini_jit::kernels::reduce_op_t op, mini_jit::kernels::reduce_axis_t axis)
+  {
+    int M = state.range(0);
+    int N = state.range(1);
+
+    mini_jit::Kernel native_kernel;
+    mini_jit::kernels::reduce(native_kernel, M, N, op, mini_jit::kernels::dtype_t::fp32, axis, false, 1.0);
+    native_kernel.set_kernel();
+    mini_jit::Reduce::kernel_t kernel = reinterpret_cast<mini_jit::Reduce::kernel_t>(const_cast<void *>(native_kernel.get_kernel()));
+
+    for (auto _ : state)
+    {
+      kernel(matrix_a.data(), matrix_b.data(), M, 1);
+    }
+
+    // M * N * 4 bytes (fp32) of A, the store of B is a single row or column
+    bytes = (M * N + (axis == mini_jit::kernels::reduce_axis_t::m ? N : M)) * 4 * state.iterations();
+  }
+};
+
+BENCHMARK_DEFINE_F(ReduceFixture, BM_reduce_sum_m)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::reduce_op_t::sum, mini_jit::kernels::reduce_axis_t::m);
+}
+
+BENCHMARK_DEFINE_F(ReduceFixture, BM_reduce_sum_n)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::reduce_op_t::sum, mini_jit::kernels::reduce_axis_t::n);
+}
+
+BENCHMARK_DEFINE_F(ReduceFixture, BM_reduce_max_m)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::reduce_op_t::max, mini_jit::kernels::reduce_axis_t::m);
+}
+
+BENCHMARK_DEFINE_F(ReduceFixture, BM_reduce_max_n)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::reduce_op_t::max, mini_jit::kernels::reduce_axis_t::n);
+}
+
+static void CustomArguments(benchmark::internal::Benchmark *b)
+{
+  for (int S : {50, 64, 512, 2048})
+    b->Args({S, S});
+}
+
+BENCHMARK_REGISTER_F(ReduceFixture, BM_reduce_sum_m)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(ReduceFixture, BM_reduce_sum_n)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(ReduceFixture, BM_reduce_max_m)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(ReduceFixture, BM_reduce_max_n)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
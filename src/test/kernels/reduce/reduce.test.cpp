@@ -0,0 +1,160 @@
+#include "../../../main/Reduce.h"
+#include "../../../main/kernels/reduce/reduce.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  using mini_jit::kernels::reduce_axis_t;
+  using mini_jit::kernels::reduce_op_t;
+
+  /**
+   * @brief Executes the generated kernel on random values with a padded leading dimension of A and a strided B.
+   *
+   * @param M The rows of A.
+   * @param N The columns of A.
+   * @param op The reduce operation.
+   * @param axis The reduced dimension of A.
+   * @param accumulate True if the reduction is combined with the initial values of B.
+   * @param scale The factor of a sum.
+   */
+  template <typename T>
+  void run_reduce(const uint32_t M, const uint32_t N, reduce_op_t op, reduce_axis_t axis, bool accumulate, double scale)
+  {
+    const uint32_t lda = M + 3;
+    const uint32_t ldb = axis == reduce_axis_t::m ? 2 : 1;
+    const uint32_t size_b = axis == reduce_axis_t::m ? N * ldb : M + 1;
+
+    std::vector<T> a(lda * N);
+    std::vector<T> b(size_b);
+    for (std::vector<T> *values : {&a, &b})
+    {
+      for (T &value : *values)
+      {
+        value = static_cast<T>(std::rand()) / RAND_MAX * 10 - 5;
+      }
+    }
+    const std::vector<T> b_initial = b;
+
+    const mini_jit::kernels::dtype_t dtype = sizeof(T) == 8 ? mini_jit::kernels::dtype_t::fp64 : mini_jit::kernels::dtype_t::fp32;
+    mini_jit::Kernel kernel;
+    mini_jit::kernels::reduce(kernel, M, N, op, dtype, axis, accumulate, scale);
+    kernel.set_kernel();
+    mini_jit::Reduce::kernel_t reduce = reinterpret_cast<mini_jit::Reduce::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    reduce(a.data(), b.data(), lda, ldb);
+
+    const uint32_t outer = axis == reduce_axis_t::m ? N : M;
+    const uint32_t inner = axis == reduce_axis_t::m ? M : N;
+    for (uint32_t iOuter = 0; iOuter < outer; ++iOuter)
+    {
+      T expected = op == reduce_op_t::max ? -std::numeric_limits<T>::infinity() : 0;
+      for (uint32_t iInner = 0; iInner < inner; ++iInner)
+      {
+        const T value = axis == reduce_axis_t::m ? a[lda * iOuter + iInner] : a[lda * iInner + iOuter];
+        expected = op == reduce_op_t::max ? std::max(expected, value) : expected + value;
+      }
+      if (op == reduce_op_t::sum)
+      {
+        expected *= scale;
+      }
+
+      const uint32_t index_b = iOuter * ldb;
+      if (accumulate)
+      {
+        expected = op == reduce_op_t::max ? std::max(expected, b_initial[index_b]) : expected + b_initial[index_b];
+      }
+
+      CAPTURE(iOuter, expected, b[index_b]);
+      REQUIRE_THAT(b[index_b], Catch::Matchers::WithinAbs(expected, sizeof(T) == 8 ? 1e-10 : 1e-4));
+    }
+
+    // The elements between and after the results must not be written
+    for (uint32_t i = 0; i < size_b; ++i)
+    {
+      if (i >= outer * ldb || i % ldb != 0)
+      {
+        REQUIRE(b[i] == b_initial[i]);
+      }
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test reduce jited correctness on random data", "[jit][correctness][reduce]")
+{
+  auto op = GENERATE(reduce_op_t::sum, reduce_op_t::max);
+  auto axis = GENERATE(reduce_axis_t::m, reduce_axis_t::n);
+  auto accumulate = GENERATE(false, true);
+  auto M = GENERATE(range(1u, 37u + 1u, 1u));
+  auto N = GENERATE(1u, 3u, 17u);
+
+  CAPTURE(op, axis, accumulate, M, N);
+  run_reduce<float>(M, N, op, axis, accumulate, 1.0);
+  run_reduce<double>(M, N, op, axis, accumulate, 1.0);
+}
+
+TEST_CASE("Test reduce jited correctness of a scaled sum", "[jit][correctness][reduce]")
+{
+  auto axis = GENERATE(reduce_axis_t::m, reduce_axis_t::n);
+  auto accumulate = GENERATE(false, true);
+  auto [M, N] = GENERATE(table<uint32_t, uint32_t>({{1, 1}, {7, 5}, {64, 3}, {67, 9}}));
+
+  CAPTURE(axis, accumulate, M, N);
+  run_reduce<float>(M, N, reduce_op_t::sum, axis, accumulate, 1.0 / 3);
+  run_reduce<double>(M, N, reduce_op_t::sum, axis, accumulate, 1.0 / 3);
+}
+
+TEST_CASE("Test reduce jited max propagates NaN", "[jit][correctness][reduce]")
+{
+  auto axis = GENERATE(reduce_axis_t::m, reduce_axis_t::n);
+  CAPTURE(axis);
+
+  // The NaN of the first column is in the partial register, the second column does not hold a NaN
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  const std::vector<float> a{1.0f, 2.0f, 3.0f, 4.0f, nan, -1.0f, -2.0f, -3.0f, -4.0f, -0.5f};
+  std::vector<float> b(5);
+
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::reduce(kernel, 5, 2, reduce_op_t::max, mini_jit::kernels::dtype_t::fp32, axis, false, 1.0);
+  kernel.set_kernel();
+  mini_jit::Reduce::kernel_t reduce = reinterpret_cast<mini_jit::Reduce::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  reduce(a.data(), b.data(), 5, 1);
+
+  if (axis == reduce_axis_t::m)
+  {
+    REQUIRE(std::isnan(b[0]));
+    REQUIRE(b[1] == -0.5f);
+  }
+  else
+  {
+    REQUIRE(b[0] == 1.0f);
+    REQUIRE(b[1] == 2.0f);
+    REQUIRE(b[2] == 3.0f);
+    REQUIRE(b[3] == 4.0f);
+    REQUIRE(std::isnan(b[4]));
+  }
+}
+
+TEST_CASE("Test Reduce generate", "[generation][reduce]")
+{
+  using mini_jit::Reduce;
+
+  auto ptype = GENERATE(Reduce::ptype_t::sum, Reduce::ptype_t::max, Reduce::ptype_t::mean);
+  auto axis = GENERATE(Reduce::axis_t::m, Reduce::axis_t::n);
+  auto dtype = GENERATE(Reduce::dtype_t::fp32, Reduce::dtype_t::fp64);
+  CAPTURE(ptype, axis, dtype);
+
+  Reduce reduce;
+  REQUIRE(reduce.generate(11, 3, axis, true, dtype, ptype, 33) == Reduce::error_t::success);
+  REQUIRE(reduce.get_kernel() != nullptr);
+  REQUIRE(reduce.generate(0, 3, axis, false, dtype, ptype) == Reduce::error_t::err_wrong_dimension);
+  REQUIRE(reduce.generate(11, 0, axis, false, dtype, ptype) == Reduce::error_t::err_wrong_dimension);
+  REQUIRE(reduce.generate(11, 3, axis, false, static_cast<Reduce::dtype_t>(2), ptype) == Reduce::error_t::err_wrong_dtype);
+}
@@ -0,0 +1,56 @@
+#ifndef MINIJIT_KERNELS_SVE_TEST_H
+#define MINIJIT_KERNELS_SVE_TEST_H
+
+#include "../../main/Cpu.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+
+/**
+ * @brief Restores the SVE vector length of the calling thread when a test leaves its scope, also on a failed assertion.
+ */
+class SveVectorLengthGuard
+{
+private:
+  uint32_t original = mini_jit::Cpu::get_sve_vector_length();
+
+public:
+  SveVectorLengthGuard() = default;
+  SveVectorLengthGuard(SveVectorLengthGuard const &) = delete;
+  SveVectorLengthGuard &operator=(SveVectorLengthGuard const &) = delete;
+
+  ~SveVectorLengthGuard()
+  {
+    mini_jit::Cpu::set_sve_vector_length(original);
+  }
+};
+
+/**
+ * @brief Runs a test of a vector-length agnostic kernel at each vector length the processor supports.
+ * The kernel is generated once and executed at 128, 256, 512, 1024 and 2048 bit, skipped if SVE is not implemented.
+ *
+ * @param run The test that executes the kernel.
+ */
+template <typename TRun> void for_each_sve_vector_length(TRun run)
+{
+  if (!mini_jit::Cpu::has_sve())
+  {
+    SKIP("The processor does not implement SVE.");
+  }
+
+  SveVectorLengthGuard guard;
+  uint32_t tested = 0;
+  for (uint32_t bytes : {16u, 32u, 64u, 128u, 256u})
+  {
+    if (!mini_jit::Cpu::set_sve_vector_length(bytes))
+    {
+      continue;
+    }
+
+    CAPTURE(bytes);
+    run();
+    ++tested;
+  }
+  REQUIRE(tested > 0);
+}
+
+#endif  // MINIJIT_KERNELS_SVE_TEST_H
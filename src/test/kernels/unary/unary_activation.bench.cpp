@@ -0,0 +1,126 @@
+#include "../../../main/Unary.h"
+#include "../../../main/kernels/unary/unary_activation.h"
+#include "unary.bench.h"
+#include <benchmark/benchmark.h>
+
+class UnaryActivationFixture : public benchmark::Fixture
+{
+public:
+  std::vector<float> matrix_a, matrix_b;
+  double bytes;
+
+  void SetUp(::benchmark::State &state) override
+  {
+    bytes = 0;
+
+    int M = state.range(0);
+    int N = state.range(1);
+
+    matrix_a.resize(M * N);
+    matrix_b.resize(M * N);
+
+    fill_random_matrix_args(matrix_a.data(), M * N);
+    fill_random_matrix_args(matrix_b.data(), M * N);
+  }
+
+  void TearDown(::benchmark::State &state) override
+  {
+    state.counters["Bytes"] = benchmark::Counter(bytes, benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @brief Runs the activation kernel of the benchmark arguments.
+   *
+   * @param state The state of the benchmark.
+   * @param activation The activation function of the kernel.
+   */
+  void run(benchmark::State &state, mini_jit::kernels::unary_activation_t activation)
+  {
+    int M = state.range(0);
+    int N = state.range(1);
+
+    mini_jit::Kernel native_kernel;
+    mini_jit::kernels::unary_activation(native_kernel, M, N, activation);
+    native_kernel.set_kernel();
+    mini_jit::Unary::kernel_t kernel = reinterpret_cast<mini_jit::Unary::kernel_t>(const_cast<void *>(native_kernel.get_kernel()));
+
+    for (auto _ : state)
+    {
+      kernel(matrix_a.data(), matrix_b.data(), M, M);
+    }
+
+    bytes = M * N * 4 * 2 * state.iterations();  // M * N * 4 bytes (fp32) * 2 (load/store)
+  }
+};
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_exp)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::exp);
+}
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_sigmoid)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::sigmoid);
+}
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_tanh)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::tanh);
+}
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_gelu_erf)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::gelu_erf);
+}
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_gelu_tanh)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::gelu_tanh);
+}
+
+BENCHMARK_DEFINE_F(UnaryActivationFixture, BM_unary_silu)(benchmark::State &state)
+{
+  run(state, mini_jit::kernels::unary_activation_t::silu);
+}
+
+static void CustomArguments(benchmark::internal::Benchmark *b)
+{
+  for (int S : {50, 64, 512, 2048})
+    b->Args({S, S});
+}
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_exp)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_sigmoid)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_tanh)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_gelu_erf)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_gelu_tanh)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
+
+BENCHMARK_REGISTER_F(UnaryActivationFixture, BM_unary_silu)
+  ->ArgNames({"M", "N"})
+  ->DisplayAggregatesOnly(true)
+  ->Apply(CustomArguments)
+  ->MinWarmUpTime(1.0);  // WarmUp in seconds
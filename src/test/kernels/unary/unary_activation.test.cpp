@@ -0,0 +1,181 @@
+#include "../../../main/Unary.h"
+#include "../../../main/kernels/unary/unary_activation.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  using mini_jit::kernels::unary_activation_t;
+
+  /**
+   * @brief Computes the activation in double precision.
+   *
+   * @param activation The activation function.
+   * @param x The input value.
+   * @return The reference result.
+   */
+  double reference(unary_activation_t activation, double x)
+  {
+    switch (activation)
+    {
+    case unary_activation_t::exp:
+      return std::exp(x);
+    case unary_activation_t::sigmoid:
+      return 1 / (1 + std::exp(-x));
+    case unary_activation_t::tanh:
+      return std::tanh(x);
+    case unary_activation_t::gelu_erf:
+      return 0.5 * x * std::erfc(-x / std::sqrt(2.0));
+    case unary_activation_t::gelu_tanh:
+      return 0.5 * x * (1 + std::tanh(std::sqrt(2 / M_PI) * (x + 0.044715 * x * x * x)));
+    case unary_activation_t::silu:
+      return x / (1 + std::exp(-x));
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  /**
+   * @brief Computes the distance of a single-precision result to the reference in units in the last place of the reference.
+   *
+   * @param result The result of the kernel.
+   * @param expected The reference result.
+   * @return The error in ULP.
+   */
+  double ulp_error(float result, double expected)
+  {
+    int exponent = 0;
+    std::frexp(expected, &exponent);
+    return std::abs(result - expected) / std::ldexp(1.0, std::max(exponent - 24, -149));
+  }
+
+  /**
+   * @brief Executes the generated kernel on values uniformly drawn from [lo, hi] with padded leading dimensions.
+   *
+   * @param M The rows of A.
+   * @param N The columns of A.
+   * @param activation The activation function.
+   * @param lo The smallest input value.
+   * @param hi The largest input value.
+   * @param max_ulp The maximum allowed error in ULP.
+   */
+  void run_unary_activation(const uint32_t M, const uint32_t N, unary_activation_t activation, float lo, float hi, double max_ulp)
+  {
+    const uint32_t lda = M + 3;
+    const uint32_t ldb = M + 2;
+
+    std::vector<float> a(lda * N);
+    std::vector<float> b(ldb * N, -1.0f);
+    for (float &value : a)
+    {
+      value = lo + (hi - lo) * static_cast<float>(std::rand()) / RAND_MAX;
+    }
+
+    mini_jit::Kernel kernel;
+    mini_jit::kernels::unary_activation(kernel, M, N, activation);
+    kernel.set_kernel();
+    mini_jit::Unary::kernel_t unary = reinterpret_cast<mini_jit::Unary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    unary(a.data(), b.data(), lda, ldb);
+
+    // The padding rows of B must not be written
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < ldb; ++iM)
+      {
+        const float x = a[lda * iN + iM];
+        const float result = b[ldb * iN + iM];
+        if (iM >= M)
+        {
+          REQUIRE(result == -1.0f);
+          continue;
+        }
+
+        CAPTURE(iM, iN, x, result, reference(activation, x));
+        REQUIRE(ulp_error(result, reference(activation, x)) <= max_ulp);
+      }
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test unary activations jited accuracy on random data", "[jit][correctness][unary]")
+{
+  auto [activation, lo, hi, max_ulp] = GENERATE(table<unary_activation_t, float, float, double>({
+    {unary_activation_t::exp, -87.3f, 88.7f, 2},
+    {unary_activation_t::sigmoid, -87.0f, 30.0f, 3},
+    {unary_activation_t::tanh, -10.0f, 10.0f, 5},
+    {unary_activation_t::gelu_erf, -2.0f, 30.0f, 8},
+    {unary_activation_t::gelu_erf, -4.0f, 4.0f, 22},
+    {unary_activation_t::gelu_tanh, -2.0f, 30.0f, 6},
+    {unary_activation_t::gelu_tanh, -4.0f, 4.0f, 18},
+    {unary_activation_t::silu, -87.0f, 30.0f, 3},
+  }));
+  auto M = GENERATE(range(1u, 37u + 1u, 1u));
+  auto N = GENERATE(1u, 3u);
+
+  CAPTURE(activation, lo, hi, M, N);
+  run_unary_activation(M, N, activation, lo, hi, max_ulp);
+}
+
+TEST_CASE("Test unary activations jited accuracy near zero", "[jit][correctness][unary]")
+{
+  auto activation = GENERATE(unary_activation_t::exp, unary_activation_t::sigmoid, unary_activation_t::tanh, unary_activation_t::gelu_erf,
+                             unary_activation_t::gelu_tanh, unary_activation_t::silu);
+
+  CAPTURE(activation);
+  run_unary_activation(997, 20, activation, -1e-3f, 1e-3f, 5);
+}
+
+TEST_CASE("Test unary activations jited special values", "[jit][correctness][unary]")
+{
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> a{inf, -inf, 0.0f, -0.0f, std::numeric_limits<float>::quiet_NaN()};
+
+  // The last entry is NaN for all activations, silu and gelu_tanh of -inf are -0 and tanh saturates within 5 ULP of 1
+  auto [activation, expected] = GENERATE_COPY(table<unary_activation_t, std::vector<float>>({
+    {unary_activation_t::exp, {inf, 0.0f, 1.0f, 1.0f}},
+    {unary_activation_t::sigmoid, {1.0f, 0.0f, 0.5f, 0.5f}},
+    {unary_activation_t::tanh, {1.0f, -1.0f, 0.0f, -0.0f}},
+    {unary_activation_t::gelu_erf, {inf, 0.0f, 0.0f, -0.0f}},
+    {unary_activation_t::gelu_tanh, {inf, -0.0f, 0.0f, -0.0f}},
+    {unary_activation_t::silu, {inf, -0.0f, 0.0f, -0.0f}},
+  }));
+
+  CAPTURE(activation);
+
+  std::vector<float> b(a.size());
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_activation(kernel, a.size(), 1, activation);
+  kernel.set_kernel();
+  mini_jit::Unary::kernel_t unary = reinterpret_cast<mini_jit::Unary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+  unary(a.data(), b.data(), a.size(), a.size());
+
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    CAPTURE(i, a[i], b[i], expected[i]);
+    REQUIRE((b[i] == expected[i] || ulp_error(b[i], expected[i]) <= 5));
+    REQUIRE(std::signbit(b[i]) == std::signbit(expected[i]));
+  }
+  REQUIRE(std::isnan(b[4]));
+}
+
+TEST_CASE("Test Unary generate of the activations", "[generation][unary]")
+{
+  using mini_jit::Unary;
+
+  auto ptype = GENERATE(Unary::ptype_t::exp, Unary::ptype_t::sigmoid, Unary::ptype_t::tanh, Unary::ptype_t::gelu_erf,
+                        Unary::ptype_t::gelu_tanh, Unary::ptype_t::silu);
+
+  CAPTURE(ptype);
+
+  Unary unary;
+  REQUIRE(unary.generate(11, 3, 0, Unary::dtype_t::fp32, ptype) == Unary::error_t::success);
+  REQUIRE(unary.generate(11, 3, 0, Unary::dtype_t::fp64, ptype) == Unary::error_t::err_wrong_dtype);
+  REQUIRE(unary.generate(11, 3, 0, Unary::dtype_t::fp16, ptype) == Unary::error_t::err_wrong_dtype);
+  REQUIRE(unary.generate(11, 3, 1, Unary::dtype_t::fp32, ptype) == Unary::error_t::err_row_major_order_not_supported);
+}
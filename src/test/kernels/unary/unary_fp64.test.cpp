@@ -0,0 +1,119 @@
+#include "../../../main/Unary.h"
+#include "../../../main/kernels/unary/unary_fp64.h"
+#include "unary.test.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Executes the generated fp64 kernel on random data with padded leading dimensions and compares it against a naive unary.
+   *
+   * @param kernel The kernel that contains the generated instructions.
+   * @param M The rows of A.
+   * @param N The columns of A.
+   * @param trans_b True if B is the transposed A.
+   * @param type The unary that is applied to each element.
+   */
+  void run_unary_fp64(mini_jit::Kernel &kernel, const uint32_t M, const uint32_t N, bool trans_b, UnaryType type)
+  {
+    const uint32_t lda = M + 3;
+    const uint32_t ldb = (trans_b ? N : M) + 2;
+    const uint32_t b_columns = trans_b ? M : N;
+
+    std::vector<double> a(lda * N);
+    std::vector<double> b(ldb * b_columns);
+    for (double &value : a)
+    {
+      value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+    }
+    for (double &value : b)
+    {
+      value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+    }
+
+    std::vector<double> expected = b;
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        double value = a[lda * iN + iM];
+        if (type == UnaryType::Zero)
+        {
+          value = 0;
+        }
+        else if (type == UnaryType::ReLu)
+        {
+          value = std::max(value, 0.0);
+        }
+
+        expected[trans_b ? ldb * iM + iN : ldb * iN + iM] = value;
+      }
+    }
+
+    kernel.set_kernel();
+    mini_jit::Unary::kernel_t unary = reinterpret_cast<mini_jit::Unary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    unary(a.data(), b.data(), lda, ldb);
+
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+      CAPTURE(i, b[i], expected[i]);
+      REQUIRE(b[i] == expected[i]);
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test unary zero fp64 jited correctness random data", "[jit][correctness][unary]")
+{
+  auto M = GENERATE(range(1u, 19u + 1u, 1u));
+  auto N = GENERATE(1u, 2u, 5u);
+  CAPTURE(M, N);
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_zero_fp64(kernel, M, N);
+  run_unary_fp64(kernel, M, N, false, UnaryType::Zero);
+}
+
+TEST_CASE("Test unary identity fp64 jited correctness random data", "[jit][correctness][unary]")
+{
+  auto M = GENERATE(range(1u, 19u + 1u, 1u));
+  auto N = GENERATE(1u, 2u, 5u);
+  CAPTURE(M, N);
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_identity_fp64(kernel, M, N);
+  run_unary_fp64(kernel, M, N, false, UnaryType::Identity);
+}
+
+TEST_CASE("Test unary relu fp64 jited correctness random data", "[jit][correctness][unary]")
+{
+  auto M = GENERATE(range(1u, 19u + 1u, 1u));
+  auto N = GENERATE(1u, 2u, 5u);
+  CAPTURE(M, N);
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_relu_fp64(kernel, M, N);
+  run_unary_fp64(kernel, M, N, false, UnaryType::ReLu);
+}
+
+TEST_CASE("Test unary identity transpose fp64 jited correctness random data", "[jit][correctness][unary]")
+{
+  auto M = GENERATE(range(1u, 9u + 1u, 1u));
+  auto N = GENERATE(range(1u, 9u + 1u, 1u));
+  CAPTURE(M, N);
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_identity_transpose_fp64(kernel, M, N);
+  run_unary_fp64(kernel, M, N, true, UnaryType::Identity);
+}
+
+TEST_CASE("Test unary relu transpose fp64 jited correctness random data", "[jit][correctness][unary]")
+{
+  auto M = GENERATE(range(1u, 9u + 1u, 1u));
+  auto N = GENERATE(range(1u, 9u + 1u, 1u));
+  CAPTURE(M, N);
+  mini_jit::Kernel kernel;
+  mini_jit::kernels::unary_relu_transpose_fp64(kernel, M, N);
+  run_unary_fp64(kernel, M, N, true, UnaryType::ReLu);
+}
@@ -0,0 +1,104 @@
+#include "../../../main/Unary.h"
+#include "../../../main/kernels/unary/unary_sve.h"
+#include "../sve.test.h"
+#include "unary.test.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Executes a generated SVE kernel on random data with padded leading dimensions and compares it against a naive unary.
+   *
+   * @param kernel The kernel that contains the generated instructions.
+   * @param M The rows of A.
+   * @param N The columns of A.
+   * @param type The unary that is applied to each element.
+   */
+  template <typename T> void run_unary_sve(mini_jit::Kernel &kernel, const uint32_t M, const uint32_t N, UnaryType type)
+  {
+    const uint32_t lda = M + 3;
+    const uint32_t ldb = M + 2;
+
+    std::vector<T> a(lda * N);
+    std::vector<T> b(ldb * N);
+    for (std::vector<T> *values : {&a, &b})
+    {
+      for (T &value : *values)
+      {
+        value = static_cast<T>(std::rand()) / RAND_MAX - static_cast<T>(0.5);
+      }
+    }
+
+    // The padding rows of B must not be written
+    std::vector<T> expected = b;
+    for (uint32_t iN = 0; iN < N; ++iN)
+    {
+      for (uint32_t iM = 0; iM < M; ++iM)
+      {
+        T value = a[lda * iN + iM];
+        if (type == UnaryType::Zero)
+        {
+          value = 0;
+        }
+        else if (type == UnaryType::ReLu)
+        {
+          value = std::max(value, static_cast<T>(0));
+        }
+        expected[ldb * iN + iM] = value;
+      }
+    }
+
+    mini_jit::Unary::kernel_t unary = reinterpret_cast<mini_jit::Unary::kernel_t>(const_cast<void *>(kernel.get_kernel()));
+    unary(a.data(), b.data(), lda, ldb);
+
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+      CAPTURE(i, b[i], expected[i]);
+      REQUIRE(b[i] == expected[i]);
+    }
+  }
+}  // namespace
+
+TEST_CASE("Test unary sve jited correctness at each vector length on random data", "[jit][correctness][unary][sve]")
+{
+  auto M = GENERATE(range(1u, 25u + 1u, 3u), 64u, 129u);
+  auto N = GENERATE(1u, 3u);
+  auto type = GENERATE(UnaryType::Zero, UnaryType::Identity, UnaryType::ReLu);
+  auto dtype = GENERATE(mini_jit::kernels::dtype_t::fp32, mini_jit::kernels::dtype_t::fp64);
+
+  CAPTURE(M, N, static_cast<uint32_t>(type), static_cast<uint32_t>(dtype));
+
+  mini_jit::Kernel kernel;
+  switch (type)
+  {
+  case UnaryType::Zero:
+    mini_jit::kernels::unary_zero_sve(kernel, M, N, dtype);
+    break;
+  case UnaryType::Identity:
+    mini_jit::kernels::unary_identity_sve(kernel, M, N, dtype);
+    break;
+  case UnaryType::ReLu:
+    mini_jit::kernels::unary_relu_sve(kernel, M, N, dtype);
+    break;
+  }
+  kernel.set_kernel();
+
+  for_each_sve_vector_length(
+    [&]()
+    {
+      if (dtype == mini_jit::kernels::dtype_t::fp64)
+      {
+        run_unary_sve<double>(kernel, M, N, type);
+      }
+      else
+      {
+        run_unary_sve<float>(kernel, M, N, type);
+      }
+    });
+}